@@ -33,6 +33,8 @@ else ()
 
   test_undefined_symbols_allowed()
 
+  find_package(Threads REQUIRED)
+
   find_package(Python ${PREFERRED_PYTHON_VERSION} COMPONENTS Interpreter ${_FIND_PYTHON_DEVELOPMENT_TYPE})
 
   find_program(BUILDCACHE_EXE buildcache)
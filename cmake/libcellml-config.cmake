@@ -1,2 +1,4 @@
 @LIBXML2_CONFIG_MODE_INFORMATION@
+include(CMakeFindDependencyMacro)
+find_dependency(Threads)
 include("${CMAKE_CURRENT_LIST_DIR}/libcellml-targets.cmake")
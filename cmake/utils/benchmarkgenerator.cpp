@@ -0,0 +1,155 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <libcellml>
+
+static const std::string MATHML_NS = "http://www.w3.org/1998/Math/MathML";
+
+static std::string ci(const std::string &name)
+{
+    return "<ci>" + name + "</ci>";
+}
+
+static std::string cn(const std::string &value)
+{
+    return "<cn cellml:units=\"dimensionless\">" + value + "</cn>";
+}
+
+static std::string applyMath(const std::string &op, const std::string &arguments)
+{
+    return "<apply><" + op + "/>" + arguments + "</apply>";
+}
+
+static libcellml::ModelPtr syntheticModel(size_t equationCount, size_t nestingDepth)
+{
+    // Create a model with a chain of equationCount algebraic equations, which
+    // all depend on a state, the rate of which depends on the last algebraic
+    // equation, as well as an algebraic equation which right-hand side is an
+    // expression that is nestingDepth deep.
+
+    auto model = libcellml::Model::create("benchmark");
+    auto component = libcellml::Component::create("main");
+    std::string math = "<math xmlns=\"" + MATHML_NS + "\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\">";
+
+    model->addComponent(component);
+
+    auto addVariable = [&](const std::string &name, const std::string &initialValue = {}) {
+        auto variable = libcellml::Variable::create(name);
+
+        variable->setUnits("dimensionless");
+
+        if (!initialValue.empty()) {
+            variable->setInitialValue(initialValue);
+        }
+
+        component->addVariable(variable);
+    };
+
+    addVariable("t");
+    addVariable("x", "1.0");
+
+    for (size_t i = 0; i < equationCount; ++i) {
+        auto name = "v_" + std::to_string(i);
+        auto previous = (i == 0) ? ci("x") : ci("v_" + std::to_string(i - 1));
+
+        addVariable(name);
+
+        math += applyMath("eq", ci(name)
+                                + applyMath("plus", applyMath("times", cn("1.0001") + previous)
+                                                    + applyMath("sin", applyMath("divide", ci("x") + cn(std::to_string(i + 1))))));
+    }
+
+    math += applyMath("eq", applyMath("diff", "<bvar>" + ci("t") + "</bvar>" + ci("x"))
+                            + applyMath("minus", ci((equationCount == 0) ? "x" : "v_" + std::to_string(equationCount - 1))));
+
+    std::string nestedExpression = ci("x");
+
+    for (size_t i = 0; i < nestingDepth; ++i) {
+        nestedExpression = applyMath((i % 2 == 0) ? "plus" : "times", nestedExpression + cn(std::to_string(i % 7 + 1)));
+    }
+
+    addVariable("nested");
+
+    math += applyMath("eq", ci("nested") + nestedExpression);
+    math += "</math>";
+
+    component->setMath(math);
+
+    return model;
+}
+
+int main(int argc, char *argv[])
+{
+    // Usage: benchmarkgenerator [equationCount] [nestingDepth] [repeatCount]
+
+    size_t equationCount = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 1000;
+    size_t nestingDepth = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 200;
+    size_t repeatCount = (argc > 3) ? std::strtoul(argv[3], nullptr, 10) : 3;
+
+    if (repeatCount == 0) {
+        repeatCount = 1;
+    }
+
+    auto model = syntheticModel(equationCount, nestingDepth);
+    auto analyser = libcellml::Analyser::create();
+    auto start = std::chrono::steady_clock::now();
+
+    analyser->analyseModel(model);
+
+    auto analysisTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (analyser->errorCount() != 0) {
+        std::cerr << "The synthetic model could not be analysed:" << std::endl;
+
+        for (size_t i = 0; i < analyser->errorCount(); ++i) {
+            std::cerr << " - " << analyser->error(i)->description() << std::endl;
+        }
+
+        return 1;
+    }
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+    size_t codeSize = 0;
+
+    generator->setModel(analyserModel);
+
+    start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < repeatCount; ++i) {
+        codeSize += generator->interfaceCode().size();
+        codeSize += generator->implementationCode().size();
+    }
+
+    auto generationTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / double(repeatCount);
+
+    codeSize /= repeatCount;
+
+    std::cout << "Equations:         " << analyserModel->equationCount() << std::endl;
+    std::cout << "Nesting depth:     " << nestingDepth << std::endl;
+    std::cout << "Analysis time:     " << analysisTime << " s" << std::endl;
+    std::cout << "Generation time:   " << generationTime << " s (average over " << repeatCount << " run(s))" << std::endl;
+    std::cout << "Generated code:    " << codeSize << " bytes" << std::endl;
+    std::cout << "Throughput:        " << double(analyserModel->equationCount()) / generationTime << " equations/s, "
+              << double(codeSize) / generationTime << " bytes/s" << std::endl;
+
+    return 0;
+}
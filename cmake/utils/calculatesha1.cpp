@@ -30,13 +30,37 @@ int main()
     auto cGeneratorProfileRepr = libcellml::generatorProfileAsString(cGeneratorProfile);
     std::string cSha1Value = libcellml::sha1(cGeneratorProfileRepr);
 
+    cGeneratorProfile->setPrecision(libcellml::GeneratorProfile::Precision::SINGLE);
+
+    auto cSinglePrecisionGeneratorProfileRepr = libcellml::generatorProfileAsString(cGeneratorProfile);
+    std::string cSinglePrecisionSha1Value = libcellml::sha1(cSinglePrecisionGeneratorProfileRepr);
+
+    cGeneratorProfile->setPrecision(libcellml::GeneratorProfile::Precision::MIXED);
+
+    auto cMixedPrecisionGeneratorProfileRepr = libcellml::generatorProfileAsString(cGeneratorProfile);
+    std::string cMixedPrecisionSha1Value = libcellml::sha1(cMixedPrecisionGeneratorProfileRepr);
+
     auto pyGeneratorProfileRepr = libcellml::generatorProfileAsString(pyGeneratorProfile);
     std::string pySha1Value = libcellml::sha1(pyGeneratorProfileRepr);
 
+    auto cppGeneratorProfile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::CPP);
+
+    auto cppGeneratorProfileRepr = libcellml::generatorProfileAsString(cppGeneratorProfile);
+    std::string cppSha1Value = libcellml::sha1(cppGeneratorProfileRepr);
+
+    auto numpyGeneratorProfile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::NUMPY);
+
+    auto numpyGeneratorProfileRepr = libcellml::generatorProfileAsString(numpyGeneratorProfile);
+    std::string numpySha1Value = libcellml::sha1(numpyGeneratorProfileRepr);
+
     std::ofstream outFile("generatorprofilesha1values.cmake");
 
     outFile << "set(C_GENERATOR_PROFILE_SHA1_VALUE " << cSha1Value << ")" << std::endl;
+    outFile << "set(C_SINGLE_PRECISION_GENERATOR_PROFILE_SHA1_VALUE " << cSinglePrecisionSha1Value << ")" << std::endl;
+    outFile << "set(C_MIXED_PRECISION_GENERATOR_PROFILE_SHA1_VALUE " << cMixedPrecisionSha1Value << ")" << std::endl;
     outFile << "set(PYTHON_GENERATOR_PROFILE_SHA1_VALUE " << pySha1Value << ")" << std::endl;
+    outFile << "set(CPP_GENERATOR_PROFILE_SHA1_VALUE " << cppSha1Value << ")" << std::endl;
+    outFile << "set(NUMPY_GENERATOR_PROFILE_SHA1_VALUE " << numpySha1Value << ")" << std::endl;
 
     outFile.close();
 
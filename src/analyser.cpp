@@ -602,6 +602,30 @@ public:
     bool isStateRateBased(const AnalyserEquationPtr &equation,
                           AnalyserEquationPtrs &checkedEquations);
 
+    static bool isStateAst(const AnalyserEquationAstPtr &ast,
+                           const AnalyserVariablePtr &state,
+                           const std::map<VariablePtr, AnalyserVariablePtr> &v2avMappings);
+    static bool isOneMinusStateAst(const AnalyserEquationAstPtr &ast,
+                                   const AnalyserVariablePtr &state,
+                                   const std::map<VariablePtr, AnalyserVariablePtr> &v2avMappings);
+    static bool dependsOnState(const AnalyserEquationAstPtr &ast,
+                               const AnalyserVariablePtr &state,
+                               const std::map<VariablePtr, AnalyserVariablePtr> &v2avMappings,
+                               AnalyserEquationPtrs &checkedEquations);
+    static bool dependsOnState(const AnalyserEquationPtr &equation,
+                               const AnalyserVariablePtr &state,
+                               const std::map<VariablePtr, AnalyserVariablePtr> &v2avMappings,
+                               AnalyserEquationPtrs &checkedEquations);
+    void analyseGatingVariable(const AnalyserVariablePtr &state,
+                               const std::map<VariablePtr, AnalyserVariablePtr> &v2avMappings);
+
+    static bool isLookupTableCompatible(const AnalyserEquationAstPtr &ast,
+                                        const std::map<VariablePtr, AnalyserVariablePtr> &v2avMappings,
+                                        AnalyserVariablePtr &state,
+                                        bool &hasExpensiveFunction);
+    static void analyseLookupTableState(const AnalyserEquationPtr &equation,
+                                        const std::map<VariablePtr, AnalyserVariablePtr> &v2avMappings);
+
     void addInvalidVariableIssue(const AnalyserInternalVariablePtr &variable,
                                  Issue::ReferenceRule referenceRule);
 
@@ -1091,8 +1115,8 @@ void Analyser::AnalyserImpl::analyseComponent(const ComponentPtr &component)
                     if (internalEquation->mAst->mPimpl->mType != AnalyserEquationAst::Type::EQUALITY) {
                         auto issue = Issue::IssueImpl::create();
 
-                        issue->mPimpl->setDescription("Equation " + expression(internalEquation->mAst)
-                                                      + " is not an equality statement (i.e. LHS = RHS).");
+                        issue->mPimpl->setDescription("Equation %1 is not an equality statement (i.e. LHS = RHS).",
+                                                       {expression(internalEquation->mAst)});
                         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_EQUATION_NOT_EQUALITY_STATEMENT);
                         issue->mPimpl->mItem->mPimpl->setComponent(component);
 
@@ -1152,11 +1176,8 @@ void Analyser::AnalyserImpl::analyseComponentVariables(const ComponentPtr &compo
             auto issue = Issue::IssueImpl::create();
             auto trackedVariableComponent = owningComponent(internalVariable->mVariable);
 
-            issue->mPimpl->setDescription("Variable '" + variable->name()
-                                          + "' in component '" + component->name()
-                                          + "' and variable '" + internalVariable->mVariable->name()
-                                          + "' in component '" + trackedVariableComponent->name()
-                                          + "' are equivalent and cannot therefore both be initialised.");
+            issue->mPimpl->setDescription("Variable '%1' in component '%2' and variable '%3' in component '%4' are equivalent and cannot therefore both be initialised.",
+                                           {variable->name(), component->name(), internalVariable->mVariable->name(), trackedVariableComponent->name()});
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_VARIABLE_INITIALISED_MORE_THAN_ONCE);
             issue->mPimpl->mItem->mPimpl->setVariable(variable);
 
@@ -1170,10 +1191,8 @@ void Analyser::AnalyserImpl::analyseComponentVariables(const ComponentPtr &compo
             if (initialisingInternalVariable->mType != AnalyserInternalVariable::Type::INITIALISED) {
                 auto issue = Issue::IssueImpl::create();
 
-                issue->mPimpl->setDescription("Variable '" + variable->name()
-                                              + "' in component '" + component->name()
-                                              + "' is initialised using variable '" + internalVariable->mVariable->initialValue()
-                                              + "', which is not a constant.");
+                issue->mPimpl->setDescription("Variable '%1' in component '%2' is initialised using variable '%3', which is not a constant.",
+                                               {variable->name(), component->name(), internalVariable->mVariable->initialValue()});
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_VARIABLE_NON_CONSTANT_INITIALISATION);
                 issue->mPimpl->mItem->mPimpl->setVariable(variable);
 
@@ -1263,9 +1282,8 @@ void Analyser::AnalyserImpl::analyseEquationAst(const AnalyserEquationAstPtr &as
                         if (!voiEquivalentVariable->initialValue().empty()) {
                             auto issue = Issue::IssueImpl::create();
 
-                            issue->mPimpl->setDescription("Variable '" + voiEquivalentVariable->name()
-                                                          + "' in component '" + owningComponent(voiEquivalentVariable)->name()
-                                                          + "' cannot be both a variable of integration and initialised.");
+                            issue->mPimpl->setDescription("Variable '%1' in component '%2' cannot be both a variable of integration and initialised.",
+                                                           {voiEquivalentVariable->name(), owningComponent(voiEquivalentVariable)->name()});
                             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_VOI_INITIALISED);
                             issue->mPimpl->mItem->mPimpl->setVariable(voiEquivalentVariable);
 
@@ -1289,11 +1307,8 @@ void Analyser::AnalyserImpl::analyseEquationAst(const AnalyserEquationAstPtr &as
             if (!mModel->areEquivalentVariables(astVariable, voiVariable)) {
                 auto issue = Issue::IssueImpl::create();
 
-                issue->mPimpl->setDescription("Variable '" + voiVariable->name()
-                                              + "' in component '" + owningComponent(voiVariable)->name()
-                                              + "' and variable '" + astVariable->name()
-                                              + "' in component '" + owningComponent(astVariable)->name()
-                                              + "' cannot both be the variable of integration.");
+                issue->mPimpl->setDescription("Variable '%1' in component '%2' and variable '%3' in component '%4' cannot both be the variable of integration.",
+                                               {voiVariable->name(), owningComponent(voiVariable)->name(), astVariable->name(), owningComponent(astVariable)->name()});
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_VOI_SEVERAL);
                 issue->mPimpl->mItem->mPimpl->setVariable(astVariable);
 
@@ -1315,9 +1330,8 @@ void Analyser::AnalyserImpl::analyseEquationAst(const AnalyserEquationAstPtr &as
             auto variable = astGreatGrandparent->mPimpl->mOwnedRightChild->variable();
             auto issue = Issue::IssueImpl::create();
 
-            issue->mPimpl->setDescription("The differential equation for variable '" + variable->name()
-                                          + "' in component '" + owningComponent(variable)->name()
-                                          + "' must be of the first order.");
+            issue->mPimpl->setDescription("The differential equation for variable '%1' in component '%2' must be of the first order.",
+                                           {variable->name(), owningComponent(variable)->name()});
             issue->mPimpl->mItem->mPimpl->setMath(owningComponent(variable));
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_ODE_NOT_FIRST_ORDER);
 
@@ -2285,6 +2299,315 @@ bool Analyser::AnalyserImpl::isStateRateBased(const AnalyserEquationPtr &equatio
     return false;
 }
 
+bool Analyser::AnalyserImpl::isStateAst(const AnalyserEquationAstPtr &ast,
+                                        const AnalyserVariablePtr &state,
+                                        const std::map<VariablePtr, AnalyserVariablePtr> &v2avMappings)
+{
+    // Check whether the given AST is for the given state (rather than for its
+    // rate).
+
+    if ((ast == nullptr)
+        || (ast->type() != AnalyserEquationAst::Type::CI)
+        || (ast->parent()->type() == AnalyserEquationAst::Type::DIFF)) {
+        return false;
+    }
+
+    auto v2avMapping = v2avMappings.find(ast->variable());
+
+    return (v2avMapping != v2avMappings.end()) && (v2avMapping->second == state);
+}
+
+bool Analyser::AnalyserImpl::isOneMinusStateAst(const AnalyserEquationAstPtr &ast,
+                                                const AnalyserVariablePtr &state,
+                                                const std::map<VariablePtr, AnalyserVariablePtr> &v2avMappings)
+{
+    // Check whether the given AST is of the form 1-y, with y the given state.
+
+    double value;
+
+    return (ast != nullptr)
+           && (ast->type() == AnalyserEquationAst::Type::MINUS)
+           && (ast->leftChild()->type() == AnalyserEquationAst::Type::CN)
+           && convertToDouble(ast->leftChild()->value(), value)
+           && areEqual(value, 1.0)
+           && isStateAst(ast->rightChild(), state, v2avMappings);
+}
+
+bool Analyser::AnalyserImpl::dependsOnState(const AnalyserEquationAstPtr &ast,
+                                            const AnalyserVariablePtr &state,
+                                            const std::map<VariablePtr, AnalyserVariablePtr> &v2avMappings,
+                                            AnalyserEquationPtrs &checkedEquations)
+{
+    // Check whether the given AST depends, directly or indirectly, on the given
+    // state.
+
+    if (ast == nullptr) {
+        return false;
+    }
+
+    if (ast->type() == AnalyserEquationAst::Type::CI) {
+        auto v2avMapping = v2avMappings.find(ast->variable());
+
+        if (v2avMapping == v2avMappings.end()) {
+            return false;
+        }
+
+        auto variable = v2avMapping->second;
+
+        if (variable == state) {
+            return true;
+        }
+
+        // The value of another state doesn't depend on the given state, but
+        // its rate might.
+
+        if ((variable->type() == AnalyserVariable::Type::STATE)
+            && (ast->parent()->type() != AnalyserEquationAst::Type::DIFF)) {
+            return false;
+        }
+
+        for (const auto &equation : variable->equations()) {
+            if (dependsOnState(equation, state, v2avMappings, checkedEquations)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    return dependsOnState(ast->leftChild(), state, v2avMappings, checkedEquations)
+           || dependsOnState(ast->rightChild(), state, v2avMappings, checkedEquations);
+}
+
+bool Analyser::AnalyserImpl::dependsOnState(const AnalyserEquationPtr &equation,
+                                            const AnalyserVariablePtr &state,
+                                            const std::map<VariablePtr, AnalyserVariablePtr> &v2avMappings,
+                                            AnalyserEquationPtrs &checkedEquations)
+{
+    // Check whether the given equation depends, directly or indirectly, on the
+    // given state.
+
+    if (std::find(checkedEquations.begin(), checkedEquations.end(), equation) != checkedEquations.end()) {
+        return false;
+    }
+
+    checkedEquations.push_back(equation);
+
+    if (equation->ast() != nullptr) {
+        return dependsOnState(equation->ast(), state, v2avMappings, checkedEquations);
+    }
+
+    // This is an external equation, so we rely on its dependencies, where a
+    // dependency on an ODE equation corresponds to a dependency on a state.
+
+    for (const auto &dependency : equation->dependencies()) {
+        if (dependency->type() == AnalyserEquation::Type::ODE) {
+            if (dependency->variable(0) == state) {
+                return true;
+            }
+        } else if (dependsOnState(dependency, state, v2avMappings, checkedEquations)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Analyser::AnalyserImpl::analyseGatingVariable(const AnalyserVariablePtr &state,
+                                                   const std::map<VariablePtr, AnalyserVariablePtr> &v2avMappings)
+{
+    // Check whether the ODE for the given state is of the form:
+    //     dy/dt = alpha*(1-y)-beta*y
+    // or:
+    //     dy/dt = (y_inf-y)/tau
+    // with alpha, beta, y_inf and tau independent of y, in which case the state
+    // is a gating variable which ODE can be rewritten as:
+    //     dy/dt = (y_inf-y)/tau
+    // with tau = 1/(alpha+beta) and y_inf = alpha/(alpha+beta) in the first
+    // case.
+
+    auto equation = state->equation(0);
+
+    if (equation->type() != AnalyserEquation::Type::ODE) {
+        return;
+    }
+
+    auto rhs = equation->ast()->rightChild();
+    AnalyserEquationAstPtr tau;
+    AnalyserEquationAstPtr steadyState;
+
+    if ((rhs->type() == AnalyserEquationAst::Type::MINUS)
+        && (rhs->rightChild() != nullptr)
+        && (rhs->leftChild()->type() == AnalyserEquationAst::Type::TIMES)
+        && (rhs->rightChild()->type() == AnalyserEquationAst::Type::TIMES)) {
+        auto alphaTerm = rhs->leftChild();
+        auto betaTerm = rhs->rightChild();
+        AnalyserEquationAstPtr alpha;
+        AnalyserEquationAstPtr beta;
+
+        if (isOneMinusStateAst(alphaTerm->rightChild(), state, v2avMappings)) {
+            alpha = alphaTerm->leftChild();
+        } else if (isOneMinusStateAst(alphaTerm->leftChild(), state, v2avMappings)) {
+            alpha = alphaTerm->rightChild();
+        }
+
+        if (isStateAst(betaTerm->rightChild(), state, v2avMappings)) {
+            beta = betaTerm->leftChild();
+        } else if (isStateAst(betaTerm->leftChild(), state, v2avMappings)) {
+            beta = betaTerm->rightChild();
+        }
+
+        if ((alpha != nullptr) && (beta != nullptr)) {
+            AnalyserEquationPtrs alphaCheckedEquations;
+            AnalyserEquationPtrs betaCheckedEquations;
+
+            if (!dependsOnState(alpha, state, v2avMappings, alphaCheckedEquations)
+                && !dependsOnState(beta, state, v2avMappings, betaCheckedEquations)) {
+                // Create the ASTs for 1/(alpha+beta) and alpha/(alpha+beta).
+                // Note: alpha and beta are referenced rather than owned, so
+                //       that they remain part of the ODE's AST.
+
+                auto createSumAst = [&](const AnalyserEquationAstPtr &parent) {
+                    auto res = AnalyserEquationAst::create();
+
+                    res->mPimpl->populate(AnalyserEquationAst::Type::PLUS, parent);
+
+                    res->setLeftChild(alpha);
+                    res->setRightChild(beta);
+
+                    return res;
+                };
+
+                tau = AnalyserEquationAst::create();
+
+                tau->mPimpl->populate(AnalyserEquationAst::Type::DIVIDE, nullptr);
+
+                tau->mPimpl->mOwnedLeftChild = AnalyserEquationAst::create();
+                tau->mPimpl->mOwnedRightChild = createSumAst(tau);
+
+                tau->mPimpl->mOwnedLeftChild->mPimpl->populate(AnalyserEquationAst::Type::CN, "1.0", tau);
+
+                steadyState = AnalyserEquationAst::create();
+
+                steadyState->mPimpl->populate(AnalyserEquationAst::Type::DIVIDE, nullptr);
+
+                steadyState->setLeftChild(alpha);
+
+                steadyState->mPimpl->mOwnedRightChild = createSumAst(steadyState);
+            }
+        }
+    } else if ((rhs->type() == AnalyserEquationAst::Type::DIVIDE)
+               && (rhs->leftChild()->type() == AnalyserEquationAst::Type::MINUS)
+               && isStateAst(rhs->leftChild()->rightChild(), state, v2avMappings)) {
+        AnalyserEquationPtrs steadyStateCheckedEquations;
+        AnalyserEquationPtrs tauCheckedEquations;
+
+        if (!dependsOnState(rhs->leftChild()->leftChild(), state, v2avMappings, steadyStateCheckedEquations)
+            && !dependsOnState(rhs->rightChild(), state, v2avMappings, tauCheckedEquations)) {
+            tau = rhs->rightChild();
+            steadyState = rhs->leftChild()->leftChild();
+        }
+    }
+
+    state->mPimpl->mGatingTauAst = tau;
+    state->mPimpl->mGatingSteadyStateAst = steadyState;
+}
+
+bool Analyser::AnalyserImpl::isLookupTableCompatible(const AnalyserEquationAstPtr &ast,
+                                                     const std::map<VariablePtr, AnalyserVariablePtr> &v2avMappings,
+                                                     AnalyserVariablePtr &state,
+                                                     bool &hasExpensiveFunction)
+{
+    // Check whether the given AST only depends on one state and literals, and
+    // doesn't involve anything that is not smooth enough to be interpolated
+    // (i.e. relational and logical operators, and piecewise statements). Note
+    // that (computed) constants are not allowed since a lookup table is
+    // initialised once, so it would go stale if their value were to change.
+
+    if (ast == nullptr) {
+        return true;
+    }
+
+    switch (ast->type()) {
+    case AnalyserEquationAst::Type::EQ:
+    case AnalyserEquationAst::Type::NEQ:
+    case AnalyserEquationAst::Type::LT:
+    case AnalyserEquationAst::Type::LEQ:
+    case AnalyserEquationAst::Type::GT:
+    case AnalyserEquationAst::Type::GEQ:
+    case AnalyserEquationAst::Type::AND:
+    case AnalyserEquationAst::Type::OR:
+    case AnalyserEquationAst::Type::XOR:
+    case AnalyserEquationAst::Type::NOT:
+    case AnalyserEquationAst::Type::PIECEWISE:
+    case AnalyserEquationAst::Type::PIECE:
+    case AnalyserEquationAst::Type::OTHERWISE:
+    case AnalyserEquationAst::Type::DIFF:
+        return false;
+    case AnalyserEquationAst::Type::CI: {
+        auto v2avMapping = v2avMappings.find(ast->variable());
+
+        if (v2avMapping == v2avMappings.end()) {
+            return false;
+        }
+
+        auto variable = v2avMapping->second;
+
+        if (variable->type() == AnalyserVariable::Type::STATE) {
+            if ((state != nullptr) && (state != variable)) {
+                return false;
+            }
+
+            state = variable;
+
+            return true;
+        }
+
+        return false;
+    }
+    case AnalyserEquationAst::Type::POWER:
+    case AnalyserEquationAst::Type::ROOT:
+    case AnalyserEquationAst::Type::EXP:
+    case AnalyserEquationAst::Type::LN:
+    case AnalyserEquationAst::Type::LOG:
+        hasExpensiveFunction = true;
+
+        break;
+    default:
+        if ((ast->type() >= AnalyserEquationAst::Type::SIN)
+            && (ast->type() <= AnalyserEquationAst::Type::ACOTH)) {
+            hasExpensiveFunction = true;
+        }
+
+        break;
+    }
+
+    return isLookupTableCompatible(ast->leftChild(), v2avMappings, state, hasExpensiveFunction)
+           && isLookupTableCompatible(ast->rightChild(), v2avMappings, state, hasExpensiveFunction);
+}
+
+void Analyser::AnalyserImpl::analyseLookupTableState(const AnalyserEquationPtr &equation,
+                                                     const std::map<VariablePtr, AnalyserVariablePtr> &v2avMappings)
+{
+    // Check whether the given equation is an algebraic equation which RHS only
+    // depends on one state and literals, and involves at least one expensive
+    // function, in which case it could be evaluated using a lookup table.
+
+    if ((equation->type() != AnalyserEquation::Type::ALGEBRAIC)
+        || (equation->variableCount() != 1)) {
+        return;
+    }
+
+    AnalyserVariablePtr state;
+    bool hasExpensiveFunction = false;
+
+    if (isLookupTableCompatible(equation->ast()->rightChild(), v2avMappings, state, hasExpensiveFunction)
+        && (state != nullptr)
+        && hasExpensiveFunction) {
+        equation->mPimpl->mLookupTableState = state;
+    }
+}
+
 void Analyser::AnalyserImpl::addInvalidVariableIssue(const AnalyserInternalVariablePtr &variable,
                                                      Issue::ReferenceRule referenceRule)
 {
@@ -2310,9 +2633,8 @@ void Analyser::AnalyserImpl::addInvalidVariableIssue(const AnalyserInternalVaria
     auto issue = Issue::IssueImpl::create();
     auto realVariable = variable->mVariable;
 
-    issue->mPimpl->setDescription(descriptionStart + " '" + realVariable->name()
-                                  + "' in component '" + owningComponent(realVariable)->name()
-                                  + "' " + descriptionEnd + ".");
+    issue->mPimpl->setDescription("%1 '%2' in component '%3' %4.",
+                                   {descriptionStart, realVariable->name(), owningComponent(realVariable)->name(), descriptionEnd});
     issue->mPimpl->setReferenceRule(referenceRule);
     issue->mPimpl->mItem->mPimpl->setVariable(realVariable);
 
@@ -2364,9 +2686,8 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
             if (owningModel(variable) != model) {
                 auto issue = Issue::IssueImpl::create();
 
-                issue->mPimpl->setDescription("Variable '" + variable->name()
-                                              + "' in component '" + owningComponent(variable)->name()
-                                              + "' is marked as an external variable, but it belongs to a different model and will therefore be ignored.");
+                issue->mPimpl->setDescription("Variable '%1' in component '%2' is marked as an external variable, but it belongs to a different model and will therefore be ignored.",
+                                               {variable->name(), owningComponent(variable)->name()});
                 issue->mPimpl->setLevel(Issue::Level::MESSAGE);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::ANALYSER_EXTERNAL_VARIABLE_DIFFERENT_MODEL);
                 issue->mPimpl->mItem->mPimpl->setVariable(variable);
@@ -2401,10 +2722,13 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
         return;
     }
 
+    if (mIssueStreamingCancelled) {
+        return;
+    }
+
     // Check that the variables that were marked as external were rightly so.
 
     for (const auto &primaryExternalVariable : primaryExternalVariables) {
-        std::string description;
         auto isVoi = (mModel->mPimpl->mVoi != nullptr)
                      && (primaryExternalVariable.first == mModel->mPimpl->mVoi->variable());
         auto equivalentVariableCount = primaryExternalVariable.second.size();
@@ -2414,64 +2738,77 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
                                   != primaryExternalVariable.second.end();
 
         if (isVoi || (equivalentVariableCount > 1) || !hasPrimaryVariable) {
-            description += (equivalentVariableCount == 2) ? "Both " : "";
+            // Keep track of the names that make up the description of the
+            // issue, which only gets formatted when it is first needed.
 
-            for (size_t i = 0; i < equivalentVariableCount; ++i) {
-                if (i != 0) {
-                    description += (i != equivalentVariableCount - 1) ? ", " : " and ";
-                }
-
-                auto variableString = ((i == 0) && (equivalentVariableCount != 2)) ?
-                                          std::string("Variable") :
-                                          std::string("variable");
+            Strings variableNames;
+            Strings componentNames;
 
-                description += variableString + " '" + primaryExternalVariable.second[i]->name()
-                               + "' in component '" + owningComponent(primaryExternalVariable.second[i])->name()
-                               + "'";
+            for (const auto &variable : primaryExternalVariable.second) {
+                variableNames.push_back(variable->name());
+                componentNames.push_back(owningComponent(variable)->name());
             }
 
-            Issue::ReferenceRule referenceRule;
+            auto primaryVariableName = primaryExternalVariable.first->name();
+            auto primaryComponentName = owningComponent(primaryExternalVariable.first)->name();
+            auto issue = Issue::IssueImpl::create();
+
+            issue->mPimpl->setDescription([=]() {
+                std::string description;
 
-            if (isVoi) {
-                description += (equivalentVariableCount == 1) ?
-                                   " is marked as an external variable, but it is" :
-                                   " are marked as external variables, but they are";
+                description += (equivalentVariableCount == 2) ? "Both " : "";
 
-                if ((equivalentVariableCount == 1) && hasPrimaryVariable) {
-                    description += " the";
-                } else {
-                    description += " equivalent to variable '" + primaryExternalVariable.first->name()
-                                   + "' in component '" + owningComponent(primaryExternalVariable.first)->name()
-                                   + "', the primary";
+                for (size_t i = 0; i < equivalentVariableCount; ++i) {
+                    if (i != 0) {
+                        description += (i != equivalentVariableCount - 1) ? ", " : " and ";
+                    }
+
+                    auto variableString = ((i == 0) && (equivalentVariableCount != 2)) ?
+                                              std::string("Variable") :
+                                              std::string("variable");
+
+                    description += variableString + " '" + variableNames[i]
+                                   + "' in component '" + componentNames[i]
+                                   + "'";
                 }
 
-                description += " variable of integration which cannot be used as an external variable.";
+                if (isVoi) {
+                    description += (equivalentVariableCount == 1) ?
+                                       " is marked as an external variable, but it is" :
+                                       " are marked as external variables, but they are";
 
-                referenceRule = Issue::ReferenceRule::ANALYSER_EXTERNAL_VARIABLE_VOI;
-            } else {
-                description += (equivalentVariableCount == 1) ?
-                                   " is marked as an external variable, but it is not a primary variable." :
-                                   " are marked as external variables, but they are";
-                description += (equivalentVariableCount > 2) ? " all" : "";
-                description += (equivalentVariableCount == 1) ? "" : " equivalent.";
-                description += " Variable '" + primaryExternalVariable.first->name()
-                               + "' in component '" + owningComponent(primaryExternalVariable.first)->name()
-                               + "' is";
-                description += hasPrimaryVariable ?
-                                   " the" :
-                               (equivalentVariableCount == 1) ?
-                                   " its corresponding" :
-                                   " their corresponding";
-                description += " primary variable and will therefore be the one used as an external variable.";
-
-                referenceRule = Issue::ReferenceRule::ANALYSER_EXTERNAL_VARIABLE_USE_PRIMARY_VARIABLE;
-            }
+                    if ((equivalentVariableCount == 1) && hasPrimaryVariable) {
+                        description += " the";
+                    } else {
+                        description += " equivalent to variable '" + primaryVariableName
+                                       + "' in component '" + primaryComponentName
+                                       + "', the primary";
+                    }
 
-            auto issue = Issue::IssueImpl::create();
+                    description += " variable of integration which cannot be used as an external variable.";
+                } else {
+                    description += (equivalentVariableCount == 1) ?
+                                       " is marked as an external variable, but it is not a primary variable." :
+                                       " are marked as external variables, but they are";
+                    description += (equivalentVariableCount > 2) ? " all" : "";
+                    description += (equivalentVariableCount == 1) ? "" : " equivalent.";
+                    description += " Variable '" + primaryVariableName
+                                   + "' in component '" + primaryComponentName
+                                   + "' is";
+                    description += hasPrimaryVariable ?
+                                       " the" :
+                                   (equivalentVariableCount == 1) ?
+                                       " its corresponding" :
+                                       " their corresponding";
+                    description += " primary variable and will therefore be the one used as an external variable.";
+                }
 
-            issue->mPimpl->setDescription(description);
+                return description;
+            });
             issue->mPimpl->setLevel(Issue::Level::MESSAGE);
-            issue->mPimpl->setReferenceRule(referenceRule);
+            issue->mPimpl->setReferenceRule(isVoi ?
+                                                Issue::ReferenceRule::ANALYSER_EXTERNAL_VARIABLE_VOI :
+                                                Issue::ReferenceRule::ANALYSER_EXTERNAL_VARIABLE_USE_PRIMARY_VARIABLE);
             issue->mPimpl->mItem->mPimpl->setVariable(primaryExternalVariable.first);
 
             addIssue(issue);
@@ -2502,6 +2839,10 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
         }
     }
 
+    if (mIssueStreamingCancelled) {
+        return;
+    }
+
     // Detmerine whether some variables have been marked as external.
 
     auto hasExternalVariables = std::any_of(mInternalVariables.begin(), mInternalVariables.end(), [](const auto &iv) {
@@ -3061,6 +3402,36 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
 
         equation->mPimpl->mIsStateRateBased = isStateRateBased(equation, checkedEquations);
     }
+
+    // Determine which of our states are gating variables.
+    // Note: the ASTs of our equations may reference any of the variables that
+    //       are equivalent to one of our states/variables, hence we map all of
+    //       them.
+
+    std::map<VariablePtr, AnalyserVariablePtr> equivalentV2avMappings;
+
+    for (const auto &variable : mModel->mPimpl->mStates) {
+        for (const auto &equivalentVariable : equivalentVariables(variable->variable())) {
+            equivalentV2avMappings.emplace(equivalentVariable, variable);
+        }
+    }
+
+    for (const auto &variable : mModel->mPimpl->mVariables) {
+        for (const auto &equivalentVariable : equivalentVariables(variable->variable())) {
+            equivalentV2avMappings.emplace(equivalentVariable, variable);
+        }
+    }
+
+    for (const auto &state : mModel->mPimpl->mStates) {
+        analyseGatingVariable(state, equivalentV2avMappings);
+    }
+
+    // Determine which of our equations could be evaluated using a lookup
+    // table.
+
+    for (const auto &equation : mModel->mPimpl->mEquations) {
+        analyseLookupTableState(equation, equivalentV2avMappings);
+    }
 }
 
 AnalyserExternalVariablePtrs::const_iterator Analyser::AnalyserImpl::findExternalVariable(const ModelPtr &model,
@@ -3126,21 +3497,42 @@ void Analyser::analyseModel(const ModelPtr &model)
         return;
     }
 
+    // Validate the model, making the validation issues our own as soon as they
+    // are final, so that they get streamed as they would by the validator, and
+    // having the validator stop should our streaming of issues be cancelled.
+
     auto validator = Validator::create();
+    auto analyser = pFunc();
+
+    validator->setIssueCallback([analyser](const IssuePtr &issue) {
+        analyser->addIssue(issue);
+
+        return !analyser->mIssueStreamingCancelled;
+    });
+    validator->setRetainIssues(false);
 
     validator->validateModel(model);
 
     if (validator->issueCount() > 0) {
-        // The model is not valid, so retrieve the validation issues and make
-        // them our own.
+        // The model is not valid, so retrieve the validation issues that didn't
+        // get streamed (because the streaming was cancelled) and make them our
+        // own too.
 
         for (size_t i = 0; i < validator->issueCount(); ++i) {
-            pFunc()->addIssue(validator->issue(i));
+            auto issue = validator->issue(i);
+
+            if (issue != nullptr) {
+                pFunc()->addIssue(issue);
+            }
         }
 
         pFunc()->mModel->mPimpl->mType = AnalyserModel::Type::INVALID;
     }
 
+    if (pFunc()->mIssueStreamingCancelled) {
+        return;
+    }
+
     // Check for non-validation errors that will render the given model invalid
     // for analysis.
 
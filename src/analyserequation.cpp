@@ -153,6 +153,11 @@ bool AnalyserEquation::isStateRateBased() const
     return mPimpl->mIsStateRateBased;
 }
 
+AnalyserVariablePtr AnalyserEquation::lookupTableState() const
+{
+    return mPimpl->mLookupTableState;
+}
+
 size_t AnalyserEquation::variableCount() const
 {
     return mPimpl->mVariables.size();
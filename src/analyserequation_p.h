@@ -35,6 +35,7 @@ struct AnalyserEquation::AnalyserEquationImpl
     size_t mNlaSystemIndex;
     std::vector<AnalyserEquationWeakPtr> mNlaSiblings;
     bool mIsStateRateBased = false;
+    AnalyserVariablePtr mLookupTableState;
     std::vector<AnalyserVariablePtr> mVariables;
 
     static AnalyserEquationPtr create();
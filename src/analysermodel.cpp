@@ -16,6 +16,14 @@ limitations under the License.
 
 #include "libcellml/analysermodel.h"
 
+#include <algorithm>
+#include <functional>
+#include <set>
+
+#include "libcellml/analyserequation.h"
+#include "libcellml/analyserequationast.h"
+#include "libcellml/analyservariable.h"
+
 #include "analysermodel_p.h"
 #include "utilities.h"
 
@@ -31,6 +39,179 @@ AnalyserModel::AnalyserModelImpl::AnalyserModelImpl(const ModelPtr &model)
 {
 }
 
+void AnalyserModel::AnalyserModelImpl::computeDependencyStructures()
+{
+    // Compute, once and for all, the sparsity pattern of the Jacobian of our
+    // rates with respect to our states, as well as the dependency structure of
+    // our equations. Both are stored using the compressed sparse row (CSR)
+    // format.
+
+    if (mDependencyStructuresComputed) {
+        return;
+    }
+
+    mDependencyStructuresComputed = true;
+
+    // Map all the variables that are equivalent to a state to the index of that
+    // state, and index our equations.
+
+    std::unordered_map<Variable *, size_t> stateIndices;
+    std::unordered_map<AnalyserEquation *, size_t> equationIndices;
+    auto equationCount = mEquations.size();
+
+    for (const auto &state : mStates) {
+        for (const auto &variable : equivalentVariables(state->variable())) {
+            stateIndices.emplace(variable.get(), state->index());
+        }
+    }
+
+    for (size_t i = 0; i < equationCount; ++i) {
+        equationIndices.emplace(mEquations[i].get(), i);
+    }
+
+    // Determine the states and rates that are directly referenced by each of
+    // our equations.
+    // Note: the rate(s) computed by an equation are not of interest to us.
+
+    std::vector<std::set<size_t>> directStates(equationCount);
+    std::vector<std::set<size_t>> directRates(equationCount);
+    std::function<void(const AnalyserEquationAstPtr &, size_t)> collectStatesAndRates = [&](const AnalyserEquationAstPtr &ast, size_t equationIndex) {
+        if (ast == nullptr) {
+            return;
+        }
+
+        if (ast->type() == AnalyserEquationAst::Type::CI) {
+            auto stateIndex = stateIndices.find(ast->variable().get());
+
+            if (stateIndex != stateIndices.end()) {
+                if (ast->parent()->type() == AnalyserEquationAst::Type::DIFF) {
+                    directRates[equationIndex].insert(stateIndex->second);
+                } else {
+                    directStates[equationIndex].insert(stateIndex->second);
+                }
+            }
+
+            return;
+        }
+
+        collectStatesAndRates(ast->leftChild(), equationIndex);
+        collectStatesAndRates(ast->rightChild(), equationIndex);
+    };
+
+    for (size_t i = 0; i < equationCount; ++i) {
+        collectStatesAndRates(mEquations[i]->ast(), i);
+
+        for (const auto &variable : mEquations[i]->variables()) {
+            if (variable->type() == AnalyserVariable::Type::STATE) {
+                directRates[i].erase(variable->index());
+            }
+        }
+    }
+
+    // Group the equations that belong to the same NLA system since they are
+    // solved together and therefore share the same dependencies.
+
+    std::vector<size_t> groups(equationCount);
+
+    for (size_t i = 0; i < equationCount; ++i) {
+        groups[i] = i;
+
+        for (const auto &nlaSibling : mEquations[i]->nlaSiblings()) {
+            groups[i] = std::min(groups[i], equationIndices[nlaSibling.get()]);
+        }
+    }
+
+    // Determine, for each group of equations, the states on which it depends,
+    // whether directly or through the equations on which it depends.
+    // Note: an ODE equation that is a dependency of an equation corresponds to
+    //       a state used by that equation, something that we have already
+    //       accounted for, unless the equation is an external one, in which
+    //       case it has no AST, hence we rely on its dependencies.
+
+    std::vector<std::set<size_t>> groupStates(equationCount);
+    std::vector<bool> visitedGroups(equationCount, false);
+    std::function<void(size_t)> computeGroupStates = [&](size_t group) {
+        if (visitedGroups[group]) {
+            return;
+        }
+
+        visitedGroups[group] = true;
+
+        auto &states = groupStates[group];
+
+        for (size_t i = group; i < equationCount; ++i) {
+            if (groups[i] != group) {
+                continue;
+            }
+
+            auto equation = mEquations[i];
+
+            states.insert(directStates[i].begin(), directStates[i].end());
+
+            for (const auto &rate : directRates[i]) {
+                auto rateGroup = groups[equationIndices[mStates[rate]->equation(0).get()]];
+
+                computeGroupStates(rateGroup);
+
+                states.insert(groupStates[rateGroup].begin(), groupStates[rateGroup].end());
+            }
+
+            for (const auto &dependency : equation->dependencies()) {
+                if (dependency->type() == AnalyserEquation::Type::ODE) {
+                    if (equation->type() == AnalyserEquation::Type::EXTERNAL) {
+                        states.insert(dependency->variable(0)->index());
+                    }
+                } else {
+                    auto dependencyGroup = groups[equationIndices[dependency.get()]];
+
+                    if (dependencyGroup != group) {
+                        computeGroupStates(dependencyGroup);
+
+                        states.insert(groupStates[dependencyGroup].begin(), groupStates[dependencyGroup].end());
+                    }
+                }
+            }
+        }
+    };
+
+    // Build the sparsity pattern of our Jacobian, i.e. for each rate, the
+    // states on which it depends.
+
+    mJacobianRowOffsets = {0};
+
+    for (const auto &state : mStates) {
+        auto group = groups[equationIndices[state->equation(0).get()]];
+
+        computeGroupStates(group);
+
+        mJacobianColumnIndices.insert(mJacobianColumnIndices.end(), groupStates[group].begin(), groupStates[group].end());
+        mJacobianRowOffsets.push_back(mJacobianColumnIndices.size());
+    }
+
+    // Build the dependency structure of our equations, i.e. for each equation,
+    // the (non-ODE) equations on which it directly depends.
+    // Note: NLA siblings are solved together, so they don't depend on each
+    //       other.
+
+    mEquationDependencyRowOffsets = {0};
+
+    for (size_t i = 0; i < equationCount; ++i) {
+        std::set<size_t> dependencies;
+
+        for (const auto &dependency : mEquations[i]->dependencies()) {
+            auto dependencyIndex = equationIndices[dependency.get()];
+
+            if ((dependency->type() != AnalyserEquation::Type::ODE)
+                && (groups[dependencyIndex] != groups[i])) {
+                dependencies.insert(dependencyIndex);
+            }
+        }
+
+        mEquationDependencyColumnIndices.insert(mEquationDependencyColumnIndices.end(), dependencies.begin(), dependencies.end());
+        mEquationDependencyRowOffsets.push_back(mEquationDependencyColumnIndices.size());
+    }
+}
+
 AnalyserModel::AnalyserModel(const ModelPtr &model)
     : mPimpl(new AnalyserModelImpl(model))
 {
@@ -104,8 +285,15 @@ size_t AnalyserModel::stateCount() const
 
 std::vector<AnalyserVariablePtr> AnalyserModel::states() const
 {
+    return statesRef();
+}
+
+const std::vector<AnalyserVariablePtr> &AnalyserModel::statesRef() const
+{
+    static const std::vector<AnalyserVariablePtr> NO_STATES;
+
     if (!isValid()) {
-        return {};
+        return NO_STATES;
     }
 
     return mPimpl->mStates;
@@ -132,8 +320,15 @@ size_t AnalyserModel::variableCount() const
 
 std::vector<AnalyserVariablePtr> AnalyserModel::variables() const
 {
+    return variablesRef();
+}
+
+const std::vector<AnalyserVariablePtr> &AnalyserModel::variablesRef() const
+{
+    static const std::vector<AnalyserVariablePtr> NO_VARIABLES;
+
     if (!isValid()) {
-        return {};
+        return NO_VARIABLES;
     }
 
     return mPimpl->mVariables;
@@ -159,8 +354,15 @@ size_t AnalyserModel::equationCount() const
 
 std::vector<AnalyserEquationPtr> AnalyserModel::equations() const
 {
+    return equationsRef();
+}
+
+const std::vector<AnalyserEquationPtr> &AnalyserModel::equationsRef() const
+{
+    static const std::vector<AnalyserEquationPtr> NO_EQUATIONS;
+
     if (!isValid()) {
-        return {};
+        return NO_EQUATIONS;
     }
 
     return mPimpl->mEquations;
@@ -175,6 +377,78 @@ AnalyserEquationPtr AnalyserModel::equation(size_t index) const
     return mPimpl->mEquations[index];
 }
 
+size_t AnalyserModel::jacobianNonZeroCount() const
+{
+    if (!isValid()) {
+        return 0;
+    }
+
+    mPimpl->computeDependencyStructures();
+
+    return mPimpl->mJacobianColumnIndices.size();
+}
+
+std::vector<size_t> AnalyserModel::jacobianRowOffsets() const
+{
+    if (!isValid()) {
+        return {};
+    }
+
+    mPimpl->computeDependencyStructures();
+
+    return mPimpl->mJacobianRowOffsets;
+}
+
+std::vector<size_t> AnalyserModel::jacobianColumnIndices() const
+{
+    if (!isValid()) {
+        return {};
+    }
+
+    mPimpl->computeDependencyStructures();
+
+    return mPimpl->mJacobianColumnIndices;
+}
+
+std::vector<AnalyserVariablePtr> AnalyserModel::stateDependencies(size_t index) const
+{
+    if (!isValid() || (index >= mPimpl->mStates.size())) {
+        return {};
+    }
+
+    mPimpl->computeDependencyStructures();
+
+    std::vector<AnalyserVariablePtr> res;
+
+    for (auto i = mPimpl->mJacobianRowOffsets[index]; i < mPimpl->mJacobianRowOffsets[index + 1]; ++i) {
+        res.push_back(mPimpl->mStates[mPimpl->mJacobianColumnIndices[i]]);
+    }
+
+    return res;
+}
+
+std::vector<size_t> AnalyserModel::equationDependencyRowOffsets() const
+{
+    if (!isValid()) {
+        return {};
+    }
+
+    mPimpl->computeDependencyStructures();
+
+    return mPimpl->mEquationDependencyRowOffsets;
+}
+
+std::vector<size_t> AnalyserModel::equationDependencyColumnIndices() const
+{
+    if (!isValid()) {
+        return {};
+    }
+
+    mPimpl->computeDependencyStructures();
+
+    return mPimpl->mEquationDependencyColumnIndices;
+}
+
 bool AnalyserModel::needEqFunction() const
 {
     if (!isValid()) {
@@ -18,6 +18,8 @@ limitations under the License.
 
 #include "libcellml/analysermodel.h"
 
+#include <unordered_map>
+
 namespace libcellml {
 
 /**
@@ -67,9 +69,17 @@ struct AnalyserModel::AnalyserModelImpl
 
     std::map<uintptr_t, bool> mCachedEquivalentVariables;
 
+    bool mDependencyStructuresComputed = false;
+    std::vector<size_t> mJacobianRowOffsets;
+    std::vector<size_t> mJacobianColumnIndices;
+    std::vector<size_t> mEquationDependencyRowOffsets;
+    std::vector<size_t> mEquationDependencyColumnIndices;
+
     static AnalyserModelPtr create(const ModelPtr &model = nullptr);
 
     AnalyserModelImpl(const ModelPtr &model);
+
+    void computeDependencyStructures();
 };
 
 } // namespace libcellml
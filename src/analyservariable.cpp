@@ -88,6 +88,11 @@ VariablePtr AnalyserVariable::variable() const
     return mPimpl->mVariable;
 }
 
+bool AnalyserVariable::isGatingVariable() const
+{
+    return mPimpl->mGatingTauAst != nullptr;
+}
+
 size_t AnalyserVariable::equationCount() const
 {
     return mPimpl->mEquations.size();
@@ -35,6 +35,8 @@ struct AnalyserVariable::AnalyserVariableImpl
     VariablePtr mVariable;
     ComponentPtr mComponent;
     std::vector<AnalyserEquationWeakPtr> mEquations;
+    AnalyserEquationAstPtr mGatingTauAst;
+    AnalyserEquationAstPtr mGatingSteadyStateAst;
 
     static AnalyserVariablePtr create();
 
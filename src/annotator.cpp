@@ -30,6 +30,7 @@ limitations under the License.
 
 #include "anycellmlelement_p.h"
 #include "commonutils.h"
+#include "idindex.h"
 #include "internaltypes.h"
 #include "issue_p.h"
 #include "logger_p.h"
@@ -37,7 +38,7 @@ limitations under the License.
 
 namespace libcellml {
 
-using ItemList = std::multimap<std::string, AnyCellmlElementPtr>;
+using ItemList = IdIndex<AnyCellmlElementPtr>;
 
 /**
  * @brief The Annotator::AnnotatorImpl class.
@@ -53,16 +54,15 @@ public:
     ItemList mIdList;
     ModelWeakPtr mModel;
     size_t mCounter = 0xb4da55;
-    size_t mHash = 0;
 
     AnyCellmlElementPtr convertToWeak(const AnyCellmlElementPtr &item);
     AnyCellmlElementPtr convertToShared(const AnyCellmlElementPtr &item);
 
     void listComponentIdsAndItems(const ComponentPtr &component, ItemList &idList);
-    ItemList listIdsAndItems(const ModelPtr &model);
+    void listIdsAndItems(const ModelPtr &model, ItemList &idList);
 
     void update();
-    void buildIdList();
+    void buildIdList(const EntityRevisions &revisions);
 
     size_t idCount();
 
@@ -117,9 +117,6 @@ public:
      */
     bool exists(const std::string &id, size_t index, bool unique = false);
 
-    size_t generateHash();
-    void doUpdateComponentHash(const ComponentPtr &component, std::string &idsString);
-
     void addIssueNoModel();
     void addIssueInvalidArgument(CellmlElementType type);
     void addIssueNotFound(const std::string &id);
@@ -140,7 +137,6 @@ Annotator::Annotator()
     : Logger(new Annotator::AnnotatorImpl())
 {
     pFunc()->mAnnotator = this;
-    pFunc()->mIdList = std::multimap<std::string, AnyCellmlElementPtr>();
 }
 
 Annotator::~Annotator()
@@ -165,7 +161,7 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
     if (!id.empty()) {
         auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
         entry->mPimpl->setComponent(component);
-        idList.insert(std::make_pair(id, convertToWeak(entry)));
+        idList.add(id, convertToWeak(entry));
     }
     // Imports.
     ImportSourcePtr importSource = component->importSource();
@@ -174,7 +170,7 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
         if (!id.empty()) {
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setImportSource(importSource);
-            idList.insert(std::make_pair(id, convertToWeak(entry)));
+            idList.add(id, convertToWeak(entry));
         }
     }
     // Component reference in encapsulation structure.
@@ -182,7 +178,7 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
     if (!id.empty()) {
         auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
         entry->mPimpl->setComponentRef(component);
-        idList.insert(std::make_pair(id, convertToWeak(entry)));
+        idList.add(id, convertToWeak(entry));
     }
     // Variables.
     for (size_t v = 0; v < component->variableCount(); ++v) {
@@ -192,7 +188,7 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
         if (!id.empty()) {
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setVariable(variable);
-            idList.insert(std::make_pair(id, convertToWeak(entry)));
+            idList.add(id, convertToWeak(entry));
         }
         for (size_t e = 0; e < variable->equivalentVariableCount(); ++e) {
             // Equivalent variable mappings.
@@ -205,12 +201,10 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
                 // either.
                 bool found = false;
                 if (idList.count(id) != 0) {
-                    // Get the range of items with this identifier:
-                    auto rangePair = idList.equal_range(id);
-                    for (auto it = rangePair.first; it != rangePair.second; ++it) {
+                    for (const auto &item : idList.items(id)) {
                         // Make sure it's also a MAP_VARIABLES item.
-                        if (it->second->type() == CellmlElementType::MAP_VARIABLES) {
-                            auto testPair = it->second->variablePair();
+                        if (item->type() == CellmlElementType::MAP_VARIABLES) {
+                            auto testPair = item->variablePair();
                             VariableWeakPtr variable1Weak = testPair->variable1();
                             VariableWeakPtr variable2Weak = testPair->variable2();
                             if (equals(variable1Weak, weakEquivalentVariable) && equals(variable2Weak, weakVariable)) {
@@ -222,7 +216,7 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
                 if (!found) {
                     auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
                     entry->mPimpl->setMapVariables(variable, equivalentVariable);
-                    idList.insert(std::make_pair(id, convertToWeak(entry)));
+                    idList.add(id, convertToWeak(entry));
                 }
             }
 
@@ -234,12 +228,10 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
                 // either.
                 bool found = false;
                 if (idList.count(id) != 0) {
-                    // Get the range of items with this identifier:
-                    auto rangePair = idList.equal_range(id);
-                    for (auto it = rangePair.first; it != rangePair.second; ++it) {
+                    for (const auto &item : idList.items(id)) {
                         // Make sure it's also a CONNECTION item.
-                        if (it->second->type() == CellmlElementType::CONNECTION) {
-                            auto testPair = it->second->variablePair();
+                        if (item->type() == CellmlElementType::CONNECTION) {
+                            auto testPair = item->variablePair();
                             if ((owningComponent(testPair->variable1()) == owningComponent(equivalentVariable)) && (owningComponent(testPair->variable2()) == owningComponent(variable))) {
                                 found = true;
                             } else if ((owningComponent(testPair->variable2()) == owningComponent(equivalentVariable)) && (owningComponent(testPair->variable1()) == owningComponent(variable))) {
@@ -251,7 +243,7 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
                 if (!found) {
                     auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
                     entry->mPimpl->setConnection(variable, equivalentVariable);
-                    idList.insert(std::make_pair(id, convertToWeak(entry)));
+                    idList.add(id, convertToWeak(entry));
                 }
             }
         }
@@ -263,19 +255,19 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
         if (!id.empty()) {
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setReset(reset);
-            idList.insert(std::make_pair(id, convertToWeak(entry)));
+            idList.add(id, convertToWeak(entry));
         }
         id = reset->testValueId();
         if (!id.empty()) {
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setTestValue(reset);
-            idList.insert(std::make_pair(id, convertToWeak(entry)));
+            idList.add(id, convertToWeak(entry));
         }
         id = reset->resetValueId();
         if (!id.empty()) {
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setResetValue(reset);
-            idList.insert(std::make_pair(id, convertToWeak(entry)));
+            idList.add(id, convertToWeak(entry));
         }
     }
 
@@ -284,17 +276,15 @@ void Annotator::AnnotatorImpl::listComponentIdsAndItems(const ComponentPtr &comp
     }
 }
 
-ItemList Annotator::AnnotatorImpl::listIdsAndItems(const ModelPtr &model)
+void Annotator::AnnotatorImpl::listIdsAndItems(const ModelPtr &model, ItemList &idList)
 {
-    // Collect all existing identifiers in a list and return.
-    //    auto model = weakModel.lock();
-    ItemList idList;
+    // Collect all existing identifiers in the given list.
     // Model.
     std::string id = model->id();
     if (!id.empty()) {
         auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
         entry->mPimpl->setModel(model);
-        idList.insert(std::make_pair(id, convertToWeak(entry)));
+        idList.add(id, convertToWeak(entry));
     }
 
     // Units.
@@ -304,7 +294,7 @@ ItemList Annotator::AnnotatorImpl::listIdsAndItems(const ModelPtr &model)
         if (!id.empty()) {
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setUnits(units);
-            idList.insert(std::make_pair(id, convertToWeak(entry)));
+            idList.add(id, convertToWeak(entry));
         }
         for (size_t i = 0; i < units->unitCount(); ++i) {
             std::string prefix;
@@ -315,7 +305,7 @@ ItemList Annotator::AnnotatorImpl::listIdsAndItems(const ModelPtr &model)
             if (!id.empty()) {
                 auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
                 entry->mPimpl->setUnitsItem(UnitsItem::create(units, i));
-                idList.insert(std::make_pair(id, convertToWeak(entry)));
+                idList.add(id, convertToWeak(entry));
             }
         }
         if (units->isImport()) {
@@ -324,7 +314,7 @@ ItemList Annotator::AnnotatorImpl::listIdsAndItems(const ModelPtr &model)
             if (!id.empty()) {
                 auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
                 entry->mPimpl->setImportSource(importSource);
-                idList.insert(std::make_pair(id, convertToWeak(entry)));
+                idList.add(id, convertToWeak(entry));
             }
         }
     }
@@ -339,10 +329,8 @@ ItemList Annotator::AnnotatorImpl::listIdsAndItems(const ModelPtr &model)
     if (!id.empty()) {
         auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
         entry->mPimpl->setEncapsulation(model);
-        idList.insert(std::make_pair(id, convertToWeak(entry)));
+        idList.add(id, convertToWeak(entry));
     }
-
-    return idList;
 }
 
 AnyCellmlElementPtr Annotator::AnnotatorImpl::convertToWeak(const AnyCellmlElementPtr &item)
@@ -460,10 +448,13 @@ AnyCellmlElementPtr Annotator::AnnotatorImpl::convertToShared(const AnyCellmlEle
     return converted;
 }
 
-void Annotator::AnnotatorImpl::buildIdList()
+void Annotator::AnnotatorImpl::buildIdList(const EntityRevisions &revisions)
 {
-    mIdList.clear();
-    mIdList = listIdsAndItems(mModel.lock());
+    auto model = mModel.lock();
+    mIdList.reset(revisions);
+    if (model != nullptr) {
+        listIdsAndItems(model, mIdList);
+    }
 }
 
 size_t Annotator::AnnotatorImpl::idCount()
@@ -474,17 +465,16 @@ size_t Annotator::AnnotatorImpl::idCount()
 void Annotator::AnnotatorImpl::update()
 {
     removeAllIssues();
-    size_t hash = generateHash();
-    if (mHash != hash) {
-        buildIdList();
-        mHash = hash;
+    auto revisions = IdIndexBase::identifierRevisions(mModel.lock());
+    if (!mIdList.isUpToDate(revisions)) {
+        buildIdList(revisions);
     }
 }
 
 void Annotator::setModel(const ModelPtr &model)
 {
     pFunc()->mModel = model;
-    pFunc()->mHash = 0;
+    pFunc()->mIdList.invalidate();
     pFunc()->update();
 }
 
@@ -568,9 +558,8 @@ std::vector<AnyCellmlElementPtr> Annotator::items(const std::string &id)
 {
     pFunc()->update();
     std::vector<AnyCellmlElementPtr> items;
-    auto range = pFunc()->mIdList.equal_range(id);
-    for (auto it = range.first; it != range.second; ++it) {
-        items.push_back(pFunc()->convertToShared(it->second));
+    for (const auto &item : pFunc()->mIdList.items(id)) {
+        items.push_back(pFunc()->convertToShared(item));
     }
     return items;
 }
@@ -578,25 +567,13 @@ std::vector<AnyCellmlElementPtr> Annotator::items(const std::string &id)
 std::vector<std::string> Annotator::duplicateIds()
 {
     pFunc()->update();
-    std::vector<std::string> ids;
-    for (auto i = pFunc()->mIdList.begin(), end = pFunc()->mIdList.end(); i != end; i = pFunc()->mIdList.upper_bound(i->first)) {
-        auto next = i;
-        ++next;
-        if ((next != end) && (next->first == i->first)) {
-            ids.push_back(i->first);
-        }
-    }
-    return ids;
+    return pFunc()->mIdList.ids(true);
 }
 
 std::vector<std::string> Annotator::ids()
 {
     pFunc()->update();
-    std::vector<std::string> ids;
-    for (auto i = pFunc()->mIdList.begin(), end = pFunc()->mIdList.end(); i != end; i = pFunc()->mIdList.upper_bound(i->first)) {
-        ids.push_back(i->first);
-    }
-    return ids;
+    return pFunc()->mIdList.ids();
 }
 
 ComponentPtr Annotator::component(const std::string &id, size_t index)
@@ -750,8 +727,7 @@ void Annotator::clearAllIds()
         }
         model->removeEncapsulationId();
 
-        pFunc()->mIdList.clear();
-        pFunc()->mHash = 0;
+        pFunc()->mIdList.reset({});
     } else {
         pFunc()->addIssueNoModel();
     }
@@ -877,14 +853,14 @@ void Annotator::AnnotatorImpl::doSetComponentTreeTypeIds(const ComponentPtr &com
         component->setId(id);
         auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
         entry->mPimpl->setComponent(component);
-        mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+        mIdList.add(id, convertToWeak(entry));
     }
     if (assignEncapsulationId(component, type, all)) {
         auto id = makeUniqueId();
         component->setEncapsulationId(id);
         auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
         entry->mPimpl->setComponentRef(component);
-        mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+        mIdList.add(id, convertToWeak(entry));
     }
     if ((type == CellmlElementType::VARIABLE) || all) {
         for (size_t vIndex = 0; vIndex < component->variableCount(); ++vIndex) {
@@ -894,7 +870,7 @@ void Annotator::AnnotatorImpl::doSetComponentTreeTypeIds(const ComponentPtr &com
                 v->setId(id);
                 auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
                 entry->mPimpl->setVariable(v);
-                mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+                mIdList.add(id, convertToWeak(entry));
             }
         }
     }
@@ -908,7 +884,7 @@ void Annotator::AnnotatorImpl::doSetComponentTreeTypeIds(const ComponentPtr &com
                 Variable::setEquivalenceConnectionId(v1, v2, id);
                 auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
                 entry->mPimpl->setConnection(v1, v2);
-                mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+                mIdList.add(id, convertToWeak(entry));
             }
             if (((type == CellmlElementType::MAP_VARIABLES) || all)
                 && Variable::equivalenceMappingId(v1, v2).empty()) {
@@ -916,7 +892,7 @@ void Annotator::AnnotatorImpl::doSetComponentTreeTypeIds(const ComponentPtr &com
                 Variable::setEquivalenceMappingId(v1, v2, id);
                 auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
                 entry->mPimpl->setMapVariables(v1, v2);
-                mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+                mIdList.add(id, convertToWeak(entry));
             }
         }
     }
@@ -928,7 +904,7 @@ void Annotator::AnnotatorImpl::doSetComponentTreeTypeIds(const ComponentPtr &com
             r->setId(id);
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setReset(r);
-            mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+            mIdList.add(id, convertToWeak(entry));
         }
         if (((type == CellmlElementType::RESET_VALUE) || all)
             && r->resetValueId().empty()) {
@@ -936,7 +912,7 @@ void Annotator::AnnotatorImpl::doSetComponentTreeTypeIds(const ComponentPtr &com
             r->setResetValueId(id);
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setResetValue(r);
-            mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+            mIdList.add(id, convertToWeak(entry));
         }
         if (((type == CellmlElementType::TEST_VALUE) || all)
             && r->testValueId().empty()) {
@@ -944,7 +920,7 @@ void Annotator::AnnotatorImpl::doSetComponentTreeTypeIds(const ComponentPtr &com
             r->setTestValueId(id);
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setTestValue(r);
-            mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+            mIdList.add(id, convertToWeak(entry));
         }
     }
 
@@ -964,7 +940,7 @@ void Annotator::AnnotatorImpl::doSetImportSourceIds()
             importSource->setId(id);
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setImportSource(importSource);
-            mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+            mIdList.add(id, convertToWeak(entry));
         }
     }
 }
@@ -980,7 +956,7 @@ void Annotator::AnnotatorImpl::doSetUnitsIds()
             us->setId(id);
             auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
             entry->mPimpl->setUnits(us);
-            mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+            mIdList.add(id, convertToWeak(entry));
         }
     }
 }
@@ -996,7 +972,7 @@ void Annotator::AnnotatorImpl::doSetUnitsItemIds()
                 us->setUnitId(i, id);
                 auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
                 entry->mPimpl->setUnitsItem(UnitsItem::create(us, i));
-                mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+                mIdList.add(id, convertToWeak(entry));
             }
         }
     }
@@ -1010,7 +986,7 @@ void Annotator::AnnotatorImpl::doSetEncapsulationIds()
         model->setEncapsulationId(id);
         auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
         entry->mPimpl->setEncapsulation(model);
-        mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+        mIdList.add(id, convertToWeak(entry));
     }
 }
 
@@ -1022,7 +998,7 @@ void Annotator::AnnotatorImpl::doSetModelIds()
         model->setId(id);
         auto entry = AnyCellmlElement::AnyCellmlElementImpl::create();
         entry->mPimpl->setModel(model);
-        mIdList.insert(std::make_pair(id, convertToWeak(entry)));
+        mIdList.add(id, convertToWeak(entry));
     }
 }
 
@@ -1296,10 +1272,10 @@ bool Annotator::AnnotatorImpl::validItem(const AnyCellmlElementPtr &item)
 
 void Annotator::AnnotatorImpl::removeId(const AnyCellmlElementPtr &item, const std::string &id)
 {
-    auto range = mIdList.equal_range(id);
-    for (auto it = range.first; it != range.second; ++it) {
-        if ((it->second->type() == item->type()) && itemsEqual(it->second, item)) {
-            mIdList.erase(it);
+    const auto &items = mIdList.items(id);
+    for (size_t i = 0; i < items.size(); ++i) {
+        if ((items[i]->type() == item->type()) && itemsEqual(items[i], item)) {
+            mIdList.remove(id, i);
             break;
         }
     }
@@ -1324,7 +1300,7 @@ std::string Annotator::AnnotatorImpl::setAutoId(const AnyCellmlElementPtr &item)
             }
 
             setId(item, newId);
-            mIdList.insert(std::make_pair(newId, convertToWeak(item)));
+            mIdList.add(newId, convertToWeak(item));
         } else {
             addIssueNoModel();
         }
@@ -1415,62 +1391,6 @@ size_t Annotator::itemCount(const std::string &id)
     return pFunc()->mIdList.count(id);
 }
 
-void Annotator::AnnotatorImpl::doUpdateComponentHash(const ComponentPtr &component, std::string &idsString)
-{
-    for (size_t i = 0; i < component->variableCount(); ++i) {
-        idsString += "v=" + std::to_string(i) + component->variable(i)->id();
-    }
-
-    for (size_t i = 0; i < component->resetCount(); ++i) {
-        auto reset = component->reset(i);
-        idsString += "r=" + std::to_string(i) + reset->id() + "rv=" + reset->resetValueId() + "tv=" + reset->testValueId();
-    }
-
-    // Note that MathML identifiers are not yet included.
-
-    for (size_t i = 0; i < component->componentCount(); ++i) {
-        auto child = component->component(i);
-        idsString += "c=" + std::to_string(i) + child->id() + "ce=" + child->encapsulationId();
-        doUpdateComponentHash(child, idsString);
-    }
-}
-
-size_t Annotator::AnnotatorImpl::generateHash()
-{
-    // Serialise the stored model into a (very) simplified string of identifier-based items, and create a hash.
-    size_t hash = 0;
-    auto model = mModel.lock();
-    if (model != nullptr) {
-        std::string idsString;
-        size_t i;
-        idsString += "m=" + model->id() + "me=" + model->encapsulationId();
-
-        auto importSources = getAllImportSources(model);
-        i = 0;
-        for (auto &importSource : importSources) {
-            idsString += "i=" + std::to_string(++i) + importSource->id();
-        }
-
-        for (i = 0; i < model->unitsCount(); ++i) {
-            auto units = model->units(i);
-            idsString += "U=" + std::to_string(i) + units->id();
-            for (size_t j = 0; j < units->unitCount(); ++j) {
-                idsString += "u=" + std::to_string(j) + units->unitId(j);
-            }
-        }
-
-        for (i = 0; i < model->componentCount(); ++i) {
-            auto component = model->component(i);
-            idsString += "c=" + std::to_string(i) + component->id();
-            idsString += "cr=" + std::to_string(i) + component->encapsulationId();
-            doUpdateComponentHash(component, idsString);
-        }
-
-        hash = std::hash<std::string> {}(idsString);
-    }
-    return hash;
-}
-
 bool Annotator::hasModel() const
 {
     return !pFunc()->mModel.expired();
@@ -52,7 +52,11 @@ public:
     /**
      * @brief Analyse the @ref Model.
      *
-     * Analyse the @ref Model using this @ref Analyser.
+     * Analyse the @ref Model using this @ref Analyser.  The @ref Model is
+     * first validated, with the validation issues being streamed to the issue
+     * callback, if any, as they would by a @ref Validator.  Should the
+     * streaming of issues get cancelled, the analysis stops and the type of
+     * the @ref AnalyserModel may remain AnalyserModel::Type::UNKNOWN.
      *
      * @param model The @ref Model to analyse.
      */
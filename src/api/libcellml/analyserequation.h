@@ -165,6 +165,29 @@ public:
      */
     bool isStateRateBased() const;
 
+    /**
+     * @brief Get the state on which this @ref AnalyserEquation solely depends.
+     *
+     * Return the state on which this @ref AnalyserEquation solely depends,
+     * should it be an algebraic equation which right-hand side depends on one
+     * state and literals only, and which involves at least one expensive
+     * function (e.g. an exponential). Such an equation can be evaluated using
+     * a lookup table indexed by the value of the state. An equation which
+     * right-hand side also depends on a constant or a computed constant is
+     * not tabulated since its lookup table would go stale should the value of
+     * that constant or computed constant change.
+     *
+     * Only whole equations are considered, i.e. an algebraic equation that
+     * computes one variable which right-hand side as a whole qualifies. A
+     * single-state subexpression of an equation that doesn't qualify (e.g.
+     * the exponential in an equation that also depends on another state) is
+     * not tabulated.
+     *
+     * @return The state, if this @ref AnalyserEquation solely depends on one,
+     * @c nullptr otherwise.
+     */
+    AnalyserVariablePtr lookupTableState() const;
+
     /**
      * @brief Get the number of variables computed by this @ref AnalyserEquation.
      *
@@ -129,6 +129,17 @@ public:
      */
     std::vector<AnalyserVariablePtr> states() const;
 
+    /**
+     * @brief Get the states, by reference.
+     *
+     * Return a reference to the states in the @ref AnalyserModel, thus
+     * avoiding the copy made by states(). The reference remains valid for as
+     * long as the @ref AnalyserModel exists.
+     *
+     * @return The states as a reference to a @c std::vector.
+     */
+    const std::vector<AnalyserVariablePtr> &statesRef() const;
+
     /**
      * @brief Get the state at @p index.
      *
@@ -159,6 +170,17 @@ public:
      */
     std::vector<AnalyserVariablePtr> variables() const;
 
+    /**
+     * @brief Get the variables, by reference.
+     *
+     * Return a reference to the variables in the @ref AnalyserModel, thus
+     * avoiding the copy made by variables(). The reference remains valid for as
+     * long as the @ref AnalyserModel exists.
+     *
+     * @return The variables as a reference to a @c std::vector.
+     */
+    const std::vector<AnalyserVariablePtr> &variablesRef() const;
+
     /**
      * @brief Get the variable at @p index.
      *
@@ -189,6 +211,17 @@ public:
      */
     std::vector<AnalyserEquationPtr> equations() const;
 
+    /**
+     * @brief Get the equations, by reference.
+     *
+     * Return a reference to the equations in the @ref AnalyserModel, thus
+     * avoiding the copy made by equations(). The reference remains valid for as
+     * long as the @ref AnalyserModel exists.
+     *
+     * @return The equations as a reference to a @c std::vector.
+     */
+    const std::vector<AnalyserEquationPtr> &equationsRef() const;
+
     /**
      * @brief Get the equation at @p index.
      *
@@ -201,6 +234,95 @@ public:
      */
     AnalyserEquationPtr equation(size_t index) const;
 
+    /**
+     * @brief Get the number of non-zero entries in the Jacobian.
+     *
+     * Return the number of non-zero entries in the Jacobian of the rates with
+     * respect to the states of the @ref AnalyserModel, i.e. the number of
+     * (rate, state) pairs for which the rate depends on the state.
+     *
+     * @return The number of non-zero entries in the Jacobian.
+     */
+    size_t jacobianNonZeroCount() const;
+
+    /**
+     * @brief Get the row offsets of the sparsity pattern of the Jacobian.
+     *
+     * Return the row offsets of the sparsity pattern of the Jacobian of the
+     * rates with respect to the states of the @ref AnalyserModel, using the
+     * compressed sparse row (CSR) format. There are @ref stateCount + 1 row
+     * offsets and the column indices of the states on which the rate at index
+     * @c i depends are stored from @c jacobianColumnIndices()[rowOffsets[i]] to
+     * @c jacobianColumnIndices()[rowOffsets[i+1]-1].
+     *
+     * The sparsity pattern accounts for the dependencies of a rate on the
+     * states, whether directly or through the algebraic variables on which it
+     * depends. It is computed the first time it is needed and then cached.
+     *
+     * @return The row offsets as a @c std::vector.
+     */
+    std::vector<size_t> jacobianRowOffsets() const;
+
+    /**
+     * @brief Get the column indices of the sparsity pattern of the Jacobian.
+     *
+     * Return the column indices of the sparsity pattern of the Jacobian of the
+     * rates with respect to the states of the @ref AnalyserModel, using the
+     * compressed sparse row (CSR) format. The column indices of a given row
+     * are sorted in ascending order.
+     *
+     * @sa jacobianRowOffsets
+     *
+     * @return The column indices as a @c std::vector.
+     */
+    std::vector<size_t> jacobianColumnIndices() const;
+
+    /**
+     * @brief Get the states on which the rate at @p index depends.
+     *
+     * Return the states on which the rate at index @p index depends, whether
+     * directly or through the algebraic variables on which it depends.
+     *
+     * @param index The index of the rate for which we want the states.
+     *
+     * @return The states as a @c std::vector.
+     */
+    std::vector<AnalyserVariablePtr> stateDependencies(size_t index) const;
+
+    /**
+     * @brief Get the row offsets of the dependency structure of the equations.
+     *
+     * Return the row offsets of the dependency structure of the equations of
+     * the @ref AnalyserModel, using the compressed sparse row (CSR) format.
+     * There are @ref equationCount + 1 row offsets and the indices of the
+     * equations on which the equation at index @c i directly depends are stored
+     * from @c equationDependencyColumnIndices()[rowOffsets[i]] to
+     * @c equationDependencyColumnIndices()[rowOffsets[i+1]-1].
+     *
+     * Dependencies on ODE equations are not included since they correspond to
+     * states, which are inputs of the model. Similarly, the NLA siblings of an
+     * equation are not included since they are solved together. The resulting
+     * structure is a directed acyclic graph. It is computed the first time it
+     * is needed and then cached.
+     *
+     * @return The row offsets as a @c std::vector.
+     */
+    std::vector<size_t> equationDependencyRowOffsets() const;
+
+    /**
+     * @brief Get the column indices of the dependency structure of the
+     * equations.
+     *
+     * Return the column indices of the dependency structure of the equations of
+     * the @ref AnalyserModel, using the compressed sparse row (CSR) format. The
+     * column indices of a given row are sorted in ascending order.
+     *
+     * @sa equationDependencyRowOffsets
+     *
+     * @return The column indices as a @c std::vector.
+     */
+    std::vector<size_t> equationDependencyColumnIndices() const;
+
     /**
      * @brief Test to determine if @ref AnalyserModel needs an "equal to"
      * function.
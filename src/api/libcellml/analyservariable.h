@@ -29,6 +29,7 @@ namespace libcellml {
 class LIBCELLML_EXPORT AnalyserVariable
 {
     friend class Analyser;
+    friend class Generator;
 
 public:
     /**
@@ -119,6 +120,21 @@ public:
      */
     VariablePtr variable() const;
 
+    /**
+     * @brief Test to determine if this @ref AnalyserVariable is a gating
+     * variable.
+     *
+     * Test to determine if this @ref AnalyserVariable is a gating variable,
+     * i.e. a state which ODE is of the form
+     * @c dy/dt = alpha*(1-y)-beta*y or @c dy/dt = (y_inf-y)/tau, with
+     * @c alpha, @c beta, @c y_inf and @c tau independent of @c y. Such a state
+     * can be integrated using the Rush-Larsen method.
+     *
+     * @return @c true if this @ref AnalyserVariable is a gating variable,
+     * @c false otherwise.
+     */
+    bool isGatingVariable() const;
+
     /**
      * @brief Get the number of equations used to compute this @ref AnalyserVariable.
      *
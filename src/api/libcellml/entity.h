@@ -31,6 +31,10 @@ namespace libcellml {
  */
 class LIBCELLML_EXPORT Entity
 {
+    friend class IdIndexBase;
+    friend class ImportedEntity;
+    friend class Validator;
+
 public:
     virtual ~Entity() = 0; /**< Destructor. */
     Entity(const Entity &rhs) = delete; /**< Copy constructor. */
@@ -85,6 +85,353 @@ public:
      */
     void setModel(const AnalyserModelPtr &model);
 
+    /**
+     * @brief Add a lookup table for the given @p variable.
+     *
+     * Add a lookup table for the given @p variable, which is to cover the range
+     * [@p minimum, @p maximum] using the given @p step. A lookup table is only
+     * used if the given @p variable is (equivalent to) a state of the
+     * @ref AnalyserModel, in which case the algebraic equations which
+     * @ref AnalyserEquation::lookupTableState is that state are tabulated
+     * rather than evaluated. Values are linearly interpolated and a state value
+     * outside of the range of the lookup table is clamped to that range.
+     *
+     * The lookup tables are initialised in a generated method, which is to be
+     * called after computed constants have been computed and which returns the
+     * maximum interpolation error of the lookup tables.
+     *
+     * @param variable The @ref Variable for which to add a lookup table.
+     * @param minimum The minimum value covered by the lookup table.
+     * @param maximum The maximum value covered by the lookup table.
+     * @param step The step between two consecutive values of the lookup table.
+     *
+     * @return @c true if the lookup table was added, @c false otherwise (e.g.
+     * the @p variable is @c nullptr, the range or step is not valid, or the
+     * @p variable already has a lookup table).
+     */
+    bool addLookupTable(const VariablePtr &variable, double minimum,
+                        double maximum, double step);
+
+    /**
+     * @brief Remove the lookup table for the given @p variable.
+     *
+     * Remove the lookup table for the given @p variable.
+     *
+     * @param variable The @ref Variable which lookup table is to be removed.
+     *
+     * @return @c true if the lookup table was removed, @c false otherwise.
+     */
+    bool removeLookupTable(const VariablePtr &variable);
+
+    /**
+     * @brief Remove all the lookup tables from this @ref Generator.
+     *
+     * Clear all the lookup tables that have been added to this
+     * @ref Generator.
+     */
+    void removeAllLookupTables();
+
+    /**
+     * @brief Test if the given @p variable has a lookup table.
+     *
+     * Test if the given @p variable has a lookup table in this
+     * @ref Generator.
+     *
+     * @param variable The @ref Variable to test.
+     *
+     * @return @c true if the @p variable has a lookup table, @c false
+     * otherwise.
+     */
+    bool containsLookupTable(const VariablePtr &variable) const;
+
+    /**
+     * @brief Get the number of lookup tables.
+     *
+     * Return the number of lookup tables that have been added to this
+     * @ref Generator.
+     *
+     * @return The number of lookup tables.
+     */
+    size_t lookupTableCount() const;
+
+    /**
+     * @brief Test if this @ref Generator specialises constants.
+     *
+     * Test if this @ref Generator specialises constants, i.e. evaluates the
+     * value of the constants and computed constants of the
+     * @ref AnalyserModel at generation time and uses those values as literals
+     * in the generated code.
+     *
+     * @return @c true if this @ref Generator specialises constants, @c false
+     * otherwise.
+     */
+    bool hasConstantSpecialisation() const;
+
+    /**
+     * @brief Set whether this @ref Generator specialises constants.
+     *
+     * Set whether this @ref Generator specialises constants. If so, the value
+     * of a constant is either its initial value or the value of its constant
+     * override, if any, while the value of a computed constant is evaluated at
+     * generation time. Those values are then used as literals rather than read
+     * from the variables array, thus allowing a compiler to fold them. The
+     * variables array is still initialised with those values. A computed
+     * constant which value cannot be evaluated at generation time (e.g. it
+     * depends on an external variable or is computed using an NLA system) is
+     * not specialised.
+     *
+     * @param constantSpecialisation A @c bool to determine whether this
+     * @ref Generator specialises constants.
+     */
+    void setConstantSpecialisation(bool constantSpecialisation);
+
+    /**
+     * @brief Add a constant override for the given @p variable.
+     *
+     * Add a constant override for the given @p variable. A constant override
+     * is only used if constants are specialised and the given @p variable is
+     * (equivalent to) a constant of the @ref AnalyserModel, in which case the
+     * given @p value, expressed in the units of that constant, is used
+     * instead of the initial value of that constant.
+     *
+     * @sa setConstantSpecialisation
+     *
+     * @param variable The @ref Variable for which to add a constant override.
+     * @param value The value of the constant override.
+     *
+     * @return @c true if the constant override was added, @c false otherwise
+     * (e.g. the @p variable is @c nullptr or the @p variable already has a
+     * constant override).
+     */
+    bool addConstantOverride(const VariablePtr &variable, double value);
+
+    /**
+     * @brief Remove the constant override for the given @p variable.
+     *
+     * Remove the constant override for the given @p variable.
+     *
+     * @param variable The @ref Variable which constant override is to be
+     * removed.
+     *
+     * @return @c true if the constant override was removed, @c false
+     * otherwise.
+     */
+    bool removeConstantOverride(const VariablePtr &variable);
+
+    /**
+     * @brief Remove all the constant overrides from this @ref Generator.
+     *
+     * Clear all the constant overrides that have been added to this
+     * @ref Generator.
+     */
+    void removeAllConstantOverrides();
+
+    /**
+     * @brief Test if the given @p variable has a constant override.
+     *
+     * Test if the given @p variable has a constant override in this
+     * @ref Generator.
+     *
+     * @param variable The @ref Variable to test.
+     *
+     * @return @c true if the @p variable has a constant override, @c false
+     * otherwise.
+     */
+    bool containsConstantOverride(const VariablePtr &variable) const;
+
+    /**
+     * @brief Get the number of constant overrides.
+     *
+     * Return the number of constant overrides that have been added to this
+     * @ref Generator.
+     *
+     * @return The number of constant overrides.
+     */
+    size_t constantOverrideCount() const;
+
+    /**
+     * @brief Add an ensemble parameter for the given @p variable.
+     *
+     * Add an ensemble parameter for the given @p variable. An ensemble
+     * parameter is only used if the given @p variable is (equivalent to) a
+     * constant of the @ref AnalyserModel, in which case each instance of an
+     * ensemble gets its own value for that constant.
+     *
+     * If there is at least one ensemble parameter and the @ref AnalyserModel
+     * has some ODEs, no external variables, and no lookup tables in use, then
+     * methods to initialise an ensemble and to compute its rates and variables
+     * are generated. Those methods work on a parameter matrix (instances x
+     * ensemble parameters, in the order in which the ensemble parameters were
+     * added) and on states, rates, and variables matrices, which are all laid
+     * out one instance after the other, so that the data of an instance is
+     * contiguous in memory. The instances may be distributed among threads
+     * using OpenMP, in which case each thread processes blocks of consecutive
+     * instances which data fits in an L1 cache.
+     *
+     * An ensemble parameter is never specialised, even if constants are
+     * specialised.
+     *
+     * @sa setConstantSpecialisation
+     *
+     * @param variable The @ref Variable for which to add an ensemble
+     * parameter.
+     *
+     * @return @c true if the ensemble parameter was added, @c false otherwise
+     * (e.g. the @p variable is @c nullptr or the @p variable is already an
+     * ensemble parameter).
+     */
+    bool addEnsembleParameter(const VariablePtr &variable);
+
+    /**
+     * @brief Remove the ensemble parameter for the given @p variable.
+     *
+     * Remove the ensemble parameter for the given @p variable.
+     *
+     * @param variable The @ref Variable which ensemble parameter is to be
+     * removed.
+     *
+     * @return @c true if the ensemble parameter was removed, @c false
+     * otherwise.
+     */
+    bool removeEnsembleParameter(const VariablePtr &variable);
+
+    /**
+     * @brief Remove all the ensemble parameters from this @ref Generator.
+     *
+     * Clear all the ensemble parameters that have been added to this
+     * @ref Generator.
+     */
+    void removeAllEnsembleParameters();
+
+    /**
+     * @brief Test if the given @p variable is an ensemble parameter.
+     *
+     * Test if the given @p variable is an ensemble parameter in this
+     * @ref Generator.
+     *
+     * @param variable The @ref Variable to test.
+     *
+     * @return @c true if the @p variable is an ensemble parameter, @c false
+     * otherwise.
+     */
+    bool containsEnsembleParameter(const VariablePtr &variable) const;
+
+    /**
+     * @brief Get the number of ensemble parameters.
+     *
+     * Return the number of ensemble parameters that have been added to this
+     * @ref Generator.
+     *
+     * @return The number of ensemble parameters.
+     */
+    size_t ensembleParameterCount() const;
+
+    /**
+     * @brief Add a sensitivity parameter for the given @p variable.
+     *
+     * Add a sensitivity parameter for the given @p variable. A sensitivity
+     * parameter is only used if the given @p variable is (equivalent to) a
+     * constant of the @ref AnalyserModel, in which case the forward
+     * sensitivity of each state with respect to that constant, i.e.
+     * d(state)/d(constant), is computed alongside the states.
+     *
+     * If there is at least one sensitivity parameter and the
+     * @ref AnalyserModel has some ODEs and no external variables, and if its
+     * rates don't rely on an NLA system or on other rates, then the
+     * sensitivities are appended to the states array, one block of states per
+     * sensitivity parameter (in the order in which the sensitivity parameters
+     * were added), and their rates are computed in the generated method to
+     * compute the rates, by differentiating the equations needed to compute
+     * the rates with respect to the sensitivity parameters. Thus, integrating
+     * the model also integrates the sensitivities.
+     *
+     * @param variable The @ref Variable for which to add a sensitivity
+     * parameter.
+     *
+     * @return @c true if the sensitivity parameter was added, @c false
+     * otherwise (e.g. the @p variable is @c nullptr or the @p variable is
+     * already a sensitivity parameter).
+     */
+    bool addSensitivityParameter(const VariablePtr &variable);
+
+    /**
+     * @brief Remove the sensitivity parameter for the given @p variable.
+     *
+     * Remove the sensitivity parameter for the given @p variable.
+     *
+     * @param variable The @ref Variable which sensitivity parameter is to be
+     * removed.
+     *
+     * @return @c true if the sensitivity parameter was removed, @c false
+     * otherwise.
+     */
+    bool removeSensitivityParameter(const VariablePtr &variable);
+
+    /**
+     * @brief Remove all the sensitivity parameters from this @ref Generator.
+     *
+     * Clear all the sensitivity parameters that have been added to this
+     * @ref Generator.
+     */
+    void removeAllSensitivityParameters();
+
+    /**
+     * @brief Test if the given @p variable is a sensitivity parameter.
+     *
+     * Test if the given @p variable is a sensitivity parameter in this
+     * @ref Generator.
+     *
+     * @param variable The @ref Variable to test.
+     *
+     * @return @c true if the @p variable is a sensitivity parameter, @c false
+     * otherwise.
+     */
+    bool containsSensitivityParameter(const VariablePtr &variable) const;
+
+    /**
+     * @brief Get the number of sensitivity parameters.
+     *
+     * Return the number of sensitivity parameters that have been added to
+     * this @ref Generator.
+     *
+     * @return The number of sensitivity parameters.
+     */
+    size_t sensitivityParameterCount() const;
+
+    /**
+     * @brief Get the number of chunks of the implementation code.
+     *
+     * Return the number of chunks into which this @ref Generator partitions
+     * the implementation code.
+     *
+     * @return The number of chunks of the implementation code.
+     */
+    size_t implementationChunkCount() const;
+
+    /**
+     * @brief Set the number of chunks of the implementation code.
+     *
+     * Set the number of chunks into which this @ref Generator partitions the
+     * implementation code, zero (the default) meaning that the implementation
+     * code is not partitioned. If so, the equations computed in
+     * computeRates() and computeVariables() are spread, along their dependency
+     * order, over chunk methods, which are called by those methods and which
+     * definition is to be found in one of the chunks of the implementation
+     * code, so that those chunks can be compiled in parallel. An equation which
+     * relies on a root finding method, a lookup table, or an
+     * arithmetic/trigonometric function is always computed in the
+     * implementation code itself, as are the equations of computeRates() if
+     * local variables are in use. If the @ref GeneratorProfile doesn't require
+     * an interface to be generated, then the chunk methods are defined in the
+     * implementation code itself.
+     *
+     * @sa implementationChunkCode
+     *
+     * @param implementationChunkCount The number of chunks of the
+     * implementation code.
+     */
+    void setImplementationChunkCount(size_t implementationChunkCount);
+
     /**
      * @brief Get the interface code for the @ref AnalyserModel.
      *
@@ -105,6 +452,23 @@ public:
      */
     std::string implementationCode() const;
 
+    /**
+     * @brief Get the code for the chunk at the given @p index.
+     *
+     * Return the code for the chunk, at the given @p index, of the
+     * implementation code for the @ref AnalyserModel, using the
+     * @ref GeneratorProfile.
+     *
+     * @sa setImplementationChunkCount
+     *
+     * @param index The index of the chunk of the implementation code.
+     *
+     * @return The code for the chunk as a @c std::string, or an empty string
+     * if the @p index is out of range or the @ref GeneratorProfile doesn't
+     * require an interface to be generated.
+     */
+    std::string implementationChunkCode(size_t index) const;
+
     /**
      * @brief Get the equation code for the given @ref AnalyserEquationAst.
      *
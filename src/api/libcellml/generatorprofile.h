@@ -30,18 +30,50 @@ namespace libcellml {
  */
 class LIBCELLML_EXPORT GeneratorProfile
 {
+    friend class Generator;
+
 public:
     /**
      * @brief The type of a profile.
      *
      * A profile can be of one of the following types:
-     *  - C: a profile that targets the C language; or
-     *  - PYTHON: a profile that targets the Python language.
+     *  - C: a profile that targets the C language;
+     *  - PYTHON: a profile that targets the Python language;
+     *  - CPP: a profile that targets the C++ language, generating a header-only
+     *    file where the kernels are inline function templates on their scalar
+     *    type, e.g. @c double, @c float, a SIMD vector type, or a dual number
+     *    type for automatic differentiation; or
+     *  - NUMPY: a profile that targets the Python language using NumPy, where
+     *    the states, rates, and variables arrays are 2-D arrays with the
+     *    instances of a model along their last axis, so that the generated
+     *    code computes all of them at once (lookup tables are not supported
+     *    by this profile since they would need to be tabulated for each
+     *    instance).
      */
     enum class Profile
     {
         C,
-        PYTHON
+        PYTHON,
+        CPP,
+        NUMPY
+    };
+
+    /**
+     * @brief The precision of a profile.
+     *
+     * A profile can use one of the following precisions:
+     *  - DOUBLE: all floating-point values are in double precision;
+     *  - SINGLE: all floating-point values are in single precision; or
+     *  - MIXED: the variable of integration, states, and rates are in double
+     *    precision while all the other variables are in single precision.
+     *
+     * Only the C profile makes use of the precision.
+     */
+    enum class Precision
+    {
+        DOUBLE,
+        SINGLE,
+        MIXED
     };
 
     ~GeneratorProfile(); /**< Destructor, @private. */
@@ -92,6 +124,38 @@ public:
      */
     void setProfile(Profile profile);
 
+    /**
+     * @brief Get the @ref Precision for this @ref GeneratorProfile.
+     *
+     * Return the @ref Precision for this @ref GeneratorProfile.
+     *
+     * @return The @ref Precision for this @ref GeneratorProfile.
+     */
+    Precision precision() const;
+
+    /**
+     * @brief Get the string version of a @ref Precision.
+     *
+     * Return the string version of a @ref Precision.
+     *
+     * @param precision The precision for which we want the string version.
+     *
+     * @return The string version of the @ref Precision.
+     */
+    static std::string precisionAsString(Precision precision);
+
+    /**
+     * @brief Set the @ref Precision.
+     *
+     * Set the @ref Precision of this @ref GeneratorProfile. The profile is
+     * reloaded, i.e. any customisation of the profile is lost, and, for the C
+     * profile, its floating-point types, mathematical functions, and literals
+     * are adapted to the given @ref Precision.
+     *
+     * @param precision The @ref Precision to use.
+     */
+    void setPrecision(Precision precision);
+
     // Whether the profile requires an interface to be generated.
 
     /**
@@ -119,6 +183,97 @@ public:
      */
     void setHasInterface(bool hasInterface);
 
+    /**
+     * @brief Test if this @ref GeneratorProfile requires a method to compute
+     * the Rush-Larsen coefficients to be generated.
+     *
+     * Test if this @ref GeneratorProfile requires a method to compute the
+     * Rush-Larsen coefficients (i.e. the time constant and steady-state value)
+     * of the gating variables to be generated.
+     *
+     * @return @c true if the @ref GeneratorProfile requires a method to compute
+     * the Rush-Larsen coefficients to be generated,
+     * @c false otherwise.
+     */
+    bool hasComputeRushLarsenCoefficientsMethod() const;
+
+    /**
+     * @brief Set whether this @ref GeneratorProfile requires a method to
+     * compute the Rush-Larsen coefficients to be generated.
+     *
+     * Set whether this @ref GeneratorProfile requires a method to compute the
+     * Rush-Larsen coefficients (i.e. the time constant and steady-state value)
+     * of the gating variables to be generated.
+     *
+     * @param hasComputeRushLarsenCoefficientsMethod A @c bool to determine
+     * whether this @ref GeneratorProfile requires a method to compute the
+     * Rush-Larsen coefficients to be generated.
+     */
+    void setHasComputeRushLarsenCoefficientsMethod(bool hasComputeRushLarsenCoefficientsMethod);
+
+    /**
+     * @brief Test if this @ref GeneratorProfile keeps purely intermediate
+     * algebraic variables as local variables in computeRates().
+     *
+     * Test if this @ref GeneratorProfile keeps the algebraic variables that are
+     * purely intermediate (i.e. which are neither needed by a non-linear
+     * algebraic system nor by computeRushLarsenCoefficients()) as local
+     * variables in computeRates(), rather than as entries of the variables
+     * array. Those variables are then only written back to the variables array
+     * in computeVariables().
+     *
+     * @return @c true if the @ref GeneratorProfile keeps purely intermediate
+     * algebraic variables as local variables in computeRates(), @c false
+     * otherwise.
+     */
+    bool hasLocalVariablesInComputeRates() const;
+
+    /**
+     * @brief Set whether this @ref GeneratorProfile keeps purely intermediate
+     * algebraic variables as local variables in computeRates().
+     *
+     * Set whether this @ref GeneratorProfile keeps the algebraic variables that
+     * are purely intermediate (i.e. which are neither needed by a non-linear
+     * algebraic system nor by computeRushLarsenCoefficients()) as local
+     * variables in computeRates(), rather than as entries of the variables
+     * array. This has no effect on models with external variables.
+     *
+     * @param hasLocalVariablesInComputeRates A @c bool to determine whether
+     * this @ref GeneratorProfile keeps purely intermediate algebraic variables
+     * as local variables in computeRates().
+     */
+    void setHasLocalVariablesInComputeRates(bool hasLocalVariablesInComputeRates);
+
+    /**
+     * @brief Test if this @ref GeneratorProfile requires fixed-step integration
+     * methods to be generated.
+     *
+     * Test if this @ref GeneratorProfile requires methods to integrate the
+     * model over a number of steps of constant size, using the forward Euler,
+     * fourth-order Runge-Kutta, and Rush-Larsen (if a method to compute the
+     * Rush-Larsen coefficients is also generated) methods, to be generated.
+     *
+     * @return @c true if the @ref GeneratorProfile requires fixed-step
+     * integration methods to be generated, @c false otherwise.
+     */
+    bool hasIntegrateMethods() const;
+
+    /**
+     * @brief Set whether this @ref GeneratorProfile requires fixed-step
+     * integration methods to be generated.
+     *
+     * Set whether this @ref GeneratorProfile requires methods to integrate the
+     * model over a number of steps of constant size, using the forward Euler,
+     * fourth-order Runge-Kutta, and Rush-Larsen (if a method to compute the
+     * Rush-Larsen coefficients is also generated) methods, to be generated.
+     * This has no effect on models with external variables.
+     *
+     * @param hasIntegrateMethods A @c bool to determine whether this
+     * @ref GeneratorProfile requires fixed-step integration methods to be
+     * generated.
+     */
+    void setHasIntegrateMethods(bool hasIntegrateMethods);
+
     // Equality.
 
     /**
@@ -1698,6 +1853,26 @@ public:
      */
     void setNanString(const std::string &nanString);
 
+    /**
+     * @brief Get the @c std::string for the suffix of a floating-point literal.
+     *
+     * Return the @c std::string for the suffix of a floating-point literal.
+     *
+     * @return The @c std::string for the suffix of a floating-point literal.
+     */
+    std::string literalSuffixString() const;
+
+    /**
+     * @brief Set the @c std::string for the suffix of a floating-point literal.
+     *
+     * Set the @c std::string for the suffix of a floating-point literal. For
+     * example, "f" for single-precision literals in C.
+     *
+     * @param literalSuffixString The @c std::string to use for the suffix of a
+     * floating-point literal.
+     */
+    void setLiteralSuffixString(const std::string &literalSuffixString);
+
     // Arithmetic functions.
 
     /**
@@ -2325,6 +2500,80 @@ public:
      */
     void setImplementationHeaderString(const std::string &implementationHeaderString);
 
+    /**
+     * @brief Get the @c std::string for the name of a namespace.
+     *
+     * Return the @c std::string for the name of the namespace in which the
+     * implementation code is generated.
+     *
+     * @return The @c std::string for the name of a namespace.
+     */
+    std::string namespaceString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of a namespace.
+     *
+     * Set the @c std::string for the name of the namespace in which the
+     * implementation code is generated. If empty, the name of the model is
+     * used instead, so that the code generated for different models can be
+     * used in the same program. Any method that the generated code expects to
+     * be provided, e.g. nlaSolve(), must be defined in that namespace.
+     *
+     * @sa setImplementationNamespaceBeginString
+     *
+     * @param namespaceString The @c std::string to use for the name of a
+     * namespace.
+     */
+    void setNamespaceString(const std::string &namespaceString);
+
+    /**
+     * @brief Get the @c std::string for the beginning of a namespace.
+     *
+     * Return the @c std::string for the beginning of a namespace.
+     *
+     * @return The @c std::string for the beginning of a namespace.
+     */
+    std::string implementationNamespaceBeginString() const;
+
+    /**
+     * @brief Set the @c std::string for the beginning of a namespace.
+     *
+     * Set the @c std::string for the beginning of the namespace in which the
+     * implementation code is generated. To be useful, the string should
+     * contain the [NAMESPACE] tag, which will be replaced with the name of the
+     * namespace. No namespace is generated if this string or the one for the
+     * end of a namespace is empty.
+     *
+     * @sa namespaceString
+     *
+     * @param implementationNamespaceBeginString The @c std::string to use for
+     * the beginning of a namespace.
+     */
+    void setImplementationNamespaceBeginString(const std::string &implementationNamespaceBeginString);
+
+    /**
+     * @brief Get the @c std::string for the end of a namespace.
+     *
+     * Return the @c std::string for the end of a namespace.
+     *
+     * @return The @c std::string for the end of a namespace.
+     */
+    std::string implementationNamespaceEndString() const;
+
+    /**
+     * @brief Set the @c std::string for the end of a namespace.
+     *
+     * Set the @c std::string for the end of the namespace in which the
+     * implementation code is generated. The string may contain the
+     * [NAMESPACE] tag, which will be replaced with the name of the namespace.
+     *
+     * @sa namespaceString
+     *
+     * @param implementationNamespaceEndString The @c std::string to use for
+     * the end of a namespace.
+     */
+    void setImplementationNamespaceEndString(const std::string &implementationNamespaceEndString);
+
     /**
      * @brief Get the @c std::string for the interface of the version constant.
      *
@@ -2509,6 +2758,56 @@ public:
      */
     void setImplementationVariableCountString(const std::string &implementationVariableCountString);
 
+    /**
+     * @brief Get the @c std::string for the interface of the number of ensemble
+     * parameters.
+     *
+     * Return the @c std::string for the interface of the number of ensemble
+     * parameters.
+     *
+     * @return The @c std::string for the interface of the number of ensemble
+     * parameters.
+     */
+    std::string interfaceEnsembleParameterCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of the number of ensemble
+     * parameters.
+     *
+     * Set the @c std::string for the interface of the number of ensemble
+     * parameters.
+     *
+     * @param interfaceEnsembleParameterCountString The @c std::string to use
+     * for the interface of the number of ensemble parameters.
+     */
+    void setInterfaceEnsembleParameterCountString(const std::string &interfaceEnsembleParameterCountString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the number of
+     * ensemble parameters.
+     *
+     * Return the @c std::string for the implementation of the number of
+     * ensemble parameters.
+     *
+     * @return The @c std::string for the implementation of the number of
+     * ensemble parameters.
+     */
+    std::string implementationEnsembleParameterCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the number of
+     * ensemble parameters.
+     *
+     * Set the @c std::string for the implementation of the number of ensemble
+     * parameters. To be useful, the string should contain the
+     * [ENSEMBLE_PARAMETER_COUNT] tag, which will be replaced with the number of
+     * ensemble parameters in the model.
+     *
+     * @param implementationEnsembleParameterCountString The @c std::string to
+     * use for the implementation of the number of ensemble parameters.
+     */
+    void setImplementationEnsembleParameterCountString(const std::string &implementationEnsembleParameterCountString);
+
     /**
      * @brief Get the @c std::string for the data structure for the variable
      * type object.
@@ -2956,6 +3255,406 @@ public:
      */
     void setVariablesArrayString(const std::string &variablesArrayString);
 
+    /**
+     * @brief Get the @c std::string for the name of the Rush-Larsen time
+     * constants array.
+     *
+     * Return the @c std::string for the name of the Rush-Larsen time constants
+     * array.
+     *
+     * @return The @c std::string for the name of the Rush-Larsen time
+     * constants array.
+     */
+    std::string rushLarsenTausArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the Rush-Larsen time
+     * constants array.
+     *
+     * Set the @c std::string for the name of the Rush-Larsen time constants
+     * array.
+     *
+     * @param rushLarsenTausArrayString The @c std::string to use for the name
+     * of the Rush-Larsen time constants array.
+     */
+    void setRushLarsenTausArrayString(const std::string &rushLarsenTausArrayString);
+
+    /**
+     * @brief Get the @c std::string for the name of the Rush-Larsen
+     * steady-state values array.
+     *
+     * Return the @c std::string for the name of the Rush-Larsen steady-state
+     * values array.
+     *
+     * @return The @c std::string for the name of the Rush-Larsen steady-state
+     * values array.
+     */
+    std::string rushLarsenSteadyStatesArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the Rush-Larsen
+     * steady-state values array.
+     *
+     * Set the @c std::string for the name of the Rush-Larsen steady-state
+     * values array.
+     *
+     * @param rushLarsenSteadyStatesArrayString The @c std::string to use for
+     * the name of the Rush-Larsen steady-state values array.
+     */
+    void setRushLarsenSteadyStatesArrayString(const std::string &rushLarsenSteadyStatesArrayString);
+
+    /**
+     * @brief Get the @c std::string for the name of a local variable.
+     *
+     * Return the @c std::string for the name of a local variable.
+     *
+     * @return The @c std::string for the name of a local variable.
+     */
+    std::string localVariableNameString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of a local variable.
+     *
+     * Set the @c std::string for the name of a local variable. To be useful,
+     * the string should contain the [NAME] and [INDEX] tags, which will be
+     * replaced with the name of the variable and its index in the variables
+     * array, respectively.
+     *
+     * @param localVariableNameString The @c std::string to use for the name of
+     * a local variable.
+     */
+    void setLocalVariableNameString(const std::string &localVariableNameString);
+
+    /**
+     * @brief Get the @c std::string for the declaration of a local variable.
+     *
+     * Return the @c std::string for the declaration of a local variable.
+     *
+     * @return The @c std::string for the declaration of a local variable.
+     */
+    std::string localVariableDeclarationString() const;
+
+    /**
+     * @brief Set the @c std::string for the declaration of a local variable.
+     *
+     * Set the @c std::string for the declaration of a local variable. The
+     * string is inserted right before the name of the local variable when it is
+     * first assigned.
+     *
+     * @param localVariableDeclarationString The @c std::string to use for the
+     * declaration of a local variable.
+     */
+    void setLocalVariableDeclarationString(const std::string &localVariableDeclarationString);
+
+    /**
+     * @brief Get the @c std::string for updating a state using the forward
+     * Euler method.
+     *
+     * Return the @c std::string for updating a state using the forward Euler
+     * method.
+     *
+     * @return The @c std::string for updating a state using the forward Euler
+     * method.
+     */
+    std::string forwardEulerStateUpdateString() const;
+
+    /**
+     * @brief Set the @c std::string for updating a state using the forward
+     * Euler method.
+     *
+     * Set the @c std::string for updating a state using the forward Euler
+     * method. To be useful, the string should contain the [INDEX] tag, which
+     * will be replaced with the index of the state.
+     *
+     * @param forwardEulerStateUpdateString The @c std::string to use for
+     * updating a state using the forward Euler method.
+     */
+    void setForwardEulerStateUpdateString(const std::string &forwardEulerStateUpdateString);
+
+    /**
+     * @brief Get the @c std::string for updating a gating variable using the
+     * Rush-Larsen method.
+     *
+     * Return the @c std::string for updating a gating variable using the
+     * Rush-Larsen method.
+     *
+     * @return The @c std::string for updating a gating variable using the
+     * Rush-Larsen method.
+     */
+    std::string rushLarsenStateUpdateString() const;
+
+    /**
+     * @brief Set the @c std::string for updating a gating variable using the
+     * Rush-Larsen method.
+     *
+     * Set the @c std::string for updating a gating variable using the
+     * Rush-Larsen method. To be useful, the string should contain the [INDEX]
+     * tag, which will be replaced with the index of the gating variable.
+     *
+     * @param rushLarsenStateUpdateString The @c std::string to use for updating
+     * a gating variable using the Rush-Larsen method.
+     */
+    void setRushLarsenStateUpdateString(const std::string &rushLarsenStateUpdateString);
+
+    /**
+     * @brief Get the @c std::string for the name of a sensitivity.
+     *
+     * Return the @c std::string for the name of a sensitivity.
+     *
+     * @return The @c std::string for the name of a sensitivity.
+     */
+    std::string sensitivityNameString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of a sensitivity.
+     *
+     * Set the @c std::string for the name of a sensitivity. To be useful, the
+     * string should contain the [NAME] and [PARAMETER] tags, which will be
+     * replaced with the name of the state or variable and the name of the
+     * sensitivity parameter, respectively.
+     *
+     * @param sensitivityNameString The @c std::string to use for the name of a
+     * sensitivity.
+     */
+    void setSensitivityNameString(const std::string &sensitivityNameString);
+
+    /**
+     * @brief Get the @c std::string for the name of a chunk method.
+     *
+     * Return the @c std::string for the name of a chunk method.
+     *
+     * @return The @c std::string for the name of a chunk method.
+     */
+    std::string chunkMethodNameString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of a chunk method.
+     *
+     * Set the @c std::string for the name of a chunk method. To be useful, the
+     * string should contain the [NAME] and [INDEX] tags, which will be replaced
+     * with the name of the method that calls the chunk method and the index of
+     * the chunk method, respectively.
+     *
+     * @param chunkMethodNameString The @c std::string to use for the name of a
+     * chunk method.
+     */
+    void setChunkMethodNameString(const std::string &chunkMethodNameString);
+
+    /**
+     * @brief Get the @c std::string for the declaration of a lookup table.
+     *
+     * Return the @c std::string for the declaration of a lookup table.
+     *
+     * @return The @c std::string for the declaration of a lookup table.
+     */
+    std::string lookupTableDeclarationString() const;
+
+    /**
+     * @brief Set the @c std::string for the declaration of a lookup table.
+     *
+     * Set the @c std::string for the declaration of a lookup table. To be
+     * useful, the string should contain the [INDEX] and [SIZE] tags, which will
+     * be replaced with the index of the lookup table and its number of entries,
+     * respectively.
+     *
+     * @param lookupTableDeclarationString The @c std::string to use for the
+     * declaration of a lookup table.
+     */
+    void setLookupTableDeclarationString(const std::string &lookupTableDeclarationString);
+
+    /**
+     * @brief Get the @c std::string for an entry of a lookup table.
+     *
+     * Return the @c std::string for an entry of a lookup table.
+     *
+     * @return The @c std::string for an entry of a lookup table.
+     */
+    std::string lookupTableEntryString() const;
+
+    /**
+     * @brief Set the @c std::string for an entry of a lookup table.
+     *
+     * Set the @c std::string for an entry of a lookup table. To be useful, the
+     * string should contain the [INDEX], [COLUMN_COUNT], and [COLUMN] tags,
+     * which will be replaced with the index of the lookup table, its number of
+     * columns, and the column of the entry, respectively. The row of the entry
+     * is expected to be referred to as i.
+     *
+     * @param lookupTableEntryString The @c std::string to use for an entry of a
+     * lookup table.
+     */
+    void setLookupTableEntryString(const std::string &lookupTableEntryString);
+
+    /**
+     * @brief Get the @c std::string for a call to the method that returns a
+     * value from a lookup table.
+     *
+     * Return the @c std::string for a call to the method that returns a value
+     * from a lookup table.
+     *
+     * @return The @c std::string for a call to the method that returns a value
+     * from a lookup table.
+     */
+    std::string lookupTableValueCallString() const;
+
+    /**
+     * @brief Set the @c std::string for a call to the method that returns a
+     * value from a lookup table.
+     *
+     * Set the @c std::string for a call to the method that returns a value from
+     * a lookup table. To be useful, the string should contain the [INDEX],
+     * [COLUMN_COUNT], [COLUMN], [STATE], [MINIMUM], [STEP], and [SIZE] tags,
+     * which will be replaced with the index of the lookup table, its number of
+     * columns, the column of interest, the state used to look up the value, the
+     * minimum value and step of the state, and the number of rows of the lookup
+     * table, respectively.
+     *
+     * @param lookupTableValueCallString The @c std::string to use for a call to
+     * the method that returns a value from a lookup table.
+     */
+    void setLookupTableValueCallString(const std::string &lookupTableValueCallString);
+
+    /**
+     * @brief Get the @c std::string for the update of the maximum interpolation
+     * error of a lookup table.
+     *
+     * Return the @c std::string for the update of the maximum interpolation
+     * error of a lookup table.
+     *
+     * @return The @c std::string for the update of the maximum interpolation
+     * error of a lookup table.
+     */
+    std::string lookupTableErrorString() const;
+
+    /**
+     * @brief Set the @c std::string for the update of the maximum interpolation
+     * error of a lookup table.
+     *
+     * Set the @c std::string for the update of the maximum interpolation error
+     * of a lookup table. To be useful, the string should contain the [CODE] and
+     * [VALUE] tags, which will be replaced with some code to compute the exact
+     * value of an entry and with some code to compute its interpolated value,
+     * respectively. A non-finite interpolated value is expected to make the
+     * maximum interpolation error non-finite too.
+     *
+     * @param lookupTableErrorString The @c std::string to use for the update of
+     * the maximum interpolation error of a lookup table.
+     */
+    void setLookupTableErrorString(const std::string &lookupTableErrorString);
+
+    /**
+     * @brief Get the @c std::string for the method that returns a value from a
+     * lookup table.
+     *
+     * Return the @c std::string for the method that returns a value from a
+     * lookup table.
+     *
+     * @return The @c std::string for the method that returns a value from a
+     * lookup table.
+     */
+    std::string lookupTableValueMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the method that returns a value from a
+     * lookup table.
+     *
+     * Set the @c std::string for the method that returns a value from a lookup
+     * table. The method is expected to linearly interpolate between the two
+     * rows of the lookup table that surround the given state value, and to
+     * clamp the state value to the range covered by the lookup table. The
+     * string may also define any helper method used by the other lookup table
+     * strings.
+     *
+     * @param lookupTableValueMethodString The @c std::string to use for the
+     * method that returns a value from a lookup table.
+     */
+    void setLookupTableValueMethodString(const std::string &lookupTableValueMethodString);
+
+    /**
+     * @brief Get the @c std::string for the initialisation of a lookup table.
+     *
+     * Return the @c std::string for the initialisation of a lookup table.
+     *
+     * @return The @c std::string for the initialisation of a lookup table.
+     */
+    std::string lookupTableInitialisationString() const;
+
+    /**
+     * @brief Set the @c std::string for the initialisation of a lookup table.
+     *
+     * Set the @c std::string for the initialisation of a lookup table. To be
+     * useful, the string should contain the [SIZE], [STATE], [MINIMUM], [STEP],
+     * [CODE], and [ERROR_CODE] tags, which will be replaced with the number of
+     * rows of the lookup table, the state used to look up values, the minimum
+     * value and step of the state, some code to compute the entries of a row,
+     * and some code to update the maximum interpolation error at the midpoint
+     * between two rows, respectively. The string may also contain the
+     * [COLUMN_COUNT] and [ENTRY] tags, which will be replaced with the number of
+     * entries in a row and with the entry in column @c j of a row,
+     * respectively.
+     *
+     * Since a tabulated equation may have a removable singularity (e.g. 0/0)
+     * that happens to be on a row, the entries of a row are best computed as
+     * the average of their values just either side of it.
+     *
+     * @param lookupTableInitialisationString The @c std::string to use for the
+     * initialisation of a lookup table.
+     */
+    void setLookupTableInitialisationString(const std::string &lookupTableInitialisationString);
+
+    /**
+     * @brief Get the @c std::string for the OpenMP pragma used to distribute
+     * the instances of an ensemble.
+     *
+     * Return the @c std::string for the OpenMP pragma used to distribute the
+     * instances of an ensemble.
+     *
+     * @return The @c std::string for the OpenMP pragma used to distribute the
+     * instances of an ensemble.
+     */
+    std::string ensembleOpenmpPragmaString() const;
+
+    /**
+     * @brief Set the @c std::string for the OpenMP pragma used to distribute
+     * the instances of an ensemble.
+     *
+     * Set the @c std::string for the OpenMP pragma used to distribute the
+     * instances of an ensemble. To be useful, the string should contain the
+     * [BLOCK_SIZE] tag, which will be replaced with the number of consecutive
+     * instances that are to be processed by a thread.
+     *
+     * @param ensembleOpenmpPragmaString The @c std::string to use for the
+     * OpenMP pragma used to distribute the instances of an ensemble.
+     */
+    void setEnsembleOpenmpPragmaString(const std::string &ensembleOpenmpPragmaString);
+
+    /**
+     * @brief Get the @c std::string for assigning an ensemble parameter to an
+     * instance.
+     *
+     * Return the @c std::string for assigning an ensemble parameter to an
+     * instance.
+     *
+     * @return The @c std::string for assigning an ensemble parameter to an
+     * instance.
+     */
+    std::string ensembleParameterAssignmentString() const;
+
+    /**
+     * @brief Set the @c std::string for assigning an ensemble parameter to an
+     * instance.
+     *
+     * Set the @c std::string for assigning an ensemble parameter to an
+     * instance. To be useful, the string should contain the [INDEX] and
+     * [PARAMETER_INDEX] tags, which will be replaced with the index of the
+     * ensemble parameter in the variables array and in the parameters of the
+     * instance, respectively.
+     *
+     * @param ensembleParameterAssignmentString The @c std::string to use for
+     * assigning an ensemble parameter to an instance.
+     */
+    void setEnsembleParameterAssignmentString(const std::string &ensembleParameterAssignmentString);
+
     /**
      * @brief Get the @c std::string for the type definition of an external
      * variable method.
@@ -3531,6 +4230,437 @@ public:
     void setImplementationComputeRatesMethodString(bool withExternalVariables,
                                                    const std::string &implementationComputeRatesMethodString);
 
+    /**
+     * @brief Get the @c std::string for the interface to compute the
+     * Rush-Larsen coefficients.
+     *
+     * Return the @c std::string for the interface to compute the Rush-Larsen
+     * coefficients.
+     *
+     * @return The @c std::string for the interface to compute the Rush-Larsen
+     * coefficients.
+     */
+    std::string interfaceComputeRushLarsenCoefficientsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to compute the
+     * Rush-Larsen coefficients.
+     *
+     * Set the @c std::string for the interface to compute the Rush-Larsen
+     * coefficients.
+     *
+     * @param interfaceComputeRushLarsenCoefficientsMethodString The
+     * @c std::string to use for the interface to compute the Rush-Larsen
+     * coefficients.
+     */
+    void setInterfaceComputeRushLarsenCoefficientsMethodString(const std::string &interfaceComputeRushLarsenCoefficientsMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to compute the
+     * Rush-Larsen coefficients.
+     *
+     * Return the @c std::string for the implementation to compute the
+     * Rush-Larsen coefficients.
+     *
+     * @return The @c std::string for the implementation to compute the
+     * Rush-Larsen coefficients.
+     */
+    std::string implementationComputeRushLarsenCoefficientsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to compute the
+     * Rush-Larsen coefficients.
+     *
+     * Set the @c std::string for the implementation to compute the Rush-Larsen
+     * coefficients. To be useful, the string should contain the [CODE] tag,
+     * which will be replaced with some code to compute the time constant and
+     * steady-state value of each gating variable. The method is expected to be
+     * called after the method to compute rates, since the Rush-Larsen
+     * coefficients may rely on some of the variables it computes.
+     *
+     * @param implementationComputeRushLarsenCoefficientsMethodString The
+     * @c std::string to use for the implementation to compute the Rush-Larsen
+     * coefficients.
+     */
+    void setImplementationComputeRushLarsenCoefficientsMethodString(const std::string &implementationComputeRushLarsenCoefficientsMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the compute rates
+     * method when local variables are used.
+     *
+     * Return the @c std::string for the implementation of the compute rates
+     * method when local variables are used.
+     *
+     * @return The @c std::string for the implementation of the compute rates
+     * method when local variables are used.
+     */
+    std::string implementationComputeRatesMethodWithLocalVariablesString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the compute rates
+     * method when local variables are used.
+     *
+     * Set the @c std::string for the implementation of the compute rates method
+     * when local variables are used. The array parameters of the method may be
+     * qualified so that the compiler knows that they do not alias one another.
+     * To be useful, the string should contain the [CODE] tag, which will be
+     * replaced with some code to compute the rates.
+     *
+     * @param implementationComputeRatesMethodWithLocalVariablesString The @c
+     * std::string to use for the implementation of the compute rates method
+     * when local variables are used.
+     */
+    void setImplementationComputeRatesMethodWithLocalVariablesString(const std::string &implementationComputeRatesMethodWithLocalVariablesString);
+
+    /**
+     * @brief Get the @c std::string for the interface to initialise lookup
+     * tables.
+     *
+     * Return the @c std::string for the interface to initialise lookup tables.
+     *
+     * @return The @c std::string for the interface to initialise lookup tables.
+     */
+    std::string interfaceInitialiseLookupTablesMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to initialise lookup
+     * tables.
+     *
+     * Set the @c std::string for the interface to initialise lookup tables.
+     *
+     * @param interfaceInitialiseLookupTablesMethodString The @c std::string to
+     * use for the interface to initialise lookup tables.
+     */
+    void setInterfaceInitialiseLookupTablesMethodString(const std::string &interfaceInitialiseLookupTablesMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to initialise lookup
+     * tables.
+     *
+     * Return the @c std::string for the implementation to initialise lookup
+     * tables.
+     *
+     * @return The @c std::string for the implementation to initialise lookup
+     * tables.
+     */
+    std::string implementationInitialiseLookupTablesMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to initialise lookup
+     * tables.
+     *
+     * Set the @c std::string for the implementation to initialise lookup
+     * tables. To be useful, the string should contain the [CODE] tag, which
+     * will be replaced with some code to initialise the lookup tables. The
+     * method is expected to be called after the method to compute computed
+     * constants and to return the maximum interpolation error of the lookup
+     * tables.
+     *
+     * @param implementationInitialiseLookupTablesMethodString The @c
+     * std::string to use for the implementation to initialise lookup tables.
+     */
+    void setImplementationInitialiseLookupTablesMethodString(const std::string &implementationInitialiseLookupTablesMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to initialise an
+     * ensemble.
+     *
+     * Return the @c std::string for the interface to initialise an ensemble.
+     *
+     * @return The @c std::string for the interface to initialise an ensemble.
+     */
+    std::string interfaceInitialiseEnsembleMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to initialise an
+     * ensemble.
+     *
+     * Set the @c std::string for the interface to initialise an ensemble.
+     *
+     * @param interfaceInitialiseEnsembleMethodString The @c std::string to use
+     * for the interface to initialise an ensemble.
+     */
+    void setInterfaceInitialiseEnsembleMethodString(const std::string &interfaceInitialiseEnsembleMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to initialise an
+     * ensemble.
+     *
+     * Return the @c std::string for the implementation to initialise an
+     * ensemble.
+     *
+     * @return The @c std::string for the implementation to initialise an
+     * ensemble.
+     */
+    std::string implementationInitialiseEnsembleMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to initialise an
+     * ensemble.
+     *
+     * Set the @c std::string for the implementation to initialise an ensemble.
+     * To be useful, the string should contain the [OPENMP_PRAGMA] and [CODE]
+     * tags, which will be replaced with the OpenMP pragma, if any, and with the
+     * code to initialise an instance using its parameters, respectively. That
+     * code assigns the ensemble parameters to the instance and reinitialises
+     * the states and constants which initial value is that of an ensemble
+     * parameter, so it must come after the default initialisation of the
+     * instance.
+     *
+     * @param implementationInitialiseEnsembleMethodString The @c std::string to
+     * use for the implementation to initialise an ensemble.
+     */
+    void setImplementationInitialiseEnsembleMethodString(const std::string &implementationInitialiseEnsembleMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to compute the rates of
+     * an ensemble.
+     *
+     * Return the @c std::string for the interface to compute the rates of an
+     * ensemble.
+     *
+     * @return The @c std::string for the interface to compute the rates of an
+     * ensemble.
+     */
+    std::string interfaceComputeEnsembleRatesMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to compute the rates of
+     * an ensemble.
+     *
+     * Set the @c std::string for the interface to compute the rates of an
+     * ensemble.
+     *
+     * @param interfaceComputeEnsembleRatesMethodString The @c std::string to
+     * use for the interface to compute the rates of an ensemble.
+     */
+    void setInterfaceComputeEnsembleRatesMethodString(const std::string &interfaceComputeEnsembleRatesMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to compute the rates
+     * of an ensemble.
+     *
+     * Return the @c std::string for the implementation to compute the rates of
+     * an ensemble.
+     *
+     * @return The @c std::string for the implementation to compute the rates of
+     * an ensemble.
+     */
+    std::string implementationComputeEnsembleRatesMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to compute the rates
+     * of an ensemble.
+     *
+     * Set the @c std::string for the implementation to compute the rates of an
+     * ensemble. To be useful, the string should contain the [OPENMP_PRAGMA]
+     * tag, which will be replaced with the OpenMP pragma, if any.
+     *
+     * @param implementationComputeEnsembleRatesMethodString The @c std::string
+     * to use for the implementation to compute the rates of an ensemble.
+     */
+    void setImplementationComputeEnsembleRatesMethodString(const std::string &implementationComputeEnsembleRatesMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to compute the variables
+     * of an ensemble.
+     *
+     * Return the @c std::string for the interface to compute the variables of
+     * an ensemble.
+     *
+     * @return The @c std::string for the interface to compute the variables of
+     * an ensemble.
+     */
+    std::string interfaceComputeEnsembleVariablesMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to compute the variables
+     * of an ensemble.
+     *
+     * Set the @c std::string for the interface to compute the variables of an
+     * ensemble.
+     *
+     * @param interfaceComputeEnsembleVariablesMethodString The @c std::string
+     * to use for the interface to compute the variables of an ensemble.
+     */
+    void setInterfaceComputeEnsembleVariablesMethodString(const std::string &interfaceComputeEnsembleVariablesMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to compute the
+     * variables of an ensemble.
+     *
+     * Return the @c std::string for the implementation to compute the variables
+     * of an ensemble.
+     *
+     * @return The @c std::string for the implementation to compute the
+     * variables of an ensemble.
+     */
+    std::string implementationComputeEnsembleVariablesMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to compute the
+     * variables of an ensemble.
+     *
+     * Set the @c std::string for the implementation to compute the variables of
+     * an ensemble. To be useful, the string should contain the [OPENMP_PRAGMA]
+     * tag, which will be replaced with the OpenMP pragma, if any.
+     *
+     * @param implementationComputeEnsembleVariablesMethodString The @c
+     * std::string to use for the implementation to compute the variables of an
+     * ensemble.
+     */
+    void setImplementationComputeEnsembleVariablesMethodString(const std::string &implementationComputeEnsembleVariablesMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to integrate the model
+     * using the forward Euler method.
+     *
+     * Return the @c std::string for the interface to integrate the model using
+     * the forward Euler method.
+     *
+     * @return The @c std::string for the interface to integrate the model using
+     * the forward Euler method.
+     */
+    std::string interfaceIntegrateForwardEulerMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to integrate the model
+     * using the forward Euler method.
+     *
+     * Set the @c std::string for the interface to integrate the model using the
+     * forward Euler method.
+     *
+     * @param interfaceIntegrateForwardEulerMethodString The @c std::string to
+     * use for the interface to integrate the model using the forward Euler
+     * method.
+     */
+    void setInterfaceIntegrateForwardEulerMethodString(const std::string &interfaceIntegrateForwardEulerMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to integrate the
+     * model using the forward Euler method.
+     *
+     * Return the @c std::string for the implementation to integrate the model
+     * using the forward Euler method.
+     *
+     * @return The @c std::string for the implementation to integrate the model
+     * using the forward Euler method.
+     */
+    std::string implementationIntegrateForwardEulerMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to integrate the
+     * model using the forward Euler method.
+     *
+     * Set the @c std::string for the implementation to integrate the model
+     * using the forward Euler method.
+     *
+     * @param implementationIntegrateForwardEulerMethodString The @c std::string
+     * to use for the implementation to integrate the model using the forward
+     * Euler method.
+     */
+    void setImplementationIntegrateForwardEulerMethodString(const std::string &implementationIntegrateForwardEulerMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to integrate the model
+     * using the fourth-order Runge-Kutta method.
+     *
+     * Return the @c std::string for the interface to integrate the model using
+     * the fourth-order Runge-Kutta method.
+     *
+     * @return The @c std::string for the interface to integrate the model using
+     * the fourth-order Runge-Kutta method.
+     */
+    std::string interfaceIntegrateRk4MethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to integrate the model
+     * using the fourth-order Runge-Kutta method.
+     *
+     * Set the @c std::string for the interface to integrate the model using the
+     * fourth-order Runge-Kutta method.
+     *
+     * @param interfaceIntegrateRk4MethodString The @c std::string to use for
+     * the interface to integrate the model using the fourth-order Runge-Kutta
+     * method.
+     */
+    void setInterfaceIntegrateRk4MethodString(const std::string &interfaceIntegrateRk4MethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to integrate the
+     * model using the fourth-order Runge-Kutta method.
+     *
+     * Return the @c std::string for the implementation to integrate the model
+     * using the fourth-order Runge-Kutta method.
+     *
+     * @return The @c std::string for the implementation to integrate the model
+     * using the fourth-order Runge-Kutta method.
+     */
+    std::string implementationIntegrateRk4MethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to integrate the
+     * model using the fourth-order Runge-Kutta method.
+     *
+     * Set the @c std::string for the implementation to integrate the model
+     * using the fourth-order Runge-Kutta method.
+     *
+     * @param implementationIntegrateRk4MethodString The @c std::string to use
+     * for the implementation to integrate the model using the fourth-order
+     * Runge-Kutta method.
+     */
+    void setImplementationIntegrateRk4MethodString(const std::string &implementationIntegrateRk4MethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to integrate the model
+     * using the Rush-Larsen method.
+     *
+     * Return the @c std::string for the interface to integrate the model using
+     * the Rush-Larsen method.
+     *
+     * @return The @c std::string for the interface to integrate the model using
+     * the Rush-Larsen method.
+     */
+    std::string interfaceIntegrateRushLarsenMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to integrate the model
+     * using the Rush-Larsen method.
+     *
+     * Set the @c std::string for the interface to integrate the model using the
+     * Rush-Larsen method.
+     *
+     * @param interfaceIntegrateRushLarsenMethodString The @c std::string to use
+     * for the interface to integrate the model using the Rush-Larsen method.
+     */
+    void setInterfaceIntegrateRushLarsenMethodString(const std::string &interfaceIntegrateRushLarsenMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to integrate the
+     * model using the Rush-Larsen method.
+     *
+     * Return the @c std::string for the implementation to integrate the model
+     * using the Rush-Larsen method.
+     *
+     * @return The @c std::string for the implementation to integrate the model
+     * using the Rush-Larsen method.
+     */
+    std::string implementationIntegrateRushLarsenMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to integrate the
+     * model using the Rush-Larsen method.
+     *
+     * Set the @c std::string for the implementation to integrate the model
+     * using the Rush-Larsen method. To be useful, the string should contain the
+     * [CODE] tag, which will be replaced with the code to update the states.
+     *
+     * @param implementationIntegrateRushLarsenMethodString The @c std::string
+     * to use for the implementation to integrate the model using the
+     * Rush-Larsen method.
+     */
+    void setImplementationIntegrateRushLarsenMethodString(const std::string &implementationIntegrateRushLarsenMethodString);
+
     /**
      * @brief Get the @c std::string for the interface to compute variables.
      *
@@ -16,6 +16,7 @@ limitations under the License.
 
 #pragma once
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -24,6 +25,15 @@ limitations under the License.
 
 namespace libcellml {
 
+/**
+ * @brief The type of the function to which a logger streams its issues.
+ *
+ * A function that is given each issue logged by a logger and that returns
+ * @c true to keep receiving issues or @c false to cancel the streaming of
+ * issues.
+ */
+using IssueCallback = std::function<bool(const IssuePtr &)>;
+
 /**
  * @brief The Logger class.
  *
@@ -125,6 +135,57 @@ public:
      */
     IssuePtr message(size_t index) const;
 
+    /**
+     * @brief Set the function to which issues are streamed.
+     *
+     * Set the function to which this logger passes its issues, in the order in
+     * which they are logged.  An issue is passed as soon as it is final, which
+     * for the @ref Validator, @ref Importer and @ref Printer means once the
+     * part of the model that it is about has been dealt with.
+     *
+     * If the @p callback returns @c false then no further issues are passed to
+     * it and the @ref Validator (or @ref Analyser) stops validating (or
+     * analysing) the model at the next opportunity.  Issues that are not
+     * passed to the @p callback are retained by this logger.
+     *
+     * An empty @p callback, the default, means that issues are not streamed.
+     *
+     * @param callback The function to which issues are streamed.
+     */
+    void setIssueCallback(const IssueCallback &callback);
+
+    /**
+     * @brief Get the function to which issues are streamed.
+     *
+     * Get the function to which this logger passes its issues.
+     *
+     * @return The function to which issues are streamed.
+     */
+    IssueCallback issueCallback() const;
+
+    /**
+     * @brief Set whether streamed issues are retained.
+     *
+     * Set whether the issues that have been passed to the issue callback are
+     * kept in this logger, which is the default.  If they are not, they are
+     * still counted by issueCount(), errorCount(), warningCount() and
+     * messageCount(), but they are returned as @c nullptr by issue(), error(),
+     * warning() and message().
+     *
+     * @param retainIssues Whether streamed issues are retained.
+     */
+    void setRetainIssues(bool retainIssues);
+
+    /**
+     * @brief Test whether streamed issues are retained.
+     *
+     * Test whether the issues that have been passed to the issue callback are
+     * kept in this logger.
+     *
+     * @return @c true if streamed issues are retained, @c false otherwise.
+     */
+    bool retainIssues() const;
+
 protected:
     class LoggerImpl; /**< Forward declaration for pImpl idiom, @private. */
 
@@ -49,6 +49,176 @@ public:
      */
     static ValidatorPtr create() noexcept;
 
+    /**
+     * @brief Get the number of threads used to validate a model.
+     *
+     * Return the number of threads used by this @c Validator to validate a
+     * model.
+     *
+     * @return The number of threads used to validate a model.
+     */
+    size_t threadCount() const;
+
+    /**
+     * @brief Set the number of threads used to validate a model.
+     *
+     * Set the number of threads used by this @c Validator to validate a
+     * model. By default, a model is validated using one thread. Otherwise, the
+     * components of a model are validated in parallel, using the given number
+     * of threads or, if @p threadCount is zero, as many threads as there are
+     * concurrent threads supported by the hardware. Either way, the issues are
+     * logged in the same order.
+     *
+     * @param threadCount The number of threads used to validate a model.
+     */
+    void setThreadCount(size_t threadCount);
+
+    /**
+     * @brief Test if this validator validates a model incrementally.
+     *
+     * Test if this @c Validator reuses the results of its previous validation
+     * of a model for the parts of the model that have not been modified since.
+     *
+     * @sa setIncremental
+     *
+     * @return @c true if this validator validates a model incrementally,
+     * @c false otherwise.
+     */
+    bool isIncremental() const;
+
+    /**
+     * @brief Set whether this validator validates a model incrementally.
+     *
+     * Set whether this @c Validator validates a model incrementally. By
+     * default, a model is fully validated every time. Otherwise, this
+     * @c Validator keeps the issues logged for the components, the units, the
+     * equivalence networks and the identifiers of the last model it validated,
+     * and only validates again the parts of that model that have been modified
+     * since. Either way, the same issues are logged in the same order.
+     *
+     * Imported components and components with resets are always validated
+     * again since their validity depends on entities outside of them.
+     *
+     * @param incremental Whether this validator validates a model
+     * incrementally.
+     */
+    void setIncremental(bool incremental);
+
+    /**
+     * @brief Get the maximum number of errors logged when validating a model.
+     *
+     * Return the maximum number of errors logged by this @c Validator when
+     * validating a model, or zero if there is no maximum.
+     *
+     * @sa setMaximumErrorCount
+     *
+     * @return The maximum number of errors logged when validating a model.
+     */
+    size_t maximumErrorCount() const;
+
+    /**
+     * @brief Set the maximum number of errors logged when validating a model.
+     *
+     * Set the maximum number of errors logged by this @c Validator when
+     * validating a model. By default, there is no maximum (i.e. zero), and a
+     * model is fully validated. Otherwise, the validation of a model stops as
+     * soon as the given number of errors has been logged, and the logged
+     * issues are the same as the first ones of a full validation, up to and
+     * including the last allowed error. For instance, a maximum of one error
+     * can be used to find out whether a model is valid as quickly as possible.
+     *
+     * The components of a model are always validated using one thread when
+     * there is a maximum number of errors.
+     *
+     * @param maximumErrorCount The maximum number of errors logged when
+     * validating a model.
+     */
+    void setMaximumErrorCount(size_t maximumErrorCount);
+
+    /**
+     * @brief Test if this validator validates math against the MathML DTD.
+     *
+     * Test if this @c Validator validates the math of a component against the
+     * W3C MathML DTD.
+     *
+     * @sa setHasMathMLDtdValidation
+     *
+     * @return @c true if this validator validates math against the MathML DTD,
+     * @c false otherwise.
+     */
+    bool hasMathMLDtdValidation() const;
+
+    /**
+     * @brief Set whether this validator validates math against the MathML DTD.
+     *
+     * Set whether this @c Validator validates the math of a component against
+     * the W3C MathML DTD, which it does by default. Skipping this validation
+     * makes validating a model faster, but the issues that it reports (i.e.
+     * those starting with "W3C MathML DTD error") are not logged.
+     *
+     * @sa setHasMathMLDtdCompatibility
+     *
+     * @param mathMLDtdValidation Whether this validator validates math against
+     * the MathML DTD.
+     */
+    void setHasMathMLDtdValidation(bool mathMLDtdValidation);
+
+    /**
+     * @brief Test if this validator uses the MathML DTD itself to validate math.
+     *
+     * Test if this @c Validator uses the W3C MathML DTD itself to validate the
+     * math of a component against it.
+     *
+     * @sa setHasMathMLDtdCompatibility
+     *
+     * @return @c true if this validator uses the MathML DTD itself to validate
+     * math, @c false otherwise.
+     */
+    bool hasMathMLDtdCompatibility() const;
+
+    /**
+     * @brief Set whether this validator uses the MathML DTD itself to validate math.
+     *
+     * Set whether this @c Validator uses the W3C MathML DTD itself to validate
+     * the math of a component against it. By default, the math is validated
+     * natively against the rules of the W3C MathML DTD for the MathML elements
+     * supported by CellML. Otherwise, the math is serialised, and then parsed
+     * and validated using the W3C MathML DTD itself, which is slower. Either
+     * way, the same issues are logged for valid MathML elements, but the
+     * elements that are not supported by CellML are only fully validated in
+     * compatibility mode.
+     *
+     * @param mathMLDtdCompatibility Whether this validator uses the MathML DTD
+     * itself to validate math.
+     */
+    void setHasMathMLDtdCompatibility(bool mathMLDtdCompatibility);
+
+    /**
+     * @brief Test if this validator checks that identifiers are unique.
+     *
+     * Test if this @c Validator checks that the identifiers in a model are
+     * unique.
+     *
+     * @sa setHasUniqueIdValidation
+     *
+     * @return @c true if this validator checks that identifiers are unique,
+     * @c false otherwise.
+     */
+    bool hasUniqueIdValidation() const;
+
+    /**
+     * @brief Set whether this validator checks that identifiers are unique.
+     *
+     * Set whether this @c Validator checks that the identifiers in a model
+     * are unique, which it does by default. Skipping this check makes
+     * validating a model faster, but duplicate identifiers are not reported.
+     * The identifiers are still checked for validity.
+     *
+     * @param uniqueIdValidation Whether this validator checks that identifiers
+     * are unique.
+     */
+    void setHasUniqueIdValidation(bool uniqueIdValidation);
+
     /**
      * @brief Validate the @p model using the CellML 2.0 Specification.
      *
@@ -67,6 +237,7 @@ private:
     class ValidatorImpl; /**< Forward declaration for pImpl idiom, @private. */
 
     ValidatorImpl *pFunc(); /**< Getter for private implementation pointer, @private. */
+    const ValidatorImpl *pFunc() const; /**< Const getter for private implementation pointer, @private. */
 };
 
 } // namespace libcellml
@@ -43,6 +43,9 @@
 %feature("docstring") libcellml::AnalyserEquation::isStateRateBased
 "Tests if this :class:`AnalyserEquation` object relies on states and/or rates.";
 
+%feature("docstring") libcellml::AnalyserEquation::lookupTableState
+"Returns the state on which this :class:`AnalyserEquation` object could be tabulated, if any.";
+
 %feature("docstring") libcellml::AnalyserEquation::variableCount
 "Returns the number of variables computed by this :class:`AnalyserEquation` object.";
 
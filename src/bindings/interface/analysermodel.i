@@ -52,6 +52,24 @@
 %feature("docstring") libcellml::AnalyserModel::equation
 "Returns the equation, specified by index, contained by this :class:`AnalyserModel` object.";
 
+%feature("docstring") libcellml::AnalyserModel::jacobianNonZeroCount
+"Returns the number of non-zero entries in the Jacobian of the rates with respect to the states.";
+
+%feature("docstring") libcellml::AnalyserModel::jacobianRowOffsets
+"Returns the row offsets of the sparsity pattern (CSR format) of the Jacobian of the rates with respect to the states.";
+
+%feature("docstring") libcellml::AnalyserModel::jacobianColumnIndices
+"Returns the column indices of the sparsity pattern (CSR format) of the Jacobian of the rates with respect to the states.";
+
+%feature("docstring") libcellml::AnalyserModel::stateDependencies
+"Returns the states on which the rate, specified by index, depends.";
+
+%feature("docstring") libcellml::AnalyserModel::equationDependencyRowOffsets
+"Returns the row offsets of the dependency structure (CSR format) of the equations.";
+
+%feature("docstring") libcellml::AnalyserModel::equationDependencyColumnIndices
+"Returns the column indices of the dependency structure (CSR format) of the equations.";
+
 %feature("docstring") libcellml::AnalyserModel::needEqFunction
 "Tests if this :class:`AnalyserModel` object needs an \"equal to\" function.";
 
@@ -131,8 +149,13 @@
 #include "libcellml/analysermodel.h"
 %}
 
+%ignore libcellml::AnalyserModel::statesRef;
+%ignore libcellml::AnalyserModel::variablesRef;
+%ignore libcellml::AnalyserModel::equationsRef;
+
 %template(AnalyserEquationVector) std::vector<libcellml::AnalyserEquationPtr>;
 %template(AnalyserVariableVector) std::vector<libcellml::AnalyserVariablePtr>;
+%template(IndexVector) std::vector<size_t>;
 
 %pythoncode %{
 # libCellML generated wrapper code starts here.
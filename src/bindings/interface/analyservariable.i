@@ -24,6 +24,9 @@
 %feature("docstring") libcellml::AnalyserVariable::variable
 "Returns the :class:`Variable`.";
 
+%feature("docstring") libcellml::AnalyserVariable::isGatingVariable
+"Tests if this :class:`AnalyserVariable` object is a gating variable.";
+
 %feature("docstring") libcellml::AnalyserVariable::equationCount
 "Returns the number of equations used to compute this :class:`AnalyserVariable` object.";
 
@@ -23,12 +23,87 @@
 %feature("docstring") libcellml::Generator::setModel
 "Sets the model to use for code generation.";
 
+%feature("docstring") libcellml::Generator::addLookupTable
+"Adds a lookup table, covering the given range with the given step, for the given variable. Returns `True` on success.";
+
+%feature("docstring") libcellml::Generator::removeLookupTable
+"Removes the lookup table for the given variable. Returns `True` on success.";
+
+%feature("docstring") libcellml::Generator::removeAllLookupTables
+"Removes all the lookup tables from this generator.";
+
+%feature("docstring") libcellml::Generator::containsLookupTable
+"Tests if the given variable has a lookup table.";
+
+%feature("docstring") libcellml::Generator::lookupTableCount
+"Returns the number of lookup tables.";
+
+%feature("docstring") libcellml::Generator::hasConstantSpecialisation
+"Tests if this generator specialises constants, i.e. uses their value, evaluated at generation time, as literals.";
+
+%feature("docstring") libcellml::Generator::setConstantSpecialisation
+"Sets whether this generator specialises constants, i.e. uses their value, evaluated at generation time, as literals.";
+
+%feature("docstring") libcellml::Generator::addConstantOverride
+"Adds a constant override, i.e. a value to use instead of the initial value of the given constant when constants are specialised. Returns `True` on success.";
+
+%feature("docstring") libcellml::Generator::removeConstantOverride
+"Removes the constant override for the given variable. Returns `True` on success.";
+
+%feature("docstring") libcellml::Generator::removeAllConstantOverrides
+"Removes all the constant overrides from this generator.";
+
+%feature("docstring") libcellml::Generator::containsConstantOverride
+"Tests if the given variable has a constant override.";
+
+%feature("docstring") libcellml::Generator::constantOverrideCount
+"Returns the number of constant overrides.";
+
+%feature("docstring") libcellml::Generator::addEnsembleParameter
+"Adds an ensemble parameter, i.e. a constant which value is given for each instance of an ensemble. Returns `True` on success.";
+
+%feature("docstring") libcellml::Generator::removeEnsembleParameter
+"Removes the ensemble parameter for the given variable. Returns `True` on success.";
+
+%feature("docstring") libcellml::Generator::removeAllEnsembleParameters
+"Removes all the ensemble parameters from this generator.";
+
+%feature("docstring") libcellml::Generator::containsEnsembleParameter
+"Tests if the given variable is an ensemble parameter.";
+
+%feature("docstring") libcellml::Generator::ensembleParameterCount
+"Returns the number of ensemble parameters.";
+
+%feature("docstring") libcellml::Generator::addSensitivityParameter
+"Adds a sensitivity parameter, i.e. a constant with respect to which the sensitivity of the states is computed. Returns `True` on success.";
+
+%feature("docstring") libcellml::Generator::removeSensitivityParameter
+"Removes the sensitivity parameter for the given variable. Returns `True` on success.";
+
+%feature("docstring") libcellml::Generator::removeAllSensitivityParameters
+"Removes all the sensitivity parameters from this generator.";
+
+%feature("docstring") libcellml::Generator::containsSensitivityParameter
+"Tests if the given variable is a sensitivity parameter.";
+
+%feature("docstring") libcellml::Generator::sensitivityParameterCount
+"Returns the number of sensitivity parameters.";
+
+%feature("docstring") libcellml::Generator::implementationChunkCount
+"Returns the number of chunks into which the implementation code is partitioned.";
+
+%feature("docstring") libcellml::Generator::setImplementationChunkCount
+"Sets the number of chunks into which the implementation code is partitioned, zero meaning that it is not partitioned.";
+
 %feature("docstring") libcellml::Generator::interfaceCode
 "Returns the interface code.";
 
 %feature("docstring") libcellml::Generator::implementationCode
 "Returns the implementation code.";
 
+%feature("docstring") libcellml::Generator::implementationChunkCode
+"Returns the code for the chunk, at the given index, of the implementation code.";
+
 %feature("docstring") libcellml::Generator::equationCode
 "Returns the equation code for a given equation AST.";
 
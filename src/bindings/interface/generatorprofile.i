@@ -19,12 +19,39 @@
 %feature("docstring") libcellml::GeneratorProfile::setProfile
 "Sets the :enum:`GeneratorProfile::Profile` for this :class:`GeneratorProfile`.";
 
+%feature("docstring") libcellml::GeneratorProfile::precision
+"Returns the :enum:`GeneratorProfile::Precision` for this :class:`GeneratorProfile`.";
+
+%feature("docstring") libcellml::GeneratorProfile::precisionAsString
+"Returns the :enum:`GeneratorProfile::Precision` as a string for this :class:`GeneratorProfile`.";
+
+%feature("docstring") libcellml::GeneratorProfile::setPrecision
+"Sets the :enum:`GeneratorProfile::Precision` for this :class:`GeneratorProfile`, reloading its profile.";
+
 %feature("docstring") libcellml::GeneratorProfile::hasInterface
 "Tests if this :class:`GeneratorProfile` requires an interface.";
 
 %feature("docstring") libcellml::GeneratorProfile::setHasInterface
 "Sets whether this :class:`GeneratorProfile` requires an interface.";
 
+%feature("docstring") libcellml::GeneratorProfile::hasComputeRushLarsenCoefficientsMethod
+"Tests if this :class:`GeneratorProfile` requires a method to compute the Rush-Larsen coefficients.";
+
+%feature("docstring") libcellml::GeneratorProfile::setHasComputeRushLarsenCoefficientsMethod
+"Sets whether this :class:`GeneratorProfile` requires a method to compute the Rush-Larsen coefficients.";
+
+%feature("docstring") libcellml::GeneratorProfile::hasLocalVariablesInComputeRates
+"Tests if this :class:`GeneratorProfile` keeps purely intermediate algebraic variables as local variables in the computeRates() method.";
+
+%feature("docstring") libcellml::GeneratorProfile::setHasLocalVariablesInComputeRates
+"Sets whether this :class:`GeneratorProfile` keeps purely intermediate algebraic variables as local variables in the computeRates() method.";
+
+%feature("docstring") libcellml::GeneratorProfile::hasIntegrateMethods
+"Tests if this :class:`GeneratorProfile` requires fixed-step integration methods to be generated.";
+
+%feature("docstring") libcellml::GeneratorProfile::setHasIntegrateMethods
+"Sets whether this :class:`GeneratorProfile` requires fixed-step integration methods to be generated.";
+
 %feature("docstring") libcellml::GeneratorProfile::equalityString
 "Returns the string representing the MathML \"equality\" operator.";
 
@@ -463,6 +490,12 @@
 %feature("docstring") libcellml::GeneratorProfile::setNanString
 "Sets the string representing the MathML \"not-a-number\" value.";
 
+%feature("docstring") libcellml::GeneratorProfile::literalSuffixString
+"Returns the string for the suffix of a floating-point literal.";
+
+%feature("docstring") libcellml::GeneratorProfile::setLiteralSuffixString
+"Sets the string for the suffix of a floating-point literal.";
+
 %feature("docstring") libcellml::GeneratorProfile::eqFunctionString
 "Returns the string for the \"equal to\" function implementation.";
 
@@ -640,6 +673,24 @@ used respectively.";
 %feature("docstring") libcellml::GeneratorProfile::setImplementationHeaderString
 "Sets the string for an implementation header.";
 
+%feature("docstring") libcellml::GeneratorProfile::namespaceString
+"Returns the string for the name of a namespace.";
+
+%feature("docstring") libcellml::GeneratorProfile::setNamespaceString
+"Sets the string for the name of a namespace.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationNamespaceBeginString
+"Returns the string for the beginning of a namespace.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationNamespaceBeginString
+"Sets the string for the beginning of a namespace.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationNamespaceEndString
+"Returns the string for the end of a namespace.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationNamespaceEndString
+"Sets the string for the end of a namespace.";
+
 %feature("docstring") libcellml::GeneratorProfile::interfaceVersionString
 "Returns the string for the interface of the version constant.";
 
@@ -690,6 +741,18 @@ used respectively.";
 "Sets the string for the implementation of the variable count constant. To be useful, the string should contain
 the <VARIABLE_COUNT> tag, which will be replaced with the number of states in the model.";
 
+%feature("docstring") libcellml::GeneratorProfile::interfaceEnsembleParameterCountString
+"Returns the string for the interface of the number of ensemble parameters.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceEnsembleParameterCountString
+"Sets the string for the interface of the number of ensemble parameters.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationEnsembleParameterCountString
+"Returns the string for the implementation of the number of ensemble parameters.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationEnsembleParameterCountString
+"Sets the string for the implementation of the number of ensemble parameters.";
+
 %feature("docstring") libcellml::GeneratorProfile::variableTypeObjectString
 "Returns the string for the data structure for the variable type object.";
 
@@ -813,6 +876,102 @@ and units of a variable respectively.";
 %feature("docstring") libcellml::GeneratorProfile::setVariablesArrayString
 "Sets the string for the name of the variables array.";
 
+%feature("docstring") libcellml::GeneratorProfile::rushLarsenTausArrayString
+"Returns the string for the name of the Rush-Larsen time constants array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setRushLarsenTausArrayString
+"Sets the string for the name of the Rush-Larsen time constants array.";
+
+%feature("docstring") libcellml::GeneratorProfile::rushLarsenSteadyStatesArrayString
+"Returns the string for the name of the Rush-Larsen steady-state values array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setRushLarsenSteadyStatesArrayString
+"Sets the string for the name of the Rush-Larsen steady-state values array.";
+
+%feature("docstring") libcellml::GeneratorProfile::localVariableNameString
+"Returns the string for the name of a local variable.";
+
+%feature("docstring") libcellml::GeneratorProfile::setLocalVariableNameString
+"Sets the string for the name of a local variable.";
+
+%feature("docstring") libcellml::GeneratorProfile::localVariableDeclarationString
+"Returns the string for the declaration of a local variable.";
+
+%feature("docstring") libcellml::GeneratorProfile::setLocalVariableDeclarationString
+"Sets the string for the declaration of a local variable.";
+
+%feature("docstring") libcellml::GeneratorProfile::forwardEulerStateUpdateString
+"Returns the string for updating a state using the forward Euler method.";
+
+%feature("docstring") libcellml::GeneratorProfile::setForwardEulerStateUpdateString
+"Sets the string for updating a state using the forward Euler method.";
+
+%feature("docstring") libcellml::GeneratorProfile::rushLarsenStateUpdateString
+"Returns the string for updating a gating variable using the Rush-Larsen method.";
+
+%feature("docstring") libcellml::GeneratorProfile::setRushLarsenStateUpdateString
+"Sets the string for updating a gating variable using the Rush-Larsen method.";
+
+%feature("docstring") libcellml::GeneratorProfile::sensitivityNameString
+"Returns the string for the name of a sensitivity.";
+
+%feature("docstring") libcellml::GeneratorProfile::setSensitivityNameString
+"Sets the string for the name of a sensitivity.";
+
+%feature("docstring") libcellml::GeneratorProfile::chunkMethodNameString
+"Returns the string for the name of a chunk method.";
+
+%feature("docstring") libcellml::GeneratorProfile::setChunkMethodNameString
+"Sets the string for the name of a chunk method.";
+
+%feature("docstring") libcellml::GeneratorProfile::lookupTableDeclarationString
+"Returns the string for the declaration of a lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::setLookupTableDeclarationString
+"Sets the string for the declaration of a lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::lookupTableEntryString
+"Returns the string for an entry of a lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::setLookupTableEntryString
+"Sets the string for an entry of a lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::lookupTableValueCallString
+"Returns the string for a call to the method that returns a value from a lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::setLookupTableValueCallString
+"Sets the string for a call to the method that returns a value from a lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::lookupTableErrorString
+"Returns the string for the update of the maximum interpolation error of a lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::setLookupTableErrorString
+"Sets the string for the update of the maximum interpolation error of a lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::lookupTableValueMethodString
+"Returns the string for the method that returns a value from a lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::setLookupTableValueMethodString
+"Sets the string for the method that returns a value from a lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::lookupTableInitialisationString
+"Returns the string for the initialisation of a lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::setLookupTableInitialisationString
+"Sets the string for the initialisation of a lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::ensembleOpenmpPragmaString
+"Returns the string for the OpenMP pragma used to distribute the instances of an ensemble.";
+
+%feature("docstring") libcellml::GeneratorProfile::setEnsembleOpenmpPragmaString
+"Sets the string for the OpenMP pragma used to distribute the instances of an ensemble.";
+
+%feature("docstring") libcellml::GeneratorProfile::ensembleParameterAssignmentString
+"Returns the string for assigning an ensemble parameter to an instance.";
+
+%feature("docstring") libcellml::GeneratorProfile::setEnsembleParameterAssignmentString
+"Sets the string for assigning an ensemble parameter to an instance.";
+
 %feature("docstring") libcellml::GeneratorProfile::externalVariableMethodTypeDefinitionString
 "Returns the string for the type definition of an external variable method.";
 
@@ -953,6 +1112,108 @@ tag, which will be replaced with some code to create the variables array.";
 %feature("docstring") libcellml::GeneratorProfile::setImplementationComputeRatesMethodString
 "Sets the string for the implementation to compute rates.";
 
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputeRushLarsenCoefficientsMethodString
+"Returns the string for the interface to compute the Rush-Larsen coefficients.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputeRushLarsenCoefficientsMethodString
+"Sets the string for the interface to compute the Rush-Larsen coefficients.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeRushLarsenCoefficientsMethodString
+"Returns the string for the implementation to compute the Rush-Larsen coefficients.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeRushLarsenCoefficientsMethodString
+"Sets the string for the implementation to compute the Rush-Larsen coefficients.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeRatesMethodWithLocalVariablesString
+"Returns the string for the implementation of the compute rates method when local variables are used.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeRatesMethodWithLocalVariablesString
+"Sets the string for the implementation of the compute rates method when local variables are used.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceInitialiseLookupTablesMethodString
+"Returns the string for the interface to initialise lookup tables.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceInitialiseLookupTablesMethodString
+"Sets the string for the interface to initialise lookup tables.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationInitialiseLookupTablesMethodString
+"Returns the string for the implementation to initialise lookup tables.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationInitialiseLookupTablesMethodString
+"Sets the string for the implementation to initialise lookup tables.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceInitialiseEnsembleMethodString
+"Returns the string for the interface to initialise an ensemble.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceInitialiseEnsembleMethodString
+"Sets the string for the interface to initialise an ensemble.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationInitialiseEnsembleMethodString
+"Returns the string for the implementation to initialise an ensemble.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationInitialiseEnsembleMethodString
+"Sets the string for the implementation to initialise an ensemble.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputeEnsembleRatesMethodString
+"Returns the string for the interface to compute the rates of an ensemble.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputeEnsembleRatesMethodString
+"Sets the string for the interface to compute the rates of an ensemble.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeEnsembleRatesMethodString
+"Returns the string for the implementation to compute the rates of an ensemble.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeEnsembleRatesMethodString
+"Sets the string for the implementation to compute the rates of an ensemble.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputeEnsembleVariablesMethodString
+"Returns the string for the interface to compute the variables of an ensemble.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputeEnsembleVariablesMethodString
+"Sets the string for the interface to compute the variables of an ensemble.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeEnsembleVariablesMethodString
+"Returns the string for the implementation to compute the variables of an ensemble.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeEnsembleVariablesMethodString
+"Sets the string for the implementation to compute the variables of an ensemble.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceIntegrateForwardEulerMethodString
+"Returns the string for the interface to integrate the model using the forward Euler method.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceIntegrateForwardEulerMethodString
+"Sets the string for the interface to integrate the model using the forward Euler method.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationIntegrateForwardEulerMethodString
+"Returns the string for the implementation to integrate the model using the forward Euler method.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationIntegrateForwardEulerMethodString
+"Sets the string for the implementation to integrate the model using the forward Euler method.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceIntegrateRk4MethodString
+"Returns the string for the interface to integrate the model using the fourth-order Runge-Kutta method.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceIntegrateRk4MethodString
+"Sets the string for the interface to integrate the model using the fourth-order Runge-Kutta method.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationIntegrateRk4MethodString
+"Returns the string for the implementation to integrate the model using the fourth-order Runge-Kutta method.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationIntegrateRk4MethodString
+"Sets the string for the implementation to integrate the model using the fourth-order Runge-Kutta method.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceIntegrateRushLarsenMethodString
+"Returns the string for the interface to integrate the model using the Rush-Larsen method.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceIntegrateRushLarsenMethodString
+"Sets the string for the interface to integrate the model using the Rush-Larsen method.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationIntegrateRushLarsenMethodString
+"Returns the string for the implementation to integrate the model using the Rush-Larsen method.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationIntegrateRushLarsenMethodString
+"Sets the string for the implementation to integrate the model using the Rush-Larsen method.";
+
 %feature("docstring") libcellml::GeneratorProfile::interfaceComputeVariablesMethodString
 "Returns the string for the interface to compute variables.";
 
@@ -57,5 +57,12 @@
 
 %ignore libcellml::Logger::Logger();
 
+// Issue callbacks are not (yet) supported by the bindings.
+%ignore libcellml::IssueCallback;
+%ignore libcellml::Logger::setIssueCallback;
+%ignore libcellml::Logger::issueCallback;
+%ignore libcellml::Logger::setRetainIssues;
+%ignore libcellml::Logger::retainIssues;
+
 %include "libcellml/types.h"
 %include "libcellml/logger.h"
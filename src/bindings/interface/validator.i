@@ -9,6 +9,48 @@
 %feature("docstring") libcellml::Validator
 "Validates CellML objects.";
 
+%feature("docstring") libcellml::Validator::threadCount
+"Returns the number of threads used to validate a model.";
+
+%feature("docstring") libcellml::Validator::setThreadCount
+"Sets the number of threads used to validate a model. If more than one (or zero,
+i.e. as many as supported by the hardware), the components of a model are
+validated in parallel.";
+
+%feature("docstring") libcellml::Validator::isIncremental
+"Tests if this validator only validates again the parts of a model that have been
+modified since its previous validation.";
+
+%feature("docstring") libcellml::Validator::setIncremental
+"Sets whether this validator only validates again the parts of a model that have
+been modified since its previous validation.";
+
+%feature("docstring") libcellml::Validator::maximumErrorCount
+"Returns the maximum number of errors logged when validating a model, or zero if
+there is no maximum.";
+
+%feature("docstring") libcellml::Validator::setMaximumErrorCount
+"Sets the maximum number of errors logged when validating a model. The validation
+stops as soon as that many errors have been logged. Zero means no maximum.";
+
+%feature("docstring") libcellml::Validator::hasMathMLDtdValidation
+"Tests if this validator validates math against the W3C MathML DTD.";
+
+%feature("docstring") libcellml::Validator::setHasMathMLDtdValidation
+"Sets whether this validator validates math against the W3C MathML DTD.";
+
+%feature("docstring") libcellml::Validator::hasMathMLDtdCompatibility
+"Tests if this validator uses the W3C MathML DTD itself to validate math.";
+
+%feature("docstring") libcellml::Validator::setHasMathMLDtdCompatibility
+"Sets whether this validator uses the W3C MathML DTD itself to validate math, rather than validating it natively.";
+
+%feature("docstring") libcellml::Validator::hasUniqueIdValidation
+"Tests if this validator checks that the identifiers in a model are unique.";
+
+%feature("docstring") libcellml::Validator::setHasUniqueIdValidation
+"Sets whether this validator checks that the identifiers in a model are unique.";
+
 %feature("docstring") libcellml::Validator::validateModel
 "Validate the given `model` and its encapsulated entities using the CellML 2.0
 Specification. Any errors will be logged in the `Validator`.";
@@ -45,6 +45,7 @@ EMSCRIPTEN_BINDINGS(libcellml_analyserequation)
         .function("nlaSiblings", &libcellml::AnalyserEquation::nlaSiblings)
         .function("nlaSibling", &libcellml::AnalyserEquation::nlaSibling)
         .function("isStateRateBased", &libcellml::AnalyserEquation::isStateRateBased)
+        .function("lookupTableState", &libcellml::AnalyserEquation::lookupTableState)
         .function("variableCount", &libcellml::AnalyserEquation::variableCount)
         .function("variables", &libcellml::AnalyserEquation::variables)
         .function("variable", &libcellml::AnalyserEquation::variable)
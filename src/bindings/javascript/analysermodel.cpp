@@ -51,6 +51,12 @@ EMSCRIPTEN_BINDINGS(libcellml_analysermodel)
         .function("equationCount", &libcellml::AnalyserModel::equationCount)
         .function("equations", &libcellml::AnalyserModel::equations)
         .function("equation", &libcellml::AnalyserModel::equation)
+        .function("jacobianNonZeroCount", &libcellml::AnalyserModel::jacobianNonZeroCount)
+        .function("jacobianRowOffsets", &libcellml::AnalyserModel::jacobianRowOffsets)
+        .function("jacobianColumnIndices", &libcellml::AnalyserModel::jacobianColumnIndices)
+        .function("stateDependencies", &libcellml::AnalyserModel::stateDependencies)
+        .function("equationDependencyRowOffsets", &libcellml::AnalyserModel::equationDependencyRowOffsets)
+        .function("equationDependencyColumnIndices", &libcellml::AnalyserModel::equationDependencyColumnIndices)
         .function("needEqFunction", &libcellml::AnalyserModel::needEqFunction)
         .function("needNeqFunction", &libcellml::AnalyserModel::needNeqFunction)
         .function("needLtFunction", &libcellml::AnalyserModel::needLtFunction)
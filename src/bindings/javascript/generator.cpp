@@ -30,8 +30,33 @@ EMSCRIPTEN_BINDINGS(libcellml_generator)
         .function("setProfile", &libcellml::Generator::setProfile)
         .function("model", &libcellml::Generator::model)
         .function("setModel", &libcellml::Generator::setModel)
+        .function("addLookupTable", &libcellml::Generator::addLookupTable)
+        .function("removeLookupTable", &libcellml::Generator::removeLookupTable)
+        .function("removeAllLookupTables", &libcellml::Generator::removeAllLookupTables)
+        .function("containsLookupTable", &libcellml::Generator::containsLookupTable)
+        .function("lookupTableCount", &libcellml::Generator::lookupTableCount)
+        .function("hasConstantSpecialisation", &libcellml::Generator::hasConstantSpecialisation)
+        .function("setConstantSpecialisation", &libcellml::Generator::setConstantSpecialisation)
+        .function("addConstantOverride", &libcellml::Generator::addConstantOverride)
+        .function("removeConstantOverride", &libcellml::Generator::removeConstantOverride)
+        .function("removeAllConstantOverrides", &libcellml::Generator::removeAllConstantOverrides)
+        .function("containsConstantOverride", &libcellml::Generator::containsConstantOverride)
+        .function("constantOverrideCount", &libcellml::Generator::constantOverrideCount)
+        .function("addEnsembleParameter", &libcellml::Generator::addEnsembleParameter)
+        .function("removeEnsembleParameter", &libcellml::Generator::removeEnsembleParameter)
+        .function("removeAllEnsembleParameters", &libcellml::Generator::removeAllEnsembleParameters)
+        .function("containsEnsembleParameter", &libcellml::Generator::containsEnsembleParameter)
+        .function("ensembleParameterCount", &libcellml::Generator::ensembleParameterCount)
+        .function("addSensitivityParameter", &libcellml::Generator::addSensitivityParameter)
+        .function("removeSensitivityParameter", &libcellml::Generator::removeSensitivityParameter)
+        .function("removeAllSensitivityParameters", &libcellml::Generator::removeAllSensitivityParameters)
+        .function("containsSensitivityParameter", &libcellml::Generator::containsSensitivityParameter)
+        .function("sensitivityParameterCount", &libcellml::Generator::sensitivityParameterCount)
+        .function("implementationChunkCount", &libcellml::Generator::implementationChunkCount)
+        .function("setImplementationChunkCount", &libcellml::Generator::setImplementationChunkCount)
         .function("interfaceCode", &libcellml::Generator::interfaceCode)
         .function("implementationCode", &libcellml::Generator::implementationCode)
+        .function("implementationChunkCode", &libcellml::Generator::implementationChunkCode)
         .class_function("equationCode", select_overload<std::string(const libcellml::AnalyserEquationAstPtr &)>(&libcellml::Generator::equationCode))
         .class_function("equationCodeByProfile", select_overload<std::string(const libcellml::AnalyserEquationAstPtr &, const libcellml::GeneratorProfilePtr &)>(&libcellml::Generator::equationCode))
     ;
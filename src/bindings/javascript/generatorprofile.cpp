@@ -26,6 +26,14 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorprofile)
     enum_<libcellml::GeneratorProfile::Profile>("GeneratorProfile.Profile")
         .value("C", libcellml::GeneratorProfile::Profile::C)
         .value("PYTHON", libcellml::GeneratorProfile::Profile::PYTHON)
+        .value("CPP", libcellml::GeneratorProfile::Profile::CPP)
+        .value("NUMPY", libcellml::GeneratorProfile::Profile::NUMPY)
+    ;
+
+    enum_<libcellml::GeneratorProfile::Precision>("GeneratorProfile.Precision")
+        .value("DOUBLE", libcellml::GeneratorProfile::Precision::DOUBLE)
+        .value("SINGLE", libcellml::GeneratorProfile::Precision::SINGLE)
+        .value("MIXED", libcellml::GeneratorProfile::Precision::MIXED)
     ;
 
     class_<libcellml::GeneratorProfile>("GeneratorProfile")
@@ -33,8 +41,17 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorprofile)
         .function("profile", &libcellml::GeneratorProfile::profile)
         .class_function("profileAsString", &libcellml::GeneratorProfile::profileAsString)
         .function("setProfile", &libcellml::GeneratorProfile::setProfile)
+        .function("precision", &libcellml::GeneratorProfile::precision)
+        .class_function("precisionAsString", &libcellml::GeneratorProfile::precisionAsString)
+        .function("setPrecision", &libcellml::GeneratorProfile::setPrecision)
         .function("hasInterface", &libcellml::GeneratorProfile::hasInterface)
         .function("setHasInterface", &libcellml::GeneratorProfile::setHasInterface)
+        .function("hasComputeRushLarsenCoefficientsMethod", &libcellml::GeneratorProfile::hasComputeRushLarsenCoefficientsMethod)
+        .function("setHasComputeRushLarsenCoefficientsMethod", &libcellml::GeneratorProfile::setHasComputeRushLarsenCoefficientsMethod)
+        .function("hasLocalVariablesInComputeRates", &libcellml::GeneratorProfile::hasLocalVariablesInComputeRates)
+        .function("setHasLocalVariablesInComputeRates", &libcellml::GeneratorProfile::setHasLocalVariablesInComputeRates)
+        .function("hasIntegrateMethods", &libcellml::GeneratorProfile::hasIntegrateMethods)
+        .function("setHasIntegrateMethods", &libcellml::GeneratorProfile::setHasIntegrateMethods)
         .function("equalityString", &libcellml::GeneratorProfile::equalityString)
         .function("setEqualityString", &libcellml::GeneratorProfile::setEqualityString)
         .function("eqString", &libcellml::GeneratorProfile::eqString)
@@ -181,6 +198,8 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorprofile)
         .function("setInfString", &libcellml::GeneratorProfile::setInfString)
         .function("nanString", &libcellml::GeneratorProfile::nanString)
         .function("setNanString", &libcellml::GeneratorProfile::setNanString)
+        .function("literalSuffixString", &libcellml::GeneratorProfile::literalSuffixString)
+        .function("setLiteralSuffixString", &libcellml::GeneratorProfile::setLiteralSuffixString)
         .function("eqFunctionString", &libcellml::GeneratorProfile::eqFunctionString)
         .function("setEqFunctionString", &libcellml::GeneratorProfile::setEqFunctionString)
         .function("neqFunctionString", &libcellml::GeneratorProfile::neqFunctionString)
@@ -239,6 +258,12 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorprofile)
         .function("setInterfaceHeaderString", &libcellml::GeneratorProfile::setInterfaceHeaderString)
         .function("implementationHeaderString", &libcellml::GeneratorProfile::implementationHeaderString)
         .function("setImplementationHeaderString", &libcellml::GeneratorProfile::setImplementationHeaderString)
+        .function("namespaceString", &libcellml::GeneratorProfile::namespaceString)
+        .function("setNamespaceString", &libcellml::GeneratorProfile::setNamespaceString)
+        .function("implementationNamespaceBeginString", &libcellml::GeneratorProfile::implementationNamespaceBeginString)
+        .function("setImplementationNamespaceBeginString", &libcellml::GeneratorProfile::setImplementationNamespaceBeginString)
+        .function("implementationNamespaceEndString", &libcellml::GeneratorProfile::implementationNamespaceEndString)
+        .function("setImplementationNamespaceEndString", &libcellml::GeneratorProfile::setImplementationNamespaceEndString)
         .function("interfaceVersionString", &libcellml::GeneratorProfile::interfaceVersionString)
         .function("setInterfaceVersionString", &libcellml::GeneratorProfile::setInterfaceVersionString)
         .function("implementationVersionString", &libcellml::GeneratorProfile::implementationVersionString)
@@ -255,6 +280,10 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorprofile)
         .function("setInterfaceVariableCountString", &libcellml::GeneratorProfile::setInterfaceVariableCountString)
         .function("implementationVariableCountString", &libcellml::GeneratorProfile::implementationVariableCountString)
         .function("setImplementationVariableCountString", &libcellml::GeneratorProfile::setImplementationVariableCountString)
+        .function("interfaceEnsembleParameterCountString", &libcellml::GeneratorProfile::interfaceEnsembleParameterCountString)
+        .function("setInterfaceEnsembleParameterCountString", &libcellml::GeneratorProfile::setInterfaceEnsembleParameterCountString)
+        .function("implementationEnsembleParameterCountString", &libcellml::GeneratorProfile::implementationEnsembleParameterCountString)
+        .function("setImplementationEnsembleParameterCountString", &libcellml::GeneratorProfile::setImplementationEnsembleParameterCountString)
         .function("variableTypeObjectString", &libcellml::GeneratorProfile::variableTypeObjectString)
         .function("setVariableTypeObjectString", &libcellml::GeneratorProfile::setVariableTypeObjectString)
         .function("variableOfIntegrationVariableTypeString", &libcellml::GeneratorProfile::variableOfIntegrationVariableTypeString)
@@ -293,6 +322,38 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorprofile)
         .function("setRatesArrayString", &libcellml::GeneratorProfile::setRatesArrayString)
         .function("variablesArrayString", &libcellml::GeneratorProfile::variablesArrayString)
         .function("setVariablesArrayString", &libcellml::GeneratorProfile::setVariablesArrayString)
+        .function("rushLarsenTausArrayString", &libcellml::GeneratorProfile::rushLarsenTausArrayString)
+        .function("setRushLarsenTausArrayString", &libcellml::GeneratorProfile::setRushLarsenTausArrayString)
+        .function("rushLarsenSteadyStatesArrayString", &libcellml::GeneratorProfile::rushLarsenSteadyStatesArrayString)
+        .function("setRushLarsenSteadyStatesArrayString", &libcellml::GeneratorProfile::setRushLarsenSteadyStatesArrayString)
+        .function("localVariableNameString", &libcellml::GeneratorProfile::localVariableNameString)
+        .function("setLocalVariableNameString", &libcellml::GeneratorProfile::setLocalVariableNameString)
+        .function("localVariableDeclarationString", &libcellml::GeneratorProfile::localVariableDeclarationString)
+        .function("setLocalVariableDeclarationString", &libcellml::GeneratorProfile::setLocalVariableDeclarationString)
+        .function("forwardEulerStateUpdateString", &libcellml::GeneratorProfile::forwardEulerStateUpdateString)
+        .function("setForwardEulerStateUpdateString", &libcellml::GeneratorProfile::setForwardEulerStateUpdateString)
+        .function("rushLarsenStateUpdateString", &libcellml::GeneratorProfile::rushLarsenStateUpdateString)
+        .function("setRushLarsenStateUpdateString", &libcellml::GeneratorProfile::setRushLarsenStateUpdateString)
+        .function("sensitivityNameString", &libcellml::GeneratorProfile::sensitivityNameString)
+        .function("setSensitivityNameString", &libcellml::GeneratorProfile::setSensitivityNameString)
+        .function("chunkMethodNameString", &libcellml::GeneratorProfile::chunkMethodNameString)
+        .function("setChunkMethodNameString", &libcellml::GeneratorProfile::setChunkMethodNameString)
+        .function("lookupTableDeclarationString", &libcellml::GeneratorProfile::lookupTableDeclarationString)
+        .function("setLookupTableDeclarationString", &libcellml::GeneratorProfile::setLookupTableDeclarationString)
+        .function("lookupTableEntryString", &libcellml::GeneratorProfile::lookupTableEntryString)
+        .function("setLookupTableEntryString", &libcellml::GeneratorProfile::setLookupTableEntryString)
+        .function("lookupTableValueCallString", &libcellml::GeneratorProfile::lookupTableValueCallString)
+        .function("setLookupTableValueCallString", &libcellml::GeneratorProfile::setLookupTableValueCallString)
+        .function("lookupTableErrorString", &libcellml::GeneratorProfile::lookupTableErrorString)
+        .function("setLookupTableErrorString", &libcellml::GeneratorProfile::setLookupTableErrorString)
+        .function("lookupTableValueMethodString", &libcellml::GeneratorProfile::lookupTableValueMethodString)
+        .function("setLookupTableValueMethodString", &libcellml::GeneratorProfile::setLookupTableValueMethodString)
+        .function("lookupTableInitialisationString", &libcellml::GeneratorProfile::lookupTableInitialisationString)
+        .function("setLookupTableInitialisationString", &libcellml::GeneratorProfile::setLookupTableInitialisationString)
+        .function("ensembleOpenmpPragmaString", &libcellml::GeneratorProfile::ensembleOpenmpPragmaString)
+        .function("setEnsembleOpenmpPragmaString", &libcellml::GeneratorProfile::setEnsembleOpenmpPragmaString)
+        .function("ensembleParameterAssignmentString", &libcellml::GeneratorProfile::ensembleParameterAssignmentString)
+        .function("setEnsembleParameterAssignmentString", &libcellml::GeneratorProfile::setEnsembleParameterAssignmentString)
         .function("externalVariableMethodTypeDefinitionString", &libcellml::GeneratorProfile::externalVariableMethodTypeDefinitionString)
         .function("setExternalVariableMethodTypeDefinitionString", &libcellml::GeneratorProfile::setExternalVariableMethodTypeDefinitionString)
         .function("externalVariableMethodCallString", &libcellml::GeneratorProfile::externalVariableMethodCallString)
@@ -337,6 +398,40 @@ EMSCRIPTEN_BINDINGS(libcellml_generatorprofile)
         .function("setInterfaceComputeRatesMethodString", &libcellml::GeneratorProfile::setInterfaceComputeRatesMethodString)
         .function("implementationComputeRatesMethodString", &libcellml::GeneratorProfile::implementationComputeRatesMethodString)
         .function("setImplementationComputeRatesMethodString", &libcellml::GeneratorProfile::setImplementationComputeRatesMethodString)
+        .function("interfaceComputeRushLarsenCoefficientsMethodString", &libcellml::GeneratorProfile::interfaceComputeRushLarsenCoefficientsMethodString)
+        .function("setInterfaceComputeRushLarsenCoefficientsMethodString", &libcellml::GeneratorProfile::setInterfaceComputeRushLarsenCoefficientsMethodString)
+        .function("implementationComputeRushLarsenCoefficientsMethodString", &libcellml::GeneratorProfile::implementationComputeRushLarsenCoefficientsMethodString)
+        .function("setImplementationComputeRushLarsenCoefficientsMethodString", &libcellml::GeneratorProfile::setImplementationComputeRushLarsenCoefficientsMethodString)
+        .function("implementationComputeRatesMethodWithLocalVariablesString", &libcellml::GeneratorProfile::implementationComputeRatesMethodWithLocalVariablesString)
+        .function("setImplementationComputeRatesMethodWithLocalVariablesString", &libcellml::GeneratorProfile::setImplementationComputeRatesMethodWithLocalVariablesString)
+        .function("interfaceInitialiseLookupTablesMethodString", &libcellml::GeneratorProfile::interfaceInitialiseLookupTablesMethodString)
+        .function("setInterfaceInitialiseLookupTablesMethodString", &libcellml::GeneratorProfile::setInterfaceInitialiseLookupTablesMethodString)
+        .function("implementationInitialiseLookupTablesMethodString", &libcellml::GeneratorProfile::implementationInitialiseLookupTablesMethodString)
+        .function("setImplementationInitialiseLookupTablesMethodString", &libcellml::GeneratorProfile::setImplementationInitialiseLookupTablesMethodString)
+        .function("interfaceInitialiseEnsembleMethodString", &libcellml::GeneratorProfile::interfaceInitialiseEnsembleMethodString)
+        .function("setInterfaceInitialiseEnsembleMethodString", &libcellml::GeneratorProfile::setInterfaceInitialiseEnsembleMethodString)
+        .function("implementationInitialiseEnsembleMethodString", &libcellml::GeneratorProfile::implementationInitialiseEnsembleMethodString)
+        .function("setImplementationInitialiseEnsembleMethodString", &libcellml::GeneratorProfile::setImplementationInitialiseEnsembleMethodString)
+        .function("interfaceComputeEnsembleRatesMethodString", &libcellml::GeneratorProfile::interfaceComputeEnsembleRatesMethodString)
+        .function("setInterfaceComputeEnsembleRatesMethodString", &libcellml::GeneratorProfile::setInterfaceComputeEnsembleRatesMethodString)
+        .function("implementationComputeEnsembleRatesMethodString", &libcellml::GeneratorProfile::implementationComputeEnsembleRatesMethodString)
+        .function("setImplementationComputeEnsembleRatesMethodString", &libcellml::GeneratorProfile::setImplementationComputeEnsembleRatesMethodString)
+        .function("interfaceComputeEnsembleVariablesMethodString", &libcellml::GeneratorProfile::interfaceComputeEnsembleVariablesMethodString)
+        .function("setInterfaceComputeEnsembleVariablesMethodString", &libcellml::GeneratorProfile::setInterfaceComputeEnsembleVariablesMethodString)
+        .function("implementationComputeEnsembleVariablesMethodString", &libcellml::GeneratorProfile::implementationComputeEnsembleVariablesMethodString)
+        .function("setImplementationComputeEnsembleVariablesMethodString", &libcellml::GeneratorProfile::setImplementationComputeEnsembleVariablesMethodString)
+        .function("interfaceIntegrateForwardEulerMethodString", &libcellml::GeneratorProfile::interfaceIntegrateForwardEulerMethodString)
+        .function("setInterfaceIntegrateForwardEulerMethodString", &libcellml::GeneratorProfile::setInterfaceIntegrateForwardEulerMethodString)
+        .function("implementationIntegrateForwardEulerMethodString", &libcellml::GeneratorProfile::implementationIntegrateForwardEulerMethodString)
+        .function("setImplementationIntegrateForwardEulerMethodString", &libcellml::GeneratorProfile::setImplementationIntegrateForwardEulerMethodString)
+        .function("interfaceIntegrateRk4MethodString", &libcellml::GeneratorProfile::interfaceIntegrateRk4MethodString)
+        .function("setInterfaceIntegrateRk4MethodString", &libcellml::GeneratorProfile::setInterfaceIntegrateRk4MethodString)
+        .function("implementationIntegrateRk4MethodString", &libcellml::GeneratorProfile::implementationIntegrateRk4MethodString)
+        .function("setImplementationIntegrateRk4MethodString", &libcellml::GeneratorProfile::setImplementationIntegrateRk4MethodString)
+        .function("interfaceIntegrateRushLarsenMethodString", &libcellml::GeneratorProfile::interfaceIntegrateRushLarsenMethodString)
+        .function("setInterfaceIntegrateRushLarsenMethodString", &libcellml::GeneratorProfile::setInterfaceIntegrateRushLarsenMethodString)
+        .function("implementationIntegrateRushLarsenMethodString", &libcellml::GeneratorProfile::implementationIntegrateRushLarsenMethodString)
+        .function("setImplementationIntegrateRushLarsenMethodString", &libcellml::GeneratorProfile::setImplementationIntegrateRushLarsenMethodString)
         .function("interfaceComputeVariablesMethodString", &libcellml::GeneratorProfile::interfaceComputeVariablesMethodString)
         .function("setInterfaceComputeVariablesMethodString", &libcellml::GeneratorProfile::setInterfaceComputeVariablesMethodString)
         .function("implementationComputeVariablesMethodString", &libcellml::GeneratorProfile::implementationComputeVariablesMethodString)
@@ -27,6 +27,7 @@ EMSCRIPTEN_BINDINGS(libcellml_types)
     register_vector<libcellml::VariablePtr>("VectorVariablePtr");
     register_vector<libcellml::AnalyserVariablePtr>("VectorAnalyserVariablePtr");
     register_vector<libcellml::AnalyserEquationPtr>("VectorAnalyserEquation");
+    register_vector<size_t>("VectorSizeT");
 
     class_<libcellml::UnitsItem>("UnitsItem")
         .smart_ptr_constructor("UnitsItem", select_overload<libcellml::UnitsItemPtr(const libcellml::UnitsPtr &, size_t)>(&libcellml::UnitsItem::create))
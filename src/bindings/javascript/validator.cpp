@@ -24,6 +24,18 @@ EMSCRIPTEN_BINDINGS(libcellml_validator) {
 
     class_<libcellml::Validator, base<libcellml::Logger>>("Validator")
         .smart_ptr_constructor("Validator", &libcellml::Validator::create)
+        .function("threadCount", &libcellml::Validator::threadCount)
+        .function("setThreadCount", &libcellml::Validator::setThreadCount)
+        .function("isIncremental", &libcellml::Validator::isIncremental)
+        .function("setIncremental", &libcellml::Validator::setIncremental)
+        .function("maximumErrorCount", &libcellml::Validator::maximumErrorCount)
+        .function("setMaximumErrorCount", &libcellml::Validator::setMaximumErrorCount)
+        .function("hasMathMLDtdValidation", &libcellml::Validator::hasMathMLDtdValidation)
+        .function("setHasMathMLDtdValidation", &libcellml::Validator::setHasMathMLDtdValidation)
+        .function("hasMathMLDtdCompatibility", &libcellml::Validator::hasMathMLDtdCompatibility)
+        .function("setHasMathMLDtdCompatibility", &libcellml::Validator::setHasMathMLDtdCompatibility)
+        .function("hasUniqueIdValidation", &libcellml::Validator::hasUniqueIdValidation)
+        .function("setHasUniqueIdValidation", &libcellml::Validator::setHasUniqueIdValidation)
         .function("validateModel", &libcellml::Validator::validateModel)
     ;
 }
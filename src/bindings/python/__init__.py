@@ -175,6 +175,13 @@ convert(AnalyserVariable, 'Type', [
 convert(GeneratorProfile, 'Profile', [
     'C',
     'PYTHON',
+    'CPP',
+    'NUMPY',
+])
+convert(GeneratorProfile, 'Precision', [
+    'DOUBLE',
+    'SINGLE',
+    'MIXED',
 ])
 convert(Issue, 'Cause', [
     'COMPONENT',
@@ -37,8 +37,12 @@ namespace libcellml {
 
 std::vector<VariablePtr>::const_iterator Component::ComponentImpl::findVariable(const std::string &name) const
 {
-    return std::find_if(mVariables.begin(), mVariables.end(),
-                        [=](const VariablePtr &v) -> bool { return v->name() == name; });
+    auto index = mVariableNames.find(name);
+    if (index == NameIndex::npos) {
+        return mVariables.end();
+    }
+
+    return mVariables.begin() + ptrdiff_t(index);
 }
 
 std::vector<VariablePtr>::const_iterator Component::ComponentImpl::findVariable(const VariablePtr &variable) const
@@ -187,6 +191,8 @@ void Component::setSourceComponent(ImportSourcePtr &importSource, const std::str
 void Component::appendMath(const std::string &math)
 {
     pFunc()->mMath.append(math);
+
+    EntityImpl::markModified(this);
 }
 
 std::string Component::math() const
@@ -197,11 +203,15 @@ std::string Component::math() const
 void Component::setMath(const std::string &math)
 {
     pFunc()->mMath = math;
+
+    EntityImpl::markModified(this);
 }
 
 void Component::removeMath()
 {
     pFunc()->mMath.clear();
+
+    EntityImpl::markModified(this);
 }
 
 bool Component::addVariable(const VariablePtr &variable)
@@ -219,7 +229,10 @@ bool Component::addVariable(const VariablePtr &variable)
     }
 
     variable->pFunc()->setParent(thisComponent);
+    variable->pFunc()->mNameIndex = &pFunc()->mVariableNames;
     pFunc()->mVariables.push_back(variable);
+    pFunc()->mVariableNames.append(variable.get());
+    EntityImpl::markModified(this);
     return true;
 }
 
@@ -228,7 +241,10 @@ bool Component::removeVariable(size_t index)
     if (index < pFunc()->mVariables.size()) {
         auto variable = pFunc()->mVariables[index];
         pFunc()->mVariables.erase(pFunc()->mVariables.begin() + ptrdiff_t(index));
+        pFunc()->mVariableNames.remove(index);
         variable->pFunc()->removeParent();
+        variable->pFunc()->mNameIndex = nullptr;
+        EntityImpl::markModified(this);
         return true;
     }
 
@@ -240,7 +256,10 @@ bool Component::removeVariable(const std::string &name)
     auto result = pFunc()->findVariable(name);
     if (result != pFunc()->mVariables.end()) {
         (*result)->pFunc()->removeParent();
+        (*result)->pFunc()->mNameIndex = nullptr;
+        pFunc()->mVariableNames.remove(size_t(result - pFunc()->mVariables.begin()));
         pFunc()->mVariables.erase(result);
+        EntityImpl::markModified(this);
         return true;
     }
 
@@ -251,8 +270,11 @@ bool Component::removeVariable(const VariablePtr &variable)
 {
     auto result = pFunc()->findVariable(variable);
     if (result != pFunc()->mVariables.end()) {
+        pFunc()->mVariableNames.remove(size_t(result - pFunc()->mVariables.begin()));
         pFunc()->mVariables.erase(result);
         variable->pFunc()->removeParent();
+        variable->pFunc()->mNameIndex = nullptr;
+        EntityImpl::markModified(this);
         return true;
     }
 
@@ -263,8 +285,12 @@ void Component::removeAllVariables()
 {
     for (const auto &variable : pFunc()->mVariables) {
         variable->pFunc()->removeParent();
+        variable->pFunc()->mNameIndex = nullptr;
     }
     pFunc()->mVariables.clear();
+    pFunc()->mVariableNames.clear();
+
+    EntityImpl::markModified(this);
 }
 
 VariablePtr Component::variable(size_t index) const
@@ -335,6 +361,7 @@ bool Component::addReset(const ResetPtr &reset)
     }
     reset->pFunc()->setParent(thisComponent);
     pFunc()->mResets.push_back(reset);
+    EntityImpl::markModified(this);
     return true;
 }
 
@@ -343,6 +370,7 @@ bool Component::removeReset(size_t index)
     if (index < pFunc()->mResets.size()) {
         pFunc()->mResets.at(index)->pFunc()->removeParent();
         pFunc()->mResets.erase(pFunc()->mResets.begin() + ptrdiff_t(index));
+        EntityImpl::markModified(this);
         return true;
     }
     return false;
@@ -354,6 +382,7 @@ bool Component::removeReset(const ResetPtr &reset)
     if (result != pFunc()->mResets.end()) {
         (*result)->pFunc()->removeParent();
         pFunc()->mResets.erase(result);
+        EntityImpl::markModified(this);
         return true;
     }
     return false;
@@ -365,6 +394,8 @@ void Component::removeAllResets()
         reset->pFunc()->removeParent();
     }
     pFunc()->mResets.clear();
+
+    EntityImpl::markModified(this);
 }
 
 ResetPtr Component::takeReset(size_t index)
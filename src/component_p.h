@@ -37,6 +37,7 @@ public:
     std::string mMath;
     std::vector<ResetPtr> mResets;
     std::vector<VariablePtr> mVariables;
+    NameIndex mVariableNames; /**< Index of the names of the variables in mVariables. */
 
     std::vector<ResetPtr>::const_iterator findReset(const ResetPtr &reset) const;
     std::vector<VariablePtr>::const_iterator findVariable(const std::string &name) const;
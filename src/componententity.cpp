@@ -31,8 +31,12 @@ namespace libcellml {
 
 std::vector<ComponentPtr>::const_iterator ComponentEntity::ComponentEntityImpl::findComponent(const std::string &name) const
 {
-    return std::find_if(mComponents.begin(), mComponents.end(),
-                        [=](const ComponentPtr &c) -> bool { return c->name() == name; });
+    auto index = mComponentNames.find(name);
+    if (index == NameIndex::npos) {
+        return mComponents.end();
+    }
+
+    return mComponents.begin() + ptrdiff_t(index);
 }
 
 std::vector<ComponentPtr>::const_iterator ComponentEntity::ComponentEntityImpl::findComponent(const ComponentPtr &component) const
@@ -67,7 +71,10 @@ bool ComponentEntity::addComponent(const ComponentPtr &component)
 
 bool ComponentEntity::doAddComponent(const ComponentPtr &component)
 {
+    component->pFunc()->mNameIndex = &pFunc()->mComponentNames;
     pFunc()->mComponents.push_back(component);
+    pFunc()->mComponentNames.append(component.get());
+    EntityImpl::markModified(this);
     return true;
 }
 
@@ -77,7 +84,10 @@ bool ComponentEntity::removeComponent(const std::string &name, bool searchEncaps
     auto result = pFunc()->findComponent(name);
     if (result != pFunc()->mComponents.end()) {
         (*result)->pFunc()->removeParent();
+        (*result)->pFunc()->mNameIndex = nullptr;
+        pFunc()->mComponentNames.remove(size_t(result - pFunc()->mComponents.begin()));
         pFunc()->mComponents.erase(result);
+        EntityImpl::markModified(this);
         status = true;
     } else if (searchEncapsulated) {
         for (size_t i = 0; i < componentCount() && !status; ++i) {
@@ -94,7 +104,10 @@ bool ComponentEntity::removeComponent(size_t index)
     if (index < pFunc()->mComponents.size()) {
         auto component = pFunc()->mComponents[index];
         pFunc()->mComponents.erase(pFunc()->mComponents.begin() + ptrdiff_t(index));
+        pFunc()->mComponentNames.remove(index);
         component->pFunc()->removeParent();
+        component->pFunc()->mNameIndex = nullptr;
+        EntityImpl::markModified(this);
         status = true;
     }
 
@@ -107,7 +120,10 @@ bool ComponentEntity::removeComponent(const ComponentPtr &component, bool search
     auto result = pFunc()->findComponent(component);
     if (result != pFunc()->mComponents.end()) {
         component->pFunc()->removeParent();
+        component->pFunc()->mNameIndex = nullptr;
+        pFunc()->mComponentNames.remove(size_t(result - pFunc()->mComponents.begin()));
         pFunc()->mComponents.erase(result);
+        EntityImpl::markModified(this);
         status = true;
     } else if (searchEncapsulated) {
         for (size_t i = 0; i < componentCount() && !status; ++i) {
@@ -122,8 +138,12 @@ void ComponentEntity::removeAllComponents()
 {
     for (auto &component : pFunc()->mComponents) {
         component->pFunc()->removeParent();
+        component->pFunc()->mNameIndex = nullptr;
     }
     pFunc()->mComponents.clear();
+    pFunc()->mComponentNames.clear();
+
+    EntityImpl::markModified(this);
 }
 
 size_t ComponentEntity::componentCount() const
@@ -192,7 +212,10 @@ ComponentPtr ComponentEntity::takeComponent(size_t index)
     if (index < pFunc()->mComponents.size()) {
         component = pFunc()->mComponents.at(index);
         pFunc()->mComponents.erase(pFunc()->mComponents.begin() + ptrdiff_t(index));
+        pFunc()->mComponentNames.remove(index);
         component->pFunc()->removeParent();
+        component->pFunc()->mNameIndex = nullptr;
+        EntityImpl::markModified(this);
     }
 
     return component;
@@ -204,8 +227,11 @@ ComponentPtr ComponentEntity::takeComponent(const std::string &name, bool search
     auto result = pFunc()->findComponent(name);
     if (result != pFunc()->mComponents.end()) {
         foundComponent = *result;
+        pFunc()->mComponentNames.remove(size_t(result - pFunc()->mComponents.begin()));
         pFunc()->mComponents.erase(result);
         foundComponent->pFunc()->removeParent();
+        foundComponent->pFunc()->mNameIndex = nullptr;
+        EntityImpl::markModified(this);
     } else if (searchEncapsulated) {
         for (size_t i = 0; i < componentCount() && !foundComponent; ++i) {
             foundComponent = component(i)->takeComponent(name, searchEncapsulated);
@@ -226,7 +252,9 @@ bool ComponentEntity::replaceComponent(size_t index, const ComponentPtr &newComp
 
     if (removeComponent(index)) {
         pFunc()->mComponents.insert(pFunc()->mComponents.begin() + ptrdiff_t(index), newComponent);
+        pFunc()->mComponentNames.insert(index, newComponent.get());
         newComponent->pFunc()->setParent(parent);
+        newComponent->pFunc()->mNameIndex = &pFunc()->mComponentNames;
         status = true;
     }
 
@@ -261,6 +289,8 @@ bool ComponentEntity::replaceComponent(const ComponentPtr &oldComponent, const C
 void ComponentEntity::setEncapsulationId(const std::string &id)
 {
     pFunc()->mEncapsulationId = id;
+
+    EntityImpl::markModified(this);
 }
 
 std::string ComponentEntity::encapsulationId() const
@@ -271,6 +301,8 @@ std::string ComponentEntity::encapsulationId() const
 void ComponentEntity::removeEncapsulationId()
 {
     pFunc()->mEncapsulationId = "";
+
+    EntityImpl::markModified(this);
 }
 
 bool ComponentEntity::doEquals(const EntityPtr &other) const
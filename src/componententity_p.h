@@ -35,6 +35,7 @@ class ComponentEntity::ComponentEntityImpl: public NamedEntityImpl
 {
 public:
     std::vector<ComponentPtr> mComponents;
+    NameIndex mComponentNames; /**< Index of the names of the components in mComponents. */
     std::string mEncapsulationId;
 
     std::vector<ComponentPtr>::const_iterator findComponent(const std::string &name) const;
@@ -25,6 +25,10 @@ namespace libcellml {
  * See docs/dev_utilities.rst for further information.
  */
 static const char C_GENERATOR_PROFILE_SHA1[] = "${C_GENERATOR_PROFILE_SHA1_VALUE}";
+static const char C_SINGLE_PRECISION_GENERATOR_PROFILE_SHA1[] = "${C_SINGLE_PRECISION_GENERATOR_PROFILE_SHA1_VALUE}";
+static const char C_MIXED_PRECISION_GENERATOR_PROFILE_SHA1[] = "${C_MIXED_PRECISION_GENERATOR_PROFILE_SHA1_VALUE}";
 static const char PYTHON_GENERATOR_PROFILE_SHA1[] = "${PYTHON_GENERATOR_PROFILE_SHA1_VALUE}";
+static const char CPP_GENERATOR_PROFILE_SHA1[] = "${CPP_GENERATOR_PROFILE_SHA1_VALUE}";
+static const char NUMPY_GENERATOR_PROFILE_SHA1[] = "${NUMPY_GENERATOR_PROFILE_SHA1_VALUE}";
 
 } // namespace libcellml
@@ -16,14 +16,60 @@ limitations under the License.
 
 #include "libcellml/entity.h"
 
+#include <atomic>
 #include <utility>
 
+#include "libcellml/parentedentity.h"
+
 #include "entity_p.h"
 
 namespace libcellml {
 
 using EntityWeakPtr = std::weak_ptr<Entity>; /**< Type definition for weak entity pointer. */
 
+/**
+ * @brief Return a revision that has never been returned before.
+ *
+ * Return a revision that has never been returned before, so that a revision
+ * uniquely identifies the state of an entity.
+ *
+ * @return The new revision.
+ */
+size_t newRevision()
+{
+    static std::atomic<size_t> revision(0);
+
+    return ++revision;
+}
+
+Entity::EntityImpl::EntityImpl()
+    : mRevision(newRevision())
+    , mTreeRevision(mRevision)
+{
+}
+
+void Entity::EntityImpl::markModified()
+{
+    mRevision = newRevision();
+    mTreeRevision = mRevision;
+}
+
+void Entity::EntityImpl::markModified(Entity *entity)
+{
+    auto pImpl = entity->pFunc();
+
+    pImpl->markModified();
+
+    auto parentedEntity = dynamic_cast<ParentedEntity *>(entity);
+    auto parent = (parentedEntity != nullptr) ? parentedEntity->parent() : nullptr;
+
+    while (parent != nullptr) {
+        static_cast<Entity *>(parent.get())->pFunc()->mTreeRevision = pImpl->mRevision;
+
+        parent = parent->parent();
+    }
+}
+
 Entity::Entity(Entity::EntityImpl *derivedPimpl)
     : mPimpl(derivedPimpl)
 {
@@ -34,6 +80,8 @@ Entity::~Entity() = default;
 void Entity::setId(const std::string &id)
 {
     pFunc()->mId = id;
+
+    EntityImpl::markModified(this);
 }
 
 std::string Entity::id() const
@@ -44,6 +92,8 @@ std::string Entity::id() const
 void Entity::removeId()
 {
     pFunc()->mId = "";
+
+    EntityImpl::markModified(this);
 }
 
 bool Entity::equals(const EntityPtr &other) const
@@ -29,6 +29,34 @@ class Entity::EntityImpl
 {
 public:
     std::string mId; /**< String document identifier for this entity. */
+
+    size_t mRevision; /**< Revision of this entity, updated whenever this entity gets modified. */
+    size_t mTreeRevision; /**< Revision of this entity and its descendants, updated whenever this entity or one of its descendants gets modified. */
+
+    /**
+     * @brief Constructor.
+     *
+     * Give this entity a revision that no other entity has ever had.
+     */
+    EntityImpl();
+
+    /**
+     * @brief Mark this entity as modified.
+     *
+     * Give this entity a revision that no other entity has ever had, without
+     * updating the tree revision of its ancestors.
+     */
+    void markModified();
+
+    /**
+     * @brief Mark the given @p entity and its ancestors as modified.
+     *
+     * Give the given @p entity a revision that no other entity has ever had,
+     * and make it the tree revision of the @p entity and of its ancestors.
+     *
+     * @param entity The @c Entity that has been modified.
+     */
+    static void markModified(Entity *entity);
 };
 
 } // namespace libcellml
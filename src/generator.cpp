@@ -14,8 +14,14 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 
+#ifdef _WIN32
+#    define _USE_MATH_DEFINES
+#endif
+
 #include "libcellml/generator.h"
 
+#include <cmath>
+#include <functional>
 #include <regex>
 #include <sstream>
 
@@ -27,6 +33,7 @@ limitations under the License.
 #include "libcellml/units.h"
 #include "libcellml/version.h"
 
+#include "analyservariable_p.h"
 #include "commonutils.h"
 #include "generator_p.h"
 #include "generatorprofilesha1values.h"
@@ -37,1973 +44,4536 @@ limitations under the License.
 
 namespace libcellml {
 
-void Generator::GeneratorImpl::reset()
+static AnalyserEquationAstPtr createAst(AnalyserEquationAst::Type type,
+                                        const AnalyserEquationAstPtr &leftChild,
+                                        const AnalyserEquationAstPtr &rightChild = nullptr)
 {
-    mCode = {};
+    // Create an AST for the given operator or function.
+    // Note: the children of the AST may be (shared) sub-ASTs of an equation, in
+    //       which case we leave their parent alone.
+
+    auto ast = AnalyserEquationAst::create();
+
+    ast->setType(type);
+
+    for (const auto &child : {leftChild, rightChild}) {
+        if ((child != nullptr) && (child->parent() == nullptr)) {
+            child->setParent(ast);
+        }
+    }
+
+    ast->setLeftChild(leftChild);
+    ast->setRightChild(rightChild);
+
+    return ast;
 }
 
-bool Generator::GeneratorImpl::modelHasOdes() const
+static AnalyserEquationAstPtr createAst(AnalyserEquationAst::Type type,
+                                        const std::string &value)
 {
-    switch (mModel->type()) {
-    case AnalyserModel::Type::ODE:
-    case AnalyserModel::Type::DAE:
-        return true;
-    default:
-        return false;
-    }
+    // Create an AST for the given number or, if it is a CI AST with no
+    // variable, for the given code.
+
+    auto ast = AnalyserEquationAst::create();
+
+    ast->setType(type);
+    ast->setValue(value);
+
+    return ast;
 }
 
-bool Generator::GeneratorImpl::modelHasNlas() const
+static bool isOneAst(const AnalyserEquationAstPtr &ast)
 {
-    switch (mModel->type()) {
-    case AnalyserModel::Type::NLA:
-    case AnalyserModel::Type::DAE:
-        return true;
-    default:
-        return false;
+    return (ast->type() == AnalyserEquationAst::Type::CN) && (ast->value() == "1");
+}
+
+// The following methods create the AST for some arithmetic operations, where a
+// nullptr AST stands for zero, something that we use to prune derivatives.
+
+static AnalyserEquationAstPtr plusAst(const AnalyserEquationAstPtr &leftAst,
+                                      const AnalyserEquationAstPtr &rightAst)
+{
+    if (leftAst == nullptr) {
+        return rightAst;
     }
+
+    if (rightAst == nullptr) {
+        return leftAst;
+    }
+
+    return createAst(AnalyserEquationAst::Type::PLUS, leftAst, rightAst);
 }
 
-AnalyserVariablePtr Generator::GeneratorImpl::analyserVariable(const VariablePtr &variable) const
+static AnalyserEquationAstPtr minusAst(const AnalyserEquationAstPtr &leftAst,
+                                       const AnalyserEquationAstPtr &rightAst)
 {
-    // Find and return the analyser variable associated with the given variable.
+    if (rightAst == nullptr) {
+        return leftAst;
+    }
 
-    AnalyserVariablePtr res;
-    auto modelVoi = mModel->voi();
-    VariablePtr modelVoiVariable = (modelVoi != nullptr) ? modelVoi->variable() : nullptr;
+    if (leftAst == nullptr) {
+        // Negate the given AST, pushing the negation down to the left operand
+        // of a product or quotient, so that we never end up with something
+        // like --1.0*x.
 
-    if ((modelVoiVariable != nullptr)
-        && mModel->areEquivalentVariables(variable, modelVoiVariable)) {
-        res = modelVoi;
-    } else {
-        for (const auto &modelState : mModel->states()) {
-            if (mModel->areEquivalentVariables(variable, modelState->variable())) {
-                res = modelState;
+        switch (rightAst->type()) {
+        case AnalyserEquationAst::Type::MINUS:
+            if (rightAst->rightChild() == nullptr) {
+                return rightAst->leftChild();
+            }
 
-                break;
+            break;
+        case AnalyserEquationAst::Type::TIMES:
+        case AnalyserEquationAst::Type::DIVIDE:
+            return createAst(rightAst->type(), minusAst(nullptr, rightAst->leftChild()), rightAst->rightChild());
+        case AnalyserEquationAst::Type::CN:
+            if (rightAst->value().front() == '-') {
+                return createAst(AnalyserEquationAst::Type::CN, rightAst->value().substr(1));
             }
-        }
 
-        if (res == nullptr) {
-            // Normally, we would have:
-            //
-            //     for (const auto &modelVariable : mModel->variables()) {
-            //         if (mModel->areEquivalentVariables(variable, modelVariable->variable())) {
-            //             res = modelVariable;
-            //
-            //             break;
-            //         }
-            //     }
-            //
-            // but we always have variables, so llvm-cov will complain that the
-            // false branch of our for loop is never reached. The below code is
-            // a bit more verbose but at least it makes llvm-cov happy.
-
-            auto modelVariables = mModel->variables();
-            auto modelVariable = modelVariables.begin();
-
-            do {
-                if (mModel->areEquivalentVariables(variable, (*modelVariable)->variable())) {
-                    res = *modelVariable;
-                } else {
-                    ++modelVariable;
-                }
-            } while (res == nullptr);
+            break;
+        default:
+            break;
         }
-    }
 
-    return res;
-}
-
-double Generator::GeneratorImpl::scalingFactor(const VariablePtr &variable) const
-{
-    // Return the scaling factor for the given variable.
+        return createAst(AnalyserEquationAst::Type::MINUS, rightAst);
+    }
 
-    return Units::scalingFactor(variable->units(), analyserVariable(variable)->variable()->units());
+    return createAst(AnalyserEquationAst::Type::MINUS, leftAst, rightAst);
 }
 
-bool Generator::GeneratorImpl::isNegativeNumber(const AnalyserEquationAstPtr &ast) const
+static AnalyserEquationAstPtr timesAst(const AnalyserEquationAstPtr &leftAst,
+                                       const AnalyserEquationAstPtr &rightAst)
 {
-    if (ast->type() == AnalyserEquationAst::Type::CN) {
-        double doubleValue;
+    if ((leftAst == nullptr) || (rightAst == nullptr)) {
+        return nullptr;
+    }
 
-        convertToDouble(ast->value(), doubleValue);
+    if (isOneAst(leftAst)) {
+        return rightAst;
+    }
 
-        return doubleValue < 0.0;
+    if (isOneAst(rightAst)) {
+        return leftAst;
     }
 
-    return false;
+    return createAst(AnalyserEquationAst::Type::TIMES, leftAst, rightAst);
 }
 
-bool Generator::GeneratorImpl::isRelationalOperator(const AnalyserEquationAstPtr &ast) const
+static AnalyserEquationAstPtr divideAst(const AnalyserEquationAstPtr &leftAst,
+                                        const AnalyserEquationAstPtr &rightAst)
 {
-    switch (ast->type()) {
-    case AnalyserEquationAst::Type::EQ:
-        return mProfile->hasEqOperator();
-    case AnalyserEquationAst::Type::NEQ:
-        return mProfile->hasNeqOperator();
-    case AnalyserEquationAst::Type::LT:
-        return mProfile->hasLtOperator();
-    case AnalyserEquationAst::Type::LEQ:
-        return mProfile->hasLeqOperator();
-    case AnalyserEquationAst::Type::GT:
-        return mProfile->hasGtOperator();
-    case AnalyserEquationAst::Type::GEQ:
-        return mProfile->hasGeqOperator();
-    default:
-        return false;
+    if (leftAst == nullptr) {
+        return nullptr;
     }
-}
 
-bool Generator::GeneratorImpl::isAndOperator(const AnalyserEquationAstPtr &ast) const
-{
-    return (ast->type() == AnalyserEquationAst::Type::AND)
-           && mProfile->hasAndOperator();
-}
+    if (isOneAst(rightAst)) {
+        return leftAst;
+    }
 
-bool Generator::GeneratorImpl::isOrOperator(const AnalyserEquationAstPtr &ast) const
-{
-    return (ast->type() == AnalyserEquationAst::Type::OR)
-           && mProfile->hasOrOperator();
+    return createAst(AnalyserEquationAst::Type::DIVIDE, leftAst, rightAst);
 }
 
-bool Generator::GeneratorImpl::isXorOperator(const AnalyserEquationAstPtr &ast) const
+void Generator::GeneratorImpl::reset()
 {
-    return (ast->type() == AnalyserEquationAst::Type::XOR)
-           && mProfile->hasXorOperator();
+    mCode = {};
+
+    retrieveProfileTemplates();
+    indexModel();
 }
 
-bool Generator::GeneratorImpl::isLogicalOperator(const AnalyserEquationAstPtr &ast) const
+void Generator::GeneratorImpl::cacheImplementationChunks()
 {
-    // Note: AnalyserEquationAst::Type::NOT is a unary logical operator, hence
-    //       we don't include it here since this method is only used to
-    //       determine whether parentheses should be added around some code.
+    // Keep track of the model, profile (and its version), and options with
+    // which our implementation chunks were generated.
 
-    return isAndOperator(ast) || isOrOperator(ast) || isXorOperator(ast);
+    mImplementationChunksModel = mModel;
+    mImplementationChunksProfile = mProfile;
+    mImplementationChunksProfileVersion = mProfile->mPimpl->mVersion;
+    mImplementationChunksOptionsVersion = mOptionsVersion;
 }
 
-bool Generator::GeneratorImpl::isPlusOperator(const AnalyserEquationAstPtr &ast) const
+bool Generator::GeneratorImpl::hasCachedImplementationChunks() const
 {
-    return ast->type() == AnalyserEquationAst::Type::PLUS;
-}
+    // Our implementation chunks can be reused if they were generated with our
+    // current model, profile (and its version), and options.
 
-bool Generator::GeneratorImpl::isMinusOperator(const AnalyserEquationAstPtr &ast) const
-{
-    return ast->type() == AnalyserEquationAst::Type::MINUS;
+    return (mImplementationChunksModel == mModel)
+           && (mImplementationChunksProfile == mProfile)
+           && (mImplementationChunksProfileVersion == mProfile->mPimpl->mVersion)
+           && (mImplementationChunksOptionsVersion == mOptionsVersion);
 }
 
-bool Generator::GeneratorImpl::isTimesOperator(const AnalyserEquationAstPtr &ast) const
+void Generator::GeneratorImpl::indexModel()
 {
-    return ast->type() == AnalyserEquationAst::Type::TIMES;
+    // Map all the variables that are equivalent to our variable of integration,
+    // a state, or a variable to the corresponding analyser variable.
+    // Note: a variable can only be equivalent to one analyser variable, but
+    //       we give precedence to our variable of integration and then to our
+    //       states, just in case.
+
+    mAnalyserVariables.clear();
+
+    auto indexAnalyserVariable = [this](const AnalyserVariablePtr &analyserVariable) {
+        for (const auto &variable : equivalentVariables(analyserVariable->variable())) {
+            mAnalyserVariables.emplace(variable.get(), analyserVariable);
+        }
+    };
+
+    if (mModel->voi() != nullptr) {
+        indexAnalyserVariable(mModel->voi());
+    }
+
+    for (const auto &state : modelStates()) {
+        indexAnalyserVariable(state);
+    }
+
+    for (const auto &variable : modelVariables()) {
+        indexAnalyserVariable(variable);
+    }
+
+    // Index our equations and keep track of the index of their dependencies
+    // and NLA siblings, so that we can schedule them using their index rather
+    // than having to look them up.
+
+    auto &equations = modelEquations();
+    auto equationCount = equations.size();
+    std::unordered_map<AnalyserEquation *, size_t> equationIndices;
+
+    for (size_t i = 0; i < equationCount; ++i) {
+        equationIndices.emplace(equations[i].get(), i);
+    }
+
+    mEquationDependencies.assign(equationCount, {});
+    mEquationNlaSiblings.assign(equationCount, {});
+
+    for (size_t i = 0; i < equationCount; ++i) {
+        for (const auto &dependency : equations[i]->dependencies()) {
+            mEquationDependencies[i].push_back(equationIndices[dependency.get()]);
+        }
+
+        for (const auto &nlaSibling : equations[i]->nlaSiblings()) {
+            mEquationNlaSiblings[i].push_back(equationIndices[nlaSibling.get()]);
+        }
+    }
 }
 
-bool Generator::GeneratorImpl::isDivideOperator(const AnalyserEquationAstPtr &ast) const
+const std::vector<AnalyserVariablePtr> &Generator::GeneratorImpl::modelStates() const
 {
-    return ast->type() == AnalyserEquationAst::Type::DIVIDE;
+    return mModel->statesRef();
 }
 
-bool Generator::GeneratorImpl::isPowerOperator(const AnalyserEquationAstPtr &ast) const
+const std::vector<AnalyserVariablePtr> &Generator::GeneratorImpl::modelVariables() const
 {
-    return (ast->type() == AnalyserEquationAst::Type::POWER)
-           && mProfile->hasPowerOperator();
+    return mModel->variablesRef();
 }
 
-bool Generator::GeneratorImpl::isRootOperator(const AnalyserEquationAstPtr &ast) const
+const std::vector<AnalyserEquationPtr> &Generator::GeneratorImpl::modelEquations() const
 {
-    return (ast->type() == AnalyserEquationAst::Type::ROOT)
-           && mProfile->hasPowerOperator();
+    return mModel->equationsRef();
 }
 
-bool Generator::GeneratorImpl::isPiecewiseStatement(const AnalyserEquationAstPtr &ast) const
+const ProfileTemplate &Generator::GeneratorImpl::profileTemplate(const std::string &string,
+                                                                 const std::vector<std::string> &tags) const
 {
-    return (ast->type() == AnalyserEquationAst::Type::PIECEWISE)
-           && mProfile->hasConditionalOperator();
+    return *mProfile->mPimpl->profileTemplate(string, tags);
 }
 
-void Generator::GeneratorImpl::updateVariableInfoSizes(size_t &componentSize,
-                                                       size_t &nameSize,
-                                                       size_t &unitsSize,
-                                                       const AnalyserVariablePtr &variable) const
+void Generator::GeneratorImpl::retrieveProfileTemplates()
 {
-    auto variableVariable = variable->variable();
-    auto variableComponentSize = owningComponent(variableVariable)->name().length() + 1;
-    auto variableNameSize = variableVariable->name().length() + 1;
-    auto variableUnitsSize = variableVariable->units()->name().length() + 1;
-    // Note: +1 to account for the end of string termination.
+    // Retrieve the precompiled version of the profile strings that get
+    // instantiated for (nearly) every equation or variable.
+    // Note: those templates are owned by our profile, which compiles them only
+    //       once (or again if it gets modified).
+
+    if (mProfile->hasConditionalOperator()) {
+        mPiecewiseIfTemplate = &profileTemplate(mProfile->conditionalOperatorIfString(),
+                                                {"[CONDITION]", "[IF_STATEMENT]"});
+        mPiecewiseElseTemplate = &profileTemplate(mProfile->conditionalOperatorElseString(),
+                                                  {"[ELSE_STATEMENT]"});
+    } else {
+        mPiecewiseIfTemplate = &profileTemplate(mProfile->piecewiseIfString(),
+                                                {"[CONDITION]", "[IF_STATEMENT]"});
+        mPiecewiseElseTemplate = &profileTemplate(mProfile->piecewiseElseString(),
+                                                  {"[ELSE_STATEMENT]"});
+    }
 
-    componentSize = (componentSize > variableComponentSize) ? componentSize : variableComponentSize;
-    nameSize = (nameSize > variableNameSize) ? nameSize : variableNameSize;
-    unitsSize = (unitsSize > variableUnitsSize) ? unitsSize : variableUnitsSize;
-}
+    mVariableInfoEntryTemplate = &profileTemplate(mProfile->variableInfoEntryString(),
+                                                  {"[NAME]", "[UNITS]", "[COMPONENT]", "[TYPE]"});
 
-bool Generator::GeneratorImpl::modifiedProfile() const
-{
-    std::string profileContents = generatorProfileAsString(mProfile);
+    if (mModel != nullptr) {
+        mExternalVariableMethodCallTemplate = &profileTemplate(mProfile->externalVariableMethodCallString(modelHasOdes()),
+                                                               {"[INDEX]"});
+        mFindRootCallTemplate = &profileTemplate(mProfile->findRootCallString(modelHasOdes()),
+                                                 {"[INDEX]"});
+    }
 
-    return (mProfile->profile() == GeneratorProfile::Profile::C) ?
-               sha1(profileContents) != C_GENERATOR_PROFILE_SHA1 :
-               sha1(profileContents) != PYTHON_GENERATOR_PROFILE_SHA1;
+    mLookupTableValueCallTemplate = &profileTemplate(mProfile->lookupTableValueCallString(),
+                                                     {"[INDEX]", "[COLUMN_COUNT]", "[COLUMN]", "[STATE]", "[MINIMUM]", "[STEP]", "[SIZE]"});
+    mLocalVariableNameTemplate = &profileTemplate(mProfile->localVariableNameString(),
+                                                  {"[NAME]", "[INDEX]"});
 }
 
-std::string Generator::GeneratorImpl::newLineIfNeeded()
+std::vector<Generator::GeneratorImpl::LookupTable>::const_iterator Generator::GeneratorImpl::findLookupTable(const VariablePtr &variable) const
 {
-    return mCode.empty() ? "" : "\n";
+    return std::find_if(mLookupTables.begin(), mLookupTables.end(),
+                        [=](const LookupTable &lookupTable) {
+                            return lookupTable.mVariable == variable;
+                        });
 }
 
-void Generator::GeneratorImpl::addOriginCommentCode()
+void Generator::GeneratorImpl::prepareLookupTables()
 {
-    if (!mProfile->commentString().empty()
-        && !mProfile->originCommentString().empty()) {
-        std::string profileInformation = modifiedProfile() ?
-                                             "a modified " :
-                                             "the ";
+    // Determine which of our lookup tables can actually be used, i.e. the ones
+    // which variable is (equivalent to) a state on which at least one of our
+    // equations can be tabulated, and assign a table index and a column to
+    // each of those equations.
+
+    mUsedLookupTables.clear();
+    mLookupTableEquations.clear();
+
+    if (mProfile->lookupTableDeclarationString().empty()
+        || mProfile->lookupTableEntryString().empty()
+        || mProfile->lookupTableValueCallString().empty()
+        || mProfile->lookupTableValueMethodString().empty()
+        || mProfile->lookupTableInitialisationString().empty()
+        || mProfile->implementationInitialiseLookupTablesMethodString().empty()) {
+        return;
+    }
 
-        profileInformation += (mProfile->profile() == GeneratorProfile::Profile::C) ?
-                                  "C" :
-                                  "Python";
-        profileInformation += " profile of";
+    for (const auto &lookupTable : mLookupTables) {
+        auto analyserVariable = mAnalyserVariables.find(lookupTable.mVariable.get());
+        auto state = ((analyserVariable != mAnalyserVariables.end())
+                      && (analyserVariable->second->type() == AnalyserVariable::Type::STATE)) ?
+                         analyserVariable->second :
+                         nullptr;
+
+        if ((state == nullptr)
+            || std::any_of(mUsedLookupTables.begin(), mUsedLookupTables.end(),
+                           [=](const UsedLookupTable &usedLookupTable) {
+                               return usedLookupTable.mState == state;
+                           })) {
+            continue;
+        }
 
-        mCode += replace(mProfile->commentString(),
-                         "[CODE]", replace(replace(mProfile->originCommentString(), "[PROFILE_INFORMATION]", profileInformation), "[LIBCELLML_VERSION]", versionString()));
+        UsedLookupTable usedLookupTable {state, lookupTable.mMinimum, lookupTable.mStep,
+                                         static_cast<size_t>(std::ceil((lookupTable.mMaximum - lookupTable.mMinimum) / lookupTable.mStep)) + 1,
+                                         {}};
+
+        for (const auto &equation : modelEquations()) {
+            if (equation->lookupTableState() == state) {
+                mLookupTableEquations[equation] = {mUsedLookupTables.size(), usedLookupTable.mEquations.size()};
+
+                usedLookupTable.mEquations.push_back(equation);
+            }
+        }
+
+        if (!usedLookupTable.mEquations.empty()) {
+            mUsedLookupTables.push_back(usedLookupTable);
+        }
     }
 }
 
-void Generator::GeneratorImpl::addInterfaceHeaderCode()
+void Generator::GeneratorImpl::prepareEnsembleParameters()
 {
-    if (!mProfile->interfaceHeaderString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->interfaceHeaderString();
+    // Determine which of our ensemble parameters can actually be used, i.e. the
+    // ones which variable is (equivalent to) a constant, and whether our
+    // ensemble methods can be generated.
+    // Note: our ensemble methods rely on our compute methods having the same
+    //       signature for all the instances, hence we don't generate them if
+    //       the model has external variables or if lookup tables are in use.
+
+    mUsedEnsembleParameters.clear();
+
+    if (mEnsembleParameters.empty()
+        || !modelHasOdes()
+        || mModel->hasExternalVariables()
+        || !mUsedLookupTables.empty()
+        || mProfile->ensembleParameterAssignmentString().empty()
+        || mProfile->implementationInitialiseEnsembleMethodString().empty()) {
+        mEnsembleInUse = false;
+
+        return;
     }
-}
 
-void Generator::GeneratorImpl::addImplementationHeaderCode()
-{
-    auto hasInterfaceFileName = mProfile->implementationHeaderString().empty() ?
-                                    false :
-                                    (mProfile->implementationHeaderString().find("[INTERFACE_FILE_NAME]") != std::string::npos);
+    for (const auto &ensembleParameter : mEnsembleParameters) {
+        auto analyserVariable = mAnalyserVariables.find(ensembleParameter.get());
 
-    if (!mProfile->implementationHeaderString().empty()
-        && ((hasInterfaceFileName && !mProfile->interfaceFileNameString().empty())
-            || !hasInterfaceFileName)) {
-        mCode += newLineIfNeeded()
-                 + replace(mProfile->implementationHeaderString(),
-                           "[INTERFACE_FILE_NAME]", mProfile->interfaceFileNameString());
+        if ((analyserVariable != mAnalyserVariables.end())
+            && (analyserVariable->second->type() == AnalyserVariable::Type::CONSTANT)
+            && (std::find(mUsedEnsembleParameters.begin(), mUsedEnsembleParameters.end(),
+                          analyserVariable->second)
+                == mUsedEnsembleParameters.end())) {
+            mUsedEnsembleParameters.push_back(analyserVariable->second);
+        }
     }
+
+    mEnsembleInUse = !mUsedEnsembleParameters.empty();
 }
 
-void Generator::GeneratorImpl::addVersionAndLibcellmlVersionCode(bool interface)
+bool Generator::GeneratorImpl::hasAstOfType(const AnalyserEquationAstPtr &ast,
+                                            const std::vector<AnalyserEquationAst::Type> &types) const
 {
-    std::string versionAndLibcellmlCode;
+    return (ast != nullptr)
+           && ((std::find(types.begin(), types.end(), ast->type()) != types.end())
+               || hasAstOfType(ast->leftChild(), types)
+               || hasAstOfType(ast->rightChild(), types));
+}
 
-    if ((interface && !mProfile->interfaceVersionString().empty())
-        || (!interface && !mProfile->implementationVersionString().empty())) {
-        if (interface) {
-            versionAndLibcellmlCode += mProfile->interfaceVersionString();
-        } else {
-            if (modifiedProfile()) {
-                static const std::regex regEx("([0-9]+\\.[0-9]+\\.[0-9]+)");
+bool Generator::GeneratorImpl::prepareSensitivityEquations(size_t equationIndex,
+                                                           std::vector<bool> &visitedEquations)
+{
+    // Add the given equation to our sensitivity equations, after its
+    // dependencies, but only if it can be differentiated, i.e. it is not
+    // computed using an NLA system, it has its variable on its own on the LHS,
+    // and it doesn't rely on a rate.
 
-                versionAndLibcellmlCode += std::regex_replace(mProfile->implementationVersionString(), regEx, "$1.post0");
-            } else {
-                versionAndLibcellmlCode += mProfile->implementationVersionString();
-            }
-        }
+    if (visitedEquations[equationIndex]) {
+        return true;
     }
 
-    if ((interface && !mProfile->interfaceLibcellmlVersionString().empty())
-        || (!interface && !mProfile->implementationLibcellmlVersionString().empty())) {
-        versionAndLibcellmlCode += interface ?
-                                       mProfile->interfaceLibcellmlVersionString() :
-                                       replace(mProfile->implementationLibcellmlVersionString(),
-                                               "[LIBCELLML_VERSION]", versionString());
+    visitedEquations[equationIndex] = true;
+
+    auto &equations = modelEquations();
+    auto &equation = equations[equationIndex];
+
+    if ((equation->type() == AnalyserEquation::Type::NLA)
+        || (equation->type() == AnalyserEquation::Type::EXTERNAL)
+        || ((equation->type() != AnalyserEquation::Type::ODE)
+            && (equation->ast()->leftChild()->type() != AnalyserEquationAst::Type::CI))
+        || hasAstOfType(equation->ast()->rightChild(), {AnalyserEquationAst::Type::DIFF})) {
+        return false;
     }
 
-    if (!versionAndLibcellmlCode.empty()) {
-        mCode += "\n";
+    for (auto dependencyIndex : mEquationDependencies[equationIndex]) {
+        if ((equations[dependencyIndex]->type() != AnalyserEquation::Type::ODE)
+            && !prepareSensitivityEquations(dependencyIndex, visitedEquations)) {
+            return false;
+        }
     }
 
-    mCode += versionAndLibcellmlCode;
+    mSensitivityEquations.push_back(equationIndex);
+
+    return true;
 }
 
-void Generator::GeneratorImpl::addStateAndVariableCountCode(bool interface)
+void Generator::GeneratorImpl::prepareSensitivityParameters()
 {
-    std::string stateAndVariableCountCode;
+    // Determine which of our sensitivity parameters can actually be used, i.e.
+    // the ones which variable is (equivalent to) a constant, and the equations
+    // that need to be differentiated to compute the rates of our
+    // sensitivities, in the order in which they are to be differentiated.
+    // Note: we don't compute sensitivities if the model has external variables
+    //       since we don't know how those depend on our sensitivity
+    //       parameters, nor if a rate is computed using an NLA system.
+
+    mUsedSensitivityParameters.clear();
+    mSensitivityEquations.clear();
+    mSensitivitiesNeedLtFunction = false;
+
+    auto &states = modelStates();
+
+    if (mSensitivityParameters.empty()
+        || !modelHasOdes()
+        || mModel->hasExternalVariables()
+        || std::any_of(states.begin(), states.end(), [](const AnalyserVariablePtr &state) {
+               return state->equation(0)->type() != AnalyserEquation::Type::ODE;
+           })
+        || mProfile->sensitivityNameString().empty()
+        || mProfile->localVariableNameString().empty()) {
+        return;
+    }
 
-    if (modelHasOdes()
-        && ((interface && !mProfile->interfaceStateCountString().empty())
-            || (!interface && !mProfile->implementationStateCountString().empty()))) {
-        stateAndVariableCountCode += interface ?
-                                         mProfile->interfaceStateCountString() :
-                                         replace(mProfile->implementationStateCountString(),
-                                                 "[STATE_COUNT]", std::to_string(mModel->stateCount()));
+    auto &equations = modelEquations();
+    std::vector<bool> visitedEquations(equations.size(), false);
+
+    for (size_t i = 0; i < equations.size(); ++i) {
+        if ((equations[i]->type() == AnalyserEquation::Type::ODE)
+            && !prepareSensitivityEquations(i, visitedEquations)) {
+            mSensitivityEquations.clear();
+
+            return;
+        }
     }
 
-    if ((interface && !mProfile->interfaceVariableCountString().empty())
-        || (!interface && !mProfile->implementationVariableCountString().empty())) {
-        stateAndVariableCountCode += interface ?
-                                         mProfile->interfaceVariableCountString() :
-                                         replace(mProfile->implementationVariableCountString(),
-                                                 "[VARIABLE_COUNT]", std::to_string(mModel->variableCount()));
+    for (const auto &sensitivityParameter : mSensitivityParameters) {
+        auto analyserVariable = mAnalyserVariables.find(sensitivityParameter.get());
+
+        if ((analyserVariable != mAnalyserVariables.end())
+            && (analyserVariable->second->type() == AnalyserVariable::Type::CONSTANT)
+            && (std::find(mUsedSensitivityParameters.begin(), mUsedSensitivityParameters.end(),
+                          analyserVariable->second)
+                == mUsedSensitivityParameters.end())) {
+            mUsedSensitivityParameters.push_back(analyserVariable->second);
+        }
     }
 
-    if (!stateAndVariableCountCode.empty()) {
-        mCode += "\n";
+    if (mUsedSensitivityParameters.empty()) {
+        mSensitivityEquations.clear();
+
+        return;
     }
 
-    mCode += stateAndVariableCountCode;
+    // The derivative of ABS, MIN, and MAX relies on the LT operator, which the
+    // model itself may not need.
+
+    mSensitivitiesNeedLtFunction = std::any_of(mSensitivityEquations.begin(), mSensitivityEquations.end(), [&](size_t equationIndex) {
+        return hasAstOfType(equations[equationIndex]->ast()->rightChild(),
+                            {AnalyserEquationAst::Type::ABS, AnalyserEquationAst::Type::MIN, AnalyserEquationAst::Type::MAX});
+    });
 }
 
-void Generator::GeneratorImpl::addVariableTypeObjectCode()
+bool Generator::GeneratorImpl::evaluateCode(const AnalyserEquationAstPtr &ast,
+                                            std::unordered_set<AnalyserVariable *> &visitedConstants,
+                                            double &value)
 {
-    auto variableTypeObjectString = mProfile->variableTypeObjectString(modelHasOdes(),
-                                                                       mModel->hasExternalVariables());
+    // Evaluate the given AST, using the same semantics as our generated code.
+    // Note: this fails if the AST relies on something that is not a constant.
 
-    if (!variableTypeObjectString.empty()) {
-        mCode += newLineIfNeeded()
-                 + variableTypeObjectString;
+    if (ast == nullptr) {
+        return false;
     }
-}
 
-std::string Generator::GeneratorImpl::generateVariableInfoObjectCode(const std::string &objectString) const
+    auto astLeftChild = ast->leftChild();
+    auto astRightChild = ast->rightChild();
+    double leftValue = 0.0;
+    double rightValue = 0.0;
+
+    switch (ast->type()) {
+    case AnalyserEquationAst::Type::CI: {
+        auto analyserVariable = mAnalyserVariables.find(ast->variable().get());
+
+        return (analyserVariable != mAnalyserVariables.end())
+               && specialisedConstantValue(analyserVariable->second, visitedConstants, value);
+    }
+    case AnalyserEquationAst::Type::CN:
+        return convertToDouble(ast->value(), value);
+    case AnalyserEquationAst::Type::TRUE:
+        value = 1.0;
+
+        return true;
+    case AnalyserEquationAst::Type::FALSE:
+        value = 0.0;
+
+        return true;
+    case AnalyserEquationAst::Type::E:
+        value = std::exp(1.0);
+
+        return true;
+    case AnalyserEquationAst::Type::PI:
+        value = M_PI;
+
+        return true;
+    case AnalyserEquationAst::Type::INF:
+        value = std::numeric_limits<double>::infinity();
+
+        return true;
+    case AnalyserEquationAst::Type::NAN:
+        value = std::numeric_limits<double>::quiet_NaN();
+
+        return true;
+    case AnalyserEquationAst::Type::PIECEWISE:
+    case AnalyserEquationAst::Type::PIECE:
+        // A piecewise statement consists of a piece (i.e. a value and a
+        // condition) and of either nothing, another piece, another piecewise
+        // statement, or an otherwise statement.
+
+        if (ast->type() == AnalyserEquationAst::Type::PIECEWISE) {
+            if (!evaluateCode(astLeftChild->rightChild(), visitedConstants, leftValue)) {
+                return false;
+            }
+
+            if (leftValue != 0.0) {
+                return evaluateCode(astLeftChild->leftChild(), visitedConstants, value);
+            }
+
+            if (astRightChild == nullptr) {
+                value = std::numeric_limits<double>::quiet_NaN();
+
+                return true;
+            }
+
+            return evaluateCode(astRightChild, visitedConstants, value);
+        }
+
+        if (!evaluateCode(astRightChild, visitedConstants, rightValue)) {
+            return false;
+        }
+
+        if (rightValue != 0.0) {
+            return evaluateCode(astLeftChild, visitedConstants, value);
+        }
+
+        value = std::numeric_limits<double>::quiet_NaN();
+
+        return true;
+    case AnalyserEquationAst::Type::OTHERWISE:
+    case AnalyserEquationAst::Type::DEGREE:
+    case AnalyserEquationAst::Type::LOGBASE:
+        return evaluateCode(astLeftChild, visitedConstants, value);
+    case AnalyserEquationAst::Type::EQUALITY:
+    case AnalyserEquationAst::Type::DIFF:
+    case AnalyserEquationAst::Type::BVAR:
+        return false;
+    default:
+        break;
+    }
+
+    // We are dealing with an operator or a function, so evaluate its
+    // argument(s).
+
+    if (!evaluateCode(astLeftChild, visitedConstants, leftValue)
+        || ((astRightChild != nullptr)
+            && !evaluateCode(astRightChild, visitedConstants, rightValue))) {
+        return false;
+    }
+
+    switch (ast->type()) {
+    case AnalyserEquationAst::Type::EQ:
+        value = (leftValue == rightValue) ? 1.0 : 0.0;
+
+        break;
+    case AnalyserEquationAst::Type::NEQ:
+        value = (leftValue != rightValue) ? 1.0 : 0.0;
+
+        break;
+    case AnalyserEquationAst::Type::LT:
+        value = (leftValue < rightValue) ? 1.0 : 0.0;
+
+        break;
+    case AnalyserEquationAst::Type::LEQ:
+        value = (leftValue <= rightValue) ? 1.0 : 0.0;
+
+        break;
+    case AnalyserEquationAst::Type::GT:
+        value = (leftValue > rightValue) ? 1.0 : 0.0;
+
+        break;
+    case AnalyserEquationAst::Type::GEQ:
+        value = (leftValue >= rightValue) ? 1.0 : 0.0;
+
+        break;
+    case AnalyserEquationAst::Type::AND:
+        value = ((leftValue != 0.0) && (rightValue != 0.0)) ? 1.0 : 0.0;
+
+        break;
+    case AnalyserEquationAst::Type::OR:
+        value = ((leftValue != 0.0) || (rightValue != 0.0)) ? 1.0 : 0.0;
+
+        break;
+    case AnalyserEquationAst::Type::XOR:
+        value = ((leftValue != 0.0) != (rightValue != 0.0)) ? 1.0 : 0.0;
+
+        break;
+    case AnalyserEquationAst::Type::NOT:
+        value = (leftValue == 0.0) ? 1.0 : 0.0;
+
+        break;
+    case AnalyserEquationAst::Type::PLUS:
+        value = (astRightChild != nullptr) ? leftValue + rightValue : leftValue;
+
+        break;
+    case AnalyserEquationAst::Type::MINUS:
+        value = (astRightChild != nullptr) ? leftValue - rightValue : -leftValue;
+
+        break;
+    case AnalyserEquationAst::Type::TIMES:
+        value = leftValue * rightValue;
+
+        break;
+    case AnalyserEquationAst::Type::DIVIDE:
+        value = leftValue / rightValue;
+
+        break;
+    case AnalyserEquationAst::Type::POWER:
+        value = std::pow(leftValue, rightValue);
+
+        break;
+    case AnalyserEquationAst::Type::ROOT:
+        // Note: the left child is the degree of the root, if any.
+
+        value = (astRightChild != nullptr) ?
+                    std::pow(rightValue, 1.0 / leftValue) :
+                    std::sqrt(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::ABS:
+        value = std::fabs(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::EXP:
+        value = std::exp(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::LN:
+        value = std::log(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::LOG:
+        // Note: the left child is the base of the logarithm, if any.
+
+        value = (astRightChild != nullptr) ?
+                    std::log(rightValue) / std::log(leftValue) :
+                    std::log10(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::CEILING:
+        value = std::ceil(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::FLOOR:
+        value = std::floor(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::MIN:
+        value = std::fmin(leftValue, rightValue);
+
+        break;
+    case AnalyserEquationAst::Type::MAX:
+        value = std::fmax(leftValue, rightValue);
+
+        break;
+    case AnalyserEquationAst::Type::REM:
+        value = std::fmod(leftValue, rightValue);
+
+        break;
+    case AnalyserEquationAst::Type::SIN:
+        value = std::sin(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::COS:
+        value = std::cos(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::TAN:
+        value = std::tan(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::SEC:
+        value = 1.0 / std::cos(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::CSC:
+        value = 1.0 / std::sin(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::COT:
+        value = 1.0 / std::tan(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::SINH:
+        value = std::sinh(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::COSH:
+        value = std::cosh(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::TANH:
+        value = std::tanh(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::SECH:
+        value = 1.0 / std::cosh(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::CSCH:
+        value = 1.0 / std::sinh(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::COTH:
+        value = 1.0 / std::tanh(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::ASIN:
+        value = std::asin(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::ACOS:
+        value = std::acos(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::ATAN:
+        value = std::atan(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::ASEC:
+        value = std::acos(1.0 / leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::ACSC:
+        value = std::asin(1.0 / leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::ACOT:
+        value = std::atan(1.0 / leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::ASINH:
+        value = std::asinh(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::ACOSH:
+        value = std::acosh(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::ATANH:
+        value = std::atanh(leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::ASECH:
+        value = std::acosh(1.0 / leftValue);
+
+        break;
+    case AnalyserEquationAst::Type::ACSCH:
+        value = std::asinh(1.0 / leftValue);
+
+        break;
+    default: // AnalyserEquationAst::Type::ACOTH.
+        value = std::atanh(1.0 / leftValue);
+
+        break;
+    }
+
+    return true;
+}
+
+bool Generator::GeneratorImpl::specialisedConstantValue(const AnalyserVariablePtr &variable,
+                                                        std::unordered_set<AnalyserVariable *> &visitedConstants,
+                                                        double &value)
+{
+    // Retrieve the value of the given (computed) constant, evaluating it if
+    // needed.
+    // Note: a constant is marked as visited before being evaluated, so that
+    //       we don't end up in an infinite loop, and it remains visited if it
+    //       cannot be specialised, so that we don't try to evaluate it again.
+
+    auto specialisedConstant = mSpecialisedConstantValues.find(variable.get());
+
+    if (specialisedConstant != mSpecialisedConstantValues.end()) {
+        value = specialisedConstant->second;
+
+        return true;
+    }
+
+    if (((variable->type() != AnalyserVariable::Type::CONSTANT)
+         && (variable->type() != AnalyserVariable::Type::COMPUTED_CONSTANT))
+        || !visitedConstants.insert(variable.get()).second) {
+        return false;
+    }
+
+    if (variable->type() == AnalyserVariable::Type::CONSTANT) {
+        // The value of a constant is either the value of its constant override
+        // or its (scaled) initial value, which may be the value of another
+        // constant.
+
+        auto initialisingVariable = variable->initialisingVariable();
+
+        if (initialisingVariable == nullptr) {
+            return false;
+        }
+
+        if (isCellMLReal(initialisingVariable->initialValue())) {
+            convertToDouble(initialisingVariable->initialValue(), value);
+        } else {
+            auto initialValueVariable = mAnalyserVariables.find(owningComponent(initialisingVariable)->variable(initialisingVariable->initialValue()).get());
+
+            if ((initialValueVariable == mAnalyserVariables.end())
+                || !specialisedConstantValue(initialValueVariable->second, visitedConstants, value)) {
+                return false;
+            }
+        }
+
+        auto scalingFactor = Generator::GeneratorImpl::scalingFactor(initialisingVariable);
+
+        if (!areNearlyEqual(scalingFactor, 1.0)) {
+            value *= 1.0 / scalingFactor;
+        }
+    } else {
+        // The value of a computed constant is that of the RHS of its equation,
+        // as long as it is on its own on the LHS of that equation.
+
+        auto equation = variable->equation(0);
+
+        if ((variable->initialisingVariable() != nullptr)
+            || ((equation->type() != AnalyserEquation::Type::TRUE_CONSTANT)
+                && (equation->type() != AnalyserEquation::Type::VARIABLE_BASED_CONSTANT))
+            || (equation->ast()->leftChild()->type() != AnalyserEquationAst::Type::CI)
+            || (analyserVariable(equation->ast()->leftChild()->variable()) != variable)
+            || !evaluateCode(equation->ast()->rightChild(), visitedConstants, value)) {
+            return false;
+        }
+    }
+
+    mSpecialisedConstantValues[variable.get()] = value;
+
+    visitedConstants.erase(variable.get());
+
+    return true;
+}
+
+void Generator::GeneratorImpl::prepareSpecialisedConstants()
+{
+    // Evaluate the value of our constants and computed constants, if we are to
+    // specialise them, starting with the value of our constant overrides.
+
+    mSpecialisedConstantValues.clear();
+
+    if (!mConstantSpecialisation) {
+        return;
+    }
+
+    // Our ensemble parameters differ from one instance to another, so mark
+    // them as visited so that they, and anything that depends on them, don't
+    // get specialised.
+
+    std::unordered_set<AnalyserVariable *> visitedConstants;
+
+    for (const auto &ensembleParameter : mUsedEnsembleParameters) {
+        visitedConstants.insert(ensembleParameter.get());
+    }
+
+    for (const auto &constantOverride : mConstantOverrides) {
+        auto analyserVariable = mAnalyserVariables.find(constantOverride.first.get());
+
+        if ((analyserVariable != mAnalyserVariables.end())
+            && (analyserVariable->second->type() == AnalyserVariable::Type::CONSTANT)
+            && (visitedConstants.find(analyserVariable->second.get()) == visitedConstants.end())) {
+            mSpecialisedConstantValues[analyserVariable->second.get()] = constantOverride.second;
+        }
+    }
+
+    double value;
+
+    for (const auto &variable : modelVariables()) {
+        specialisedConstantValue(variable, visitedConstants, value);
+    }
+}
+
+void Generator::GeneratorImpl::markAstVariables(const AnalyserEquationAstPtr &ast,
+                                                std::vector<bool> &variables) const
+{
+    if (ast == nullptr) {
+        return;
+    }
+
+    if (ast->type() == AnalyserEquationAst::Type::CI) {
+        auto analyserVariable = Generator::GeneratorImpl::analyserVariable(ast->variable());
+
+        if (analyserVariable->type() == AnalyserVariable::Type::ALGEBRAIC) {
+            variables[analyserVariable->index()] = true;
+        }
+    }
+
+    markAstVariables(ast->leftChild(), variables);
+    markAstVariables(ast->rightChild(), variables);
+}
+
+void Generator::GeneratorImpl::prepareLocalVariables(const std::vector<bool> &remainingEquations)
+{
+    // Determine the algebraic equations that can be computed using a local
+    // variable in computeRates(), i.e. the algebraic equations that have yet to
+    // be generated and which variable is purely intermediate. A variable is not
+    // purely intermediate if it is needed by an NLA system (since the objective
+    // function of an NLA system relies on the variables array) or by
+    // computeRushLarsenCoefficients().
+
+    auto &equations = modelEquations();
+    std::vector<bool> nonLocalVariables(modelVariables().size(), false);
+
+    for (size_t i = 0; i < equations.size(); ++i) {
+        if (equations[i]->type() == AnalyserEquation::Type::NLA) {
+            for (auto dependencyIndex : mEquationDependencies[i]) {
+                for (const auto &variable : equations[dependencyIndex]->variables()) {
+                    nonLocalVariables[variable->index()] = true;
+                }
+            }
+        }
+    }
+
+    if (mProfile->hasComputeRushLarsenCoefficientsMethod()) {
+        for (const auto &state : modelStates()) {
+            if (state->isGatingVariable()) {
+                markAstVariables(state->mPimpl->mGatingTauAst, nonLocalVariables);
+                markAstVariables(state->mPimpl->mGatingSteadyStateAst, nonLocalVariables);
+            }
+        }
+    }
+
+    mLocalEquations.assign(equations.size(), false);
+    mLocalVariables.assign(modelVariables().size(), false);
+
+    for (size_t i = 0; i < equations.size(); ++i) {
+        auto &equation = equations[i];
+
+        if (remainingEquations[i]
+            && (equation->type() == AnalyserEquation::Type::ALGEBRAIC)) {
+            auto variables = equation->variables();
+
+            if (std::none_of(variables.begin(), variables.end(), [&](const AnalyserVariablePtr &variable) {
+                    return nonLocalVariables[variable->index()];
+                })) {
+                mLocalEquations[i] = true;
+
+                for (const auto &variable : variables) {
+                    mLocalVariables[variable->index()] = true;
+                }
+            }
+        }
+    }
+}
+
+bool Generator::GeneratorImpl::modelHasOdes() const
+{
+    switch (mModel->type()) {
+    case AnalyserModel::Type::ODE:
+    case AnalyserModel::Type::DAE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool Generator::GeneratorImpl::modelHasNlas() const
+{
+    switch (mModel->type()) {
+    case AnalyserModel::Type::NLA:
+    case AnalyserModel::Type::DAE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+size_t Generator::GeneratorImpl::stateCount() const
+{
+    // Return the number of states, including the sensitivities of our states
+    // with respect to our sensitivity parameters, if any.
+
+    return mModel->stateCount() * (1 + mUsedSensitivityParameters.size());
+}
+
+AnalyserVariablePtr Generator::GeneratorImpl::analyserVariable(const VariablePtr &variable) const
+{
+    // Return the analyser variable associated with the given variable.
+
+    return mAnalyserVariables.find(variable.get())->second;
+}
+
+double Generator::GeneratorImpl::scalingFactor(const VariablePtr &variable) const
+{
+    // Return the scaling factor for the given variable.
+
+    return Units::scalingFactor(variable->units(), analyserVariable(variable)->variable()->units());
+}
+
+bool Generator::GeneratorImpl::isNegativeNumber(const AnalyserEquationAstPtr &ast) const
+{
+    if (ast->type() == AnalyserEquationAst::Type::CN) {
+        double doubleValue;
+
+        convertToDouble(ast->value(), doubleValue);
+
+        return doubleValue < 0.0;
+    }
+
+    return false;
+}
+
+bool Generator::GeneratorImpl::isRelationalOperator(const AnalyserEquationAstPtr &ast) const
+{
+    switch (ast->type()) {
+    case AnalyserEquationAst::Type::EQ:
+        return mProfile->hasEqOperator();
+    case AnalyserEquationAst::Type::NEQ:
+        return mProfile->hasNeqOperator();
+    case AnalyserEquationAst::Type::LT:
+        return mProfile->hasLtOperator();
+    case AnalyserEquationAst::Type::LEQ:
+        return mProfile->hasLeqOperator();
+    case AnalyserEquationAst::Type::GT:
+        return mProfile->hasGtOperator();
+    case AnalyserEquationAst::Type::GEQ:
+        return mProfile->hasGeqOperator();
+    default:
+        return false;
+    }
+}
+
+bool Generator::GeneratorImpl::isAndOperator(const AnalyserEquationAstPtr &ast) const
+{
+    return (ast->type() == AnalyserEquationAst::Type::AND)
+           && mProfile->hasAndOperator();
+}
+
+bool Generator::GeneratorImpl::isOrOperator(const AnalyserEquationAstPtr &ast) const
+{
+    return (ast->type() == AnalyserEquationAst::Type::OR)
+           && mProfile->hasOrOperator();
+}
+
+bool Generator::GeneratorImpl::isXorOperator(const AnalyserEquationAstPtr &ast) const
+{
+    return (ast->type() == AnalyserEquationAst::Type::XOR)
+           && mProfile->hasXorOperator();
+}
+
+bool Generator::GeneratorImpl::isLogicalOperator(const AnalyserEquationAstPtr &ast) const
+{
+    // Note: AnalyserEquationAst::Type::NOT is a unary logical operator, hence
+    //       we don't include it here since this method is only used to
+    //       determine whether parentheses should be added around some code.
+
+    return isAndOperator(ast) || isOrOperator(ast) || isXorOperator(ast);
+}
+
+bool Generator::GeneratorImpl::isPlusOperator(const AnalyserEquationAstPtr &ast) const
+{
+    return ast->type() == AnalyserEquationAst::Type::PLUS;
+}
+
+bool Generator::GeneratorImpl::isMinusOperator(const AnalyserEquationAstPtr &ast) const
+{
+    return ast->type() == AnalyserEquationAst::Type::MINUS;
+}
+
+bool Generator::GeneratorImpl::isTimesOperator(const AnalyserEquationAstPtr &ast) const
+{
+    return ast->type() == AnalyserEquationAst::Type::TIMES;
+}
+
+bool Generator::GeneratorImpl::isDivideOperator(const AnalyserEquationAstPtr &ast) const
+{
+    return ast->type() == AnalyserEquationAst::Type::DIVIDE;
+}
+
+bool Generator::GeneratorImpl::isPowerOperator(const AnalyserEquationAstPtr &ast) const
+{
+    return (ast->type() == AnalyserEquationAst::Type::POWER)
+           && mProfile->hasPowerOperator();
+}
+
+bool Generator::GeneratorImpl::isRootOperator(const AnalyserEquationAstPtr &ast) const
+{
+    return (ast->type() == AnalyserEquationAst::Type::ROOT)
+           && mProfile->hasPowerOperator();
+}
+
+bool Generator::GeneratorImpl::isPiecewiseStatement(const AnalyserEquationAstPtr &ast) const
+{
+    return (ast->type() == AnalyserEquationAst::Type::PIECEWISE)
+           && mProfile->hasConditionalOperator();
+}
+
+void Generator::GeneratorImpl::updateVariableInfoSizes(size_t &componentSize,
+                                                       size_t &nameSize,
+                                                       size_t &unitsSize,
+                                                       const std::string &component,
+                                                       const std::string &name,
+                                                       const std::string &units) const
+{
+    auto variableComponentSize = component.length() + 1;
+    auto variableNameSize = name.length() + 1;
+    auto variableUnitsSize = units.length() + 1;
+    // Note: +1 to account for the end of string termination.
+
+    componentSize = (componentSize > variableComponentSize) ? componentSize : variableComponentSize;
+    nameSize = (nameSize > variableNameSize) ? nameSize : variableNameSize;
+    unitsSize = (unitsSize > variableUnitsSize) ? unitsSize : variableUnitsSize;
+}
+
+void Generator::GeneratorImpl::updateVariableInfoSizes(size_t &componentSize,
+                                                       size_t &nameSize,
+                                                       size_t &unitsSize,
+                                                       const AnalyserVariablePtr &variable) const
+{
+    auto variableVariable = variable->variable();
+
+    updateVariableInfoSizes(componentSize, nameSize, unitsSize,
+                            owningComponent(variableVariable)->name(),
+                            variableVariable->name(),
+                            variableVariable->units()->name());
+}
+
+std::string Generator::GeneratorImpl::sensitivityName(const AnalyserVariablePtr &variable,
+                                                      const AnalyserVariablePtr &parameter) const
+{
+    return replace(replace(mProfile->sensitivityNameString(),
+                           "[NAME]", variable->variable()->name()),
+                   "[PARAMETER]", parameter->variable()->name());
+}
+
+std::string Generator::GeneratorImpl::sensitivityUnits(const AnalyserVariablePtr &variable,
+                                                       const AnalyserVariablePtr &parameter) const
+{
+    return variable->variable()->units()->name() + "/" + parameter->variable()->units()->name();
+}
+
+bool Generator::GeneratorImpl::modifiedProfile() const
+{
+    // Compute the SHA-1 value of our profile, unless it hasn't been modified
+    // since we last computed it.
+
+    auto profilePimpl = mProfile->mPimpl;
+
+    if (profilePimpl->mSha1ValueVersion != profilePimpl->mVersion) {
+        profilePimpl->mSha1Value = sha1(generatorProfileAsString(mProfile));
+        profilePimpl->mSha1ValueVersion = profilePimpl->mVersion;
+    }
+
+    if (mProfile->profile() == GeneratorProfile::Profile::PYTHON) {
+        return profilePimpl->mSha1Value != PYTHON_GENERATOR_PROFILE_SHA1;
+    }
+
+    if (mProfile->profile() == GeneratorProfile::Profile::CPP) {
+        return profilePimpl->mSha1Value != CPP_GENERATOR_PROFILE_SHA1;
+    }
+
+    if (mProfile->profile() == GeneratorProfile::Profile::NUMPY) {
+        return profilePimpl->mSha1Value != NUMPY_GENERATOR_PROFILE_SHA1;
+    }
+
+    switch (mProfile->precision()) {
+    case GeneratorProfile::Precision::SINGLE:
+        return profilePimpl->mSha1Value != C_SINGLE_PRECISION_GENERATOR_PROFILE_SHA1;
+    case GeneratorProfile::Precision::MIXED:
+        return profilePimpl->mSha1Value != C_MIXED_PRECISION_GENERATOR_PROFILE_SHA1;
+    default: // GeneratorProfile::Precision::DOUBLE.
+        return profilePimpl->mSha1Value != C_GENERATOR_PROFILE_SHA1;
+    }
+}
+
+std::string Generator::GeneratorImpl::newLineIfNeeded()
+{
+    return mCode.empty() ? "" : "\n";
+}
+
+void Generator::GeneratorImpl::addOriginCommentCode()
+{
+    if (!mProfile->commentString().empty()
+        && !mProfile->originCommentString().empty()) {
+        std::string profileInformation = modifiedProfile() ?
+                                             "a modified " :
+                                             "the ";
+
+        if (mProfile->profile() == GeneratorProfile::Profile::C) {
+            if (mProfile->precision() != GeneratorProfile::Precision::DOUBLE) {
+                profileInformation += GeneratorProfile::precisionAsString(mProfile->precision()) + "-precision ";
+            }
+
+            profileInformation += "C";
+        } else if (mProfile->profile() == GeneratorProfile::Profile::PYTHON) {
+            profileInformation += "Python";
+        } else if (mProfile->profile() == GeneratorProfile::Profile::CPP) {
+            profileInformation += "C++";
+        } else {
+            profileInformation += "NumPy";
+        }
+        profileInformation += " profile of";
+
+        mCode += replace(mProfile->commentString(),
+                         "[CODE]", replace(replace(mProfile->originCommentString(), "[PROFILE_INFORMATION]", profileInformation), "[LIBCELLML_VERSION]", versionString()));
+    }
+}
+
+void Generator::GeneratorImpl::addInterfaceHeaderCode()
+{
+    if (!mProfile->interfaceHeaderString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->interfaceHeaderString();
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationHeaderCode()
+{
+    auto hasInterfaceFileName = mProfile->implementationHeaderString().empty() ?
+                                    false :
+                                    (mProfile->implementationHeaderString().find("[INTERFACE_FILE_NAME]") != std::string::npos);
+
+    if (!mProfile->implementationHeaderString().empty()
+        && ((hasInterfaceFileName && !mProfile->interfaceFileNameString().empty())
+            || !hasInterfaceFileName)) {
+        mCode += newLineIfNeeded()
+                 + replace(mProfile->implementationHeaderString(),
+                           "[INTERFACE_FILE_NAME]", mProfile->interfaceFileNameString());
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationNamespaceCode(bool begin)
+{
+    // Begin or end the namespace in which our implementation code is to be
+    // generated, if any. Its name is either the one given by our profile or
+    // that of our model, so that the code generated for different models can
+    // be used in the same program.
+
+    if (mProfile->implementationNamespaceBeginString().empty()
+        || mProfile->implementationNamespaceEndString().empty()) {
+        return;
+    }
+
+    auto namespaceName = mProfile->namespaceString();
+
+    if (namespaceName.empty()) {
+        auto &variables = modelVariables();
+
+        if (!variables.empty()) {
+            namespaceName = owningModel(variables.front()->variable())->name();
+        } else if (mModel->voi() != nullptr) {
+            namespaceName = owningModel(mModel->voi()->variable())->name();
+        }
+    }
+
+    mCode += newLineIfNeeded()
+             + replace(begin ?
+                           mProfile->implementationNamespaceBeginString() :
+                           mProfile->implementationNamespaceEndString(),
+                       "[NAMESPACE]", namespaceName);
+}
+
+void Generator::GeneratorImpl::addVersionAndLibcellmlVersionCode(bool interface)
+{
+    std::string versionAndLibcellmlCode;
+
+    if ((interface && !mProfile->interfaceVersionString().empty())
+        || (!interface && !mProfile->implementationVersionString().empty())) {
+        if (interface) {
+            versionAndLibcellmlCode += mProfile->interfaceVersionString();
+        } else {
+            if (modifiedProfile()) {
+                static const std::regex regEx("([0-9]+\\.[0-9]+\\.[0-9]+)");
+
+                versionAndLibcellmlCode += std::regex_replace(mProfile->implementationVersionString(), regEx, "$1.post0");
+            } else {
+                versionAndLibcellmlCode += mProfile->implementationVersionString();
+            }
+        }
+    }
+
+    if ((interface && !mProfile->interfaceLibcellmlVersionString().empty())
+        || (!interface && !mProfile->implementationLibcellmlVersionString().empty())) {
+        versionAndLibcellmlCode += interface ?
+                                       mProfile->interfaceLibcellmlVersionString() :
+                                       replace(mProfile->implementationLibcellmlVersionString(),
+                                               "[LIBCELLML_VERSION]", versionString());
+    }
+
+    if (!versionAndLibcellmlCode.empty()) {
+        mCode += "\n";
+    }
+
+    mCode += versionAndLibcellmlCode;
+}
+
+void Generator::GeneratorImpl::addStateAndVariableCountCode(bool interface)
+{
+    std::string stateAndVariableCountCode;
+
+    if (modelHasOdes()
+        && ((interface && !mProfile->interfaceStateCountString().empty())
+            || (!interface && !mProfile->implementationStateCountString().empty()))) {
+        stateAndVariableCountCode += interface ?
+                                         mProfile->interfaceStateCountString() :
+                                         replace(mProfile->implementationStateCountString(),
+                                                 "[STATE_COUNT]", std::to_string(stateCount()));
+    }
+
+    if ((interface && !mProfile->interfaceVariableCountString().empty())
+        || (!interface && !mProfile->implementationVariableCountString().empty())) {
+        stateAndVariableCountCode += interface ?
+                                         mProfile->interfaceVariableCountString() :
+                                         replace(mProfile->implementationVariableCountString(),
+                                                 "[VARIABLE_COUNT]", std::to_string(mModel->variableCount()));
+    }
+
+    if (mEnsembleInUse
+        && ((interface && !mProfile->interfaceEnsembleParameterCountString().empty())
+            || (!interface && !mProfile->implementationEnsembleParameterCountString().empty()))) {
+        stateAndVariableCountCode += interface ?
+                                         mProfile->interfaceEnsembleParameterCountString() :
+                                         replace(mProfile->implementationEnsembleParameterCountString(),
+                                                 "[ENSEMBLE_PARAMETER_COUNT]", std::to_string(mUsedEnsembleParameters.size()));
+    }
+
+    if (!stateAndVariableCountCode.empty()) {
+        mCode += "\n";
+    }
+
+    mCode += stateAndVariableCountCode;
+}
+
+void Generator::GeneratorImpl::addVariableTypeObjectCode()
+{
+    auto variableTypeObjectString = mProfile->variableTypeObjectString(modelHasOdes(),
+                                                                       mModel->hasExternalVariables());
+
+    if (!variableTypeObjectString.empty()) {
+        mCode += newLineIfNeeded()
+                 + variableTypeObjectString;
+    }
+}
+
+std::string Generator::GeneratorImpl::generateVariableInfoObjectCode(const std::string &objectString) const
+{
+    size_t componentSize = 0;
+    size_t nameSize = 0;
+    size_t unitsSize = 0;
+
+    if (modelHasOdes()) {
+        updateVariableInfoSizes(componentSize, nameSize, unitsSize, mModel->voi());
+
+        for (const auto &state : modelStates()) {
+            updateVariableInfoSizes(componentSize, nameSize, unitsSize, state);
+        }
+
+        for (const auto &parameter : mUsedSensitivityParameters) {
+            for (const auto &state : modelStates()) {
+                updateVariableInfoSizes(componentSize, nameSize, unitsSize,
+                                        owningComponent(state->variable())->name(),
+                                        sensitivityName(state, parameter),
+                                        sensitivityUnits(state, parameter));
+            }
+        }
+    }
+
+    for (const auto &variable : modelVariables()) {
+        updateVariableInfoSizes(componentSize, nameSize, unitsSize, variable);
+    }
+
+    return replace(replace(replace(objectString,
+                                   "[COMPONENT_SIZE]", std::to_string(componentSize)),
+                           "[NAME_SIZE]", std::to_string(nameSize)),
+                   "[UNITS_SIZE]", std::to_string(unitsSize));
+}
+
+void Generator::GeneratorImpl::addVariableInfoObjectCode()
+{
+    if (!mProfile->variableInfoObjectString().empty()) {
+        mCode += newLineIfNeeded()
+                 + generateVariableInfoObjectCode(mProfile->variableInfoObjectString());
+    }
+}
+
+void Generator::GeneratorImpl::generateVariableInfoEntryCode(const std::string &name,
+                                                             const std::string &units,
+                                                             const std::string &component,
+                                                             const std::string &type,
+                                                             std::string &code) const
+{
+    appendProfileTemplate(code, *mVariableInfoEntryTemplate, {&name, &units, &component, &type});
+}
+
+void Generator::GeneratorImpl::addInterfaceVoiStateAndVariableInfoCode()
+{
+    std::string interfaceVoiStateAndVariableInfoCode;
+
+    if (modelHasOdes()
+        && !mProfile->interfaceVoiInfoString().empty()) {
+        interfaceVoiStateAndVariableInfoCode += mProfile->interfaceVoiInfoString();
+    }
+
+    if (modelHasOdes()
+        && !mProfile->interfaceStateInfoString().empty()) {
+        interfaceVoiStateAndVariableInfoCode += mProfile->interfaceStateInfoString();
+    }
+
+    if (!mProfile->interfaceVariableInfoString().empty()) {
+        interfaceVoiStateAndVariableInfoCode += mProfile->interfaceVariableInfoString();
+    }
+
+    if (!interfaceVoiStateAndVariableInfoCode.empty()) {
+        mCode += "\n";
+    }
+
+    mCode += interfaceVoiStateAndVariableInfoCode;
+}
+
+void Generator::GeneratorImpl::addImplementationVoiInfoCode()
+{
+    if (modelHasOdes()
+        && !mProfile->implementationVoiInfoString().empty()
+        && !mProfile->variableInfoEntryString().empty()
+        && !mProfile->variableOfIntegrationVariableTypeString().empty()) {
+        auto voiVariable = mModel->voi()->variable();
+        auto name = voiVariable->name();
+        auto units = voiVariable->units()->name();
+        auto component = owningComponent(voiVariable)->name();
+        auto type = mProfile->variableOfIntegrationVariableTypeString();
+
+        std::string infoElementCode;
+
+        generateVariableInfoEntryCode(name, units, component, type, infoElementCode);
+
+        mCode += newLineIfNeeded();
+
+        appendProfileTemplate(mCode, profileTemplate(mProfile->implementationVoiInfoString(), {"[CODE]"}),
+                              {&infoElementCode});
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationStateInfoCode()
+{
+    if (modelHasOdes()
+        && !mProfile->implementationStateInfoString().empty()
+        && !mProfile->variableInfoEntryString().empty()
+        && !mProfile->stateVariableTypeString().empty()
+        && !mProfile->arrayElementSeparatorString().empty()) {
+        std::string infoElementsCode;
+        auto type = mProfile->stateVariableTypeString();
+
+        for (const auto &state : modelStates()) {
+            if (!infoElementsCode.empty()) {
+                infoElementsCode += mProfile->arrayElementSeparatorString() + "\n";
+            }
+
+            auto stateVariable = state->variable();
+
+            infoElementsCode += mProfile->indentString();
+
+            generateVariableInfoEntryCode(stateVariable->name(),
+                                          stateVariable->units()->name(),
+                                          owningComponent(stateVariable)->name(),
+                                          type, infoElementsCode);
+        }
+
+        // Our sensitivities, if any, come after our states, one block of states
+        // per sensitivity parameter.
+
+        for (const auto &parameter : mUsedSensitivityParameters) {
+            for (const auto &state : modelStates()) {
+                infoElementsCode += mProfile->arrayElementSeparatorString() + "\n"
+                                    + mProfile->indentString();
+
+                generateVariableInfoEntryCode(sensitivityName(state, parameter),
+                                              sensitivityUnits(state, parameter),
+                                              owningComponent(state->variable())->name(),
+                                              type, infoElementsCode);
+            }
+        }
+
+        infoElementsCode += "\n";
+
+        mCode += newLineIfNeeded();
+
+        appendProfileTemplate(mCode, profileTemplate(mProfile->implementationStateInfoString(), {"[CODE]"}),
+                              {&infoElementsCode});
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationVariableInfoCode()
+{
+    if (!mProfile->implementationVariableInfoString().empty()
+        && !mProfile->variableInfoEntryString().empty()
+        && !mProfile->arrayElementSeparatorString().empty()
+        && !mProfile->variableOfIntegrationVariableTypeString().empty()
+        && !mProfile->stateVariableTypeString().empty()
+        && !mProfile->constantVariableTypeString().empty()
+        && !mProfile->computedConstantVariableTypeString().empty()
+        && !mProfile->algebraicVariableTypeString().empty()
+        && !mProfile->externalVariableTypeString().empty()) {
+        std::string infoElementsCode;
+
+        for (const auto &variable : modelVariables()) {
+            if (!infoElementsCode.empty()) {
+                infoElementsCode += mProfile->arrayElementSeparatorString() + "\n";
+            }
+
+            std::string variableType;
+
+            switch (variable->type()) {
+            case AnalyserVariable::Type::CONSTANT:
+                variableType = mProfile->constantVariableTypeString();
+
+                break;
+            case AnalyserVariable::Type::COMPUTED_CONSTANT:
+                variableType = mProfile->computedConstantVariableTypeString();
+
+                break;
+            case AnalyserVariable::Type::ALGEBRAIC:
+                variableType = mProfile->algebraicVariableTypeString();
+
+                break;
+            default: // AnalyserVariable::Type::EXTERNAL.
+                variableType = mProfile->externalVariableTypeString();
+
+                break;
+            }
+
+            auto variableVariable = variable->variable();
+
+            infoElementsCode += mProfile->indentString();
+
+            generateVariableInfoEntryCode(variableVariable->name(),
+                                          variableVariable->units()->name(),
+                                          owningComponent(variableVariable)->name(),
+                                          variableType, infoElementsCode);
+        }
+
+        if (!infoElementsCode.empty()) {
+            infoElementsCode += "\n";
+        }
+
+        mCode += newLineIfNeeded();
+
+        appendProfileTemplate(mCode, profileTemplate(mProfile->implementationVariableInfoString(), {"[CODE]"}),
+                              {&infoElementsCode});
+    }
+}
+
+void Generator::GeneratorImpl::addArithmeticFunctionsCode()
+{
+    if (mModel->needEqFunction() && !mProfile->hasEqOperator()
+        && !mProfile->eqFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->eqFunctionString();
+    }
+
+    if (mModel->needNeqFunction() && !mProfile->hasNeqOperator()
+        && !mProfile->neqFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->neqFunctionString();
+    }
+
+    if ((mModel->needLtFunction() || mSensitivitiesNeedLtFunction)
+        && !mProfile->hasLtOperator()
+        && !mProfile->ltFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->ltFunctionString();
+    }
+
+    if (mModel->needLeqFunction() && !mProfile->hasLeqOperator()
+        && !mProfile->leqFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->leqFunctionString();
+    }
+
+    if (mModel->needGtFunction() && !mProfile->hasGtOperator()
+        && !mProfile->gtFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->gtFunctionString();
+    }
+
+    if (mModel->needGeqFunction() && !mProfile->hasGeqOperator()
+        && !mProfile->geqFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->geqFunctionString();
+    }
+
+    if (mModel->needAndFunction() && !mProfile->hasAndOperator()
+        && !mProfile->andFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->andFunctionString();
+    }
+
+    if (mModel->needOrFunction() && !mProfile->hasOrOperator()
+        && !mProfile->orFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->orFunctionString();
+    }
+
+    if (mModel->needXorFunction() && !mProfile->hasXorOperator()
+        && !mProfile->xorFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->xorFunctionString();
+    }
+
+    if (mModel->needNotFunction() && !mProfile->hasNotOperator()
+        && !mProfile->notFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->notFunctionString();
+    }
+
+    if (mModel->needMinFunction()
+        && !mProfile->minFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->minFunctionString();
+    }
+
+    if (mModel->needMaxFunction()
+        && !mProfile->maxFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->maxFunctionString();
+    }
+}
+
+void Generator::GeneratorImpl::addTrigonometricFunctionsCode()
+{
+    if (mModel->needSecFunction()
+        && !mProfile->secFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->secFunctionString();
+    }
+
+    if (mModel->needCscFunction()
+        && !mProfile->cscFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->cscFunctionString();
+    }
+
+    if (mModel->needCotFunction()
+        && !mProfile->cotFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->cotFunctionString();
+    }
+
+    if (mModel->needSechFunction()
+        && !mProfile->sechFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->sechFunctionString();
+    }
+
+    if (mModel->needCschFunction()
+        && !mProfile->cschFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->cschFunctionString();
+    }
+
+    if (mModel->needCothFunction()
+        && !mProfile->cothFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->cothFunctionString();
+    }
+
+    if (mModel->needAsecFunction()
+        && !mProfile->asecFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->asecFunctionString();
+    }
+
+    if (mModel->needAcscFunction()
+        && !mProfile->acscFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->acscFunctionString();
+    }
+
+    if (mModel->needAcotFunction()
+        && !mProfile->acotFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->acotFunctionString();
+    }
+
+    if (mModel->needAsechFunction()
+        && !mProfile->asechFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->asechFunctionString();
+    }
+
+    if (mModel->needAcschFunction()
+        && !mProfile->acschFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->acschFunctionString();
+    }
+
+    if (mModel->needAcothFunction()
+        && !mProfile->acothFunctionString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->acothFunctionString();
+    }
+}
+
+void Generator::GeneratorImpl::addInterfaceCreateDeleteArrayMethodsCode()
+{
+    std::string interfaceCreateDeleteArraysCode;
+
+    if (modelHasOdes()
+        && !mProfile->interfaceCreateStatesArrayMethodString().empty()) {
+        interfaceCreateDeleteArraysCode += mProfile->interfaceCreateStatesArrayMethodString();
+    }
+
+    if (!mProfile->interfaceCreateVariablesArrayMethodString().empty()) {
+        interfaceCreateDeleteArraysCode += mProfile->interfaceCreateVariablesArrayMethodString();
+    }
+
+    if (!mProfile->interfaceDeleteArrayMethodString().empty()) {
+        interfaceCreateDeleteArraysCode += mProfile->interfaceDeleteArrayMethodString();
+    }
+
+    if (!interfaceCreateDeleteArraysCode.empty()) {
+        mCode += "\n";
+    }
+
+    mCode += interfaceCreateDeleteArraysCode;
+}
+
+void Generator::GeneratorImpl::addExternalVariableMethodTypeDefinitionCode()
+{
+    if (mModel->hasExternalVariables()) {
+        auto externalVariableMethodTypeDefinitionString = mProfile->externalVariableMethodTypeDefinitionString(modelHasOdes());
+
+        if (!externalVariableMethodTypeDefinitionString.empty()) {
+            mCode += "\n"
+                     + externalVariableMethodTypeDefinitionString;
+        }
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationCreateStatesArrayMethodCode()
+{
+    if (modelHasOdes()
+        && !mProfile->implementationCreateStatesArrayMethodString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->implementationCreateStatesArrayMethodString();
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationCreateVariablesArrayMethodCode()
+{
+    if (!mProfile->implementationCreateVariablesArrayMethodString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->implementationCreateVariablesArrayMethodString();
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationDeleteArrayMethodCode()
+{
+    if (!mProfile->implementationDeleteArrayMethodString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->implementationDeleteArrayMethodString();
+    }
+}
+
+void Generator::GeneratorImpl::addRootFindingInfoObjectCode()
+{
+    if (modelHasNlas()
+        && !mProfile->rootFindingInfoObjectString(modelHasOdes()).empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->rootFindingInfoObjectString(modelHasOdes());
+    }
+}
+
+void Generator::GeneratorImpl::addExternNlaSolveMethodCode()
+{
+    if (modelHasNlas()
+        && !mProfile->externNlaSolveMethodString().empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->externNlaSolveMethodString();
+    }
+}
+
+void Generator::GeneratorImpl::addNlaSystemsCode()
+{
+    if (modelHasNlas()
+        && !mProfile->objectiveFunctionMethodString(modelHasOdes()).empty()
+        && !mProfile->findRootMethodString(modelHasOdes()).empty()
+        && !mProfile->nlaSolveCallString(modelHasOdes()).empty()) {
+        std::vector<AnalyserEquationPtr> handledNlaEquations;
+
+        for (const auto &equation : mModel->equations()) {
+            if ((equation->type() == AnalyserEquation::Type::NLA)
+                && (std::find(handledNlaEquations.begin(), handledNlaEquations.end(), equation) == handledNlaEquations.end())) {
+                std::string methodBody;
+                auto i = MAX_SIZE_T;
+                auto variables = equation->variables();
+                auto variablesSize = variables.size();
+
+                for (i = 0; i < variablesSize; ++i) {
+                    auto arrayString = (variables[i]->type() == AnalyserVariable::Type::STATE) ?
+                                           mProfile->ratesArrayString() :
+                                           mProfile->variablesArrayString();
+
+                    methodBody += mProfile->indentString()
+                                  + arrayString + mProfile->openArrayString() + convertToString(variables[i]->index()) + mProfile->closeArrayString()
+                                  + mProfile->equalityString()
+                                  + mProfile->uArrayString() + mProfile->openArrayString() + convertToString(i) + mProfile->closeArrayString()
+                                  + mProfile->commandSeparatorString() + "\n";
+                }
+
+                methodBody += newLineIfNeeded();
+
+                i = MAX_SIZE_T;
+
+                methodBody += mProfile->indentString()
+                              + mProfile->fArrayString() + mProfile->openArrayString() + convertToString(++i) + mProfile->closeArrayString()
+                              + mProfile->equalityString()
+                              + generateCode(equation->ast())
+                              + mProfile->commandSeparatorString() + "\n";
+
+                handledNlaEquations.push_back(equation);
+
+                for (const auto &nlaSibling : equation->nlaSiblings()) {
+                    methodBody += mProfile->indentString()
+                                  + mProfile->fArrayString() + mProfile->openArrayString() + convertToString(++i) + mProfile->closeArrayString()
+                                  + mProfile->equalityString()
+                                  + generateCode(nlaSibling->ast())
+                                  + mProfile->commandSeparatorString() + "\n";
+
+                    handledNlaEquations.push_back(nlaSibling);
+                }
+
+                auto index = convertToString(equation->nlaSystemIndex());
+
+                auto methodBodyCode = generateMethodBodyCode(methodBody);
+
+                mCode += newLineIfNeeded();
+
+                appendProfileTemplate(mCode,
+                                      profileTemplate(mProfile->objectiveFunctionMethodString(modelHasOdes()),
+                                                      {"[INDEX]", "[CODE]"}),
+                                      {&index, &methodBodyCode});
+
+                methodBody = {};
+
+                for (i = 0; i < variablesSize; ++i) {
+                    auto arrayString = (variables[i]->type() == AnalyserVariable::Type::STATE) ?
+                                           mProfile->ratesArrayString() :
+                                           mProfile->variablesArrayString();
+
+                    methodBody += mProfile->indentString()
+                                  + mProfile->uArrayString() + mProfile->openArrayString() + convertToString(i) + mProfile->closeArrayString()
+                                  + mProfile->equalityString()
+                                  + arrayString + mProfile->openArrayString() + convertToString(variables[i]->index()) + mProfile->closeArrayString()
+                                  + mProfile->commandSeparatorString() + "\n";
+                }
+
+                auto variableCount = convertToString(equation->variableCount());
+
+                methodBody += newLineIfNeeded();
+                methodBody += mProfile->indentString();
+
+                appendProfileTemplate(methodBody,
+                                      profileTemplate(mProfile->nlaSolveCallString(modelHasOdes()),
+                                                      {"[INDEX]", "[SIZE]"}),
+                                      {&index, &variableCount});
+
+                methodBody += newLineIfNeeded();
+
+                for (i = 0; i < variablesSize; ++i) {
+                    auto arrayString = (variables[i]->type() == AnalyserVariable::Type::STATE) ?
+                                           mProfile->ratesArrayString() :
+                                           mProfile->variablesArrayString();
+
+                    methodBody += mProfile->indentString()
+                                  + arrayString + mProfile->openArrayString() + convertToString(variables[i]->index()) + mProfile->closeArrayString()
+                                  + mProfile->equalityString()
+                                  + mProfile->uArrayString() + mProfile->openArrayString() + convertToString(i) + mProfile->closeArrayString()
+                                  + mProfile->commandSeparatorString() + "\n";
+                }
+
+                auto size = convertToString(variablesSize);
+
+                methodBodyCode = generateMethodBodyCode(methodBody);
+
+                mCode += newLineIfNeeded();
+
+                appendProfileTemplate(mCode,
+                                      profileTemplate(mProfile->findRootMethodString(modelHasOdes()),
+                                                      {"[INDEX]", "[SIZE]", "[CODE]"}),
+                                      {&index, &size, &methodBodyCode});
+            }
+        }
+    }
+}
+
+void Generator::GeneratorImpl::addLookupTableDeclarationsCode()
+{
+    std::string lookupTableDeclarationsCode;
+
+    for (size_t i = 0; i < mUsedLookupTables.size(); ++i) {
+        auto &usedLookupTable = mUsedLookupTables[i];
+
+        auto index = convertToString(i);
+        auto size = convertToString(usedLookupTable.mSize * usedLookupTable.mEquations.size());
+
+        appendProfileTemplate(lookupTableDeclarationsCode,
+                              profileTemplate(mProfile->lookupTableDeclarationString(), {"[INDEX]", "[SIZE]"}),
+                              {&index, &size});
+    }
+
+    if (!lookupTableDeclarationsCode.empty()) {
+        mCode += newLineIfNeeded()
+                 + lookupTableDeclarationsCode;
+    }
+}
+
+void Generator::GeneratorImpl::addLookupTableValueMethodCode()
+{
+    if (!mUsedLookupTables.empty()) {
+        mCode += newLineIfNeeded()
+                 + mProfile->lookupTableValueMethodString();
+    }
+}
+
+std::string Generator::GeneratorImpl::generateMethodBodyCode(const std::string &methodBody) const
+{
+    return methodBody.empty() ?
+               mProfile->emptyMethodString().empty() ?
+               "" :
+               mProfile->indentString() + mProfile->emptyMethodString() :
+               methodBody;
+}
+
+void Generator::GeneratorImpl::addMethodCode(const std::string &methodString,
+                                             const std::string &methodBody)
+{
+    mCode += newLineIfNeeded();
+
+    if (methodBody.empty()) {
+        auto emptyMethodBody = generateMethodBodyCode(methodBody);
+
+        appendProfileTemplate(mCode, profileTemplate(methodString, {"[CODE]"}), {&emptyMethodBody});
+    } else {
+        appendProfileTemplate(mCode, profileTemplate(methodString, {"[CODE]"}), {&methodBody});
+    }
+}
+
+std::string Generator::GeneratorImpl::generateDoubleCode(const std::string &value) const
+{
+    if (value.find('.') != std::string::npos) {
+        return value + mProfile->literalSuffixString();
+    }
+
+    auto ePos = value.find('e');
+
+    if (ePos == std::string::npos) {
+        return value + ".0" + mProfile->literalSuffixString();
+    }
+
+    return value.substr(0, ePos) + ".0" + value.substr(ePos) + mProfile->literalSuffixString();
+}
+
+std::string Generator::GeneratorImpl::generateSpecialisedConstantCode(double value,
+                                                                      bool parentheses) const
+{
+    // Generate the code for the value of a specialised constant, making sure
+    // that it round-trips (so that the generated code computes with exactly
+    // the same value as the one we evaluated) and that a negative value within
+    // an expression doesn't get mistaken for an operator.
+
+    std::string code;
+
+    if (std::isnan(value)) {
+        code = mProfile->nanString();
+    } else if (std::isinf(value)) {
+        code = mProfile->infString();
+    } else {
+        code = generateDoubleCode(convertToRoundTripString(std::fabs(value)));
+    }
+
+    if (std::signbit(value)) {
+        code = mProfile->minusString() + code;
+
+        if (parentheses) {
+            code = "(" + code + ")";
+        }
+    }
+
+    return code;
+}
+
+std::string Generator::GeneratorImpl::generateDoubleOrConstantVariableNameCode(const VariablePtr &variable) const
+{
+    if (isCellMLReal(variable->initialValue())) {
+        return generateDoubleCode(variable->initialValue());
+    }
+
+    auto initValueVariable = owningComponent(variable)->variable(variable->initialValue());
+    auto analyserInitialValueVariable = analyserVariable(initValueVariable);
+    auto specialisedConstant = mSpecialisedConstantValues.find(analyserInitialValueVariable.get());
+
+    if (specialisedConstant != mSpecialisedConstantValues.end()) {
+        return generateSpecialisedConstantCode(specialisedConstant->second);
+    }
+
+    return mProfile->variablesArrayString() + mProfile->openArrayString() + convertToString(analyserInitialValueVariable->index()) + mProfile->closeArrayString();
+}
+
+std::string Generator::GeneratorImpl::generateVariableNameCode(const VariablePtr &variable,
+                                                               bool state) const
+{
+    // Generate some code for a variable name, but only if we have a model. If
+    // we don't have a model, it means that we are using the generator from the
+    // analyser, in which case we just want to return the original name of the
+    // variable.
+
+    if (mModel == nullptr) {
+        return variable->name();
+    }
+
+    auto analyserVariable = Generator::GeneratorImpl::analyserVariable(variable);
+
+    if (analyserVariable->type() == AnalyserVariable::Type::VARIABLE_OF_INTEGRATION) {
+        return mProfile->voiString();
+    }
+
+    std::string arrayName;
+
+    if (analyserVariable->type() == AnalyserVariable::Type::STATE) {
+        arrayName = state ?
+                        mProfile->statesArrayString() :
+                        mProfile->ratesArrayString();
+    } else {
+        // Use a local variable if we are generating computeRates() and our
+        // variable is a purely intermediate algebraic variable.
+
+        if (mLocalVariablesInUse
+            && (analyserVariable->type() == AnalyserVariable::Type::ALGEBRAIC)
+            && mLocalVariables[analyserVariable->index()]) {
+            std::string code;
+            auto name = analyserVariable->variable()->name();
+            auto index = convertToString(analyserVariable->index());
+
+            appendProfileTemplate(code, *mLocalVariableNameTemplate, {&name, &index});
+
+            return code;
+        }
+
+        arrayName = mProfile->variablesArrayString();
+    }
+
+    return arrayName + mProfile->openArrayString() + convertToString(analyserVariable->index()) + mProfile->closeArrayString();
+}
+
+void Generator::GeneratorImpl::generateOperatorCode(const std::string &op,
+                                                    const AnalyserEquationAstPtr &ast,
+                                                    std::string &code) const
+{
+    auto astLeftChild = ast->leftChild();
+    auto astRightChild = ast->rightChild();
+    bool leftParentheses = false;
+    bool rightParentheses = false;
+
+    // Determine whether parentheses should be added around the left and/or
+    // right piece of code, and this based on the precedence of the operators
+    // used in CellML, which are listed below from higher to lower precedence:
+    //  1. Parentheses                                           [Left to right]
+    //  2. POWER (as an operator, not as a function, i.e.        [Left to right]
+    //            as in Matlab and not in C, for example)
+    //  3. Unary PLUS, Unary MINUS, NOT                          [Right to left]
+    //  4. TIMES, DIVIDE                                         [Left to right]
+    //  5. PLUS, MINUS                                           [Left to right]
+    //  6. LT, LEQ, GT, GEQ                                      [Left to right]
+    //  7. EQ, NEQ                                               [Left to right]
+    //  8. XOR (bitwise)                                         [Left to right]
+    //  9. AND (logical)                                         [Left to right]
+    // 10. OR (logical)                                          [Left to right]
+    // 11. PIECEWISE (as an operator)                            [Right to left]
+
+    if (isPlusOperator(ast)) {
+        if (isRelationalOperator(astLeftChild)
+            || isLogicalOperator(astLeftChild)
+            || isPiecewiseStatement(astLeftChild)) {
+            leftParentheses = true;
+        }
+
+        if (isRelationalOperator(astRightChild)
+            || isLogicalOperator(astRightChild)
+            || isPiecewiseStatement(astRightChild)) {
+            rightParentheses = true;
+        }
+    } else if (isMinusOperator(ast)) {
+        if (isRelationalOperator(astLeftChild)
+            || isLogicalOperator(astLeftChild)
+            || isPiecewiseStatement(astLeftChild)) {
+            leftParentheses = true;
+        }
+
+        if (isNegativeNumber(astRightChild)
+            || isRelationalOperator(astRightChild)
+            || isLogicalOperator(astRightChild)
+            || isMinusOperator(astRightChild)
+            || isPiecewiseStatement(astRightChild)) {
+            rightParentheses = true;
+        } else if (isPlusOperator(astRightChild)) {
+            if (astRightChild->rightChild() != nullptr) {
+                rightParentheses = true;
+            }
+        }
+    } else if (isTimesOperator(ast)) {
+        if (isRelationalOperator(astLeftChild)
+            || isLogicalOperator(astLeftChild)
+            || isPiecewiseStatement(astLeftChild)) {
+            leftParentheses = true;
+        } else if (isPlusOperator(astLeftChild)
+                   || isMinusOperator(astLeftChild)) {
+            if (astLeftChild->rightChild() != nullptr) {
+                leftParentheses = true;
+            }
+        }
+
+        if (isRelationalOperator(astRightChild)
+            || isLogicalOperator(astRightChild)
+            || isPiecewiseStatement(astRightChild)) {
+            rightParentheses = true;
+        } else if (isPlusOperator(astRightChild)
+                   || isMinusOperator(astRightChild)) {
+            if (astRightChild->rightChild() != nullptr) {
+                rightParentheses = true;
+            }
+        }
+    } else if (isDivideOperator(ast)) {
+        if (isRelationalOperator(astLeftChild)
+            || isLogicalOperator(astLeftChild)
+            || isPiecewiseStatement(astLeftChild)) {
+            leftParentheses = true;
+        } else if (isPlusOperator(astLeftChild)
+                   || isMinusOperator(astLeftChild)) {
+            if (astLeftChild->rightChild() != nullptr) {
+                leftParentheses = true;
+            }
+        }
+
+        if (isRelationalOperator(astRightChild)
+            || isLogicalOperator(astRightChild)
+            || isTimesOperator(astRightChild)
+            || isDivideOperator(astRightChild)
+            || isPiecewiseStatement(astRightChild)) {
+            rightParentheses = true;
+        } else if (isPlusOperator(astRightChild)
+                   || isMinusOperator(astRightChild)) {
+            if (astRightChild->rightChild() != nullptr) {
+                rightParentheses = true;
+            }
+        }
+    } else if (isAndOperator(ast)) {
+        // Note: according to the precedence rules above, we only need to
+        //       add parentheses around OR and PIECEWISE. However, it looks
+        //       better/clearer to have some around some other operators
+        //       (agreed, this is somewhat subjective).
+
+        if (isRelationalOperator(astLeftChild)
+            || isOrOperator(astLeftChild)
+            || isXorOperator(astLeftChild)
+            || isPiecewiseStatement(astLeftChild)) {
+            leftParentheses = true;
+        } else if (isPlusOperator(astLeftChild)
+                   || isMinusOperator(astLeftChild)) {
+            if (astLeftChild->rightChild() != nullptr) {
+                leftParentheses = true;
+            }
+        } else if (isPowerOperator(astLeftChild)) {
+            leftParentheses = true;
+        } else if (isRootOperator(astLeftChild)) {
+            leftParentheses = true;
+        }
+
+        if (isRelationalOperator(astRightChild)
+            || isOrOperator(astRightChild)
+            || isXorOperator(astRightChild)
+            || isPiecewiseStatement(astRightChild)) {
+            rightParentheses = true;
+        } else if (isPlusOperator(astRightChild)
+                   || isMinusOperator(astRightChild)) {
+            if (astRightChild->rightChild() != nullptr) {
+                rightParentheses = true;
+            }
+        } else if (isPowerOperator(astRightChild)) {
+            rightParentheses = true;
+        } else if (isRootOperator(astRightChild)) {
+            rightParentheses = true;
+        }
+    } else if (isOrOperator(ast)) {
+        // Note: according to the precedence rules above, we only need to
+        //       add parentheses around PIECEWISE. However, it looks
+        //       better/clearer to have some around some other operators
+        //       (agreed, this is somewhat subjective).
+
+        if (isRelationalOperator(astLeftChild)
+            || isAndOperator(astLeftChild)
+            || isXorOperator(astLeftChild)
+            || isPiecewiseStatement(astLeftChild)) {
+            leftParentheses = true;
+        } else if (isPlusOperator(astLeftChild)
+                   || isMinusOperator(astLeftChild)) {
+            if (astLeftChild->rightChild() != nullptr) {
+                leftParentheses = true;
+            }
+        } else if (isPowerOperator(astLeftChild)) {
+            leftParentheses = true;
+        } else if (isRootOperator(astLeftChild)) {
+            leftParentheses = true;
+        }
+
+        if (isRelationalOperator(astRightChild)
+            || isAndOperator(astRightChild)
+            || isXorOperator(astRightChild)
+            || isPiecewiseStatement(astRightChild)) {
+            rightParentheses = true;
+        } else if (isPlusOperator(astRightChild)
+                   || isMinusOperator(astRightChild)) {
+            if (astRightChild->rightChild() != nullptr) {
+                rightParentheses = true;
+            }
+        } else if (isPowerOperator(astRightChild)) {
+            rightParentheses = true;
+        } else if (isRootOperator(astRightChild)) {
+            rightParentheses = true;
+        }
+    } else if (isXorOperator(ast)) {
+        // Note: according to the precedence rules above, we only need to
+        //       add parentheses around AND, OR and PIECEWISE. However, it
+        //       looks better/clearer to have some around some other
+        //       operators (agreed, this is somewhat subjective).
+
+        if (isRelationalOperator(astLeftChild)
+            || isAndOperator(astLeftChild)
+            || isOrOperator(astLeftChild)
+            || isPiecewiseStatement(astLeftChild)) {
+            leftParentheses = true;
+        } else if (isPlusOperator(astLeftChild)
+                   || isMinusOperator(astLeftChild)) {
+            if (astLeftChild->rightChild() != nullptr) {
+                leftParentheses = true;
+            }
+        } else if (isPowerOperator(astLeftChild)) {
+            leftParentheses = true;
+        } else if (isRootOperator(astLeftChild)) {
+            leftParentheses = true;
+        }
+
+        if (isRelationalOperator(astRightChild)
+            || isAndOperator(astRightChild)
+            || isOrOperator(astRightChild)
+            || isPiecewiseStatement(astRightChild)) {
+            rightParentheses = true;
+        } else if (isPlusOperator(astRightChild)
+                   || isMinusOperator(astRightChild)) {
+            if (astRightChild->rightChild() != nullptr) {
+                rightParentheses = true;
+            }
+        } else if (isPowerOperator(astRightChild)) {
+            rightParentheses = true;
+        } else if (isRootOperator(astRightChild)) {
+            rightParentheses = true;
+        }
+    } else if (isPowerOperator(ast)) {
+        if (isRelationalOperator(astLeftChild)
+            || isLogicalOperator(astLeftChild)
+            || isMinusOperator(astLeftChild)
+            || isTimesOperator(astLeftChild)
+            || isDivideOperator(astLeftChild)
+            || isPiecewiseStatement(astLeftChild)) {
+            leftParentheses = true;
+        } else if (isPlusOperator(astLeftChild)) {
+            if (astLeftChild->rightChild() != nullptr) {
+                leftParentheses = true;
+            }
+        }
+
+        if (isRelationalOperator(astRightChild)
+            || isLogicalOperator(astRightChild)
+            || isMinusOperator(astLeftChild)
+            || isTimesOperator(astRightChild)
+            || isDivideOperator(astRightChild)
+            || isPowerOperator(astRightChild)
+            || isRootOperator(astRightChild)
+            || isPiecewiseStatement(astRightChild)) {
+            rightParentheses = true;
+        } else if (isPlusOperator(astRightChild)) {
+            if (astRightChild->rightChild() != nullptr) {
+                rightParentheses = true;
+            }
+        }
+    } else if (isRootOperator(ast)) {
+        if (isRelationalOperator(astRightChild)
+            || isLogicalOperator(astRightChild)
+            || isMinusOperator(astRightChild)
+            || isTimesOperator(astRightChild)
+            || isDivideOperator(astRightChild)
+            || isPiecewiseStatement(astRightChild)) {
+            rightParentheses = true;
+        } else if (isPlusOperator(astRightChild)) {
+            if (astRightChild->rightChild() != nullptr) {
+                rightParentheses = true;
+            }
+        }
+
+        auto astLeftChildLeftChild = astLeftChild->leftChild();
+
+        if (isRelationalOperator(astLeftChildLeftChild)
+            || isLogicalOperator(astLeftChildLeftChild)
+            || isMinusOperator(astLeftChildLeftChild)
+            || isTimesOperator(astLeftChildLeftChild)
+            || isDivideOperator(astLeftChildLeftChild)
+            || isPowerOperator(astLeftChildLeftChild)
+            || isRootOperator(astLeftChildLeftChild)
+            || isPiecewiseStatement(astLeftChildLeftChild)) {
+            leftParentheses = true;
+        } else if (isPlusOperator(astLeftChildLeftChild)) {
+            if (astLeftChildLeftChild->rightChild() != nullptr) {
+                leftParentheses = true;
+            }
+        }
+
+        generateBranchCode(astRightChild, rightParentheses, code);
+
+        code += op;
+        code += "(1.0/";
+
+        generateBranchCode(astLeftChild, leftParentheses, code);
+
+        code += ")";
+
+        return;
+    }
+
+    // Generate the code for the left and right branches of the given AST.
+
+    generateBranchCode(astLeftChild, leftParentheses, code);
+
+    code += op;
+
+    auto astRightChildCodeStart = code.size();
+
+    generateBranchCode(astRightChild, rightParentheses, code);
+
+    // The right branch of a MINUS operator also needs parentheses if its code
+    // starts with a minus sign (e.g. x-(-y*z)), something that we can only know
+    // once that code has been generated.
+
+    if (isMinusOperator(ast)
+        && !rightParentheses
+        && (code.compare(astRightChildCodeStart, mProfile->minusString().length(), mProfile->minusString()) == 0)) {
+        code.insert(astRightChildCodeStart, "(");
+        code += ")";
+    }
+}
+
+void Generator::GeneratorImpl::generateBranchCode(const AnalyserEquationAstPtr &ast,
+                                                  bool parentheses,
+                                                  std::string &code) const
+{
+    if (parentheses) {
+        code += "(";
+
+        generateCode(ast, code);
+
+        code += ")";
+    } else {
+        generateCode(ast, code);
+    }
+}
+
+void Generator::GeneratorImpl::generateMinusUnaryCode(const AnalyserEquationAstPtr &ast,
+                                                      std::string &code) const
 {
-    size_t componentSize = 0;
-    size_t nameSize = 0;
-    size_t unitsSize = 0;
+    // Determine whether parentheses should be added around the code for the
+    // left branch of the given AST, and generate it.
+
+    auto astLeftChild = ast->leftChild();
+
+    code += mProfile->minusString();
+
+    generateBranchCode(astLeftChild,
+                       isRelationalOperator(astLeftChild)
+                           || isLogicalOperator(astLeftChild)
+                           || isPlusOperator(astLeftChild)
+                           || isMinusOperator(astLeftChild)
+                           || isPiecewiseStatement(astLeftChild),
+                       code);
+}
+
+void Generator::GeneratorImpl::generateOneParameterFunctionCode(const std::string &function,
+                                                                const AnalyserEquationAstPtr &ast,
+                                                                std::string &code) const
+{
+    code += function;
+    code += "(";
+
+    generateCode(ast->leftChild(), code);
+
+    code += ")";
+}
+
+void Generator::GeneratorImpl::generateTwoParameterFunctionCode(const std::string &function,
+                                                                const AnalyserEquationAstPtr &ast,
+                                                                std::string &code) const
+{
+    code += function;
+    code += "(";
+
+    generateCode(ast->leftChild(), code);
+
+    code += ", ";
+
+    generateCode(ast->rightChild(), code);
+
+    code += ")";
+}
+
+void Generator::GeneratorImpl::generatePiecewiseIfCode(const std::string &condition,
+                                                       const std::string &value,
+                                                       std::string &code) const
+{
+    appendProfileTemplate(code, *mPiecewiseIfTemplate, {&condition, &value});
+}
+
+void Generator::GeneratorImpl::generatePiecewiseElseCode(const std::string &value,
+                                                         std::string &code) const
+{
+    appendProfileTemplate(code, *mPiecewiseElseTemplate, {&value});
+}
+
+std::string Generator::GeneratorImpl::generateCode(const AnalyserEquationAstPtr &ast) const
+{
+    std::string code;
+
+    generateCode(ast, code);
+
+    return code;
+}
+
+void Generator::GeneratorImpl::generateCode(const AnalyserEquationAstPtr &ast,
+                                            std::string &code) const
+{
+    // Generate the code for the given AST.
+    // Note: AnalyserEquationAst::Type::BVAR is only relevant when there is no
+    //       model (in which case we want to generate something like dx/dt, as
+    //       is in the case of the analyser when we want to mention an equation)
+    //       since otherwise we don't need to generate any code for it (since we
+    //       will, instead, want to generate something like rates[0]).
+    // Note: the code is appended to the given code, thus allowing us to
+    //       generate the code for an AST in a single pass.
+
+    switch (ast->type()) {
+    case AnalyserEquationAst::Type::EQUALITY:
+        generateOperatorCode(mProfile->equalityString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::EQ:
+        if (mProfile->hasEqOperator()) {
+            generateOperatorCode(mProfile->eqString(), ast, code);
+        } else {
+            generateTwoParameterFunctionCode(mProfile->eqString(), ast, code);
+        }
+
+        break;
+    case AnalyserEquationAst::Type::NEQ:
+        if (mProfile->hasNeqOperator()) {
+            generateOperatorCode(mProfile->neqString(), ast, code);
+        } else {
+            generateTwoParameterFunctionCode(mProfile->neqString(), ast, code);
+        }
+
+        break;
+    case AnalyserEquationAst::Type::LT:
+        if (mProfile->hasLtOperator()) {
+            generateOperatorCode(mProfile->ltString(), ast, code);
+        } else {
+            generateTwoParameterFunctionCode(mProfile->ltString(), ast, code);
+        }
+
+        break;
+    case AnalyserEquationAst::Type::LEQ:
+        if (mProfile->hasLeqOperator()) {
+            generateOperatorCode(mProfile->leqString(), ast, code);
+        } else {
+            generateTwoParameterFunctionCode(mProfile->leqString(), ast, code);
+        }
+
+        break;
+    case AnalyserEquationAst::Type::GT:
+        if (mProfile->hasGtOperator()) {
+            generateOperatorCode(mProfile->gtString(), ast, code);
+        } else {
+            generateTwoParameterFunctionCode(mProfile->gtString(), ast, code);
+        }
+
+        break;
+    case AnalyserEquationAst::Type::GEQ:
+        if (mProfile->hasGeqOperator()) {
+            generateOperatorCode(mProfile->geqString(), ast, code);
+        } else {
+            generateTwoParameterFunctionCode(mProfile->geqString(), ast, code);
+        }
+
+        break;
+    case AnalyserEquationAst::Type::AND:
+        if (mProfile->hasAndOperator()) {
+            generateOperatorCode(mProfile->andString(), ast, code);
+        } else {
+            generateTwoParameterFunctionCode(mProfile->andString(), ast, code);
+        }
+
+        break;
+    case AnalyserEquationAst::Type::OR:
+        if (mProfile->hasOrOperator()) {
+            generateOperatorCode(mProfile->orString(), ast, code);
+        } else {
+            generateTwoParameterFunctionCode(mProfile->orString(), ast, code);
+        }
+
+        break;
+    case AnalyserEquationAst::Type::XOR:
+        if (mProfile->hasXorOperator()) {
+            generateOperatorCode(mProfile->xorString(), ast, code);
+        } else {
+            generateTwoParameterFunctionCode(mProfile->xorString(), ast, code);
+        }
+
+        break;
+    case AnalyserEquationAst::Type::NOT:
+        if (mProfile->hasNotOperator()) {
+            code += mProfile->notString();
+
+            generateCode(ast->leftChild(), code);
+        } else {
+            generateOneParameterFunctionCode(mProfile->notString(), ast, code);
+        }
+
+        break;
+    case AnalyserEquationAst::Type::PLUS:
+        if (ast->rightChild() != nullptr) {
+            generateOperatorCode(mProfile->plusString(), ast, code);
+        } else {
+            generateCode(ast->leftChild(), code);
+        }
+
+        break;
+    case AnalyserEquationAst::Type::MINUS:
+        if (ast->rightChild() != nullptr) {
+            generateOperatorCode(mProfile->minusString(), ast, code);
+        } else {
+            generateMinusUnaryCode(ast, code);
+        }
+
+        break;
+    case AnalyserEquationAst::Type::TIMES:
+        generateOperatorCode(mProfile->timesString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::DIVIDE:
+        generateOperatorCode(mProfile->divideString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::POWER: {
+        auto stringValue = generateCode(ast->rightChild());
+        double doubleValue;
+        auto validConversion = convertToDouble(stringValue, doubleValue);
+
+        if (validConversion && areEqual(doubleValue, 0.5)) {
+            generateOneParameterFunctionCode(mProfile->squareRootString(), ast, code);
+        } else if (validConversion && areEqual(doubleValue, 2.0)
+                   && !mProfile->squareString().empty()) {
+            generateOneParameterFunctionCode(mProfile->squareString(), ast, code);
+        } else if (mProfile->hasPowerOperator()) {
+            generateOperatorCode(mProfile->powerString(), ast, code);
+        } else {
+            code += mProfile->powerString();
+            code += "(";
+
+            generateCode(ast->leftChild(), code);
+
+            code += ", ";
+            code += stringValue;
+            code += ")";
+        }
+    } break;
+    case AnalyserEquationAst::Type::ROOT: {
+        auto astRightChild = ast->rightChild();
+
+        if (astRightChild != nullptr) {
+            auto astLeftChild = ast->leftChild();
+            double doubleValue;
+
+            if (convertToDouble(generateCode(astLeftChild), doubleValue)
+                && areEqual(doubleValue, 2.0)) {
+                code += mProfile->squareRootString();
+                code += "(";
+
+                generateCode(astRightChild, code);
+
+                code += ")";
+            } else {
+                if (mProfile->hasPowerOperator()) {
+                    generateOperatorCode(mProfile->powerString(), ast, code);
+                } else {
+                    auto rootValueAst = AnalyserEquationAst::create();
+
+                    rootValueAst->setType(AnalyserEquationAst::Type::DIVIDE);
+                    rootValueAst->setParent(ast);
+
+                    auto leftChild = AnalyserEquationAst::create();
+
+                    leftChild->setType(AnalyserEquationAst::Type::CN);
+                    leftChild->setValue("1.0");
+                    leftChild->setParent(rootValueAst);
+
+                    rootValueAst->setLeftChild(leftChild);
+                    rootValueAst->setRightChild(astLeftChild->leftChild());
+
+                    code += mProfile->powerString();
+                    code += "(";
+
+                    generateCode(astRightChild, code);
+
+                    code += ", ";
+
+                    generateOperatorCode(mProfile->divideString(), rootValueAst, code);
+
+                    code += ")";
+                }
+            }
+        } else {
+            generateOneParameterFunctionCode(mProfile->squareRootString(), ast, code);
+        }
+    } break;
+    case AnalyserEquationAst::Type::ABS:
+        generateOneParameterFunctionCode(mProfile->absoluteValueString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::EXP:
+        generateOneParameterFunctionCode(mProfile->exponentialString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::LN:
+        generateOneParameterFunctionCode(mProfile->naturalLogarithmString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::LOG: {
+        auto astRightChild = ast->rightChild();
+
+        if (astRightChild != nullptr) {
+            auto stringValue = generateCode(ast->leftChild());
+            double doubleValue;
+
+            if (convertToDouble(stringValue, doubleValue)
+                && areEqual(doubleValue, 10.0)) {
+                code += mProfile->commonLogarithmString();
+                code += "(";
+
+                generateCode(astRightChild, code);
+
+                code += ")";
+            } else {
+                code += mProfile->naturalLogarithmString();
+                code += "(";
+
+                generateCode(astRightChild, code);
+
+                code += ")/";
+                code += mProfile->naturalLogarithmString();
+                code += "(";
+                code += stringValue;
+                code += ")";
+            }
+        } else {
+            generateOneParameterFunctionCode(mProfile->commonLogarithmString(), ast, code);
+        }
+    } break;
+    case AnalyserEquationAst::Type::CEILING:
+        generateOneParameterFunctionCode(mProfile->ceilingString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::FLOOR:
+        generateOneParameterFunctionCode(mProfile->floorString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::MIN:
+        generateTwoParameterFunctionCode(mProfile->minString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::MAX:
+        generateTwoParameterFunctionCode(mProfile->maxString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::REM:
+        generateTwoParameterFunctionCode(mProfile->remString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::DIFF:
+        if (mModel != nullptr) {
+            generateCode(ast->rightChild(), code);
+        } else {
+            code += "d";
+
+            generateCode(ast->rightChild(), code);
+
+            code += "/d";
+
+            generateCode(ast->leftChild(), code);
+        }
+
+        break;
+    case AnalyserEquationAst::Type::SIN:
+        generateOneParameterFunctionCode(mProfile->sinString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::COS:
+        generateOneParameterFunctionCode(mProfile->cosString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::TAN:
+        generateOneParameterFunctionCode(mProfile->tanString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::SEC:
+        generateOneParameterFunctionCode(mProfile->secString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::CSC:
+        generateOneParameterFunctionCode(mProfile->cscString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::COT:
+        generateOneParameterFunctionCode(mProfile->cotString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::SINH:
+        generateOneParameterFunctionCode(mProfile->sinhString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::COSH:
+        generateOneParameterFunctionCode(mProfile->coshString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::TANH:
+        generateOneParameterFunctionCode(mProfile->tanhString(), ast, code);
+
+        break;
+    case AnalyserEquationAst::Type::SECH:
+        generateOneParameterFunctionCode(mProfile->sechString(), ast, code);
 
-    if (modelHasOdes()) {
-        updateVariableInfoSizes(componentSize, nameSize, unitsSize, mModel->voi());
+        break;
+    case AnalyserEquationAst::Type::CSCH:
+        generateOneParameterFunctionCode(mProfile->cschString(), ast, code);
 
-        for (const auto &state : mModel->states()) {
-            updateVariableInfoSizes(componentSize, nameSize, unitsSize, state);
-        }
-    }
+        break;
+    case AnalyserEquationAst::Type::COTH:
+        generateOneParameterFunctionCode(mProfile->cothString(), ast, code);
 
-    for (const auto &variable : mModel->variables()) {
-        updateVariableInfoSizes(componentSize, nameSize, unitsSize, variable);
-    }
+        break;
+    case AnalyserEquationAst::Type::ASIN:
+        generateOneParameterFunctionCode(mProfile->asinString(), ast, code);
 
-    return replace(replace(replace(objectString,
-                                   "[COMPONENT_SIZE]", std::to_string(componentSize)),
-                           "[NAME_SIZE]", std::to_string(nameSize)),
-                   "[UNITS_SIZE]", std::to_string(unitsSize));
-}
+        break;
+    case AnalyserEquationAst::Type::ACOS:
+        generateOneParameterFunctionCode(mProfile->acosString(), ast, code);
 
-void Generator::GeneratorImpl::addVariableInfoObjectCode()
-{
-    if (!mProfile->variableInfoObjectString().empty()) {
-        mCode += newLineIfNeeded()
-                 + generateVariableInfoObjectCode(mProfile->variableInfoObjectString());
-    }
-}
+        break;
+    case AnalyserEquationAst::Type::ATAN:
+        generateOneParameterFunctionCode(mProfile->atanString(), ast, code);
 
-std::string Generator::GeneratorImpl::generateVariableInfoEntryCode(const std::string &name,
-                                                                    const std::string &units,
-                                                                    const std::string &component,
-                                                                    const std::string &type) const
-{
-    return replace(replace(replace(replace(mProfile->variableInfoEntryString(),
-                                           "[NAME]", name),
-                                   "[UNITS]", units),
-                           "[COMPONENT]", component),
-                   "[TYPE]", type);
-}
+        break;
+    case AnalyserEquationAst::Type::ASEC:
+        generateOneParameterFunctionCode(mProfile->asecString(), ast, code);
 
-void Generator::GeneratorImpl::addInterfaceVoiStateAndVariableInfoCode()
-{
-    std::string interfaceVoiStateAndVariableInfoCode;
+        break;
+    case AnalyserEquationAst::Type::ACSC:
+        generateOneParameterFunctionCode(mProfile->acscString(), ast, code);
 
-    if (modelHasOdes()
-        && !mProfile->interfaceVoiInfoString().empty()) {
-        interfaceVoiStateAndVariableInfoCode += mProfile->interfaceVoiInfoString();
-    }
+        break;
+    case AnalyserEquationAst::Type::ACOT:
+        generateOneParameterFunctionCode(mProfile->acotString(), ast, code);
 
-    if (modelHasOdes()
-        && !mProfile->interfaceStateInfoString().empty()) {
-        interfaceVoiStateAndVariableInfoCode += mProfile->interfaceStateInfoString();
-    }
+        break;
+    case AnalyserEquationAst::Type::ASINH:
+        generateOneParameterFunctionCode(mProfile->asinhString(), ast, code);
 
-    if (!mProfile->interfaceVariableInfoString().empty()) {
-        interfaceVoiStateAndVariableInfoCode += mProfile->interfaceVariableInfoString();
-    }
+        break;
+    case AnalyserEquationAst::Type::ACOSH:
+        generateOneParameterFunctionCode(mProfile->acoshString(), ast, code);
 
-    if (!interfaceVoiStateAndVariableInfoCode.empty()) {
-        mCode += "\n";
-    }
+        break;
+    case AnalyserEquationAst::Type::ATANH:
+        generateOneParameterFunctionCode(mProfile->atanhString(), ast, code);
 
-    mCode += interfaceVoiStateAndVariableInfoCode;
-}
+        break;
+    case AnalyserEquationAst::Type::ASECH:
+        generateOneParameterFunctionCode(mProfile->asechString(), ast, code);
 
-void Generator::GeneratorImpl::addImplementationVoiInfoCode()
-{
-    if (modelHasOdes()
-        && !mProfile->implementationVoiInfoString().empty()
-        && !mProfile->variableInfoEntryString().empty()
-        && !mProfile->variableOfIntegrationVariableTypeString().empty()) {
-        auto voiVariable = mModel->voi()->variable();
-        auto name = voiVariable->name();
-        auto units = voiVariable->units()->name();
-        auto component = owningComponent(voiVariable)->name();
-        auto type = mProfile->variableOfIntegrationVariableTypeString();
+        break;
+    case AnalyserEquationAst::Type::ACSCH:
+        generateOneParameterFunctionCode(mProfile->acschString(), ast, code);
 
-        mCode += newLineIfNeeded()
-                 + replace(mProfile->implementationVoiInfoString(),
-                           "[CODE]", generateVariableInfoEntryCode(name, units, component, type));
-    }
-}
+        break;
+    case AnalyserEquationAst::Type::ACOTH:
+        generateOneParameterFunctionCode(mProfile->acothString(), ast, code);
 
-void Generator::GeneratorImpl::addImplementationStateInfoCode()
-{
-    if (modelHasOdes()
-        && !mProfile->implementationStateInfoString().empty()
-        && !mProfile->variableInfoEntryString().empty()
-        && !mProfile->stateVariableTypeString().empty()
-        && !mProfile->arrayElementSeparatorString().empty()) {
-        std::string infoElementsCode;
-        auto type = mProfile->stateVariableTypeString();
+        break;
+    case AnalyserEquationAst::Type::PIECEWISE: {
+        auto astRightChild = ast->rightChild();
 
-        for (const auto &state : mModel->states()) {
-            if (!infoElementsCode.empty()) {
-                infoElementsCode += mProfile->arrayElementSeparatorString() + "\n";
-            }
+        generateCode(ast->leftChild(), code);
 
-            auto stateVariable = state->variable();
+        if (astRightChild != nullptr) {
+            auto elseCode = generateCode(astRightChild);
+
+            if (astRightChild->type() == AnalyserEquationAst::Type::PIECE) {
+                generatePiecewiseElseCode(mProfile->nanString(), elseCode);
+            }
 
-            infoElementsCode += mProfile->indentString()
-                                + generateVariableInfoEntryCode(stateVariable->name(),
-                                                                stateVariable->units()->name(),
-                                                                owningComponent(stateVariable)->name(),
-                                                                type);
+            generatePiecewiseElseCode(elseCode, code);
+        } else {
+            generatePiecewiseElseCode(mProfile->nanString(), code);
         }
+    } break;
+    case AnalyserEquationAst::Type::PIECE:
+        generatePiecewiseIfCode(generateCode(ast->rightChild()), generateCode(ast->leftChild()), code);
 
-        infoElementsCode += "\n";
+        break;
+    case AnalyserEquationAst::Type::OTHERWISE:
+        generateCode(ast->leftChild(), code);
 
-        mCode += newLineIfNeeded()
-                 + replace(mProfile->implementationStateInfoString(),
-                           "[CODE]", infoElementsCode);
-    }
-}
+        break;
+    case AnalyserEquationAst::Type::CI: {
+        // A CI AST with no variable is one that we created for a sensitivity,
+        // in which case its value is the code to use.
 
-void Generator::GeneratorImpl::addImplementationVariableInfoCode()
-{
-    if (!mProfile->implementationVariableInfoString().empty()
-        && !mProfile->variableInfoEntryString().empty()
-        && !mProfile->arrayElementSeparatorString().empty()
-        && !mProfile->variableOfIntegrationVariableTypeString().empty()
-        && !mProfile->stateVariableTypeString().empty()
-        && !mProfile->constantVariableTypeString().empty()
-        && !mProfile->computedConstantVariableTypeString().empty()
-        && !mProfile->algebraicVariableTypeString().empty()
-        && !mProfile->externalVariableTypeString().empty()) {
-        std::string infoElementsCode;
+        if (ast->variable() == nullptr) {
+            code += ast->value();
 
-        for (const auto &variable : mModel->variables()) {
-            if (!infoElementsCode.empty()) {
-                infoElementsCode += mProfile->arrayElementSeparatorString() + "\n";
-            }
+            break;
+        }
 
-            std::string variableType;
+        // Use the value of a specialised constant, unless it is the constant
+        // that we are computing.
 
-            switch (variable->type()) {
-            case AnalyserVariable::Type::CONSTANT:
-                variableType = mProfile->constantVariableTypeString();
+        if (!mSpecialisedConstantValues.empty()
+            && ((ast->parent()->type() != AnalyserEquationAst::Type::EQUALITY)
+                || (ast->parent()->leftChild() != ast))) {
+            auto specialisedConstant = mSpecialisedConstantValues.find(analyserVariable(ast->variable()).get());
 
-                break;
-            case AnalyserVariable::Type::COMPUTED_CONSTANT:
-                variableType = mProfile->computedConstantVariableTypeString();
+            if (specialisedConstant != mSpecialisedConstantValues.end()) {
+                code += generateSpecialisedConstantCode(specialisedConstant->second);
 
                 break;
-            case AnalyserVariable::Type::ALGEBRAIC:
-                variableType = mProfile->algebraicVariableTypeString();
+            }
+        }
 
-                break;
-            default: // AnalyserVariable::Type::EXTERNAL.
-                variableType = mProfile->externalVariableTypeString();
+        code += generateVariableNameCode(ast->variable(), ast->parent()->type() != AnalyserEquationAst::Type::DIFF);
+    } break;
+    case AnalyserEquationAst::Type::CN:
+        code += generateDoubleCode(ast->value());
 
-                break;
-            }
+        break;
+    case AnalyserEquationAst::Type::DEGREE:
+    case AnalyserEquationAst::Type::LOGBASE:
+        generateCode(ast->leftChild(), code);
 
-            auto variableVariable = variable->variable();
+        break;
+    case AnalyserEquationAst::Type::BVAR:
+        generateCode(ast->leftChild(), code);
 
-            infoElementsCode += mProfile->indentString()
-                                + replace(replace(replace(replace(mProfile->variableInfoEntryString(),
-                                                                  "[NAME]", variableVariable->name()),
-                                                          "[UNITS]", variableVariable->units()->name()),
-                                                  "[COMPONENT]", owningComponent(variableVariable)->name()),
-                                          "[TYPE]", variableType);
-        }
+        break;
+    case AnalyserEquationAst::Type::TRUE:
+        code += mProfile->trueString();
 
-        if (!infoElementsCode.empty()) {
-            infoElementsCode += "\n";
-        }
+        break;
+    case AnalyserEquationAst::Type::FALSE:
+        code += mProfile->falseString();
 
-        mCode += newLineIfNeeded()
-                 + replace(mProfile->implementationVariableInfoString(),
-                           "[CODE]", infoElementsCode);
-    }
-}
+        break;
+    case AnalyserEquationAst::Type::E:
+        code += mProfile->eString();
 
-void Generator::GeneratorImpl::addArithmeticFunctionsCode()
-{
-    if (mModel->needEqFunction() && !mProfile->hasEqOperator()
-        && !mProfile->eqFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->eqFunctionString();
-    }
+        break;
+    case AnalyserEquationAst::Type::PI:
+        code += mProfile->piString();
 
-    if (mModel->needNeqFunction() && !mProfile->hasNeqOperator()
-        && !mProfile->neqFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->neqFunctionString();
-    }
+        break;
+    case AnalyserEquationAst::Type::INF:
+        code += mProfile->infString();
 
-    if (mModel->needLtFunction() && !mProfile->hasLtOperator()
-        && !mProfile->ltFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->ltFunctionString();
-    }
+        break;
+    default: // AnalyserEquationAst::Type::NAN.
+        code += mProfile->nanString();
 
-    if (mModel->needLeqFunction() && !mProfile->hasLeqOperator()
-        && !mProfile->leqFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->leqFunctionString();
+        break;
     }
+}
 
-    if (mModel->needGtFunction() && !mProfile->hasGtOperator()
-        && !mProfile->gtFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->gtFunctionString();
-    }
+bool Generator::GeneratorImpl::isToBeComputedAgain(const AnalyserEquationPtr &equation) const
+{
+    // NLA and algebraic equations that are state/rate-based and external
+    // equations are to be computed again (in the computeVariables() method).
 
-    if (mModel->needGeqFunction() && !mProfile->hasGeqOperator()
-        && !mProfile->geqFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->geqFunctionString();
+    switch (equation->type()) {
+    case AnalyserEquation::Type::NLA:
+    case AnalyserEquation::Type::ALGEBRAIC:
+        return equation->isStateRateBased();
+    case AnalyserEquation::Type::EXTERNAL:
+        return true;
+    default:
+        return false;
     }
+}
 
-    if (mModel->needAndFunction() && !mProfile->hasAndOperator()
-        && !mProfile->andFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->andFunctionString();
+bool Generator::GeneratorImpl::isSomeConstant(const AnalyserEquationPtr &equation) const
+{
+    switch (equation->type()) {
+    case AnalyserEquation::Type::TRUE_CONSTANT:
+    case AnalyserEquation::Type::VARIABLE_BASED_CONSTANT:
+        return true;
+    default:
+        return false;
     }
+}
 
-    if (mModel->needOrFunction() && !mProfile->hasOrOperator()
-        && !mProfile->orFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->orFunctionString();
-    }
+void Generator::GeneratorImpl::generateLookupTableValueCallCode(size_t tableIndex,
+                                                               size_t column,
+                                                               std::string &code) const
+{
+    auto &usedLookupTable = mUsedLookupTables[tableIndex];
+    auto index = convertToString(tableIndex);
+    auto columnCount = convertToString(usedLookupTable.mEquations.size());
+    auto columnValue = convertToString(column);
+    auto state = generateVariableNameCode(usedLookupTable.mState->variable());
+    auto minimum = generateDoubleCode(convertToString(usedLookupTable.mMinimum));
+    auto step = generateDoubleCode(convertToString(usedLookupTable.mStep));
+    auto size = convertToString(usedLookupTable.mSize);
+
+    appendProfileTemplate(code, *mLookupTableValueCallTemplate,
+                          {&index, &columnCount, &columnValue, &state, &minimum, &step, &size});
+}
 
-    if (mModel->needXorFunction() && !mProfile->hasXorOperator()
-        && !mProfile->xorFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->xorFunctionString();
-    }
+std::string Generator::GeneratorImpl::generateZeroInitialisationCode(const AnalyserVariablePtr &variable) const
+{
+    return mProfile->indentString()
+           + generateVariableNameCode(variable->variable(), false)
+           + mProfile->equalityString()
+           + generateDoubleCode("0.0")
+           + mProfile->commandSeparatorString() + "\n";
+}
 
-    if (mModel->needNotFunction() && !mProfile->hasNotOperator()
-        && !mProfile->notFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->notFunctionString();
-    }
+std::string Generator::GeneratorImpl::generateInitialisationCode(const AnalyserVariablePtr &variable) const
+{
+    // Initialise a specialised constant using its value, which accounts for
+    // both its constant override, if any, and its scaling factor.
 
-    if (mModel->needMinFunction()
-        && !mProfile->minFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->minFunctionString();
+    auto specialisedConstant = mSpecialisedConstantValues.find(variable.get());
+
+    if (specialisedConstant != mSpecialisedConstantValues.end()) {
+        return mProfile->indentString()
+               + generateVariableNameCode(variable->variable())
+               + mProfile->equalityString()
+               + generateSpecialisedConstantCode(specialisedConstant->second, false)
+               + mProfile->commandSeparatorString() + "\n";
     }
 
-    if (mModel->needMaxFunction()
-        && !mProfile->maxFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->maxFunctionString();
+    auto initialisingVariable = variable->initialisingVariable();
+    auto scalingFactor = Generator::GeneratorImpl::scalingFactor(initialisingVariable);
+    std::string scalingFactorCode;
+
+    if (!areNearlyEqual(scalingFactor, 1.0)) {
+        scalingFactorCode = generateDoubleCode(convertToString(1.0 / scalingFactor)) + mProfile->timesString();
     }
+
+    return mProfile->indentString()
+           + generateVariableNameCode(variable->variable())
+           + mProfile->equalityString()
+           + scalingFactorCode + generateDoubleOrConstantVariableNameCode(initialisingVariable)
+           + mProfile->commandSeparatorString() + "\n";
 }
 
-void Generator::GeneratorImpl::addTrigonometricFunctionsCode()
+void Generator::GeneratorImpl::generateEquationCode(size_t equationIndex,
+                                                    std::vector<bool> &remainingEquations,
+                                                    const std::vector<bool> *equationsForComputeVariables,
+                                                    std::string &code)
 {
-    if (mModel->needSecFunction()
-        && !mProfile->secFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->secFunctionString();
-    }
+    if (remainingEquations[equationIndex]) {
+        auto &equations = modelEquations();
+        auto &equation = equations[equationIndex];
 
-    if (mModel->needCscFunction()
-        && !mProfile->cscFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->cscFunctionString();
-    }
+        // Stop tracking the equation and its NLA siblings, if any.
+        // Note: we need to do this as soon as possible to avoid recursive
+        //       calls, something that would happen if we were to do this at the
+        //       end of this if statement.
 
-    if (mModel->needCotFunction()
-        && !mProfile->cotFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->cotFunctionString();
-    }
+        remainingEquations[equationIndex] = false;
 
-    if (mModel->needSechFunction()
-        && !mProfile->sechFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->sechFunctionString();
-    }
+        for (auto nlaSibling : mEquationNlaSiblings[equationIndex]) {
+            remainingEquations[nlaSibling] = false;
+        }
 
-    if (mModel->needCschFunction()
-        && !mProfile->cschFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->cschFunctionString();
-    }
+        // Generate any dependency that this equation may have.
+        // Note: this accounts for the special case of the computeVariables()
+        //       method.
 
-    if (mModel->needCothFunction()
-        && !mProfile->cothFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->cothFunctionString();
-    }
+        if (!isSomeConstant(equation)) {
+            for (auto dependencyIndex : mEquationDependencies[equationIndex]) {
+                auto &dependency = equations[dependencyIndex];
 
-    if (mModel->needAsecFunction()
-        && !mProfile->asecFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->asecFunctionString();
-    }
+                if ((dependency->type() != AnalyserEquation::Type::ODE)
+                    && !isSomeConstant(dependency)
+                    && ((equationsForComputeVariables == nullptr)
+                        || isToBeComputedAgain(dependency)
+                        || (*equationsForComputeVariables)[dependencyIndex])) {
+                    generateEquationCode(dependencyIndex, remainingEquations, equationsForComputeVariables, code);
+                }
+            }
+        }
 
-    if (mModel->needAcscFunction()
-        && !mProfile->acscFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->acscFunctionString();
-    }
+        // Keep track of where the equation code starts and of whether it could
+        // be moved to a chunk method, if needed.
 
-    if (mModel->needAcotFunction()
-        && !mProfile->acotFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->acotFunctionString();
-    }
+        if (mEquationStatements != nullptr) {
+            mEquationStatements->emplace_back(code.size(), isChunkableEquation(equation));
+        }
 
-    if (mModel->needAsechFunction()
-        && !mProfile->asechFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->asechFunctionString();
-    }
+        // Generate the equation code itself, based on the equation type.
 
-    if (mModel->needAcschFunction()
-        && !mProfile->acschFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->acschFunctionString();
-    }
+        switch (equation->type()) {
+        case AnalyserEquation::Type::EXTERNAL:
+            for (const auto &variable : equation->variables()) {
+                auto index = convertToString(variable->index());
 
-    if (mModel->needAcothFunction()
-        && !mProfile->acothFunctionString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->acothFunctionString();
-    }
-}
+                code += mProfile->indentString();
+                code += generateVariableNameCode(variable->variable());
+                code += mProfile->equalityString();
 
-void Generator::GeneratorImpl::addInterfaceCreateDeleteArrayMethodsCode()
-{
-    std::string interfaceCreateDeleteArraysCode;
+                appendProfileTemplate(code, *mExternalVariableMethodCallTemplate, {&index});
 
-    if (modelHasOdes()
-        && !mProfile->interfaceCreateStatesArrayMethodString().empty()) {
-        interfaceCreateDeleteArraysCode += mProfile->interfaceCreateStatesArrayMethodString();
-    }
+                code += mProfile->commandSeparatorString();
+                code += "\n";
+            }
 
-    if (!mProfile->interfaceCreateVariablesArrayMethodString().empty()) {
-        interfaceCreateDeleteArraysCode += mProfile->interfaceCreateVariablesArrayMethodString();
-    }
+            break;
+        case AnalyserEquation::Type::NLA:
+            if (!mProfile->findRootCallString(modelHasOdes()).empty()) {
+                auto index = convertToString(equation->nlaSystemIndex());
 
-    if (!mProfile->interfaceDeleteArrayMethodString().empty()) {
-        interfaceCreateDeleteArraysCode += mProfile->interfaceDeleteArrayMethodString();
-    }
+                code += mProfile->indentString();
 
-    if (!interfaceCreateDeleteArraysCode.empty()) {
-        mCode += "\n";
-    }
+                appendProfileTemplate(code, *mFindRootCallTemplate, {&index});
+            }
 
-    mCode += interfaceCreateDeleteArraysCode;
-}
+            break;
+        default: {
+            // Use a lookup table to compute the equation, if possible.
 
-void Generator::GeneratorImpl::addExternalVariableMethodTypeDefinitionCode()
-{
-    if (mModel->hasExternalVariables()) {
-        auto externalVariableMethodTypeDefinitionString = mProfile->externalVariableMethodTypeDefinitionString(modelHasOdes());
+            auto lookupTableEquation = mLookupTableEquations.find(equation);
 
-        if (!externalVariableMethodTypeDefinitionString.empty()) {
-            mCode += "\n"
-                     + externalVariableMethodTypeDefinitionString;
+            code += mProfile->indentString();
+
+            // Declare the local variable computed by the equation, if needed.
+
+            if (mLocalVariablesInUse && mLocalEquations[equationIndex]) {
+                code += mProfile->localVariableDeclarationString();
+            }
+
+            if (lookupTableEquation != mLookupTableEquations.end()) {
+                generateCode(equation->ast()->leftChild(), code);
+
+                code += mProfile->equalityString();
+
+                generateLookupTableValueCallCode(lookupTableEquation->second.first, lookupTableEquation->second.second, code);
+            } else if (isSomeConstant(equation)
+                       && (mSpecialisedConstantValues.find(equation->variable(0).get()) != mSpecialisedConstantValues.end())) {
+                // The equation computes a specialised constant, so just assign
+                // its value.
+
+                generateCode(equation->ast()->leftChild(), code);
+
+                code += mProfile->equalityString();
+                code += generateSpecialisedConstantCode(mSpecialisedConstantValues.find(equation->variable(0).get())->second, false);
+            } else {
+                generateCode(equation->ast(), code);
+            }
+
+            code += mProfile->commandSeparatorString();
+            code += "\n";
+
+            break;
+        }
         }
     }
 }
 
-void Generator::GeneratorImpl::addImplementationCreateStatesArrayMethodCode()
+void Generator::GeneratorImpl::generateEquationCode(size_t equationIndex,
+                                                    std::vector<bool> &remainingEquations,
+                                                    std::string &code)
 {
-    if (modelHasOdes()
-        && !mProfile->implementationCreateStatesArrayMethodString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->implementationCreateStatesArrayMethodString();
-    }
+    generateEquationCode(equationIndex, remainingEquations, nullptr, code);
 }
 
-void Generator::GeneratorImpl::addImplementationCreateVariablesArrayMethodCode()
+bool Generator::GeneratorImpl::isChunkableEquation(const AnalyserEquationPtr &equation) const
 {
-    if (!mProfile->implementationCreateVariablesArrayMethodString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->implementationCreateVariablesArrayMethodString();
-    }
-}
+    // An equation can be computed in a chunk method, i.e. possibly in another
+    // chunk of the implementation code, unless its code relies on something
+    // that is only available in the implementation code itself, i.e. a root
+    // finding method, a lookup table, or an arithmetic/trigonometric function.
 
-void Generator::GeneratorImpl::addImplementationDeleteArrayMethodCode()
-{
-    if (!mProfile->implementationDeleteArrayMethodString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->implementationDeleteArrayMethodString();
+    if ((equation->type() == AnalyserEquation::Type::NLA)
+        || (mLookupTableEquations.find(equation) != mLookupTableEquations.end())) {
+        return false;
     }
-}
 
-void Generator::GeneratorImpl::addRootFindingInfoObjectCode()
-{
-    if (modelHasNlas()
-        && !mProfile->rootFindingInfoObjectString(modelHasOdes()).empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->rootFindingInfoObjectString(modelHasOdes());
+    std::vector<AnalyserEquationAst::Type> functionTypes = {
+        AnalyserEquationAst::Type::MIN,
+        AnalyserEquationAst::Type::MAX,
+        AnalyserEquationAst::Type::SEC,
+        AnalyserEquationAst::Type::CSC,
+        AnalyserEquationAst::Type::COT,
+        AnalyserEquationAst::Type::SECH,
+        AnalyserEquationAst::Type::CSCH,
+        AnalyserEquationAst::Type::COTH,
+        AnalyserEquationAst::Type::ASEC,
+        AnalyserEquationAst::Type::ACSC,
+        AnalyserEquationAst::Type::ACOT,
+        AnalyserEquationAst::Type::ASECH,
+        AnalyserEquationAst::Type::ACSCH,
+        AnalyserEquationAst::Type::ACOTH,
+    };
+    std::vector<std::pair<AnalyserEquationAst::Type, bool>> operatorTypes = {
+        {AnalyserEquationAst::Type::EQ, mProfile->hasEqOperator()},
+        {AnalyserEquationAst::Type::NEQ, mProfile->hasNeqOperator()},
+        {AnalyserEquationAst::Type::LT, mProfile->hasLtOperator()},
+        {AnalyserEquationAst::Type::LEQ, mProfile->hasLeqOperator()},
+        {AnalyserEquationAst::Type::GT, mProfile->hasGtOperator()},
+        {AnalyserEquationAst::Type::GEQ, mProfile->hasGeqOperator()},
+        {AnalyserEquationAst::Type::AND, mProfile->hasAndOperator()},
+        {AnalyserEquationAst::Type::OR, mProfile->hasOrOperator()},
+        {AnalyserEquationAst::Type::XOR, mProfile->hasXorOperator()},
+        {AnalyserEquationAst::Type::NOT, mProfile->hasNotOperator()},
+    };
+
+    for (const auto &operatorType : operatorTypes) {
+        if (!operatorType.second) {
+            functionTypes.push_back(operatorType.first);
+        }
     }
-}
 
-void Generator::GeneratorImpl::addExternNlaSolveMethodCode()
-{
-    if (modelHasNlas()
-        && !mProfile->externNlaSolveMethodString().empty()) {
-        mCode += newLineIfNeeded()
-                 + mProfile->externNlaSolveMethodString();
-    }
+    return !hasAstOfType(equation->ast(), functionTypes);
 }
 
-void Generator::GeneratorImpl::addNlaSystemsCode()
+std::string Generator::GeneratorImpl::generateChunkedMethodBodyCode(const std::string &methodString,
+                                                                   const std::string &interfaceMethodString,
+                                                                   const std::string &methodBody,
+                                                                   const std::vector<std::pair<size_t, bool>> &equationStatements)
 {
-    if (modelHasNlas()
-        && !mProfile->objectiveFunctionMethodString(modelHasOdes()).empty()
-        && !mProfile->findRootMethodString(modelHasOdes()).empty()
-        && !mProfile->nlaSolveCallString(modelHasOdes()).empty()) {
-        std::vector<AnalyserEquationPtr> handledNlaEquations;
-
-        for (const auto &equation : mModel->equations()) {
-            if ((equation->type() == AnalyserEquation::Type::NLA)
-                && (std::find(handledNlaEquations.begin(), handledNlaEquations.end(), equation) == handledNlaEquations.end())) {
-                std::string methodBody;
-                auto i = MAX_SIZE_T;
-                auto variables = equation->variables();
-                auto variablesSize = variables.size();
-
-                for (i = 0; i < variablesSize; ++i) {
-                    auto arrayString = (variables[i]->type() == AnalyserVariable::Type::STATE) ?
-                                           mProfile->ratesArrayString() :
-                                           mProfile->variablesArrayString();
-
-                    methodBody += mProfile->indentString()
-                                  + arrayString + mProfile->openArrayString() + convertToString(variables[i]->index()) + mProfile->closeArrayString()
-                                  + mProfile->equalityString()
-                                  + mProfile->uArrayString() + mProfile->openArrayString() + convertToString(i) + mProfile->closeArrayString()
-                                  + mProfile->commandSeparatorString() + "\n";
-                }
-
-                methodBody += newLineIfNeeded();
-
-                i = MAX_SIZE_T;
+    // Partition the given method body into chunk methods, i.e. runs of
+    // consecutive chunkable equation statements that belong to the same chunk
+    // of the implementation code. The N chunkable equation statements of the
+    // method body are evenly spread over our chunks, based on their rank, and
+    // the method body calls our chunk methods in the order of those equation
+    // statements, thus preserving the equation dependency order.
+
+    auto chunkableEquationStatementCount = static_cast<size_t>(std::count_if(equationStatements.begin(), equationStatements.end(), [](const std::pair<size_t, bool> &equationStatement) {
+        return equationStatement.second;
+    }));
+    auto openingParenthesis = methodString.find('(');
+    auto closingParenthesis = methodString.find(')', openingParenthesis);
+
+    if ((mImplementationChunkCount == 0)
+        || (chunkableEquationStatementCount == 0)
+        || mProfile->chunkMethodNameString().empty()
+        || (openingParenthesis == std::string::npos)
+        || (closingParenthesis == std::string::npos)) {
+        return methodBody;
+    }
 
-                methodBody += mProfile->indentString()
-                              + mProfile->fArrayString() + mProfile->openArrayString() + convertToString(++i) + mProfile->closeArrayString()
-                              + mProfile->equalityString()
-                              + generateCode(equation->ast())
-                              + mProfile->commandSeparatorString() + "\n";
+    // Retrieve the name of the method and the name of its parameters, which
+    // are also the arguments of our chunk methods.
 
-                handledNlaEquations.push_back(equation);
+    auto isIdentifierCharacter = [](char character) {
+        return (std::isalnum(static_cast<unsigned char>(character)) != 0) || (character == '_');
+    };
+    auto nameStart = openingParenthesis;
 
-                for (const auto &nlaSibling : equation->nlaSiblings()) {
-                    methodBody += mProfile->indentString()
-                                  + mProfile->fArrayString() + mProfile->openArrayString() + convertToString(++i) + mProfile->closeArrayString()
-                                  + mProfile->equalityString()
-                                  + generateCode(nlaSibling->ast())
-                                  + mProfile->commandSeparatorString() + "\n";
+    while ((nameStart > 0) && isIdentifierCharacter(methodString[nameStart - 1])) {
+        --nameStart;
+    }
 
-                    handledNlaEquations.push_back(nlaSibling);
-                }
+    auto name = methodString.substr(nameStart, openingParenthesis - nameStart);
+    auto parameters = methodString.substr(openingParenthesis + 1, closingParenthesis - openingParenthesis - 1);
+    std::string arguments;
+    size_t parameterStart = 0;
 
-                mCode += newLineIfNeeded()
-                         + replace(replace(mProfile->objectiveFunctionMethodString(modelHasOdes()),
-                                           "[INDEX]", convertToString(equation->nlaSystemIndex())),
-                                   "[CODE]", generateMethodBodyCode(methodBody));
+    while (parameterStart <= parameters.size()) {
+        auto parameterEnd = std::min(parameters.find(',', parameterStart), parameters.size());
+        auto argumentEnd = parameterEnd;
 
-                methodBody = {};
+        while ((argumentEnd > parameterStart) && !isIdentifierCharacter(parameters[argumentEnd - 1])) {
+            --argumentEnd;
+        }
 
-                for (i = 0; i < variablesSize; ++i) {
-                    auto arrayString = (variables[i]->type() == AnalyserVariable::Type::STATE) ?
-                                           mProfile->ratesArrayString() :
-                                           mProfile->variablesArrayString();
+        auto argumentStart = argumentEnd;
 
-                    methodBody += mProfile->indentString()
-                                  + mProfile->uArrayString() + mProfile->openArrayString() + convertToString(i) + mProfile->closeArrayString()
-                                  + mProfile->equalityString()
-                                  + arrayString + mProfile->openArrayString() + convertToString(variables[i]->index()) + mProfile->closeArrayString()
-                                  + mProfile->commandSeparatorString() + "\n";
-                }
+        while ((argumentStart > parameterStart) && isIdentifierCharacter(parameters[argumentStart - 1])) {
+            --argumentStart;
+        }
 
-                methodBody += newLineIfNeeded()
-                              + mProfile->indentString()
-                              + replace(replace(mProfile->nlaSolveCallString(modelHasOdes()),
-                                                "[INDEX]", convertToString(equation->nlaSystemIndex())),
-                                        "[SIZE]", convertToString(equation->variableCount()));
+        if (argumentStart != argumentEnd) {
+            arguments += (arguments.empty() ? "" : ", ") + parameters.substr(argumentStart, argumentEnd - argumentStart);
+        }
 
-                methodBody += newLineIfNeeded();
+        parameterStart = parameterEnd + 1;
+    }
 
-                for (i = 0; i < variablesSize; ++i) {
-                    auto arrayString = (variables[i]->type() == AnalyserVariable::Type::STATE) ?
-                                           mProfile->ratesArrayString() :
-                                           mProfile->variablesArrayString();
+    // Generate our chunk methods and the code that calls them.
+    // Note: if our profile doesn't require an interface to be generated, then
+    //       our chunk methods are added to the implementation code itself,
+    //       before the method which calls them. Otherwise, they are declared
+    //       there and defined in their chunk of the implementation code.
+
+    std::string chunkedMethodBody;
+    std::string chunkMethodsCode;
+    std::string chunkMethodBody;
+    size_t chunkMethodCount = 0;
+    size_t chunk = 0;
+    size_t chunkableEquationStatementIndex = 0;
+
+    auto addChunkMethod = [&]() {
+        if (chunkMethodBody.empty()) {
+            return;
+        }
 
-                    methodBody += mProfile->indentString()
-                                  + arrayString + mProfile->openArrayString() + convertToString(variables[i]->index()) + mProfile->closeArrayString()
-                                  + mProfile->equalityString()
-                                  + mProfile->uArrayString() + mProfile->openArrayString() + convertToString(i) + mProfile->closeArrayString()
-                                  + mProfile->commandSeparatorString() + "\n";
-                }
+        auto chunkMethodName = replace(replace(mProfile->chunkMethodNameString(),
+                                               "[NAME]", name),
+                                       "[INDEX]", convertToString(chunkMethodCount++));
+        auto chunkMethodCode = replace(replace(methodString, name + "(", chunkMethodName + "("),
+                                       "[CODE]", chunkMethodBody);
 
-                mCode += newLineIfNeeded()
-                         + replace(replace(replace(mProfile->findRootMethodString(modelHasOdes()),
-                                                   "[INDEX]", convertToString(equation->nlaSystemIndex())),
-                                           "[SIZE]", convertToString(variablesSize)),
-                                   "[CODE]", generateMethodBodyCode(methodBody));
+        if (mProfile->hasInterface()) {
+            mImplementationChunks[chunk].push_back(chunkMethodCode);
+
+            if (!interfaceMethodString.empty()) {
+                chunkMethodsCode += replace(interfaceMethodString, name + "(", chunkMethodName + "(");
             }
+        } else {
+            chunkMethodsCode += (chunkMethodsCode.empty() ? "" : "\n") + chunkMethodCode;
         }
+
+        chunkedMethodBody += mProfile->indentString()
+                             + chunkMethodName + "(" + arguments + ")"
+                             + mProfile->commandSeparatorString() + "\n";
+        chunkMethodBody = {};
+    };
+
+    if (!equationStatements.empty()) {
+        chunkedMethodBody = methodBody.substr(0, equationStatements.front().first);
     }
-}
 
-std::string Generator::GeneratorImpl::generateMethodBodyCode(const std::string &methodBody) const
-{
-    return methodBody.empty() ?
-               mProfile->emptyMethodString().empty() ?
-               "" :
-               mProfile->indentString() + mProfile->emptyMethodString() :
-               methodBody;
-}
+    for (size_t i = 0; i < equationStatements.size(); ++i) {
+        auto equationStatementStart = equationStatements[i].first;
+        auto equationStatementEnd = (i + 1 < equationStatements.size()) ?
+                                        equationStatements[i + 1].first :
+                                        methodBody.size();
+        auto equationStatement = methodBody.substr(equationStatementStart, equationStatementEnd - equationStatementStart);
 
-std::string Generator::GeneratorImpl::generateDoubleCode(const std::string &value) const
-{
-    if (value.find('.') != std::string::npos) {
-        return value;
+        if (equationStatements[i].second) {
+            auto equationStatementChunk = chunkableEquationStatementIndex++ * mImplementationChunkCount / chunkableEquationStatementCount;
+
+            if (equationStatementChunk != chunk) {
+                addChunkMethod();
+
+                chunk = equationStatementChunk;
+            }
+
+            chunkMethodBody += equationStatement;
+        } else {
+            addChunkMethod();
+
+            chunkedMethodBody += equationStatement;
+        }
     }
 
-    auto ePos = value.find('e');
+    addChunkMethod();
 
-    if (ePos == std::string::npos) {
-        return value + ".0";
+    if (!chunkMethodsCode.empty()) {
+        mCode += newLineIfNeeded() + chunkMethodsCode;
     }
 
-    return value.substr(0, ePos) + ".0" + value.substr(ePos);
+    return chunkedMethodBody;
 }
 
-std::string Generator::GeneratorImpl::generateDoubleOrConstantVariableNameCode(const VariablePtr &variable) const
+void Generator::GeneratorImpl::addInterfaceComputeModelMethodsCode()
 {
-    if (isCellMLReal(variable->initialValue())) {
-        return generateDoubleCode(variable->initialValue());
+    auto interfaceInitialiseVariablesMethodString = mProfile->interfaceInitialiseVariablesMethodString(modelHasOdes(),
+                                                                                                       mModel->hasExternalVariables());
+    std::string interfaceComputeModelMethodsCode;
+
+    if (!interfaceInitialiseVariablesMethodString.empty()) {
+        interfaceComputeModelMethodsCode += interfaceInitialiseVariablesMethodString;
     }
 
-    auto initValueVariable = owningComponent(variable)->variable(variable->initialValue());
-    auto analyserInitialValueVariable = analyserVariable(initValueVariable);
+    if (!mProfile->interfaceComputeComputedConstantsMethodString().empty()) {
+        interfaceComputeModelMethodsCode += mProfile->interfaceComputeComputedConstantsMethodString();
+    }
 
-    return mProfile->variablesArrayString() + mProfile->openArrayString() + convertToString(analyserInitialValueVariable->index()) + mProfile->closeArrayString();
-}
+    if (!mUsedLookupTables.empty()
+        && !mProfile->interfaceInitialiseLookupTablesMethodString().empty()) {
+        interfaceComputeModelMethodsCode += mProfile->interfaceInitialiseLookupTablesMethodString();
+    }
 
-std::string Generator::GeneratorImpl::generateVariableNameCode(const VariablePtr &variable,
-                                                               bool state) const
-{
-    // Generate some code for a variable name, but only if we have a model. If
-    // we don't have a model, it means that we are using the generator from the
-    // analyser, in which case we just want to return the original name of the
-    // variable.
+    auto interfaceComputeRatesMethodString = mProfile->interfaceComputeRatesMethodString(mModel->hasExternalVariables());
 
-    if (mModel == nullptr) {
-        return variable->name();
+    if (modelHasOdes()
+        && !interfaceComputeRatesMethodString.empty()) {
+        interfaceComputeModelMethodsCode += interfaceComputeRatesMethodString;
     }
 
-    auto analyserVariable = Generator::GeneratorImpl::analyserVariable(variable);
-
-    if (analyserVariable->type() == AnalyserVariable::Type::VARIABLE_OF_INTEGRATION) {
-        return mProfile->voiString();
+    if (modelHasOdes()
+        && mProfile->hasComputeRushLarsenCoefficientsMethod()
+        && !mProfile->interfaceComputeRushLarsenCoefficientsMethodString().empty()) {
+        interfaceComputeModelMethodsCode += mProfile->interfaceComputeRushLarsenCoefficientsMethodString();
     }
 
-    std::string arrayName;
+    auto interfaceComputeVariablesMethodString = mProfile->interfaceComputeVariablesMethodString(modelHasOdes(),
+                                                                                                 mModel->hasExternalVariables());
 
-    if (analyserVariable->type() == AnalyserVariable::Type::STATE) {
-        arrayName = state ?
-                        mProfile->statesArrayString() :
-                        mProfile->ratesArrayString();
-    } else {
-        arrayName = mProfile->variablesArrayString();
+    if (!interfaceComputeVariablesMethodString.empty()) {
+        interfaceComputeModelMethodsCode += interfaceComputeVariablesMethodString;
     }
 
-    return arrayName + mProfile->openArrayString() + convertToString(analyserVariable->index()) + mProfile->closeArrayString();
+    if (!interfaceComputeModelMethodsCode.empty()) {
+        mCode += "\n";
+    }
+
+    mCode += interfaceComputeModelMethodsCode;
 }
 
-std::string Generator::GeneratorImpl::generateOperatorCode(const std::string &op,
-                                                           const AnalyserEquationAstPtr &ast) const
+void Generator::GeneratorImpl::addImplementationInitialiseVariablesMethodCode(std::vector<bool> &remainingEquations)
 {
-    // Generate the code for the left and right branches of the given AST.
+    auto implementationInitialiseVariablesMethodString = mProfile->implementationInitialiseVariablesMethodString(modelHasOdes(),
+                                                                                                                 mModel->hasExternalVariables());
 
-    std::string res;
-    auto astLeftChild = ast->leftChild();
-    auto astRightChild = ast->rightChild();
-    auto astLeftChildCode = generateCode(astLeftChild);
-    auto astRightChildCode = generateCode(astRightChild);
+    if (!implementationInitialiseVariablesMethodString.empty()) {
+        // Initialise our constants and our algebraic variables that have an
+        // initial value. Also use an initial guess of zero for computed
+        // constants and algebraic variables computed using an NLA system.
+        // Note: a variable which is the only unknown in an equation, but which
+        //       is not on its own on either the LHS or RHS of that equation
+        //       (e.g., x = y+z with x and y known and z unknown) is (currently)
+        //       to be computed using an NLA system for which we need an initial
+        //       guess. We use an initial guess of zero, which is fine since
+        //       such an NLA system has only one solution.
 
-    // Determine whether parentheses should be added around the left and/or
-    // right piece of code, and this based on the precedence of the operators
-    // used in CellML, which are listed below from higher to lower precedence:
-    //  1. Parentheses                                           [Left to right]
-    //  2. POWER (as an operator, not as a function, i.e.        [Left to right]
-    //            as in Matlab and not in C, for example)
-    //  3. Unary PLUS, Unary MINUS, NOT                          [Right to left]
-    //  4. TIMES, DIVIDE                                         [Left to right]
-    //  5. PLUS, MINUS                                           [Left to right]
-    //  6. LT, LEQ, GT, GEQ                                      [Left to right]
-    //  7. EQ, NEQ                                               [Left to right]
-    //  8. XOR (bitwise)                                         [Left to right]
-    //  9. AND (logical)                                         [Left to right]
-    // 10. OR (logical)                                          [Left to right]
-    // 11. PIECEWISE (as an operator)                            [Right to left]
+        std::string methodBody;
 
-    if (isPlusOperator(ast)) {
-        if (isRelationalOperator(astLeftChild)
-            || isLogicalOperator(astLeftChild)
-            || isPiecewiseStatement(astLeftChild)) {
-            astLeftChildCode = "(" + astLeftChildCode + ")";
+        for (const auto &variable : modelVariables()) {
+            switch (variable->type()) {
+            case AnalyserVariable::Type::CONSTANT:
+                methodBody += generateInitialisationCode(variable);
+
+                break;
+            case AnalyserVariable::Type::COMPUTED_CONSTANT:
+            case AnalyserVariable::Type::ALGEBRAIC:
+                if (variable->initialisingVariable() != nullptr) {
+                    methodBody += generateInitialisationCode(variable);
+                } else if (variable->equation(0)->type() == AnalyserEquation::Type::NLA) {
+                    methodBody += generateZeroInitialisationCode(variable);
+                }
+
+                break;
+            default: // Other types we don't care about.
+                break;
+            }
         }
 
-        if (isRelationalOperator(astRightChild)
-            || isLogicalOperator(astRightChild)
-            || isPiecewiseStatement(astRightChild)) {
-            astRightChildCode = "(" + astRightChildCode + ")";
+        // Initialise our true constants.
+
+        auto &equations = modelEquations();
+        auto equationCount = equations.size();
+
+        for (size_t i = 0; i < equationCount; ++i) {
+            if (equations[i]->type() == AnalyserEquation::Type::TRUE_CONSTANT) {
+                generateEquationCode(i, remainingEquations, methodBody);
+            }
         }
-    } else if (isMinusOperator(ast)) {
-        if (isRelationalOperator(astLeftChild)
-            || isLogicalOperator(astLeftChild)
-            || isPiecewiseStatement(astLeftChild)) {
-            astLeftChildCode = "(" + astLeftChildCode + ")";
+
+        // Initialise our states.
+
+        for (const auto &state : modelStates()) {
+            methodBody += generateInitialisationCode(state);
         }
 
-        if (isNegativeNumber(astRightChild)
-            || isRelationalOperator(astRightChild)
-            || isLogicalOperator(astRightChild)
-            || isMinusOperator(astRightChild)
-            || isPiecewiseStatement(astRightChild)
-            || (astRightChildCode.rfind(mProfile->minusString(), 0) == 0)) {
-            astRightChildCode = "(" + astRightChildCode + ")";
-        } else if (isPlusOperator(astRightChild)) {
-            if (astRightChild->rightChild() != nullptr) {
-                astRightChildCode = "(" + astRightChildCode + ")";
+        // Initialise the sensitivities of our states, which are zero unless a
+        // state is initialised using a sensitivity parameter.
+
+        for (size_t i = 0; i < mUsedSensitivityParameters.size(); ++i) {
+            for (const auto &state : modelStates()) {
+                auto initialisingVariable = state->initialisingVariable();
+                auto sensitivityCode = generateDoubleCode("0.0");
+
+                if (!isCellMLReal(initialisingVariable->initialValue())) {
+                    auto initialValueVariable = mAnalyserVariables.find(owningComponent(initialisingVariable)->variable(initialisingVariable->initialValue()).get());
+
+                    if ((initialValueVariable != mAnalyserVariables.end())
+                        && (initialValueVariable->second == mUsedSensitivityParameters[i])) {
+                        sensitivityCode = generateDoubleCode(convertToString(1.0 / scalingFactor(initialisingVariable)));
+                    }
+                }
+
+                methodBody += mProfile->indentString()
+                              + mProfile->statesArrayString() + mProfile->openArrayString()
+                              + convertToString((i + 1) * mModel->stateCount() + state->index())
+                              + mProfile->closeArrayString()
+                              + mProfile->equalityString()
+                              + sensitivityCode
+                              + mProfile->commandSeparatorString() + "\n";
             }
         }
-    } else if (isTimesOperator(ast)) {
-        if (isRelationalOperator(astLeftChild)
-            || isLogicalOperator(astLeftChild)
-            || isPiecewiseStatement(astLeftChild)) {
-            astLeftChildCode = "(" + astLeftChildCode + ")";
-        } else if (isPlusOperator(astLeftChild)
-                   || isMinusOperator(astLeftChild)) {
-            if (astLeftChild->rightChild() != nullptr) {
-                astLeftChildCode = "(" + astLeftChildCode + ")";
+
+        // Use an initial guess of zero for rates computed using an NLA system
+        // (see the note above).
+
+        for (const auto &state : modelStates()) {
+            if (state->equation(0)->type() == AnalyserEquation::Type::NLA) {
+                methodBody += generateZeroInitialisationCode(state);
             }
         }
 
-        if (isRelationalOperator(astRightChild)
-            || isLogicalOperator(astRightChild)
-            || isPiecewiseStatement(astRightChild)) {
-            astRightChildCode = "(" + astRightChildCode + ")";
-        } else if (isPlusOperator(astRightChild)
-                   || isMinusOperator(astRightChild)) {
-            if (astRightChild->rightChild() != nullptr) {
-                astRightChildCode = "(" + astRightChildCode + ")";
+        // Initialise our external variables.
+
+        if (mModel->hasExternalVariables()) {
+            std::vector<bool> remainingExternalEquations(equationCount);
+
+            for (size_t i = 0; i < equationCount; ++i) {
+                remainingExternalEquations[i] = equations[i]->type() == AnalyserEquation::Type::EXTERNAL;
             }
-        }
-    } else if (isDivideOperator(ast)) {
-        if (isRelationalOperator(astLeftChild)
-            || isLogicalOperator(astLeftChild)
-            || isPiecewiseStatement(astLeftChild)) {
-            astLeftChildCode = "(" + astLeftChildCode + ")";
-        } else if (isPlusOperator(astLeftChild)
-                   || isMinusOperator(astLeftChild)) {
-            if (astLeftChild->rightChild() != nullptr) {
-                astLeftChildCode = "(" + astLeftChildCode + ")";
+
+            for (size_t i = 0; i < equationCount; ++i) {
+                if (equations[i]->type() == AnalyserEquation::Type::EXTERNAL) {
+                    generateEquationCode(i, remainingExternalEquations, methodBody);
+                }
             }
         }
 
-        if (isRelationalOperator(astRightChild)
-            || isLogicalOperator(astRightChild)
-            || isTimesOperator(astRightChild)
-            || isDivideOperator(astRightChild)
-            || isPiecewiseStatement(astRightChild)) {
-            astRightChildCode = "(" + astRightChildCode + ")";
-        } else if (isPlusOperator(astRightChild)
-                   || isMinusOperator(astRightChild)) {
-            if (astRightChild->rightChild() != nullptr) {
-                astRightChildCode = "(" + astRightChildCode + ")";
+        addMethodCode(implementationInitialiseVariablesMethodString, methodBody);
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationComputeComputedConstantsMethodCode(std::vector<bool> &remainingEquations)
+{
+    if (!mProfile->implementationComputeComputedConstantsMethodString().empty()) {
+        std::string methodBody;
+        auto &equations = modelEquations();
+
+        for (size_t i = 0; i < equations.size(); ++i) {
+            if (equations[i]->type() == AnalyserEquation::Type::VARIABLE_BASED_CONSTANT) {
+                generateEquationCode(i, remainingEquations, methodBody);
             }
         }
-    } else if (isAndOperator(ast)) {
-        // Note: according to the precedence rules above, we only need to
-        //       add parentheses around OR and PIECEWISE. However, it looks
-        //       better/clearer to have some around some other operators
-        //       (agreed, this is somewhat subjective).
 
-        if (isRelationalOperator(astLeftChild)
-            || isOrOperator(astLeftChild)
-            || isXorOperator(astLeftChild)
-            || isPiecewiseStatement(astLeftChild)) {
-            astLeftChildCode = "(" + astLeftChildCode + ")";
-        } else if (isPlusOperator(astLeftChild)
-                   || isMinusOperator(astLeftChild)) {
-            if (astLeftChild->rightChild() != nullptr) {
-                astLeftChildCode = "(" + astLeftChildCode + ")";
+        addMethodCode(mProfile->implementationComputeComputedConstantsMethodString(), methodBody);
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationInitialiseLookupTablesMethodCode()
+{
+    if (!mUsedLookupTables.empty()) {
+        // Initialise our lookup tables by evaluating, for each of their rows,
+        // the equations that they tabulate. Also keep track of the maximum
+        // interpolation error, which we evaluate at the midpoint between two
+        // consecutive rows.
+        // Note: the equations may rely on some computed constants, so the
+        //       method is expected to be called after computeComputedConstants().
+
+        std::string methodBody;
+
+        for (size_t i = 0; i < mUsedLookupTables.size(); ++i) {
+            auto &usedLookupTable = mUsedLookupTables[i];
+            std::string code;
+            std::string errorCode;
+
+            for (size_t j = 0; j < usedLookupTable.mEquations.size(); ++j) {
+                auto equationCode = generateCode(usedLookupTable.mEquations[j]->ast()->rightChild());
+                auto entryCode = replace(replace(replace(mProfile->lookupTableEntryString(),
+                                                         "[INDEX]", convertToString(i)),
+                                                 "[COLUMN_COUNT]", convertToString(usedLookupTable.mEquations.size())),
+                                         "[COLUMN]", convertToString(j));
+
+                code += mProfile->indentString() + mProfile->indentString()
+                        + entryCode
+                        + mProfile->equalityString()
+                        + equationCode
+                        + mProfile->commandSeparatorString() + "\n";
+
+                if (!mProfile->lookupTableErrorString().empty()) {
+                    std::string valueCode;
+
+                    generateLookupTableValueCallCode(i, j, valueCode);
+
+                    errorCode += mProfile->indentString() + mProfile->indentString()
+                                 + replace(replace(mProfile->lookupTableErrorString(),
+                                                   "[CODE]", equationCode),
+                                           "[VALUE]", valueCode);
+                }
             }
-        } else if (isPowerOperator(astLeftChild)) {
-            astLeftChildCode = "(" + astLeftChildCode + ")";
-        } else if (isRootOperator(astLeftChild)) {
-            astLeftChildCode = "(" + astLeftChildCode + ")";
-        }
 
-        if (isRelationalOperator(astRightChild)
-            || isOrOperator(astRightChild)
-            || isXorOperator(astRightChild)
-            || isPiecewiseStatement(astRightChild)) {
-            astRightChildCode = "(" + astRightChildCode + ")";
-        } else if (isPlusOperator(astRightChild)
-                   || isMinusOperator(astRightChild)) {
-            if (astRightChild->rightChild() != nullptr) {
-                astRightChildCode = "(" + astRightChildCode + ")";
+            // Note: the [SIZE], [STATE], [MINIMUM], and [STEP] tags are
+            //       typically used in each of the two loops of the
+            //       initialisation code, while the [CODE] tag may be used
+            //       several times to compute the entries of a row at different
+            //       values of the state (e.g. just either side of the row so
+            //       that a removable singularity on the row doesn't result in
+            //       non-finite entries).
+
+            auto initialisationCode = mProfile->lookupTableInitialisationString();
+            auto columnCount = convertToString(usedLookupTable.mEquations.size());
+
+            for (const auto &tag : std::vector<std::pair<std::string, std::string>> {
+                     {"[SIZE]", convertToString(usedLookupTable.mSize)},
+                     {"[STATE]", generateVariableNameCode(usedLookupTable.mState->variable())},
+                     {"[MINIMUM]", generateDoubleCode(convertToString(usedLookupTable.mMinimum))},
+                     {"[STEP]", generateDoubleCode(convertToString(usedLookupTable.mStep))},
+                     {"[COLUMN_COUNT]", columnCount},
+                     {"[ENTRY]", replace(replace(replace(mProfile->lookupTableEntryString(),
+                                                         "[INDEX]", convertToString(i)),
+                                                 "[COLUMN_COUNT]", columnCount),
+                                         "[COLUMN]", "j")},
+                     {"[CODE]", code},
+                     {"[ERROR_CODE]", errorCode},
+                 }) {
+                while (initialisationCode.find(tag.first) != std::string::npos) {
+                    initialisationCode = replace(initialisationCode, tag.first, tag.second);
+                }
             }
-        } else if (isPowerOperator(astRightChild)) {
-            astRightChildCode = "(" + astRightChildCode + ")";
-        } else if (isRootOperator(astRightChild)) {
-            astRightChildCode = "(" + astRightChildCode + ")";
+
+            methodBody += ((i == 0) ? "" : "\n") + initialisationCode;
+        }
+
+        addMethodCode(mProfile->implementationInitialiseLookupTablesMethodString(), methodBody);
+    }
+}
+
+AnalyserEquationAstPtr Generator::GeneratorImpl::sensitivityAst(const AnalyserEquationAstPtr &ast,
+                                                                const AnalyserVariablePtr &parameter,
+                                                                const std::unordered_map<AnalyserVariable *, std::string> &sensitivities) const
+{
+    // Differentiate the given AST with respect to the given parameter, using
+    // the given code for the sensitivity of the states and variables on which
+    // it depends. A nullptr AST means that the derivative is zero.
+    // Note: the derivative shares some sub-ASTs with the given AST, so it must
+    //       not be modified.
+
+    auto leftAst = ast->leftChild();
+    auto rightAst = ast->rightChild();
+    auto sensitivity = [&](const AnalyserEquationAstPtr &childAst) {
+        return (childAst != nullptr) ?
+                   sensitivityAst(childAst, parameter, sensitivities) :
+                   nullptr;
+    };
+    auto square = [](const AnalyserEquationAstPtr &childAst) {
+        return createAst(AnalyserEquationAst::Type::TIMES, childAst, childAst);
+    };
+    auto one = [] {
+        return createAst(AnalyserEquationAst::Type::CN, "1");
+    };
+
+    switch (ast->type()) {
+    case AnalyserEquationAst::Type::PLUS:
+        return plusAst(sensitivity(leftAst), sensitivity(rightAst));
+    case AnalyserEquationAst::Type::MINUS:
+        if (rightAst == nullptr) {
+            return minusAst(nullptr, sensitivity(leftAst));
+        }
+
+        return minusAst(sensitivity(leftAst), sensitivity(rightAst));
+    case AnalyserEquationAst::Type::TIMES:
+        return plusAst(timesAst(sensitivity(leftAst), rightAst),
+                       timesAst(leftAst, sensitivity(rightAst)));
+    case AnalyserEquationAst::Type::DIVIDE:
+        return minusAst(divideAst(sensitivity(leftAst), rightAst),
+                        divideAst(timesAst(leftAst, sensitivity(rightAst)), square(rightAst)));
+    case AnalyserEquationAst::Type::POWER: {
+        auto leftSensitivityAst = sensitivity(leftAst);
+        auto rightSensitivityAst = sensitivity(rightAst);
+
+        if (rightSensitivityAst == nullptr) {
+            // d(u^v) = v*u^(v-1)*du, with v-1 evaluated if v is a number.
+
+            double exponent;
+            auto exponentAst = ((rightAst->type() == AnalyserEquationAst::Type::CN)
+                                && convertToDouble(rightAst->value(), exponent)) ?
+                                   createAst(AnalyserEquationAst::Type::CN, convertToString(exponent - 1.0)) :
+                                   createAst(AnalyserEquationAst::Type::MINUS, rightAst, one());
+
+            return timesAst(timesAst(rightAst, createAst(AnalyserEquationAst::Type::POWER, leftAst, exponentAst)),
+                            leftSensitivityAst);
         }
-    } else if (isOrOperator(ast)) {
-        // Note: according to the precedence rules above, we only need to
-        //       add parentheses around PIECEWISE. However, it looks
-        //       better/clearer to have some around some other operators
-        //       (agreed, this is somewhat subjective).
 
-        if (isRelationalOperator(astLeftChild)
-            || isAndOperator(astLeftChild)
-            || isXorOperator(astLeftChild)
-            || isPiecewiseStatement(astLeftChild)) {
-            astLeftChildCode = "(" + astLeftChildCode + ")";
-        } else if (isPlusOperator(astLeftChild)
-                   || isMinusOperator(astLeftChild)) {
-            if (astLeftChild->rightChild() != nullptr) {
-                astLeftChildCode = "(" + astLeftChildCode + ")";
-            }
-        } else if (isPowerOperator(astLeftChild)) {
-            astLeftChildCode = "(" + astLeftChildCode + ")";
-        } else if (isRootOperator(astLeftChild)) {
-            astLeftChildCode = "(" + astLeftChildCode + ")";
+        // d(u^v) = u^v*(dv*ln(u)+v*du/u).
+
+        return timesAst(ast, plusAst(timesAst(rightSensitivityAst, createAst(AnalyserEquationAst::Type::LN, leftAst)),
+                                     divideAst(timesAst(rightAst, leftSensitivityAst), leftAst)));
+    }
+    case AnalyserEquationAst::Type::ROOT:
+        // Note: the left child is the degree of the root, if any, in which
+        //       case we differentiate the root as a power.
+
+        if (rightAst != nullptr) {
+            return sensitivity(createAst(AnalyserEquationAst::Type::POWER, rightAst,
+                                         createAst(AnalyserEquationAst::Type::DIVIDE, one(), leftAst->leftChild())));
         }
 
-        if (isRelationalOperator(astRightChild)
-            || isAndOperator(astRightChild)
-            || isXorOperator(astRightChild)
-            || isPiecewiseStatement(astRightChild)) {
-            astRightChildCode = "(" + astRightChildCode + ")";
-        } else if (isPlusOperator(astRightChild)
-                   || isMinusOperator(astRightChild)) {
-            if (astRightChild->rightChild() != nullptr) {
-                astRightChildCode = "(" + astRightChildCode + ")";
-            }
-        } else if (isPowerOperator(astRightChild)) {
-            astRightChildCode = "(" + astRightChildCode + ")";
-        } else if (isRootOperator(astRightChild)) {
-            astRightChildCode = "(" + astRightChildCode + ")";
+        return divideAst(sensitivity(leftAst),
+                         createAst(AnalyserEquationAst::Type::TIMES, createAst(AnalyserEquationAst::Type::CN, "2"), ast));
+    case AnalyserEquationAst::Type::ABS: {
+        auto leftSensitivityAst = sensitivity(leftAst);
+
+        if (leftSensitivityAst == nullptr) {
+            return nullptr;
         }
-    } else if (isXorOperator(ast)) {
-        // Note: according to the precedence rules above, we only need to
-        //       add parentheses around AND, OR and PIECEWISE. However, it
-        //       looks better/clearer to have some around some other
-        //       operators (agreed, this is somewhat subjective).
 
-        if (isRelationalOperator(astLeftChild)
-            || isAndOperator(astLeftChild)
-            || isOrOperator(astLeftChild)
-            || isPiecewiseStatement(astLeftChild)) {
-            astLeftChildCode = "(" + astLeftChildCode + ")";
-        } else if (isPlusOperator(astLeftChild)
-                   || isMinusOperator(astLeftChild)) {
-            if (astLeftChild->rightChild() != nullptr) {
-                astLeftChildCode = "(" + astLeftChildCode + ")";
-            }
-        } else if (isPowerOperator(astLeftChild)) {
-            astLeftChildCode = "(" + astLeftChildCode + ")";
-        } else if (isRootOperator(astLeftChild)) {
-            astLeftChildCode = "(" + astLeftChildCode + ")";
+        return createAst(AnalyserEquationAst::Type::PIECEWISE,
+                         createAst(AnalyserEquationAst::Type::PIECE,
+                                   minusAst(nullptr, leftSensitivityAst),
+                                   createAst(AnalyserEquationAst::Type::LT, leftAst, createAst(AnalyserEquationAst::Type::CN, "0"))),
+                         createAst(AnalyserEquationAst::Type::OTHERWISE, leftSensitivityAst));
+    }
+    case AnalyserEquationAst::Type::EXP:
+        return timesAst(ast, sensitivity(leftAst));
+    case AnalyserEquationAst::Type::LN:
+        return divideAst(sensitivity(leftAst), leftAst);
+    case AnalyserEquationAst::Type::LOG:
+        // Note: the left child is the base of the logarithm, if any, in which
+        //       case we differentiate the logarithm as a ratio of natural
+        //       logarithms.
+
+        if (rightAst != nullptr) {
+            return sensitivity(createAst(AnalyserEquationAst::Type::DIVIDE,
+                                         createAst(AnalyserEquationAst::Type::LN, rightAst),
+                                         createAst(AnalyserEquationAst::Type::LN, leftAst->leftChild())));
         }
 
-        if (isRelationalOperator(astRightChild)
-            || isAndOperator(astRightChild)
-            || isOrOperator(astRightChild)
-            || isPiecewiseStatement(astRightChild)) {
-            astRightChildCode = "(" + astRightChildCode + ")";
-        } else if (isPlusOperator(astRightChild)
-                   || isMinusOperator(astRightChild)) {
-            if (astRightChild->rightChild() != nullptr) {
-                astRightChildCode = "(" + astRightChildCode + ")";
-            }
-        } else if (isPowerOperator(astRightChild)) {
-            astRightChildCode = "(" + astRightChildCode + ")";
-        } else if (isRootOperator(astRightChild)) {
-            astRightChildCode = "(" + astRightChildCode + ")";
+        return divideAst(sensitivity(leftAst),
+                         createAst(AnalyserEquationAst::Type::TIMES, leftAst,
+                                   createAst(AnalyserEquationAst::Type::LN, createAst(AnalyserEquationAst::Type::CN, "10"))));
+    case AnalyserEquationAst::Type::MIN:
+    case AnalyserEquationAst::Type::MAX: {
+        auto leftSensitivityAst = sensitivity(leftAst);
+        auto rightSensitivityAst = sensitivity(rightAst);
+
+        if ((leftSensitivityAst == nullptr) && (rightSensitivityAst == nullptr)) {
+            return nullptr;
         }
-    } else if (isPowerOperator(ast)) {
-        if (isRelationalOperator(astLeftChild)
-            || isLogicalOperator(astLeftChild)
-            || isMinusOperator(astLeftChild)
-            || isTimesOperator(astLeftChild)
-            || isDivideOperator(astLeftChild)
-            || isPiecewiseStatement(astLeftChild)) {
-            astLeftChildCode = "(" + astLeftChildCode + ")";
-        } else if (isPlusOperator(astLeftChild)) {
-            if (astLeftChild->rightChild() != nullptr) {
-                astLeftChildCode = "(" + astLeftChildCode + ")";
-            }
+
+        // Note: we use the derivative of u (v) if u<v for MIN (MAX) and that of
+        //       v (u) otherwise.
+
+        if (leftSensitivityAst == nullptr) {
+            leftSensitivityAst = createAst(AnalyserEquationAst::Type::CN, "0");
         }
 
-        if (isRelationalOperator(astRightChild)
-            || isLogicalOperator(astRightChild)
-            || isMinusOperator(astLeftChild)
-            || isTimesOperator(astRightChild)
-            || isDivideOperator(astRightChild)
-            || isPowerOperator(astRightChild)
-            || isRootOperator(astRightChild)
-            || isPiecewiseStatement(astRightChild)) {
-            astRightChildCode = "(" + astRightChildCode + ")";
-        } else if (isPlusOperator(astRightChild)) {
-            if (astRightChild->rightChild() != nullptr) {
-                astRightChildCode = "(" + astRightChildCode + ")";
-            }
+        if (rightSensitivityAst == nullptr) {
+            rightSensitivityAst = createAst(AnalyserEquationAst::Type::CN, "0");
         }
-    } else if (isRootOperator(ast)) {
-        if (isRelationalOperator(astRightChild)
-            || isLogicalOperator(astRightChild)
-            || isMinusOperator(astRightChild)
-            || isTimesOperator(astRightChild)
-            || isDivideOperator(astRightChild)
-            || isPiecewiseStatement(astRightChild)) {
-            astRightChildCode = "(" + astRightChildCode + ")";
-        } else if (isPlusOperator(astRightChild)) {
-            if (astRightChild->rightChild() != nullptr) {
-                astRightChildCode = "(" + astRightChildCode + ")";
+
+        auto isMin = ast->type() == AnalyserEquationAst::Type::MIN;
+
+        return createAst(AnalyserEquationAst::Type::PIECEWISE,
+                         createAst(AnalyserEquationAst::Type::PIECE,
+                                   isMin ? leftSensitivityAst : rightSensitivityAst,
+                                   createAst(AnalyserEquationAst::Type::LT, leftAst, rightAst)),
+                         createAst(AnalyserEquationAst::Type::OTHERWISE,
+                                   isMin ? rightSensitivityAst : leftSensitivityAst));
+    }
+    case AnalyserEquationAst::Type::REM:
+        // d(rem(u, v)) = du-dv*(u-rem(u, v))/v.
+
+        return minusAst(sensitivity(leftAst),
+                        timesAst(sensitivity(rightAst),
+                                 createAst(AnalyserEquationAst::Type::DIVIDE,
+                                           createAst(AnalyserEquationAst::Type::MINUS, leftAst, ast),
+                                           rightAst)));
+    case AnalyserEquationAst::Type::SIN:
+        return timesAst(createAst(AnalyserEquationAst::Type::COS, leftAst), sensitivity(leftAst));
+    case AnalyserEquationAst::Type::COS:
+        return minusAst(nullptr, timesAst(createAst(AnalyserEquationAst::Type::SIN, leftAst), sensitivity(leftAst)));
+    case AnalyserEquationAst::Type::TAN:
+        return divideAst(sensitivity(leftAst), square(createAst(AnalyserEquationAst::Type::COS, leftAst)));
+    case AnalyserEquationAst::Type::SEC:
+        return timesAst(createAst(AnalyserEquationAst::Type::TIMES, ast, createAst(AnalyserEquationAst::Type::TAN, leftAst)),
+                        sensitivity(leftAst));
+    case AnalyserEquationAst::Type::CSC:
+        // Note: we use csc(u)/tan(u) rather than csc(u)*cot(u) since the model
+        //       may not need a cot() function (and similarly for CSCH).
+
+        return minusAst(nullptr, timesAst(createAst(AnalyserEquationAst::Type::DIVIDE, ast, createAst(AnalyserEquationAst::Type::TAN, leftAst)),
+                                          sensitivity(leftAst)));
+    case AnalyserEquationAst::Type::COT:
+        return minusAst(nullptr, divideAst(sensitivity(leftAst), square(createAst(AnalyserEquationAst::Type::SIN, leftAst))));
+    case AnalyserEquationAst::Type::SINH:
+        return timesAst(createAst(AnalyserEquationAst::Type::COSH, leftAst), sensitivity(leftAst));
+    case AnalyserEquationAst::Type::COSH:
+        return timesAst(createAst(AnalyserEquationAst::Type::SINH, leftAst), sensitivity(leftAst));
+    case AnalyserEquationAst::Type::TANH:
+        return divideAst(sensitivity(leftAst), square(createAst(AnalyserEquationAst::Type::COSH, leftAst)));
+    case AnalyserEquationAst::Type::SECH:
+        return minusAst(nullptr, timesAst(createAst(AnalyserEquationAst::Type::TIMES, ast, createAst(AnalyserEquationAst::Type::TANH, leftAst)),
+                                          sensitivity(leftAst)));
+    case AnalyserEquationAst::Type::CSCH:
+        return minusAst(nullptr, timesAst(createAst(AnalyserEquationAst::Type::DIVIDE, ast, createAst(AnalyserEquationAst::Type::TANH, leftAst)),
+                                          sensitivity(leftAst)));
+    case AnalyserEquationAst::Type::COTH:
+        return minusAst(nullptr, divideAst(sensitivity(leftAst), square(createAst(AnalyserEquationAst::Type::SINH, leftAst))));
+    case AnalyserEquationAst::Type::ASIN:
+        return divideAst(sensitivity(leftAst),
+                         createAst(AnalyserEquationAst::Type::ROOT,
+                                   createAst(AnalyserEquationAst::Type::MINUS, one(), square(leftAst))));
+    case AnalyserEquationAst::Type::ACOS:
+        return minusAst(nullptr, divideAst(sensitivity(leftAst),
+                                           createAst(AnalyserEquationAst::Type::ROOT,
+                                                     createAst(AnalyserEquationAst::Type::MINUS, one(), square(leftAst)))));
+    case AnalyserEquationAst::Type::ATAN:
+        return divideAst(sensitivity(leftAst), createAst(AnalyserEquationAst::Type::PLUS, one(), square(leftAst)));
+    case AnalyserEquationAst::Type::ASEC:
+        return divideAst(sensitivity(leftAst),
+                         createAst(AnalyserEquationAst::Type::TIMES,
+                                   createAst(AnalyserEquationAst::Type::ABS, leftAst),
+                                   createAst(AnalyserEquationAst::Type::ROOT,
+                                             createAst(AnalyserEquationAst::Type::MINUS, square(leftAst), one()))));
+    case AnalyserEquationAst::Type::ACSC:
+        return minusAst(nullptr, divideAst(sensitivity(leftAst),
+                                           createAst(AnalyserEquationAst::Type::TIMES,
+                                                     createAst(AnalyserEquationAst::Type::ABS, leftAst),
+                                                     createAst(AnalyserEquationAst::Type::ROOT,
+                                                               createAst(AnalyserEquationAst::Type::MINUS, square(leftAst), one())))));
+    case AnalyserEquationAst::Type::ACOT:
+        return minusAst(nullptr, divideAst(sensitivity(leftAst), createAst(AnalyserEquationAst::Type::PLUS, one(), square(leftAst))));
+    case AnalyserEquationAst::Type::ASINH:
+        return divideAst(sensitivity(leftAst),
+                         createAst(AnalyserEquationAst::Type::ROOT,
+                                   createAst(AnalyserEquationAst::Type::PLUS, square(leftAst), one())));
+    case AnalyserEquationAst::Type::ACOSH:
+        return divideAst(sensitivity(leftAst),
+                         createAst(AnalyserEquationAst::Type::ROOT,
+                                   createAst(AnalyserEquationAst::Type::MINUS, square(leftAst), one())));
+    case AnalyserEquationAst::Type::ATANH:
+    case AnalyserEquationAst::Type::ACOTH:
+        return divideAst(sensitivity(leftAst), createAst(AnalyserEquationAst::Type::MINUS, one(), square(leftAst)));
+    case AnalyserEquationAst::Type::ASECH:
+        return minusAst(nullptr, divideAst(sensitivity(leftAst),
+                                           createAst(AnalyserEquationAst::Type::TIMES, leftAst,
+                                                     createAst(AnalyserEquationAst::Type::ROOT,
+                                                               createAst(AnalyserEquationAst::Type::MINUS, one(), square(leftAst))))));
+    case AnalyserEquationAst::Type::ACSCH:
+        return minusAst(nullptr, divideAst(sensitivity(leftAst),
+                                           createAst(AnalyserEquationAst::Type::TIMES,
+                                                     createAst(AnalyserEquationAst::Type::ABS, leftAst),
+                                                     createAst(AnalyserEquationAst::Type::ROOT,
+                                                               createAst(AnalyserEquationAst::Type::PLUS, one(), square(leftAst))))));
+    case AnalyserEquationAst::Type::PIECEWISE:
+    case AnalyserEquationAst::Type::PIECE:
+    case AnalyserEquationAst::Type::OTHERWISE: {
+        // Differentiate the value of each piece while keeping its condition,
+        // unless the derivative of all the values is zero.
+
+        auto nonZeroSensitivity = false;
+        std::function<AnalyserEquationAstPtr(const AnalyserEquationAstPtr &)> piecewiseSensitivity = [&](const AnalyserEquationAstPtr &pieceAst) -> AnalyserEquationAstPtr {
+            if (pieceAst == nullptr) {
+                return nullptr;
             }
-        }
 
-        auto astLeftChildLeftChild = astLeftChild->leftChild();
+            if (pieceAst->type() == AnalyserEquationAst::Type::PIECEWISE) {
+                return createAst(AnalyserEquationAst::Type::PIECEWISE,
+                                 piecewiseSensitivity(pieceAst->leftChild()),
+                                 piecewiseSensitivity(pieceAst->rightChild()));
+            }
 
-        if (isRelationalOperator(astLeftChildLeftChild)
-            || isLogicalOperator(astLeftChildLeftChild)
-            || isMinusOperator(astLeftChildLeftChild)
-            || isTimesOperator(astLeftChildLeftChild)
-            || isDivideOperator(astLeftChildLeftChild)
-            || isPowerOperator(astLeftChildLeftChild)
-            || isRootOperator(astLeftChildLeftChild)
-            || isPiecewiseStatement(astLeftChildLeftChild)) {
-            astLeftChildCode = "(" + astLeftChildCode + ")";
-        } else if (isPlusOperator(astLeftChildLeftChild)) {
-            if (astLeftChildLeftChild->rightChild() != nullptr) {
-                astLeftChildCode = "(" + astLeftChildCode + ")";
+            auto valueSensitivityAst = sensitivity(pieceAst->leftChild());
+
+            if (valueSensitivityAst != nullptr) {
+                nonZeroSensitivity = true;
+            } else {
+                valueSensitivityAst = createAst(AnalyserEquationAst::Type::CN, "0");
             }
-        }
 
-        return astRightChildCode + op + "(1.0/" + astLeftChildCode + ")";
-    }
+            return createAst(pieceAst->type(), valueSensitivityAst, pieceAst->rightChild());
+        };
+        auto piecewiseSensitivityAst = piecewiseSensitivity(ast);
 
-    return astLeftChildCode + op + astRightChildCode;
-}
+        return nonZeroSensitivity ? piecewiseSensitivityAst : nullptr;
+    }
+    case AnalyserEquationAst::Type::CI: {
+        // The derivative of our parameter is one while that of a state or
+        // variable is its sensitivity, if it has one, or zero otherwise (e.g.
+        // our variable of integration or a constant).
 
-std::string Generator::GeneratorImpl::generateMinusUnaryCode(const AnalyserEquationAstPtr &ast) const
-{
-    // Generate the code for the left branch of the given AST.
+        auto analyserVariable = Generator::GeneratorImpl::analyserVariable(ast->variable());
 
-    auto astLeftChild = ast->leftChild();
-    auto code = generateCode(astLeftChild);
+        if (analyserVariable == parameter) {
+            return one();
+        }
 
-    // Determine whether parentheses should be added around the left code.
+        auto sensitivityCode = sensitivities.find(analyserVariable.get());
 
-    if (isRelationalOperator(astLeftChild)
-        || isLogicalOperator(astLeftChild)
-        || isPlusOperator(astLeftChild)
-        || isMinusOperator(astLeftChild)
-        || isPiecewiseStatement(astLeftChild)) {
-        code = "(" + code + ")";
+        return (sensitivityCode != sensitivities.end()) ?
+                   createAst(AnalyserEquationAst::Type::CI, sensitivityCode->second) :
+                   nullptr;
     }
+    default:
+        // Numbers, constants, relational and logical operators, and piecewise
+        // constant functions (i.e. CEILING and FLOOR) have a zero derivative.
+        // Note: a DIFF AST never gets here since we don't compute
+        //       sensitivities for equations that rely on a rate.
 
-    return mProfile->minusString() + code;
+        return nullptr;
+    }
 }
 
-std::string Generator::GeneratorImpl::generateOneParameterFunctionCode(const std::string &function,
-                                                                       const AnalyserEquationAstPtr &ast) const
+std::string Generator::GeneratorImpl::generateSensitivitiesCode() const
 {
-    return function + "(" + generateCode(ast->leftChild()) + ")";
-}
+    // Compute the rates of our sensitivities by differentiating, for each of
+    // our sensitivity parameters, the equations needed to compute our rates.
+    // The sensitivity of a variable is kept in a local variable, if it is not
+    // zero, while that of a state is in the states array, after our states.
 
-std::string Generator::GeneratorImpl::generateTwoParameterFunctionCode(const std::string &function,
-                                                                       const AnalyserEquationAstPtr &ast) const
-{
-    return function + "(" + generateCode(ast->leftChild()) + ", " + generateCode(ast->rightChild()) + ")";
-}
+    std::string code;
+    auto &equations = modelEquations();
+    auto stateCount = mModel->stateCount();
+
+    for (size_t i = 0; i < mUsedSensitivityParameters.size(); ++i) {
+        auto &parameter = mUsedSensitivityParameters[i];
+        std::unordered_map<AnalyserVariable *, std::string> sensitivities;
+
+        for (const auto &state : modelStates()) {
+            sensitivities.emplace(state.get(),
+                                  mProfile->statesArrayString() + mProfile->openArrayString()
+                                      + convertToString((i + 1) * stateCount + state->index())
+                                      + mProfile->closeArrayString());
+        }
 
-std::string Generator::GeneratorImpl::generatePiecewiseIfCode(const std::string &condition,
-                                                              const std::string &value) const
-{
-    return replace(replace(mProfile->hasConditionalOperator() ?
-                               mProfile->conditionalOperatorIfString() :
-                               mProfile->piecewiseIfString(),
-                           "[CONDITION]", condition),
-                   "[IF_STATEMENT]", value);
-}
+        for (auto equationIndex : mSensitivityEquations) {
+            auto &equation = equations[equationIndex];
+            auto variable = equation->variable(0);
+            auto equationSensitivityAst = sensitivityAst(equation->ast()->rightChild(), parameter, sensitivities);
+
+            if (equation->type() == AnalyserEquation::Type::ODE) {
+                code += mProfile->indentString()
+                        + mProfile->ratesArrayString() + mProfile->openArrayString()
+                        + convertToString((i + 1) * stateCount + variable->index())
+                        + mProfile->closeArrayString()
+                        + mProfile->equalityString()
+                        + ((equationSensitivityAst != nullptr) ? generateCode(equationSensitivityAst) : generateDoubleCode("0.0"))
+                        + mProfile->commandSeparatorString() + "\n";
+            } else if (equationSensitivityAst != nullptr) {
+                auto name = sensitivityName(variable, parameter);
+                auto index = convertToString(i * mModel->variableCount() + variable->index());
+                std::string sensitivityCode;
+
+                appendProfileTemplate(sensitivityCode, *mLocalVariableNameTemplate, {&name, &index});
+
+                code += mProfile->indentString()
+                        + mProfile->localVariableDeclarationString()
+                        + sensitivityCode
+                        + mProfile->equalityString()
+                        + generateCode(equationSensitivityAst)
+                        + mProfile->commandSeparatorString() + "\n";
+
+                sensitivities.emplace(variable.get(), sensitivityCode);
+            }
+        }
+    }
 
-std::string Generator::GeneratorImpl::generatePiecewiseElseCode(const std::string &value) const
-{
-    return replace(mProfile->hasConditionalOperator() ?
-                       mProfile->conditionalOperatorElseString() :
-                       mProfile->piecewiseElseString(),
-                   "[ELSE_STATEMENT]", value);
+    return code;
 }
 
-std::string Generator::GeneratorImpl::generateCode(const AnalyserEquationAstPtr &ast) const
+void Generator::GeneratorImpl::addImplementationComputeRatesMethodCode(std::vector<bool> &remainingEquations)
 {
-    // Generate the code for the given AST.
-    // Note: AnalyserEquationAst::Type::BVAR is only relevant when there is no
-    //       model (in which case we want to generate something like dx/dt, as
-    //       is in the case of the analyser when we want to mention an equation)
-    //       since otherwise we don't need to generate any code for it (since we
-    //       will, instead, want to generate something like rates[0]).
+    // Note: we don't use local variables if the model has external variables
+    //       since an external variable may be computed using any variable in
+    //       the variables array.
 
-    std::string code;
+    auto localVariablesInUse = mProfile->hasLocalVariablesInComputeRates()
+                               && !mModel->hasExternalVariables();
+    auto implementationComputeRatesMethodString = localVariablesInUse ?
+                                                      mProfile->implementationComputeRatesMethodWithLocalVariablesString() :
+                                                      mProfile->implementationComputeRatesMethodString(mModel->hasExternalVariables());
 
-    switch (ast->type()) {
-    case AnalyserEquationAst::Type::EQUALITY:
-        code = generateOperatorCode(mProfile->equalityString(), ast);
+    if (modelHasOdes()
+        && !implementationComputeRatesMethodString.empty()) {
+        std::string methodBody;
+        auto &equations = modelEquations();
 
-        break;
-    case AnalyserEquationAst::Type::EQ:
-        if (mProfile->hasEqOperator()) {
-            code = generateOperatorCode(mProfile->eqString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->eqString(), ast);
+        if (localVariablesInUse) {
+            prepareLocalVariables(remainingEquations);
         }
 
-        break;
-    case AnalyserEquationAst::Type::NEQ:
-        if (mProfile->hasNeqOperator()) {
-            code = generateOperatorCode(mProfile->neqString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->neqString(), ast);
-        }
+        mLocalVariablesInUse = localVariablesInUse;
 
-        break;
-    case AnalyserEquationAst::Type::LT:
-        if (mProfile->hasLtOperator()) {
-            code = generateOperatorCode(mProfile->ltString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->ltString(), ast);
-        }
+        // Note: we don't chunk our method body if local variables are in use
+        //       since a local variable is only visible in the method in which
+        //       it is declared.
 
-        break;
-    case AnalyserEquationAst::Type::LEQ:
-        if (mProfile->hasLeqOperator()) {
-            code = generateOperatorCode(mProfile->leqString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->leqString(), ast);
-        }
+        std::vector<std::pair<size_t, bool>> equationStatements;
 
-        break;
-    case AnalyserEquationAst::Type::GT:
-        if (mProfile->hasGtOperator()) {
-            code = generateOperatorCode(mProfile->gtString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->gtString(), ast);
+        if (!localVariablesInUse) {
+            mEquationStatements = &equationStatements;
         }
 
-        break;
-    case AnalyserEquationAst::Type::GEQ:
-        if (mProfile->hasGeqOperator()) {
-            code = generateOperatorCode(mProfile->geqString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->geqString(), ast);
-        }
+        for (size_t i = 0; i < equations.size(); ++i) {
+            auto &equation = equations[i];
 
-        break;
-    case AnalyserEquationAst::Type::AND:
-        if (mProfile->hasAndOperator()) {
-            code = generateOperatorCode(mProfile->andString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->andString(), ast);
-        }
+            // A rate is computed either through an ODE equation or through an
+            // NLA equation in case the rate is not on its own on either the LHS
+            // or RHS of the equation.
 
-        break;
-    case AnalyserEquationAst::Type::OR:
-        if (mProfile->hasOrOperator()) {
-            code = generateOperatorCode(mProfile->orString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->orString(), ast);
+            if ((equation->type() == AnalyserEquation::Type::ODE)
+                || ((equation->type() == AnalyserEquation::Type::NLA)
+                    && (equation->variableCount() == 1)
+                    && (equation->variable(0)->type() == AnalyserVariable::Type::STATE))) {
+                generateEquationCode(i, remainingEquations, methodBody);
+            }
         }
 
-        break;
-    case AnalyserEquationAst::Type::XOR:
-        if (mProfile->hasXorOperator()) {
-            code = generateOperatorCode(mProfile->xorString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->xorString(), ast);
+        mEquationStatements = nullptr;
+
+        methodBody = generateChunkedMethodBodyCode(implementationComputeRatesMethodString,
+                                                   mProfile->interfaceComputeRatesMethodString(mModel->hasExternalVariables()),
+                                                   methodBody, equationStatements);
+        methodBody += generateSensitivitiesCode();
+
+        mLocalVariablesInUse = false;
+
+        // Our local variables are only written back to the variables array in
+        // computeVariables().
+
+        if (localVariablesInUse) {
+            for (size_t i = 0; i < equations.size(); ++i) {
+                if (mLocalEquations[i]) {
+                    remainingEquations[i] = true;
+                }
+            }
         }
 
-        break;
-    case AnalyserEquationAst::Type::NOT:
-        if (mProfile->hasNotOperator()) {
-            code = mProfile->notString() + generateCode(ast->leftChild());
-        } else {
-            code = generateOneParameterFunctionCode(mProfile->notString(), ast);
+        addMethodCode(implementationComputeRatesMethodString, methodBody);
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationComputeRushLarsenCoefficientsMethodCode()
+{
+    if (modelHasOdes()
+        && mProfile->hasComputeRushLarsenCoefficientsMethod()
+        && !mProfile->implementationComputeRushLarsenCoefficientsMethodString().empty()) {
+        // Compute the time constant and steady-state value of our gating
+        // variables, i.e. the states which ODE is of the form:
+        //     dy/dt = (y_inf-y)/tau
+        // Note: the time constant and steady-state value may rely on some
+        //       variables computed in computeRates(), which is therefore
+        //       expected to have been called first.
+
+        std::string methodBody;
+
+        for (const auto &state : modelStates()) {
+            if (state->isGatingVariable()) {
+                auto index = mProfile->openArrayString() + convertToString(state->index()) + mProfile->closeArrayString();
+
+                methodBody += mProfile->indentString();
+                methodBody += mProfile->rushLarsenTausArrayString();
+                methodBody += index;
+                methodBody += mProfile->equalityString();
+
+                generateCode(state->mPimpl->mGatingTauAst, methodBody);
+
+                methodBody += mProfile->commandSeparatorString();
+                methodBody += "\n";
+                methodBody += mProfile->indentString();
+                methodBody += mProfile->rushLarsenSteadyStatesArrayString();
+                methodBody += index;
+                methodBody += mProfile->equalityString();
+
+                generateCode(state->mPimpl->mGatingSteadyStateAst, methodBody);
+
+                methodBody += mProfile->commandSeparatorString();
+                methodBody += "\n";
+            }
         }
 
-        break;
-    case AnalyserEquationAst::Type::PLUS:
-        if (ast->rightChild() != nullptr) {
-            code = generateOperatorCode(mProfile->plusString(), ast);
-        } else {
-            code = generateCode(ast->leftChild());
-        }
+        addMethodCode(mProfile->implementationComputeRushLarsenCoefficientsMethodString(), methodBody);
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationComputeVariablesMethodCode(std::vector<bool> &remainingEquations)
+{
+    auto implementationComputeVariablesMethodString = mProfile->implementationComputeVariablesMethodString(modelHasOdes(),
+                                                                                                           mModel->hasExternalVariables());
+
+    if (!implementationComputeVariablesMethodString.empty()) {
+        std::string methodBody;
+        auto &equations = modelEquations();
+        std::vector<bool> newRemainingEquations(equations.size(), true);
+
+        // Note: our remaining equations are only used to determine which
+        //       dependencies are to be computed, and that's only if there are
+        //       some remaining equations.
 
-        break;
-    case AnalyserEquationAst::Type::MINUS:
-        if (ast->rightChild() != nullptr) {
-            code = generateOperatorCode(mProfile->minusString(), ast);
-        } else {
-            code = generateMinusUnaryCode(ast);
+        auto equationsForComputeVariables = (std::find(remainingEquations.begin(), remainingEquations.end(), true) != remainingEquations.end()) ?
+                                                &remainingEquations :
+                                                nullptr;
+
+        std::vector<std::pair<size_t, bool>> equationStatements;
+
+        mEquationStatements = &equationStatements;
+
+        for (size_t i = 0; i < equations.size(); ++i) {
+            if (remainingEquations[i] || isToBeComputedAgain(equations[i])) {
+                generateEquationCode(i, newRemainingEquations, equationsForComputeVariables, methodBody);
+            }
         }
 
-        break;
-    case AnalyserEquationAst::Type::TIMES:
-        code = generateOperatorCode(mProfile->timesString(), ast);
+        mEquationStatements = nullptr;
 
-        break;
-    case AnalyserEquationAst::Type::DIVIDE:
-        code = generateOperatorCode(mProfile->divideString(), ast);
+        methodBody = generateChunkedMethodBodyCode(implementationComputeVariablesMethodString,
+                                                   mProfile->interfaceComputeVariablesMethodString(modelHasOdes(),
+                                                                                                   mModel->hasExternalVariables()),
+                                                   methodBody, equationStatements);
 
-        break;
-    case AnalyserEquationAst::Type::POWER: {
-        auto stringValue = generateCode(ast->rightChild());
-        double doubleValue;
-        auto validConversion = convertToDouble(stringValue, doubleValue);
+        addMethodCode(implementationComputeVariablesMethodString, methodBody);
+    }
+}
 
-        if (validConversion && areEqual(doubleValue, 0.5)) {
-            code = generateOneParameterFunctionCode(mProfile->squareRootString(), ast);
-        } else if (validConversion && areEqual(doubleValue, 2.0)
-                   && !mProfile->squareString().empty()) {
-            code = generateOneParameterFunctionCode(mProfile->squareString(), ast);
-        } else {
-            code = mProfile->hasPowerOperator() ?
-                       generateOperatorCode(mProfile->powerString(), ast) :
-                       mProfile->powerString() + "(" + generateCode(ast->leftChild()) + ", " + stringValue + ")";
-        }
-    } break;
-    case AnalyserEquationAst::Type::ROOT: {
-        auto astRightChild = ast->rightChild();
+bool Generator::GeneratorImpl::hasIntegrateMethods() const
+{
+    // Note: our integrate methods rely on computeRates() having the same
+    //       signature for all the steps, hence we don't generate them if the
+    //       model has external variables.
 
-        if (astRightChild != nullptr) {
-            auto astLeftChild = ast->leftChild();
-            double doubleValue;
+    return modelHasOdes()
+           && mProfile->hasIntegrateMethods()
+           && !mModel->hasExternalVariables();
+}
 
-            if (convertToDouble(generateCode(astLeftChild), doubleValue)
-                && areEqual(doubleValue, 2.0)) {
-                code = mProfile->squareRootString() + "(" + generateCode(astRightChild) + ")";
-            } else {
-                if (mProfile->hasPowerOperator()) {
-                    code = generateOperatorCode(mProfile->powerString(), ast);
-                } else {
-                    auto rootValueAst = AnalyserEquationAst::create();
+bool Generator::GeneratorImpl::hasIntegrateRushLarsenMethod() const
+{
+    return hasIntegrateMethods()
+           && mProfile->hasComputeRushLarsenCoefficientsMethod()
+           && !mProfile->implementationComputeRushLarsenCoefficientsMethodString().empty();
+}
 
-                    rootValueAst->setType(AnalyserEquationAst::Type::DIVIDE);
-                    rootValueAst->setParent(ast);
+void Generator::GeneratorImpl::addInterfaceIntegrateMethodsCode()
+{
+    if (!hasIntegrateMethods()) {
+        return;
+    }
 
-                    auto leftChild = AnalyserEquationAst::create();
+    std::string interfaceIntegrateMethodsCode;
 
-                    leftChild->setType(AnalyserEquationAst::Type::CN);
-                    leftChild->setValue("1.0");
-                    leftChild->setParent(rootValueAst);
+    if (!mProfile->interfaceIntegrateForwardEulerMethodString().empty()) {
+        interfaceIntegrateMethodsCode += mProfile->interfaceIntegrateForwardEulerMethodString();
+    }
 
-                    rootValueAst->setLeftChild(leftChild);
-                    rootValueAst->setRightChild(astLeftChild->leftChild());
+    if (!mProfile->interfaceIntegrateRk4MethodString().empty()) {
+        interfaceIntegrateMethodsCode += mProfile->interfaceIntegrateRk4MethodString();
+    }
 
-                    code = mProfile->powerString() + "(" + generateCode(astRightChild) + ", " + generateOperatorCode(mProfile->divideString(), rootValueAst) + ")";
-                }
-            }
-        } else {
-            code = generateOneParameterFunctionCode(mProfile->squareRootString(), ast);
-        }
-    } break;
-    case AnalyserEquationAst::Type::ABS:
-        code = generateOneParameterFunctionCode(mProfile->absoluteValueString(), ast);
+    if (hasIntegrateRushLarsenMethod()
+        && !mProfile->interfaceIntegrateRushLarsenMethodString().empty()) {
+        interfaceIntegrateMethodsCode += mProfile->interfaceIntegrateRushLarsenMethodString();
+    }
 
-        break;
-    case AnalyserEquationAst::Type::EXP:
-        code = generateOneParameterFunctionCode(mProfile->exponentialString(), ast);
+    if (!interfaceIntegrateMethodsCode.empty()) {
+        mCode += "\n";
+    }
 
-        break;
-    case AnalyserEquationAst::Type::LN:
-        code = generateOneParameterFunctionCode(mProfile->naturalLogarithmString(), ast);
+    mCode += interfaceIntegrateMethodsCode;
+}
 
-        break;
-    case AnalyserEquationAst::Type::LOG: {
-        auto astRightChild = ast->rightChild();
+void Generator::GeneratorImpl::addImplementationIntegrateMethodsCode()
+{
+    if (!hasIntegrateMethods()) {
+        return;
+    }
 
-        if (astRightChild != nullptr) {
-            auto stringValue = generateCode(ast->leftChild());
-            double doubleValue;
+    // Integrate our model over a number of steps of constant size using the
+    // forward Euler and fourth-order Runge-Kutta methods.
 
-            if (convertToDouble(stringValue, doubleValue)
-                && areEqual(doubleValue, 10.0)) {
-                code = mProfile->commonLogarithmString() + "(" + generateCode(astRightChild) + ")";
-            } else {
-                code = mProfile->naturalLogarithmString() + "(" + generateCode(astRightChild) + ")/" + mProfile->naturalLogarithmString() + "(" + stringValue + ")";
-            }
-        } else {
-            code = generateOneParameterFunctionCode(mProfile->commonLogarithmString(), ast);
+    for (const auto &methodString : {mProfile->implementationIntegrateForwardEulerMethodString(),
+                                     mProfile->implementationIntegrateRk4MethodString()}) {
+        if (!methodString.empty()) {
+            mCode += newLineIfNeeded() + methodString;
         }
-    } break;
-    case AnalyserEquationAst::Type::CEILING:
-        code = generateOneParameterFunctionCode(mProfile->ceilingString(), ast);
+    }
 
-        break;
-    case AnalyserEquationAst::Type::FLOOR:
-        code = generateOneParameterFunctionCode(mProfile->floorString(), ast);
+    // Integrate our model using the Rush-Larsen method, i.e. update our gating
+    // variables using their time constant and steady-state value, and our
+    // other states using the forward Euler method.
 
-        break;
-    case AnalyserEquationAst::Type::MIN:
-        code = generateTwoParameterFunctionCode(mProfile->minString(), ast);
+    if (hasIntegrateRushLarsenMethod()
+        && !mProfile->implementationIntegrateRushLarsenMethodString().empty()) {
+        std::string methodBody;
 
-        break;
-    case AnalyserEquationAst::Type::MAX:
-        code = generateTwoParameterFunctionCode(mProfile->maxString(), ast);
+        for (const auto &state : modelStates()) {
+            auto stateUpdateCode = state->isGatingVariable() ?
+                                       mProfile->rushLarsenStateUpdateString() :
+                                       mProfile->forwardEulerStateUpdateString();
+            auto index = convertToString(state->index());
 
-        break;
-    case AnalyserEquationAst::Type::REM:
-        code = generateTwoParameterFunctionCode(mProfile->remString(), ast);
+            while (stateUpdateCode.find("[INDEX]") != std::string::npos) {
+                stateUpdateCode = replace(stateUpdateCode, "[INDEX]", index);
+            }
 
-        break;
-    case AnalyserEquationAst::Type::DIFF:
-        if (mModel != nullptr) {
-            code = generateCode(ast->rightChild());
-        } else {
-            code = "d" + generateCode(ast->rightChild()) + "/d" + generateCode(ast->leftChild());
+            methodBody += stateUpdateCode;
         }
 
-        break;
-    case AnalyserEquationAst::Type::SIN:
-        code = generateOneParameterFunctionCode(mProfile->sinString(), ast);
-
-        break;
-    case AnalyserEquationAst::Type::COS:
-        code = generateOneParameterFunctionCode(mProfile->cosString(), ast);
+        // Our sensitivities, if any, are updated using the forward Euler
+        // method.
 
-        break;
-    case AnalyserEquationAst::Type::TAN:
-        code = generateOneParameterFunctionCode(mProfile->tanString(), ast);
+        for (auto i = mModel->stateCount(); i < stateCount(); ++i) {
+            auto stateUpdateCode = mProfile->forwardEulerStateUpdateString();
+            auto index = convertToString(i);
 
-        break;
-    case AnalyserEquationAst::Type::SEC:
-        code = generateOneParameterFunctionCode(mProfile->secString(), ast);
+            while (stateUpdateCode.find("[INDEX]") != std::string::npos) {
+                stateUpdateCode = replace(stateUpdateCode, "[INDEX]", index);
+            }
 
-        break;
-    case AnalyserEquationAst::Type::CSC:
-        code = generateOneParameterFunctionCode(mProfile->cscString(), ast);
+            methodBody += stateUpdateCode;
+        }
 
-        break;
-    case AnalyserEquationAst::Type::COT:
-        code = generateOneParameterFunctionCode(mProfile->cotString(), ast);
+        mCode += newLineIfNeeded()
+                 + replace(mProfile->implementationIntegrateRushLarsenMethodString(), "[CODE]", methodBody);
+    }
+}
 
-        break;
-    case AnalyserEquationAst::Type::SINH:
-        code = generateOneParameterFunctionCode(mProfile->sinhString(), ast);
+std::string Generator::GeneratorImpl::generateEnsembleMethodCode(const std::string &methodString) const
+{
+    // Distribute our instances among threads, if possible, so that each thread
+    // processes blocks of consecutive instances which data (i.e. states, rates,
+    // and variables) fits in a typical L1 cache.
 
-        break;
-    case AnalyserEquationAst::Type::COSH:
-        code = generateOneParameterFunctionCode(mProfile->coshString(), ast);
+    static const size_t L1_CACHE_SIZE = 32768;
 
-        break;
-    case AnalyserEquationAst::Type::TANH:
-        code = generateOneParameterFunctionCode(mProfile->tanhString(), ast);
+    auto precision = mProfile->precision();
+    auto stateSize = (precision == GeneratorProfile::Precision::SINGLE) ? sizeof(float) : sizeof(double);
+    auto variableSize = (precision == GeneratorProfile::Precision::DOUBLE) ? sizeof(double) : sizeof(float);
+    auto instanceSize = 2 * stateCount() * stateSize + mModel->variableCount() * variableSize;
+    auto blockSize = std::max(L1_CACHE_SIZE / instanceSize, static_cast<size_t>(1));
 
-        break;
-    case AnalyserEquationAst::Type::SECH:
-        code = generateOneParameterFunctionCode(mProfile->sechString(), ast);
+    return replace(methodString, "[OPENMP_PRAGMA]",
+                   replace(mProfile->ensembleOpenmpPragmaString(), "[BLOCK_SIZE]", convertToString(blockSize)));
+}
 
-        break;
-    case AnalyserEquationAst::Type::CSCH:
-        code = generateOneParameterFunctionCode(mProfile->cschString(), ast);
+bool Generator::GeneratorImpl::generateEnsembleInitialisationCode(const AnalyserVariablePtr &variable,
+                                                                  std::unordered_map<AnalyserVariable *, bool> &ensembleDependentVariables,
+                                                                  std::string &code) const
+{
+    // Reinitialise the given variable if its initial value is, directly or
+    // not, that of an ensemble parameter, making sure that the variable used
+    // to initialise it gets reinitialised first.
 
-        break;
-    case AnalyserEquationAst::Type::COTH:
-        code = generateOneParameterFunctionCode(mProfile->cothString(), ast);
+    auto ensembleDependentVariable = ensembleDependentVariables.find(variable.get());
 
-        break;
-    case AnalyserEquationAst::Type::ASIN:
-        code = generateOneParameterFunctionCode(mProfile->asinString(), ast);
+    if (ensembleDependentVariable != ensembleDependentVariables.end()) {
+        return ensembleDependentVariable->second;
+    }
 
-        break;
-    case AnalyserEquationAst::Type::ACOS:
-        code = generateOneParameterFunctionCode(mProfile->acosString(), ast);
+    ensembleDependentVariables[variable.get()] = false;
 
-        break;
-    case AnalyserEquationAst::Type::ATAN:
-        code = generateOneParameterFunctionCode(mProfile->atanString(), ast);
+    auto initialisingVariable = variable->initialisingVariable();
 
-        break;
-    case AnalyserEquationAst::Type::ASEC:
-        code = generateOneParameterFunctionCode(mProfile->asecString(), ast);
+    if ((initialisingVariable == nullptr)
+        || isCellMLReal(initialisingVariable->initialValue())) {
+        return false;
+    }
 
-        break;
-    case AnalyserEquationAst::Type::ACSC:
-        code = generateOneParameterFunctionCode(mProfile->acscString(), ast);
+    auto initialValueVariable = mAnalyserVariables.find(owningComponent(initialisingVariable)->variable(initialisingVariable->initialValue()).get());
 
-        break;
-    case AnalyserEquationAst::Type::ACOT:
-        code = generateOneParameterFunctionCode(mProfile->acotString(), ast);
+    if ((initialValueVariable == mAnalyserVariables.end())
+        || !generateEnsembleInitialisationCode(initialValueVariable->second, ensembleDependentVariables, code)) {
+        return false;
+    }
 
-        break;
-    case AnalyserEquationAst::Type::ASINH:
-        code = generateOneParameterFunctionCode(mProfile->asinhString(), ast);
+    code += generateInitialisationCode(variable);
 
-        break;
-    case AnalyserEquationAst::Type::ACOSH:
-        code = generateOneParameterFunctionCode(mProfile->acoshString(), ast);
+    ensembleDependentVariables[variable.get()] = true;
 
-        break;
-    case AnalyserEquationAst::Type::ATANH:
-        code = generateOneParameterFunctionCode(mProfile->atanhString(), ast);
+    return true;
+}
 
-        break;
-    case AnalyserEquationAst::Type::ASECH:
-        code = generateOneParameterFunctionCode(mProfile->asechString(), ast);
+void Generator::GeneratorImpl::addInterfaceEnsembleMethodsCode()
+{
+    if (!mEnsembleInUse) {
+        return;
+    }
 
-        break;
-    case AnalyserEquationAst::Type::ACSCH:
-        code = generateOneParameterFunctionCode(mProfile->acschString(), ast);
+    std::string interfaceEnsembleMethodsCode;
 
-        break;
-    case AnalyserEquationAst::Type::ACOTH:
-        code = generateOneParameterFunctionCode(mProfile->acothString(), ast);
+    if (!mProfile->interfaceInitialiseEnsembleMethodString().empty()) {
+        interfaceEnsembleMethodsCode += mProfile->interfaceInitialiseEnsembleMethodString();
+    }
 
-        break;
-    case AnalyserEquationAst::Type::PIECEWISE: {
-        auto astRightChild = ast->rightChild();
+    if (!mProfile->interfaceComputeEnsembleRatesMethodString().empty()) {
+        interfaceEnsembleMethodsCode += mProfile->interfaceComputeEnsembleRatesMethodString();
+    }
 
-        if (astRightChild != nullptr) {
-            if (astRightChild->type() == AnalyserEquationAst::Type::PIECE) {
-                code = generateCode(ast->leftChild()) + generatePiecewiseElseCode(generateCode(astRightChild) + generatePiecewiseElseCode(mProfile->nanString()));
-            } else {
-                code = generateCode(ast->leftChild()) + generatePiecewiseElseCode(generateCode(astRightChild));
-            }
-        } else {
-            code = generateCode(ast->leftChild()) + generatePiecewiseElseCode(mProfile->nanString());
-        }
-    } break;
-    case AnalyserEquationAst::Type::PIECE:
-        code = generatePiecewiseIfCode(generateCode(ast->rightChild()), generateCode(ast->leftChild()));
+    if (!mProfile->interfaceComputeEnsembleVariablesMethodString().empty()) {
+        interfaceEnsembleMethodsCode += mProfile->interfaceComputeEnsembleVariablesMethodString();
+    }
 
-        break;
-    case AnalyserEquationAst::Type::OTHERWISE:
-        code = generateCode(ast->leftChild());
+    if (!interfaceEnsembleMethodsCode.empty()) {
+        mCode += "\n";
+    }
 
-        break;
-    case AnalyserEquationAst::Type::CI:
-        code = generateVariableNameCode(ast->variable(), ast->parent()->type() != AnalyserEquationAst::Type::DIFF);
+    mCode += interfaceEnsembleMethodsCode;
+}
 
-        break;
-    case AnalyserEquationAst::Type::CN:
-        code = generateDoubleCode(ast->value());
+void Generator::GeneratorImpl::addImplementationEnsembleMethodsCode()
+{
+    if (!mEnsembleInUse) {
+        return;
+    }
 
-        break;
-    case AnalyserEquationAst::Type::DEGREE:
-    case AnalyserEquationAst::Type::LOGBASE:
-        code = generateCode(ast->leftChild());
+    // Initialise each instance of our ensemble using its parameters, which
+    // must be set before computing the computed constants of the instance.
+    // The states and constants that are initialised using an ensemble
+    // parameter must also be reinitialised since their default initialisation
+    // used the default value of that ensemble parameter.
 
-        break;
-    case AnalyserEquationAst::Type::BVAR:
-        code = generateCode(ast->leftChild());
+    std::string instanceInitialisationCode;
+    std::unordered_map<AnalyserVariable *, bool> ensembleDependentVariables;
 
-        break;
-    case AnalyserEquationAst::Type::TRUE:
-        code = mProfile->trueString();
+    for (size_t i = 0; i < mUsedEnsembleParameters.size(); ++i) {
+        instanceInitialisationCode += replace(replace(mProfile->ensembleParameterAssignmentString(),
+                                                      "[INDEX]", convertToString(mUsedEnsembleParameters[i]->index())),
+                                              "[PARAMETER_INDEX]", convertToString(i));
 
-        break;
-    case AnalyserEquationAst::Type::FALSE:
-        code = mProfile->falseString();
+        ensembleDependentVariables[mUsedEnsembleParameters[i].get()] = true;
+    }
 
-        break;
-    case AnalyserEquationAst::Type::E:
-        code = mProfile->eString();
+    for (const auto &variable : modelVariables()) {
+        generateEnsembleInitialisationCode(variable, ensembleDependentVariables, instanceInitialisationCode);
+    }
 
-        break;
-    case AnalyserEquationAst::Type::PI:
-        code = mProfile->piString();
+    for (const auto &state : modelStates()) {
+        generateEnsembleInitialisationCode(state, ensembleDependentVariables, instanceInitialisationCode);
+    }
 
-        break;
-    case AnalyserEquationAst::Type::INF:
-        code = mProfile->infString();
+    mCode += newLineIfNeeded()
+             + replace(generateEnsembleMethodCode(mProfile->implementationInitialiseEnsembleMethodString()),
+                       "[CODE]", instanceInitialisationCode);
 
-        break;
-    default: // AnalyserEquationAst::Type::NAN.
-        code = mProfile->nanString();
+    // Compute the rates and variables of each instance of our ensemble.
 
-        break;
+    for (const auto &methodString : {mProfile->implementationComputeEnsembleRatesMethodString(),
+                                     mProfile->implementationComputeEnsembleVariablesMethodString()}) {
+        if (!methodString.empty()) {
+            mCode += newLineIfNeeded() + generateEnsembleMethodCode(methodString);
+        }
     }
+}
 
-    return code;
+Generator::Generator()
+    : mPimpl(new GeneratorImpl())
+{
 }
 
-bool Generator::GeneratorImpl::isToBeComputedAgain(const AnalyserEquationPtr &equation) const
+Generator::~Generator()
 {
-    // NLA and algebraic equations that are state/rate-based and external
-    // equations are to be computed again (in the computeVariables() method).
+    delete mPimpl;
+}
 
-    switch (equation->type()) {
-    case AnalyserEquation::Type::NLA:
-    case AnalyserEquation::Type::ALGEBRAIC:
-        return equation->isStateRateBased();
-    case AnalyserEquation::Type::EXTERNAL:
-        return true;
-    default:
-        return false;
-    }
+GeneratorPtr Generator::create() noexcept
+{
+    return std::shared_ptr<Generator> {new Generator {}};
 }
 
-bool Generator::GeneratorImpl::isSomeConstant(const AnalyserEquationPtr &equation) const
+GeneratorProfilePtr Generator::profile()
 {
-    switch (equation->type()) {
-    case AnalyserEquation::Type::TRUE_CONSTANT:
-    case AnalyserEquation::Type::VARIABLE_BASED_CONSTANT:
-        return true;
-    default:
-        return false;
-    }
+    return mPimpl->mProfile;
 }
 
-std::string Generator::GeneratorImpl::generateZeroInitialisationCode(const AnalyserVariablePtr &variable) const
+void Generator::setProfile(const GeneratorProfilePtr &profile)
 {
-    return mProfile->indentString()
-           + generateVariableNameCode(variable->variable(), false)
-           + mProfile->equalityString()
-           + "0.0"
-           + mProfile->commandSeparatorString() + "\n";
+    mPimpl->mProfile = profile;
 }
 
-std::string Generator::GeneratorImpl::generateInitialisationCode(const AnalyserVariablePtr &variable) const
+AnalyserModelPtr Generator::model()
 {
-    auto initialisingVariable = variable->initialisingVariable();
-    auto scalingFactor = Generator::GeneratorImpl::scalingFactor(initialisingVariable);
-    std::string scalingFactorCode;
-
-    if (!areNearlyEqual(scalingFactor, 1.0)) {
-        scalingFactorCode = generateDoubleCode(convertToString(1.0 / scalingFactor)) + mProfile->timesString();
-    }
-
-    return mProfile->indentString()
-           + generateVariableNameCode(variable->variable())
-           + mProfile->equalityString()
-           + scalingFactorCode + generateDoubleOrConstantVariableNameCode(initialisingVariable)
-           + mProfile->commandSeparatorString() + "\n";
+    return mPimpl->mModel;
 }
 
-std::string Generator::GeneratorImpl::generateEquationCode(const AnalyserEquationPtr &equation,
-                                                           std::vector<AnalyserEquationPtr> &remainingEquations,
-                                                           std::vector<AnalyserEquationPtr> &equationsForComputeVariables)
+void Generator::setModel(const AnalyserModelPtr &model)
 {
-    std::string res;
+    mPimpl->mModel = model;
+}
 
-    if (std::find(remainingEquations.begin(), remainingEquations.end(), equation) != remainingEquations.end()) {
-        // Stop tracking the equation and its NLA siblings, if any.
-        // Note: we need to do this as soon as possible to avoid recursive
-        //       calls, something that would happen if we were to do this at the
-        //       end of this if statement.
+bool Generator::addLookupTable(const VariablePtr &variable, double minimum,
+                               double maximum, double step)
+{
+    if ((variable == nullptr)
+        || !(minimum < maximum)
+        || !(step > 0.0)
+        || (mPimpl->findLookupTable(variable) != mPimpl->mLookupTables.end())) {
+        return false;
+    }
 
-        remainingEquations.erase(std::find(remainingEquations.begin(), remainingEquations.end(), equation));
+    mPimpl->mLookupTables.push_back({variable, minimum, maximum, step});
 
-        for (const auto &nlaSibling : equation->nlaSiblings()) {
-            remainingEquations.erase(std::find(remainingEquations.begin(), remainingEquations.end(), nlaSibling));
-        }
+    ++mPimpl->mOptionsVersion;
 
-        // Generate any dependency that this equation may have.
-        // Note: this accounts for the special case of the computeVariables()
-        //       method.
+    return true;
+}
 
-        if (!isSomeConstant(equation)) {
-            for (const auto &dependency : equation->dependencies()) {
-                if ((dependency->type() != AnalyserEquation::Type::ODE)
-                    && !isSomeConstant(dependency)
-                    && (equationsForComputeVariables.empty()
-                        || isToBeComputedAgain(dependency)
-                        || (std::find(equationsForComputeVariables.begin(), equationsForComputeVariables.end(), dependency) != equationsForComputeVariables.end()))) {
-                    res += generateEquationCode(dependency, remainingEquations, equationsForComputeVariables);
-                }
-            }
-        }
+bool Generator::removeLookupTable(const VariablePtr &variable)
+{
+    auto lookupTable = mPimpl->findLookupTable(variable);
 
-        // Generate the equation code itself, based on the equation type.
+    if (lookupTable == mPimpl->mLookupTables.end()) {
+        return false;
+    }
 
-        switch (equation->type()) {
-        case AnalyserEquation::Type::EXTERNAL:
-            for (const auto &variable : equation->variables()) {
-                res += mProfile->indentString()
-                       + generateVariableNameCode(variable->variable())
-                       + mProfile->equalityString()
-                       + replace(mProfile->externalVariableMethodCallString(modelHasOdes()),
-                                 "[INDEX]", convertToString(variable->index()))
-                       + mProfile->commandSeparatorString() + "\n";
-            }
+    mPimpl->mLookupTables.erase(lookupTable);
 
-            break;
-        case AnalyserEquation::Type::NLA:
-            if (!mProfile->findRootCallString(modelHasOdes()).empty()) {
-                res += mProfile->indentString()
-                       + replace(mProfile->findRootCallString(modelHasOdes()),
-                                 "[INDEX]", convertToString(equation->nlaSystemIndex()));
-            }
+    ++mPimpl->mOptionsVersion;
 
-            break;
-        default:
-            res += mProfile->indentString() + generateCode(equation->ast()) + mProfile->commandSeparatorString() + "\n";
+    return true;
+}
 
-            break;
-        }
-    }
+void Generator::removeAllLookupTables()
+{
+    mPimpl->mLookupTables.clear();
 
-    return res;
+    ++mPimpl->mOptionsVersion;
 }
 
-std::string Generator::GeneratorImpl::generateEquationCode(const AnalyserEquationPtr &equation,
-                                                           std::vector<AnalyserEquationPtr> &remainingEquations)
+bool Generator::containsLookupTable(const VariablePtr &variable) const
 {
-    std::vector<AnalyserEquationPtr> dummyEquationsForComputeVariables;
-
-    return generateEquationCode(equation, remainingEquations, dummyEquationsForComputeVariables);
+    return mPimpl->findLookupTable(variable) != mPimpl->mLookupTables.end();
 }
 
-void Generator::GeneratorImpl::addInterfaceComputeModelMethodsCode()
+size_t Generator::lookupTableCount() const
 {
-    auto interfaceInitialiseVariablesMethodString = mProfile->interfaceInitialiseVariablesMethodString(modelHasOdes(),
-                                                                                                       mModel->hasExternalVariables());
-    std::string interfaceComputeModelMethodsCode;
+    return mPimpl->mLookupTables.size();
+}
 
-    if (!interfaceInitialiseVariablesMethodString.empty()) {
-        interfaceComputeModelMethodsCode += interfaceInitialiseVariablesMethodString;
-    }
+bool Generator::hasConstantSpecialisation() const
+{
+    return mPimpl->mConstantSpecialisation;
+}
 
-    if (!mProfile->interfaceComputeComputedConstantsMethodString().empty()) {
-        interfaceComputeModelMethodsCode += mProfile->interfaceComputeComputedConstantsMethodString();
-    }
+void Generator::setConstantSpecialisation(bool constantSpecialisation)
+{
+    mPimpl->mConstantSpecialisation = constantSpecialisation;
 
-    auto interfaceComputeRatesMethodString = mProfile->interfaceComputeRatesMethodString(mModel->hasExternalVariables());
+    ++mPimpl->mOptionsVersion;
+}
 
-    if (modelHasOdes()
-        && !interfaceComputeRatesMethodString.empty()) {
-        interfaceComputeModelMethodsCode += interfaceComputeRatesMethodString;
+bool Generator::addConstantOverride(const VariablePtr &variable, double value)
+{
+    if (variable == nullptr) {
+        return false;
     }
 
-    auto interfaceComputeVariablesMethodString = mProfile->interfaceComputeVariablesMethodString(modelHasOdes(),
-                                                                                                 mModel->hasExternalVariables());
-
-    if (!interfaceComputeVariablesMethodString.empty()) {
-        interfaceComputeModelMethodsCode += interfaceComputeVariablesMethodString;
+    if (!mPimpl->mConstantOverrides.emplace(variable, value).second) {
+        return false;
     }
 
-    if (!interfaceComputeModelMethodsCode.empty()) {
-        mCode += "\n";
-    }
+    ++mPimpl->mOptionsVersion;
 
-    mCode += interfaceComputeModelMethodsCode;
+    return true;
 }
 
-void Generator::GeneratorImpl::addImplementationInitialiseVariablesMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations)
+bool Generator::removeConstantOverride(const VariablePtr &variable)
 {
-    auto implementationInitialiseVariablesMethodString = mProfile->implementationInitialiseVariablesMethodString(modelHasOdes(),
-                                                                                                                 mModel->hasExternalVariables());
-
-    if (!implementationInitialiseVariablesMethodString.empty()) {
-        // Initialise our constants and our algebraic variables that have an
-        // initial value. Also use an initial guess of zero for computed
-        // constants and algebraic variables computed using an NLA system.
-        // Note: a variable which is the only unknown in an equation, but which
-        //       is not on its own on either the LHS or RHS of that equation
-        //       (e.g., x = y+z with x and y known and z unknown) is (currently)
-        //       to be computed using an NLA system for which we need an initial
-        //       guess. We use an initial guess of zero, which is fine since
-        //       such an NLA system has only one solution.
+    if (mPimpl->mConstantOverrides.erase(variable) == 0) {
+        return false;
+    }
 
-        std::string methodBody;
+    ++mPimpl->mOptionsVersion;
 
-        for (const auto &variable : mModel->variables()) {
-            switch (variable->type()) {
-            case AnalyserVariable::Type::CONSTANT:
-                methodBody += generateInitialisationCode(variable);
+    return true;
+}
 
-                break;
-            case AnalyserVariable::Type::COMPUTED_CONSTANT:
-            case AnalyserVariable::Type::ALGEBRAIC:
-                if (variable->initialisingVariable() != nullptr) {
-                    methodBody += generateInitialisationCode(variable);
-                } else if (variable->equation(0)->type() == AnalyserEquation::Type::NLA) {
-                    methodBody += generateZeroInitialisationCode(variable);
-                }
+void Generator::removeAllConstantOverrides()
+{
+    mPimpl->mConstantOverrides.clear();
 
-                break;
-            default: // Other types we don't care about.
-                break;
-            }
-        }
+    ++mPimpl->mOptionsVersion;
+}
 
-        // Initialise our true constants.
+bool Generator::containsConstantOverride(const VariablePtr &variable) const
+{
+    return mPimpl->mConstantOverrides.find(variable) != mPimpl->mConstantOverrides.end();
+}
 
-        for (const auto &equation : mModel->equations()) {
-            if (equation->type() == AnalyserEquation::Type::TRUE_CONSTANT) {
-                methodBody += generateEquationCode(equation, remainingEquations);
-            }
-        }
+size_t Generator::constantOverrideCount() const
+{
+    return mPimpl->mConstantOverrides.size();
+}
 
-        // Initialise our states.
+bool Generator::addEnsembleParameter(const VariablePtr &variable)
+{
+    if ((variable == nullptr)
+        || (std::find(mPimpl->mEnsembleParameters.begin(), mPimpl->mEnsembleParameters.end(), variable) != mPimpl->mEnsembleParameters.end())) {
+        return false;
+    }
 
-        for (const auto &state : mModel->states()) {
-            methodBody += generateInitialisationCode(state);
-        }
+    mPimpl->mEnsembleParameters.push_back(variable);
 
-        // Use an initial guess of zero for rates computed using an NLA system
-        // (see the note above).
+    ++mPimpl->mOptionsVersion;
 
-        for (const auto &state : mModel->states()) {
-            if (state->equation(0)->type() == AnalyserEquation::Type::NLA) {
-                methodBody += generateZeroInitialisationCode(state);
-            }
-        }
+    return true;
+}
 
-        // Initialise our external variables.
+bool Generator::removeEnsembleParameter(const VariablePtr &variable)
+{
+    auto ensembleParameter = std::find(mPimpl->mEnsembleParameters.begin(), mPimpl->mEnsembleParameters.end(), variable);
 
-        if (mModel->hasExternalVariables()) {
-            auto equations = mModel->equations();
-            std::vector<AnalyserEquationPtr> remainingExternalEquations;
+    if (ensembleParameter == mPimpl->mEnsembleParameters.end()) {
+        return false;
+    }
 
-            std::copy_if(equations.begin(), equations.end(),
-                         std::back_inserter(remainingExternalEquations),
-                         [](const AnalyserEquationPtr &equation) { return equation->type() == AnalyserEquation::Type::EXTERNAL; });
+    mPimpl->mEnsembleParameters.erase(ensembleParameter);
 
-            for (const auto &equation : mModel->equations()) {
-                if (equation->type() == AnalyserEquation::Type::EXTERNAL) {
-                    methodBody += generateEquationCode(equation, remainingExternalEquations);
-                }
-            }
-        }
+    ++mPimpl->mOptionsVersion;
 
-        mCode += newLineIfNeeded()
-                 + replace(implementationInitialiseVariablesMethodString,
-                           "[CODE]", generateMethodBodyCode(methodBody));
-    }
+    return true;
 }
 
-void Generator::GeneratorImpl::addImplementationComputeComputedConstantsMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations)
+void Generator::removeAllEnsembleParameters()
 {
-    if (!mProfile->implementationComputeComputedConstantsMethodString().empty()) {
-        std::string methodBody;
+    mPimpl->mEnsembleParameters.clear();
 
-        for (const auto &equation : mModel->equations()) {
-            if (equation->type() == AnalyserEquation::Type::VARIABLE_BASED_CONSTANT) {
-                methodBody += generateEquationCode(equation, remainingEquations);
-            }
-        }
+    ++mPimpl->mOptionsVersion;
+}
 
-        mCode += newLineIfNeeded()
-                 + replace(mProfile->implementationComputeComputedConstantsMethodString(),
-                           "[CODE]", generateMethodBodyCode(methodBody));
-    }
+bool Generator::containsEnsembleParameter(const VariablePtr &variable) const
+{
+    return std::find(mPimpl->mEnsembleParameters.begin(), mPimpl->mEnsembleParameters.end(), variable) != mPimpl->mEnsembleParameters.end();
 }
 
-void Generator::GeneratorImpl::addImplementationComputeRatesMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations)
+size_t Generator::ensembleParameterCount() const
 {
-    auto implementationComputeRatesMethodString = mProfile->implementationComputeRatesMethodString(mModel->hasExternalVariables());
+    return mPimpl->mEnsembleParameters.size();
+}
 
-    if (modelHasOdes()
-        && !implementationComputeRatesMethodString.empty()) {
-        std::string methodBody;
+bool Generator::addSensitivityParameter(const VariablePtr &variable)
+{
+    if ((variable == nullptr)
+        || (std::find(mPimpl->mSensitivityParameters.begin(), mPimpl->mSensitivityParameters.end(), variable) != mPimpl->mSensitivityParameters.end())) {
+        return false;
+    }
 
-        for (const auto &equation : mModel->equations()) {
-            // A rate is computed either through an ODE equation or through an
-            // NLA equation in case the rate is not on its own on either the LHS
-            // or RHS of the equation.
+    mPimpl->mSensitivityParameters.push_back(variable);
 
-            if ((equation->type() == AnalyserEquation::Type::ODE)
-                || ((equation->type() == AnalyserEquation::Type::NLA)
-                    && (equation->variableCount() == 1)
-                    && (equation->variable(0)->type() == AnalyserVariable::Type::STATE))) {
-                methodBody += generateEquationCode(equation, remainingEquations);
-            }
-        }
+    ++mPimpl->mOptionsVersion;
 
-        mCode += newLineIfNeeded()
-                 + replace(implementationComputeRatesMethodString,
-                           "[CODE]", generateMethodBodyCode(methodBody));
-    }
+    return true;
 }
 
-void Generator::GeneratorImpl::addImplementationComputeVariablesMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations)
+bool Generator::removeSensitivityParameter(const VariablePtr &variable)
 {
-    auto implementationComputeVariablesMethodString = mProfile->implementationComputeVariablesMethodString(modelHasOdes(),
-                                                                                                           mModel->hasExternalVariables());
+    auto sensitivityParameter = std::find(mPimpl->mSensitivityParameters.begin(), mPimpl->mSensitivityParameters.end(), variable);
 
-    if (!implementationComputeVariablesMethodString.empty()) {
-        std::string methodBody;
-        auto equations = mModel->equations();
-        std::vector<AnalyserEquationPtr> newRemainingEquations {std::begin(equations), std::end(equations)};
+    if (sensitivityParameter == mPimpl->mSensitivityParameters.end()) {
+        return false;
+    }
 
-        for (const auto &equation : equations) {
-            if ((std::find(remainingEquations.begin(), remainingEquations.end(), equation) != remainingEquations.end())
-                || isToBeComputedAgain(equation)) {
-                methodBody += generateEquationCode(equation, newRemainingEquations, remainingEquations);
-            }
-        }
+    mPimpl->mSensitivityParameters.erase(sensitivityParameter);
 
-        mCode += newLineIfNeeded()
-                 + replace(implementationComputeVariablesMethodString,
-                           "[CODE]", generateMethodBodyCode(methodBody));
-    }
-}
+    ++mPimpl->mOptionsVersion;
 
-Generator::Generator()
-    : mPimpl(new GeneratorImpl())
-{
+    return true;
 }
 
-Generator::~Generator()
+void Generator::removeAllSensitivityParameters()
 {
-    delete mPimpl;
-}
+    mPimpl->mSensitivityParameters.clear();
 
-GeneratorPtr Generator::create() noexcept
-{
-    return std::shared_ptr<Generator> {new Generator {}};
+    ++mPimpl->mOptionsVersion;
 }
 
-GeneratorProfilePtr Generator::profile()
+bool Generator::containsSensitivityParameter(const VariablePtr &variable) const
 {
-    return mPimpl->mProfile;
+    return std::find(mPimpl->mSensitivityParameters.begin(), mPimpl->mSensitivityParameters.end(), variable) != mPimpl->mSensitivityParameters.end();
 }
 
-void Generator::setProfile(const GeneratorProfilePtr &profile)
+size_t Generator::sensitivityParameterCount() const
 {
-    mPimpl->mProfile = profile;
+    return mPimpl->mSensitivityParameters.size();
 }
 
-AnalyserModelPtr Generator::model()
+size_t Generator::implementationChunkCount() const
 {
-    return mPimpl->mModel;
+    return mPimpl->mImplementationChunkCount;
 }
 
-void Generator::setModel(const AnalyserModelPtr &model)
+void Generator::setImplementationChunkCount(size_t implementationChunkCount)
 {
-    mPimpl->mModel = model;
+    mPimpl->mImplementationChunkCount = implementationChunkCount;
+
+    ++mPimpl->mOptionsVersion;
 }
 
 std::string Generator::interfaceCode() const
@@ -2018,6 +4588,9 @@ std::string Generator::interfaceCode() const
     // Get ourselves ready.
 
     mPimpl->reset();
+    mPimpl->prepareLookupTables();
+    mPimpl->prepareEnsembleParameters();
+    mPimpl->prepareSensitivityParameters();
 
     // Add code for the origin comment.
 
@@ -2057,6 +4630,16 @@ std::string Generator::interfaceCode() const
 
     mPimpl->addInterfaceComputeModelMethodsCode();
 
+    // Add code for the interface to integrate the model using a fixed-step
+    // method, if requested.
+
+    mPimpl->addInterfaceIntegrateMethodsCode();
+
+    // Add code for the interface to initialise and compute an ensemble of
+    // instances of the model, if requested.
+
+    mPimpl->addInterfaceEnsembleMethodsCode();
+
     return mPimpl->mCode;
 }
 
@@ -2071,6 +4654,12 @@ std::string Generator::implementationCode() const
     // Get ourselves ready.
 
     mPimpl->reset();
+    mPimpl->prepareLookupTables();
+    mPimpl->prepareEnsembleParameters();
+    mPimpl->prepareSensitivityParameters();
+    mPimpl->prepareSpecialisedConstants();
+
+    mPimpl->mImplementationChunks.assign(mPimpl->mImplementationChunkCount, {});
 
     // Add code for the origin comment.
 
@@ -2080,6 +4669,11 @@ std::string Generator::implementationCode() const
 
     mPimpl->addImplementationHeaderCode();
 
+    // Begin the namespace in which our implementation code is to be generated,
+    // if any.
+
+    mPimpl->addImplementationNamespaceCode(true);
+
     // Add code for the implementation of the version of the profile and
     // libCellML.
 
@@ -2094,6 +4688,7 @@ std::string Generator::implementationCode() const
     if (!mPimpl->mProfile->hasInterface()) {
         mPimpl->addVariableTypeObjectCode();
         mPimpl->addVariableInfoObjectCode();
+        mPimpl->addExternalVariableMethodTypeDefinitionCode();
     }
 
     // Add code for the implementation of the information about the variable of
@@ -2103,6 +4698,10 @@ std::string Generator::implementationCode() const
     mPimpl->addImplementationStateInfoCode();
     mPimpl->addImplementationVariableInfoCode();
 
+    // Add code for our lookup tables, if any.
+
+    mPimpl->addLookupTableDeclarationsCode();
+
     // Add code for the arithmetic and trigonometric functions.
 
     mPimpl->addArithmeticFunctionsCode();
@@ -2120,10 +4719,13 @@ std::string Generator::implementationCode() const
     mPimpl->addExternNlaSolveMethodCode();
     mPimpl->addNlaSystemsCode();
 
+    // Add code for the method to get a value from a lookup table, if needed.
+
+    mPimpl->addLookupTableValueMethodCode();
+
     // Add code for the implementation to initialise our variables.
 
-    auto equations = mPimpl->mModel->equations();
-    std::vector<AnalyserEquationPtr> remainingEquations {std::begin(equations), std::end(equations)};
+    std::vector<bool> remainingEquations(mPimpl->modelEquations().size(), true);
 
     mPimpl->addImplementationInitialiseVariablesMethodCode(remainingEquations);
 
@@ -2131,11 +4733,20 @@ std::string Generator::implementationCode() const
 
     mPimpl->addImplementationComputeComputedConstantsMethodCode(remainingEquations);
 
+    // Add code for the implementation to initialise our lookup tables, if any.
+
+    mPimpl->addImplementationInitialiseLookupTablesMethodCode();
+
     // Add code for the implementation to compute our rates (and any variables
     // on which they depend).
 
     mPimpl->addImplementationComputeRatesMethodCode(remainingEquations);
 
+    // Add code for the implementation to compute the Rush-Larsen coefficients
+    // of our gating variables, if requested.
+
+    mPimpl->addImplementationComputeRushLarsenCoefficientsMethodCode();
+
     // Add code for the implementation to compute our variables.
     // Note: this method computes the remaining variables, i.e. the ones not
     //       needed to compute our rates, but also the variables that depend on
@@ -2146,6 +4757,63 @@ std::string Generator::implementationCode() const
 
     mPimpl->addImplementationComputeVariablesMethodCode(remainingEquations);
 
+    // Add code for the implementation to integrate the model using a
+    // fixed-step method, if requested.
+
+    mPimpl->addImplementationIntegrateMethodsCode();
+
+    // Add code for the implementation to initialise and compute an ensemble
+    // of instances of the model, if requested.
+
+    mPimpl->addImplementationEnsembleMethodsCode();
+
+    // End the namespace in which our implementation code was generated, if
+    // any.
+
+    mPimpl->addImplementationNamespaceCode(false);
+
+    // Keep track of how our chunk methods were generated, so that they can be
+    // reused by implementationChunkCode().
+
+    mPimpl->cacheImplementationChunks();
+
+    return mPimpl->mCode;
+}
+
+std::string Generator::implementationChunkCode(size_t index) const
+{
+    if ((mPimpl->mProfile == nullptr)
+        || !mPimpl->mProfile->hasInterface()
+        || (index >= mPimpl->mImplementationChunkCount)) {
+        return {};
+    }
+
+    // Generate our implementation code, so that we know about our chunk
+    // methods, unless it was last generated with our current model, profile,
+    // and options, in which case we can reuse its chunk methods.
+
+    if (!mPimpl->hasCachedImplementationChunks()
+        && implementationCode().empty()) {
+        return {};
+    }
+
+    // Add code for the chunk methods of the given chunk, preceded by the origin
+    // comment and the header.
+
+    const auto &chunkMethods = mPimpl->mImplementationChunks[index];
+
+    mPimpl->mCode = {};
+
+    mPimpl->addOriginCommentCode();
+    mPimpl->addImplementationHeaderCode();
+    mPimpl->addImplementationNamespaceCode(true);
+
+    for (const auto &chunkMethod : chunkMethods) {
+        mPimpl->mCode += mPimpl->newLineIfNeeded() + chunkMethod;
+    }
+
+    mPimpl->addImplementationNamespaceCode(false);
+
     return mPimpl->mCode;
 }
 
@@ -2158,6 +4826,8 @@ std::string Generator::equationCode(const AnalyserEquationAstPtr &ast,
         generator->setProfile(generatorProfile);
     }
 
+    generator->mPimpl->retrieveProfileTemplates();
+
     return generator->mPimpl->generateCode(ast);
 }
 
@@ -18,8 +18,14 @@ limitations under the License.
 
 #include "libcellml/generator.h"
 
+#include "libcellml/analysermodel.h"
 #include "libcellml/generatorprofile.h"
 
+#include <unordered_set>
+
+#include "generatorprofile_p.h"
+#include "generatorprofiletools.h"
+
 #include "utilities.h"
 
 namespace libcellml {
@@ -31,17 +37,114 @@ namespace libcellml {
  */
 struct Generator::GeneratorImpl
 {
+    struct LookupTable
+    {
+        VariablePtr mVariable;
+        double mMinimum;
+        double mMaximum;
+        double mStep;
+    };
+
+    struct UsedLookupTable
+    {
+        AnalyserVariablePtr mState;
+        double mMinimum;
+        double mStep;
+        size_t mSize;
+        std::vector<AnalyserEquationPtr> mEquations;
+    };
+
     AnalyserModelPtr mModel;
 
+    std::unordered_map<Variable *, AnalyserVariablePtr> mAnalyserVariables;
+    std::vector<std::vector<size_t>> mEquationDependencies;
+    std::vector<std::vector<size_t>> mEquationNlaSiblings;
+
+    std::vector<LookupTable> mLookupTables;
+    std::vector<UsedLookupTable> mUsedLookupTables;
+    std::map<AnalyserEquationPtr, std::pair<size_t, size_t>> mLookupTableEquations;
+
+    bool mConstantSpecialisation = false;
+    std::map<VariablePtr, double> mConstantOverrides;
+    std::unordered_map<AnalyserVariable *, double> mSpecialisedConstantValues;
+
+    std::vector<VariablePtr> mEnsembleParameters;
+    std::vector<AnalyserVariablePtr> mUsedEnsembleParameters;
+    bool mEnsembleInUse = false;
+
+    std::vector<VariablePtr> mSensitivityParameters;
+    std::vector<AnalyserVariablePtr> mUsedSensitivityParameters;
+    std::vector<size_t> mSensitivityEquations;
+    bool mSensitivitiesNeedLtFunction = false;
+
+    bool mLocalVariablesInUse = false;
+    std::vector<bool> mLocalEquations;
+    std::vector<bool> mLocalVariables;
+
+    size_t mImplementationChunkCount = 0;
+    std::vector<std::pair<size_t, bool>> *mEquationStatements = nullptr;
+    std::vector<std::vector<std::string>> mImplementationChunks;
+
+    size_t mOptionsVersion = 0;
+    AnalyserModelPtr mImplementationChunksModel;
+    GeneratorProfilePtr mImplementationChunksProfile;
+    size_t mImplementationChunksProfileVersion = 0;
+    size_t mImplementationChunksOptionsVersion = 0;
+
     std::string mCode;
 
     GeneratorProfilePtr mProfile = GeneratorProfile::create();
 
+    const ProfileTemplate *mPiecewiseIfTemplate = nullptr;
+    const ProfileTemplate *mPiecewiseElseTemplate = nullptr;
+    const ProfileTemplate *mVariableInfoEntryTemplate = nullptr;
+    const ProfileTemplate *mExternalVariableMethodCallTemplate = nullptr;
+    const ProfileTemplate *mFindRootCallTemplate = nullptr;
+    const ProfileTemplate *mLookupTableValueCallTemplate = nullptr;
+    const ProfileTemplate *mLocalVariableNameTemplate = nullptr;
+
     void reset();
 
+    void cacheImplementationChunks();
+    bool hasCachedImplementationChunks() const;
+
+    const ProfileTemplate &profileTemplate(const std::string &string,
+                                           const std::vector<std::string> &tags) const;
+    void retrieveProfileTemplates();
+    void indexModel();
+
+    const std::vector<AnalyserVariablePtr> &modelStates() const;
+    const std::vector<AnalyserVariablePtr> &modelVariables() const;
+    const std::vector<AnalyserEquationPtr> &modelEquations() const;
+
+    std::vector<LookupTable>::const_iterator findLookupTable(const VariablePtr &variable) const;
+
+    void prepareLookupTables();
+    void prepareEnsembleParameters();
+
+    bool hasAstOfType(const AnalyserEquationAstPtr &ast,
+                      const std::vector<AnalyserEquationAst::Type> &types) const;
+    bool prepareSensitivityEquations(size_t equationIndex,
+                                     std::vector<bool> &visitedEquations);
+    void prepareSensitivityParameters();
+
+    bool evaluateCode(const AnalyserEquationAstPtr &ast,
+                      std::unordered_set<AnalyserVariable *> &visitedConstants,
+                      double &value);
+    bool specialisedConstantValue(const AnalyserVariablePtr &variable,
+                                  std::unordered_set<AnalyserVariable *> &visitedConstants,
+                                  double &value);
+    void prepareSpecialisedConstants();
+
+    void markAstVariables(const AnalyserEquationAstPtr &ast,
+                          std::vector<bool> &variables) const;
+    void prepareLocalVariables(const std::vector<bool> &remainingEquations);
+
     bool modelHasOdes() const;
     bool modelHasNlas() const;
 
+    size_t stateCount() const;
+
     AnalyserVariablePtr analyserVariable(const VariablePtr &variable) const;
 
     double scalingFactor(const VariablePtr &variable) const;
@@ -61,10 +164,20 @@ struct Generator::GeneratorImpl
     bool isRootOperator(const AnalyserEquationAstPtr &ast) const;
     bool isPiecewiseStatement(const AnalyserEquationAstPtr &ast) const;
 
+    void updateVariableInfoSizes(size_t &componentSize, size_t &nameSize,
+                                 size_t &unitsSize,
+                                 const std::string &component,
+                                 const std::string &name,
+                                 const std::string &units) const;
     void updateVariableInfoSizes(size_t &componentSize, size_t &nameSize,
                                  size_t &unitsSize,
                                  const AnalyserVariablePtr &variable) const;
 
+    std::string sensitivityName(const AnalyserVariablePtr &variable,
+                                const AnalyserVariablePtr &parameter) const;
+    std::string sensitivityUnits(const AnalyserVariablePtr &variable,
+                                 const AnalyserVariablePtr &parameter) const;
+
     bool modifiedProfile() const;
 
     std::string newLineIfNeeded();
@@ -73,6 +186,7 @@ struct Generator::GeneratorImpl
 
     void addInterfaceHeaderCode();
     void addImplementationHeaderCode();
+    void addImplementationNamespaceCode(bool begin);
 
     void addVersionAndLibcellmlVersionCode(bool interface = false);
 
@@ -84,10 +198,11 @@ struct Generator::GeneratorImpl
 
     void addVariableInfoObjectCode();
 
-    std::string generateVariableInfoEntryCode(const std::string &name,
-                                              const std::string &units,
-                                              const std::string &component,
-                                              const std::string &type) const;
+    void generateVariableInfoEntryCode(const std::string &name,
+                                       const std::string &units,
+                                       const std::string &component,
+                                       const std::string &type,
+                                       std::string &code) const;
 
     void addInterfaceVoiStateAndVariableInfoCode();
     void addImplementationVoiInfoCode();
@@ -107,41 +222,89 @@ struct Generator::GeneratorImpl
     void addExternNlaSolveMethodCode();
     void addNlaSystemsCode();
 
+    void addLookupTableDeclarationsCode();
+    void addLookupTableValueMethodCode();
+
     std::string generateMethodBodyCode(const std::string &methodBody) const;
+    void addMethodCode(const std::string &methodString,
+                       const std::string &methodBody);
 
     std::string generateDoubleCode(const std::string &value) const;
+    std::string generateSpecialisedConstantCode(double value,
+                                                bool parentheses = true) const;
     std::string generateDoubleOrConstantVariableNameCode(const VariablePtr &variable) const;
     std::string generateVariableNameCode(const VariablePtr &variable,
                                          bool state = true) const;
 
-    std::string generateOperatorCode(const std::string &op,
-                                     const AnalyserEquationAstPtr &ast) const;
-    std::string generateMinusUnaryCode(const AnalyserEquationAstPtr &ast) const;
-    std::string generateOneParameterFunctionCode(const std::string &function,
-                                                 const AnalyserEquationAstPtr &ast) const;
-    std::string generateTwoParameterFunctionCode(const std::string &function,
-                                                 const AnalyserEquationAstPtr &ast) const;
-    std::string generatePiecewiseIfCode(const std::string &condition,
-                                        const std::string &value) const;
-    std::string generatePiecewiseElseCode(const std::string &value) const;
+    void generateOperatorCode(const std::string &op,
+                              const AnalyserEquationAstPtr &ast,
+                              std::string &code) const;
+    void generateBranchCode(const AnalyserEquationAstPtr &ast,
+                            bool parentheses,
+                            std::string &code) const;
+    void generateMinusUnaryCode(const AnalyserEquationAstPtr &ast,
+                                std::string &code) const;
+    void generateOneParameterFunctionCode(const std::string &function,
+                                          const AnalyserEquationAstPtr &ast,
+                                          std::string &code) const;
+    void generateTwoParameterFunctionCode(const std::string &function,
+                                          const AnalyserEquationAstPtr &ast,
+                                          std::string &code) const;
+    void generatePiecewiseIfCode(const std::string &condition,
+                                 const std::string &value,
+                                 std::string &code) const;
+    void generatePiecewiseElseCode(const std::string &value,
+                                   std::string &code) const;
     std::string generateCode(const AnalyserEquationAstPtr &ast) const;
+    void generateCode(const AnalyserEquationAstPtr &ast,
+                      std::string &code) const;
 
     bool isToBeComputedAgain(const AnalyserEquationPtr &equation) const;
     bool isSomeConstant(const AnalyserEquationPtr &equation) const;
 
+    void generateLookupTableValueCallCode(size_t tableIndex, size_t column,
+                                          std::string &code) const;
+
     std::string generateZeroInitialisationCode(const AnalyserVariablePtr &variable) const;
     std::string generateInitialisationCode(const AnalyserVariablePtr &variable) const;
-    std::string generateEquationCode(const AnalyserEquationPtr &equation,
-                                     std::vector<AnalyserEquationPtr> &remainingEquations,
-                                     std::vector<AnalyserEquationPtr> &equationsForComputeVariables);
-    std::string generateEquationCode(const AnalyserEquationPtr &equation,
-                                     std::vector<AnalyserEquationPtr> &remainingEquations);
+    void generateEquationCode(size_t equationIndex,
+                              std::vector<bool> &remainingEquations,
+                              const std::vector<bool> *equationsForComputeVariables,
+                              std::string &code);
+    void generateEquationCode(size_t equationIndex,
+                              std::vector<bool> &remainingEquations,
+                              std::string &code);
+
+    bool isChunkableEquation(const AnalyserEquationPtr &equation) const;
+    std::string generateChunkedMethodBodyCode(const std::string &methodString,
+                                              const std::string &interfaceMethodString,
+                                              const std::string &methodBody,
+                                              const std::vector<std::pair<size_t, bool>> &equationStatements);
 
     void addInterfaceComputeModelMethodsCode();
-    void addImplementationInitialiseVariablesMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations);
-    void addImplementationComputeComputedConstantsMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations);
-    void addImplementationComputeRatesMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations);
-    void addImplementationComputeVariablesMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations);
+    void addImplementationInitialiseVariablesMethodCode(std::vector<bool> &remainingEquations);
+    void addImplementationComputeComputedConstantsMethodCode(std::vector<bool> &remainingEquations);
+    void addImplementationInitialiseLookupTablesMethodCode();
+    AnalyserEquationAstPtr sensitivityAst(const AnalyserEquationAstPtr &ast,
+                                          const AnalyserVariablePtr &parameter,
+                                          const std::unordered_map<AnalyserVariable *, std::string> &sensitivities) const;
+    std::string generateSensitivitiesCode() const;
+
+    void addImplementationComputeRatesMethodCode(std::vector<bool> &remainingEquations);
+    void addImplementationComputeRushLarsenCoefficientsMethodCode();
+    void addImplementationComputeVariablesMethodCode(std::vector<bool> &remainingEquations);
+
+    bool hasIntegrateMethods() const;
+    bool hasIntegrateRushLarsenMethod() const;
+    void addInterfaceIntegrateMethodsCode();
+    void addImplementationIntegrateMethodsCode();
+
+    std::string generateEnsembleMethodCode(const std::string &methodString) const;
+    bool generateEnsembleInitialisationCode(const AnalyserVariablePtr &variable,
+                                            std::unordered_map<AnalyserVariable *, bool> &ensembleDependentVariables,
+                                            std::string &code) const;
+    void addInterfaceEnsembleMethodsCode();
+    void addImplementationEnsembleMethodsCode();
 };
 
 } // namespace libcellml
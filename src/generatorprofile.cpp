@@ -21,292 +21,38 @@ limitations under the License.
 #include "libcellml/generatorprofile.h"
 
 #include <cmath>
+#include <regex>
 
+#include "generatorprofile_p.h"
 #include "utilities.h"
 
 namespace libcellml {
 
-/**
- * @brief The GeneratorProfile::GeneratorProfileImpl struct.
- *
- * The private implementation for the GeneratorProfile class.
- */
-struct GeneratorProfile::GeneratorProfileImpl
+void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profile profile)
 {
-    // Whether the profile is official.
-
-    GeneratorProfile::Profile mProfile = Profile::C;
-
-    // Whether the profile requires an interface to be generated.
-
-    bool mHasInterface = true;
-
-    // Equality.
-
-    std::string mEqualityString;
-
-    // Relational and logical operators.
-
-    std::string mEqString;
-    std::string mNeqString;
-    std::string mLtString;
-    std::string mLeqString;
-    std::string mGtString;
-    std::string mGeqString;
-    std::string mAndString;
-    std::string mOrString;
-    std::string mXorString;
-    std::string mNotString;
-
-    bool mHasEqOperator = true;
-    bool mHasNeqOperator = true;
-    bool mHasLtOperator = true;
-    bool mHasLeqOperator = true;
-    bool mHasGtOperator = true;
-    bool mHasGeqOperator = true;
-    bool mHasAndOperator = true;
-    bool mHasOrOperator = true;
-    bool mHasXorOperator = true;
-    bool mHasNotOperator = true;
-
-    // Arithmetic operators.
-
-    std::string mPlusString;
-    std::string mMinusString;
-    std::string mTimesString;
-    std::string mDivideString;
-    std::string mPowerString;
-    std::string mSquareRootString;
-    std::string mSquareString;
-    std::string mAbsoluteValueString;
-    std::string mExponentialString;
-    std::string mNaturalLogarithmString;
-    std::string mCommonLogarithmString;
-    std::string mCeilingString;
-    std::string mFloorString;
-    std::string mMinString;
-    std::string mMaxString;
-    std::string mRemString;
-
-    bool mHasPowerOperator = false;
-
-    // Trigonometric operators.
-
-    std::string mSinString;
-    std::string mCosString;
-    std::string mTanString;
-    std::string mSecString;
-    std::string mCscString;
-    std::string mCotString;
-    std::string mSinhString;
-    std::string mCoshString;
-    std::string mTanhString;
-    std::string mSechString;
-    std::string mCschString;
-    std::string mCothString;
-    std::string mAsinString;
-    std::string mAcosString;
-    std::string mAtanString;
-    std::string mAsecString;
-    std::string mAcscString;
-    std::string mAcotString;
-    std::string mAsinhString;
-    std::string mAcoshString;
-    std::string mAtanhString;
-    std::string mAsechString;
-    std::string mAcschString;
-    std::string mAcothString;
-
-    // Piecewise statement.
-
-    std::string mConditionalOperatorIfString;
-    std::string mConditionalOperatorElseString;
-    std::string mPiecewiseIfString;
-    std::string mPiecewiseElseString;
-
-    bool mHasConditionalOperator = true;
-
-    // Constants.
-
-    std::string mTrueString;
-    std::string mFalseString;
-    std::string mEString;
-    std::string mPiString;
-    std::string mInfString;
-    std::string mNanString;
-
-    // Arithmetic functions.
-
-    std::string mEqFunctionString;
-    std::string mNeqFunctionString;
-    std::string mLtFunctionString;
-    std::string mLeqFunctionString;
-    std::string mGtFunctionString;
-    std::string mGeqFunctionString;
-    std::string mAndFunctionString;
-    std::string mOrFunctionString;
-    std::string mXorFunctionString;
-    std::string mNotFunctionString;
-    std::string mMinFunctionString;
-    std::string mMaxFunctionString;
-
-    // Trigonometric functions.
-
-    std::string mSecFunctionString;
-    std::string mCscFunctionString;
-    std::string mCotFunctionString;
-    std::string mSechFunctionString;
-    std::string mCschFunctionString;
-    std::string mCothFunctionString;
-    std::string mAsecFunctionString;
-    std::string mAcscFunctionString;
-    std::string mAcotFunctionString;
-    std::string mAsechFunctionString;
-    std::string mAcschFunctionString;
-    std::string mAcothFunctionString;
-
-    // Miscellaneous.
-
-    std::string mCommentString;
-    std::string mOriginCommentString;
-
-    std::string mInterfaceFileNameString;
-
-    std::string mInterfaceHeaderString;
-    std::string mImplementationHeaderString;
-
-    std::string mInterfaceVersionString;
-    std::string mImplementationVersionString;
-
-    std::string mInterfaceLibcellmlVersionString;
-    std::string mImplementationLibcellmlVersionString;
-
-    std::string mInterfaceStateCountString;
-    std::string mImplementationStateCountString;
-
-    std::string mInterfaceVariableCountString;
-    std::string mImplementationVariableCountString;
-
-    std::string mVariableTypeObjectFamWoevString;
-    std::string mVariableTypeObjectFamWevString;
-    std::string mVariableTypeObjectFdmWoevString;
-    std::string mVariableTypeObjectFdmWevString;
-
-    std::string mVariableOfIntegrationVariableTypeString;
-    std::string mStateVariableTypeString;
-    std::string mConstantVariableTypeString;
-    std::string mComputedConstantVariableTypeString;
-    std::string mAlgebraicVariableTypeString;
-    std::string mExternalVariableTypeString;
-
-    std::string mVariableInfoObjectString;
-
-    std::string mInterfaceVoiInfoString;
-    std::string mImplementationVoiInfoString;
-
-    std::string mInterfaceStateInfoString;
-    std::string mImplementationStateInfoString;
-
-    std::string mInterfaceVariableInfoString;
-    std::string mImplementationVariableInfoString;
-
-    std::string mVariableInfoEntryString;
-
-    std::string mVoiString;
-
-    std::string mStatesArrayString;
-    std::string mRatesArrayString;
-    std::string mVariablesArrayString;
-
-    std::string mExternalVariableMethodTypeDefinitionFamString;
-    std::string mExternalVariableMethodTypeDefinitionFdmString;
-
-    std::string mExternalVariableMethodCallFamString;
-    std::string mExternalVariableMethodCallFdmString;
+    ++mVersion;
 
-    std::string mRootFindingInfoObjectFamString;
-    std::string mRootFindingInfoObjectFdmString;
-    std::string mExternNlaSolveMethodString;
-    std::string mFindRootCallFamString;
-    std::string mFindRootCallFdmString;
-    std::string mFindRootMethodFamString;
-    std::string mFindRootMethodFdmString;
-    std::string mNlaSolveCallFamString;
-    std::string mNlaSolveCallFdmString;
-    std::string mObjectiveFunctionMethodFamString;
-    std::string mObjectiveFunctionMethodFdmString;
-    std::string mUArrayString;
-    std::string mFArrayString;
-
-    std::string mInterfaceCreateStatesArrayMethodString;
-    std::string mImplementationCreateStatesArrayMethodString;
-
-    std::string mInterfaceCreateVariablesArrayMethodString;
-    std::string mImplementationCreateVariablesArrayMethodString;
-
-    std::string mInterfaceDeleteArrayMethodString;
-    std::string mImplementationDeleteArrayMethodString;
-
-    std::string mInterfaceInitialiseVariablesMethodFamWoevString;
-    std::string mImplementationInitialiseVariablesMethodFamWoevString;
-
-    std::string mInterfaceInitialiseVariablesMethodFamWevString;
-    std::string mImplementationInitialiseVariablesMethodFamWevString;
-
-    std::string mInterfaceInitialiseVariablesMethodFdmWoevString;
-    std::string mImplementationInitialiseVariablesMethodFdmWoevString;
-
-    std::string mInterfaceInitialiseVariablesMethodFdmWevString;
-    std::string mImplementationInitialiseVariablesMethodFdmWevString;
-
-    std::string mInterfaceComputeComputedConstantsMethodString;
-    std::string mImplementationComputeComputedConstantsMethodString;
-
-    std::string mInterfaceComputeRatesMethodWoevString;
-    std::string mImplementationComputeRatesMethodWoevString;
-
-    std::string mInterfaceComputeRatesMethodWevString;
-    std::string mImplementationComputeRatesMethodWevString;
-
-    std::string mInterfaceComputeVariablesMethodFamWoevString;
-    std::string mImplementationComputeVariablesMethodFamWoevString;
-
-    std::string mInterfaceComputeVariablesMethodFamWevString;
-    std::string mImplementationComputeVariablesMethodFamWevString;
-
-    std::string mInterfaceComputeVariablesMethodFdmWoevString;
-    std::string mImplementationComputeVariablesMethodFdmWoevString;
-
-    std::string mInterfaceComputeVariablesMethodFdmWevString;
-    std::string mImplementationComputeVariablesMethodFdmWevString;
-
-    std::string mEmptyMethodString;
-
-    std::string mIndentString;
-
-    std::string mOpenArrayInitialiserString;
-    std::string mCloseArrayInitialiserString;
+    mProfile = profile;
 
-    std::string mOpenArrayString;
-    std::string mCloseArrayString;
+    if (profile == GeneratorProfile::Profile::C) {
+        // Whether the profile requires an interface to be generated.
 
-    std::string mArrayElementSeparatorString;
+        mHasInterface = true;
 
-    std::string mStringDelimiterString;
+        // Whether the profile requires a method to compute the Rush-Larsen
+        // coefficients to be generated.
 
-    std::string mCommandSeparatorString;
+        mHasComputeRushLarsenCoefficientsMethod = false;
 
-    void loadProfile(GeneratorProfile::Profile profile);
-};
+        // Whether the profile keeps purely intermediate algebraic variables as
+        // local variables in computeRates().
 
-void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profile profile)
-{
-    mProfile = profile;
+        mHasLocalVariablesInComputeRates = false;
 
-    if (profile == GeneratorProfile::Profile::C) {
-        // Whether the profile requires an interface to be generated.
+        // Whether the profile requires methods to integrate the model using a
+        // fixed-step method to be generated.
 
-        mHasInterface = true;
+        mHasIntegrateMethods = false;
 
         // Equality.
 
@@ -399,6 +145,7 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mPiString = convertToString(M_PI);
         mInfString = "INFINITY";
         mNanString = "NAN";
+        mLiteralSuffixString = "";
 
         // Arithmetic functions.
 
@@ -496,6 +243,10 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                                       "#include <math.h>\n"
                                       "#include <stdlib.h>\n";
 
+        mNamespaceString = "";
+        mImplementationNamespaceBeginString = "";
+        mImplementationNamespaceEndString = "";
+
         mInterfaceVersionString = "extern const char VERSION[];\n";
         mImplementationVersionString = "const char VERSION[] = \"0.5.0\";\n";
 
@@ -508,6 +259,9 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mInterfaceVariableCountString = "extern const size_t VARIABLE_COUNT;\n";
         mImplementationVariableCountString = "const size_t VARIABLE_COUNT = [VARIABLE_COUNT];\n";
 
+        mInterfaceEnsembleParameterCountString = "extern const size_t ENSEMBLE_PARAMETER_COUNT;\n";
+        mImplementationEnsembleParameterCountString = "const size_t ENSEMBLE_PARAMETER_COUNT = [ENSEMBLE_PARAMETER_COUNT];\n";
+
         mVariableTypeObjectFamWoevString = "typedef enum {\n"
                                            "    CONSTANT,\n"
                                            "    COMPUTED_CONSTANT,\n"
@@ -570,6 +324,82 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mRatesArrayString = "rates";
         mVariablesArrayString = "variables";
 
+        mRushLarsenTausArrayString = "taus";
+        mRushLarsenSteadyStatesArrayString = "yInfs";
+        mLocalVariableNameString = "[NAME]_[INDEX]";
+        mLocalVariableDeclarationString = "double ";
+
+        mForwardEulerStateUpdateString = "        states[[INDEX]] += dt*rates[[INDEX]];\n";
+        mRushLarsenStateUpdateString = "        states[[INDEX]] = yInfs[[INDEX]]+(states[[INDEX]]-yInfs[[INDEX]])*exp(-dt/taus[[INDEX]]);\n";
+
+        mSensitivityNameString = "d[NAME]_d[PARAMETER]";
+        mChunkMethodNameString = "[NAME]Chunk[INDEX]";
+
+        mLookupTableDeclarationString = "static double lookupTable[INDEX][[SIZE]];\n";
+        mLookupTableEntryString = "lookupTable[INDEX][[COLUMN_COUNT]*i+[COLUMN]]";
+        mLookupTableValueCallString = "lookupTableValue(lookupTable[INDEX], [COLUMN_COUNT], [COLUMN], [STATE], [MINIMUM], [STEP], [SIZE])";
+        mLookupTableErrorString = "maxError = lookupTableError(maxError, [CODE], [VALUE]);\n";
+        mLookupTableValueMethodString = "static double lookupTableValue(double *table, size_t columnCount, size_t column, double x, double minimum, double step, size_t size)\n"
+                                        "{\n"
+                                        "    double position = (x-minimum)/step;\n"
+                                        "\n"
+                                        "    if (isnan(position)) {\n"
+                                        "        return NAN;\n"
+                                        "    }\n"
+                                        "\n"
+                                        "    if (position <= 0.0) {\n"
+                                        "        return table[column];\n"
+                                        "    }\n"
+                                        "\n"
+                                        "    if (position >= size-1) {\n"
+                                        "        return table[columnCount*(size-1)+column];\n"
+                                        "    }\n"
+                                        "\n"
+                                        "    size_t i = (size_t) position;\n"
+                                        "    double fraction = position-i;\n"
+                                        "\n"
+                                        "    return (1.0-fraction)*table[columnCount*i+column]+fraction*table[columnCount*(i+1)+column];\n"
+                                        "}\n"
+                                        "\n"
+                                        "static double lookupTableError(double maxError, double exactValue, double value)\n"
+                                        "{\n"
+                                        "    if (isnan(maxError) || !isfinite(exactValue)) {\n"
+                                        "        return maxError;\n"
+                                        "    }\n"
+                                        "\n"
+                                        "    double error = fabs(exactValue-value);\n"
+                                        "\n"
+                                        "    return (error <= maxError)?maxError:error;\n"
+                                        "}\n";
+        mLookupTableInitialisationString = "    for (size_t i = 0; i < [SIZE]; ++i) {\n"
+                                           "        double row[[COLUMN_COUNT]];\n"
+                                           "\n"
+                                           "        [STATE] = [MINIMUM]+(i-0.001)*[STEP];\n"
+                                           "\n"
+                                           "[CODE]"
+                                           "\n"
+                                           "        for (size_t j = 0; j < [COLUMN_COUNT]; ++j) {\n"
+                                           "            row[j] = [ENTRY];\n"
+                                           "        }\n"
+                                           "\n"
+                                           "        [STATE] = [MINIMUM]+(i+0.001)*[STEP];\n"
+                                           "\n"
+                                           "[CODE]"
+                                           "\n"
+                                           "        for (size_t j = 0; j < [COLUMN_COUNT]; ++j) {\n"
+                                           "            [ENTRY] = 0.5*(row[j]+[ENTRY]);\n"
+                                           "        }\n"
+                                           "    }\n"
+                                           "\n"
+                                           "    for (size_t i = 0; i < [SIZE]-1; ++i) {\n"
+                                           "        [STATE] = [MINIMUM]+(i+0.5)*[STEP];\n"
+                                           "\n"
+                                           "[ERROR_CODE]"
+                                           "    }\n";
+
+        mEnsembleOpenmpPragmaString = "#pragma omp parallel for schedule(static, [BLOCK_SIZE])\n";
+        mEnsembleParameterAssignmentString = "    variables[[INDEX]] = parameters[[PARAMETER_INDEX]];\n";
+
         mExternalVariableMethodTypeDefinitionFamString = "typedef double (* ExternalVariable)(double *variables, size_t index);\n";
         mExternalVariableMethodTypeDefinitionFdmString = "typedef double (* ExternalVariable)(double voi, double *states, double *rates, double *variables, size_t index);\n";
 
@@ -693,6 +523,160 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                                                      "[CODE]"
                                                      "}\n";
 
+        mInterfaceComputeRushLarsenCoefficientsMethodString = "void computeRushLarsenCoefficients(double voi, double *states, double *variables, double *taus, double *yInfs);\n";
+        mImplementationComputeRushLarsenCoefficientsMethodString = "void computeRushLarsenCoefficients(double voi, double *states, double *variables, double *taus, double *yInfs)\n"
+                                                                   "{\n"
+                                                                   "[CODE]"
+                                                                   "}\n";
+        mImplementationComputeRatesMethodWithLocalVariablesString = "void computeRates(double voi, double * restrict states, double * restrict rates, double * restrict variables)\n"
+                                                                    "{\n"
+                                                                    "[CODE]"
+                                                                    "}\n";
+
+        mInterfaceInitialiseLookupTablesMethodString = "double initialiseLookupTables(double *variables);\n";
+        mImplementationInitialiseLookupTablesMethodString = "double initialiseLookupTables(double *variables)\n"
+                                                            "{\n"
+                                                            "    double *states = createStatesArray();\n"
+                                                            "    double maxError = 0.0;\n"
+                                                            "\n"
+                                                            "[CODE]"
+                                                            "\n"
+                                                            "    deleteArray(states);\n"
+                                                            "\n"
+                                                            "    return maxError;\n"
+                                                            "}\n";
+
+        mInterfaceInitialiseEnsembleMethodString = "void initialiseEnsemble(size_t instanceCount, double *parameters, double *states, double *rates, double *variables);\n";
+        mImplementationInitialiseEnsembleMethodString = "static void initialiseEnsembleInstance(double *parameters, double *states, double *variables)\n"
+                                                        "{\n"
+                                                        "[CODE]"
+                                                        "}\n"
+                                                        "\n"
+                                                        "void initialiseEnsemble(size_t instanceCount, double *parameters, double *states, double *rates, double *variables)\n"
+                                                        "{\n"
+                                                        "[OPENMP_PRAGMA]"
+                                                        "    for (size_t i = 0; i < instanceCount; ++i) {\n"
+                                                        "        initialiseVariables(states+i*STATE_COUNT, rates+i*STATE_COUNT, variables+i*VARIABLE_COUNT);\n"
+                                                        "        initialiseEnsembleInstance(parameters+i*ENSEMBLE_PARAMETER_COUNT, states+i*STATE_COUNT, variables+i*VARIABLE_COUNT);\n"
+                                                        "        computeComputedConstants(variables+i*VARIABLE_COUNT);\n"
+                                                        "    }\n"
+                                                        "}\n";
+
+        mInterfaceComputeEnsembleRatesMethodString = "void computeEnsembleRates(size_t instanceCount, double voi, double *states, double *rates, double *variables);\n";
+        mImplementationComputeEnsembleRatesMethodString = "void computeEnsembleRates(size_t instanceCount, double voi, double *states, double *rates, double *variables)\n"
+                                                          "{\n"
+                                                          "[OPENMP_PRAGMA]"
+                                                          "    for (size_t i = 0; i < instanceCount; ++i) {\n"
+                                                          "        computeRates(voi, states+i*STATE_COUNT, rates+i*STATE_COUNT, variables+i*VARIABLE_COUNT);\n"
+                                                          "    }\n"
+                                                          "}\n";
+
+        mInterfaceComputeEnsembleVariablesMethodString = "void computeEnsembleVariables(size_t instanceCount, double voi, double *states, double *rates, double *variables);\n";
+        mImplementationComputeEnsembleVariablesMethodString = "void computeEnsembleVariables(size_t instanceCount, double voi, double *states, double *rates, double *variables)\n"
+                                                              "{\n"
+                                                              "[OPENMP_PRAGMA]"
+                                                              "    for (size_t i = 0; i < instanceCount; ++i) {\n"
+                                                              "        computeVariables(voi, states+i*STATE_COUNT, rates+i*STATE_COUNT, variables+i*VARIABLE_COUNT);\n"
+                                                              "    }\n"
+                                                              "}\n";
+
+        mInterfaceIntegrateForwardEulerMethodString = "void integrateForwardEuler(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer);\n";
+        mImplementationIntegrateForwardEulerMethodString = "void integrateForwardEuler(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer)\n"
+                                                           "{\n"
+                                                           "    for (size_t step = 0; step < nSteps; ++step) {\n"
+                                                           "        computeRates(voi0+step*dt, states, rates, variables);\n"
+                                                           "\n"
+                                                           "        for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                           "            states[i] += dt*rates[i];\n"
+                                                           "        }\n"
+                                                           "\n"
+                                                           "        if ((outputBuffer != NULL) && (outputStride != 0) && ((step+1)%outputStride == 0)) {\n"
+                                                           "            for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                           "                outputBuffer[i] = states[i];\n"
+                                                           "            }\n"
+                                                           "\n"
+                                                           "            outputBuffer += STATE_COUNT;\n"
+                                                           "        }\n"
+                                                           "    }\n"
+                                                           "}\n";
+
+        mInterfaceIntegrateRk4MethodString = "void integrateRK4(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer);\n";
+        mImplementationIntegrateRk4MethodString = "void integrateRK4(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer)\n"
+                                                  "{\n"
+                                                  "    double *k2 = createStatesArray();\n"
+                                                  "    double *k3 = createStatesArray();\n"
+                                                  "    double *k4 = createStatesArray();\n"
+                                                  "    double *y = createStatesArray();\n"
+                                                  "\n"
+                                                  "    for (size_t step = 0; step < nSteps; ++step) {\n"
+                                                  "        double voi = voi0+step*dt;\n"
+                                                  "\n"
+                                                  "        computeRates(voi, states, rates, variables);\n"
+                                                  "\n"
+                                                  "        for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                  "            y[i] = states[i]+0.5*dt*rates[i];\n"
+                                                  "        }\n"
+                                                  "\n"
+                                                  "        computeRates(voi+0.5*dt, y, k2, variables);\n"
+                                                  "\n"
+                                                  "        for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                  "            y[i] = states[i]+0.5*dt*k2[i];\n"
+                                                  "        }\n"
+                                                  "\n"
+                                                  "        computeRates(voi+0.5*dt, y, k3, variables);\n"
+                                                  "\n"
+                                                  "        for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                  "            y[i] = states[i]+dt*k3[i];\n"
+                                                  "        }\n"
+                                                  "\n"
+                                                  "        computeRates(voi+dt, y, k4, variables);\n"
+                                                  "\n"
+                                                  "        for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                  "            states[i] += dt*(rates[i]+2.0*(k2[i]+k3[i])+k4[i])/6.0;\n"
+                                                  "        }\n"
+                                                  "\n"
+                                                  "        if ((outputBuffer != NULL) && (outputStride != 0) && ((step+1)%outputStride == 0)) {\n"
+                                                  "            for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                  "                outputBuffer[i] = states[i];\n"
+                                                  "            }\n"
+                                                  "\n"
+                                                  "            outputBuffer += STATE_COUNT;\n"
+                                                  "        }\n"
+                                                  "    }\n"
+                                                  "\n"
+                                                  "    deleteArray(k2);\n"
+                                                  "    deleteArray(k3);\n"
+                                                  "    deleteArray(k4);\n"
+                                                  "    deleteArray(y);\n"
+                                                  "}\n";
+
+        mInterfaceIntegrateRushLarsenMethodString = "void integrateRushLarsen(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer);\n";
+        mImplementationIntegrateRushLarsenMethodString = "void integrateRushLarsen(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer)\n"
+                                                         "{\n"
+                                                         "    double *taus = createStatesArray();\n"
+                                                         "    double *yInfs = createStatesArray();\n"
+                                                         "\n"
+                                                         "    for (size_t step = 0; step < nSteps; ++step) {\n"
+                                                         "        double voi = voi0+step*dt;\n"
+                                                         "\n"
+                                                         "        computeRates(voi, states, rates, variables);\n"
+                                                         "        computeRushLarsenCoefficients(voi, states, variables, taus, yInfs);\n"
+                                                         "\n"
+                                                         "[CODE]"
+                                                         "\n"
+                                                         "        if ((outputBuffer != NULL) && (outputStride != 0) && ((step+1)%outputStride == 0)) {\n"
+                                                         "            for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                         "                outputBuffer[i] = states[i];\n"
+                                                         "            }\n"
+                                                         "\n"
+                                                         "            outputBuffer += STATE_COUNT;\n"
+                                                         "        }\n"
+                                                         "    }\n"
+                                                         "\n"
+                                                         "    deleteArray(taus);\n"
+                                                         "    deleteArray(yInfs);\n"
+                                                         "}\n";
+
         mInterfaceComputeVariablesMethodFamWoevString = "void computeVariables(double *variables);\n";
         mImplementationComputeVariablesMethodFamWoevString = "void computeVariables(double *variables)\n"
                                                              "{\n"
@@ -732,11 +716,736 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mStringDelimiterString = "\"";
 
         mCommandSeparatorString = ";";
-    } else { // GeneratorProfile::Profile::PYTHON.
+    } else if (profile == GeneratorProfile::Profile::CPP) {
         // Whether the profile requires an interface to be generated.
 
         mHasInterface = false;
 
+        // Whether the profile requires a method to compute the Rush-Larsen
+        // coefficients to be generated.
+
+        mHasComputeRushLarsenCoefficientsMethod = false;
+
+        // Whether the profile keeps purely intermediate algebraic variables as
+        // local variables in computeRates().
+
+        mHasLocalVariablesInComputeRates = false;
+
+        // Whether the profile requires methods to integrate the model using a
+        // fixed-step method to be generated.
+
+        mHasIntegrateMethods = false;
+
+        // Equality.
+
+        mEqualityString = " = ";
+
+        // Relational and logical operators.
+
+        mEqString = " == ";
+        mNeqString = " != ";
+        mLtString = " < ";
+        mLeqString = " <= ";
+        mGtString = " > ";
+        mGeqString = " >= ";
+        mAndString = " && ";
+        mOrString = " || ";
+        mXorString = "xorFunc";
+        mNotString = "!";
+
+        mHasEqOperator = true;
+        mHasNeqOperator = true;
+        mHasLtOperator = true;
+        mHasLeqOperator = true;
+        mHasGtOperator = true;
+        mHasGeqOperator = true;
+        mHasAndOperator = true;
+        mHasOrOperator = true;
+        mHasXorOperator = false;
+        mHasNotOperator = true;
+
+        // Arithmetic operators.
+
+        mPlusString = "+";
+        mMinusString = "-";
+        mTimesString = "*";
+        mDivideString = "/";
+        mPowerString = "pow";
+        mSquareRootString = "sqrt";
+        mSquareString = "";
+        mAbsoluteValueString = "fabs";
+        mExponentialString = "exp";
+        mNaturalLogarithmString = "log";
+        mCommonLogarithmString = "log10";
+        mCeilingString = "ceil";
+        mFloorString = "floor";
+        mMinString = "min";
+        mMaxString = "max";
+        mRemString = "fmod";
+
+        mHasPowerOperator = false;
+
+        // Trigonometric operators.
+
+        mSinString = "sin";
+        mCosString = "cos";
+        mTanString = "tan";
+        mSecString = "sec";
+        mCscString = "csc";
+        mCotString = "cot";
+        mSinhString = "sinh";
+        mCoshString = "cosh";
+        mTanhString = "tanh";
+        mSechString = "sech";
+        mCschString = "csch";
+        mCothString = "coth";
+        mAsinString = "asin";
+        mAcosString = "acos";
+        mAtanString = "atan";
+        mAsecString = "asec";
+        mAcscString = "acsc";
+        mAcotString = "acot";
+        mAsinhString = "asinh";
+        mAcoshString = "acosh";
+        mAtanhString = "atanh";
+        mAsechString = "asech";
+        mAcschString = "acsch";
+        mAcothString = "acoth";
+
+        // Piecewise statement.
+
+        mConditionalOperatorIfString = "([CONDITION])?[IF_STATEMENT]";
+        mConditionalOperatorElseString = ":[ELSE_STATEMENT]";
+
+        mHasConditionalOperator = true;
+
+        // Constants.
+
+        mTrueString = "1.0";
+        mFalseString = "0.0";
+        mEString = convertToString(exp(1.0));
+        mPiString = convertToString(M_PI);
+        mInfString = "INFINITY";
+        mNanString = "NAN";
+        mLiteralSuffixString = "";
+
+        // Arithmetic functions.
+
+        mEqFunctionString = "";
+        mNeqFunctionString = "";
+        mLtFunctionString = "";
+        mLeqFunctionString = "";
+        mGtFunctionString = "";
+        mGeqFunctionString = "";
+        mAndFunctionString = "";
+        mOrFunctionString = "";
+        mXorFunctionString = "template <typename T>\n"
+                             "inline T xorFunc(T x, T y)\n"
+                             "{\n"
+                             "    return (x != 0.0) ^ (y != 0.0);\n"
+                             "}\n";
+        mNotFunctionString = "";
+        mMinFunctionString = "template <typename T>\n"
+                             "inline T min(T x, T y)\n"
+                             "{\n"
+                             "    return (x < y)?x:y;\n"
+                             "}\n";
+        mMaxFunctionString = "template <typename T>\n"
+                             "inline T max(T x, T y)\n"
+                             "{\n"
+                             "    return (x > y)?x:y;\n"
+                             "}\n";
+
+        // Trigonometric functions.
+
+        mSecFunctionString = "template <typename T>\n"
+                             "inline T sec(T x)\n"
+                             "{\n"
+                             "    return 1.0/cos(x);\n"
+                             "}\n";
+        mCscFunctionString = "template <typename T>\n"
+                             "inline T csc(T x)\n"
+                             "{\n"
+                             "    return 1.0/sin(x);\n"
+                             "}\n";
+        mCotFunctionString = "template <typename T>\n"
+                             "inline T cot(T x)\n"
+                             "{\n"
+                             "    return 1.0/tan(x);\n"
+                             "}\n";
+        mSechFunctionString = "template <typename T>\n"
+                              "inline T sech(T x)\n"
+                              "{\n"
+                              "    return 1.0/cosh(x);\n"
+                              "}\n";
+        mCschFunctionString = "template <typename T>\n"
+                              "inline T csch(T x)\n"
+                              "{\n"
+                              "    return 1.0/sinh(x);\n"
+                              "}\n";
+        mCothFunctionString = "template <typename T>\n"
+                              "inline T coth(T x)\n"
+                              "{\n"
+                              "    return 1.0/tanh(x);\n"
+                              "}\n";
+        mAsecFunctionString = "template <typename T>\n"
+                              "inline T asec(T x)\n"
+                              "{\n"
+                              "    return acos(1.0/x);\n"
+                              "}\n";
+        mAcscFunctionString = "template <typename T>\n"
+                              "inline T acsc(T x)\n"
+                              "{\n"
+                              "    return asin(1.0/x);\n"
+                              "}\n";
+        mAcotFunctionString = "template <typename T>\n"
+                              "inline T acot(T x)\n"
+                              "{\n"
+                              "    return atan(1.0/x);\n"
+                              "}\n";
+        mAsechFunctionString = "template <typename T>\n"
+                               "inline T asech(T x)\n"
+                               "{\n"
+                               "    T oneOverX = 1.0/x;\n"
+                               "\n"
+                               "    return log(oneOverX+sqrt(oneOverX*oneOverX-1.0));\n"
+                               "}\n";
+        mAcschFunctionString = "template <typename T>\n"
+                               "inline T acsch(T x)\n"
+                               "{\n"
+                               "    T oneOverX = 1.0/x;\n"
+                               "\n"
+                               "    return log(oneOverX+sqrt(oneOverX*oneOverX+1.0));\n"
+                               "}\n";
+        mAcothFunctionString = "template <typename T>\n"
+                               "inline T acoth(T x)\n"
+                               "{\n"
+                               "    T oneOverX = 1.0/x;\n"
+                               "\n"
+                               "    return 0.5*log((1.0+oneOverX)/(1.0-oneOverX));\n"
+                               "}\n";
+
+        // Miscellaneous.
+
+        mCommentString = "/* [CODE] */\n";
+        mOriginCommentString = "The content of this file was generated using [PROFILE_INFORMATION] libCellML [LIBCELLML_VERSION].";
+
+        mInterfaceFileNameString = "";
+
+        mInterfaceHeaderString = "";
+        mImplementationHeaderString = "#pragma once\n"
+                                      "\n"
+                                      "#include <array>\n"
+                                      "#include <math.h>\n"
+                                      "#include <stddef.h>\n";
+
+        mNamespaceString = "";
+        mImplementationNamespaceBeginString = "namespace [NAMESPACE] {\n";
+        mImplementationNamespaceEndString = "} // namespace [NAMESPACE]\n";
+
+        mInterfaceVersionString = "";
+        mImplementationVersionString = "constexpr char VERSION[] = \"0.5.0\";\n";
+
+        mInterfaceLibcellmlVersionString = "";
+        mImplementationLibcellmlVersionString = "constexpr char LIBCELLML_VERSION[] = \"[LIBCELLML_VERSION]\";\n";
+
+        mInterfaceStateCountString = "";
+        mImplementationStateCountString = "constexpr size_t STATE_COUNT = [STATE_COUNT];\n";
+
+        mInterfaceVariableCountString = "";
+        mImplementationVariableCountString = "constexpr size_t VARIABLE_COUNT = [VARIABLE_COUNT];\n";
+
+        mInterfaceEnsembleParameterCountString = "";
+        mImplementationEnsembleParameterCountString = "constexpr size_t ENSEMBLE_PARAMETER_COUNT = [ENSEMBLE_PARAMETER_COUNT];\n";
+
+        mVariableTypeObjectFamWoevString = "enum class VariableType {\n"
+                                           "    CONSTANT,\n"
+                                           "    COMPUTED_CONSTANT,\n"
+                                           "    ALGEBRAIC\n"
+                                           "};\n";
+        mVariableTypeObjectFamWevString = "enum class VariableType {\n"
+                                          "    CONSTANT,\n"
+                                          "    COMPUTED_CONSTANT,\n"
+                                          "    ALGEBRAIC,\n"
+                                          "    EXTERNAL\n"
+                                          "};\n";
+        mVariableTypeObjectFdmWoevString = "enum class VariableType {\n"
+                                           "    VARIABLE_OF_INTEGRATION,\n"
+                                           "    STATE,\n"
+                                           "    CONSTANT,\n"
+                                           "    COMPUTED_CONSTANT,\n"
+                                           "    ALGEBRAIC\n"
+                                           "};\n";
+        mVariableTypeObjectFdmWevString = "enum class VariableType {\n"
+                                          "    VARIABLE_OF_INTEGRATION,\n"
+                                          "    STATE,\n"
+                                          "    CONSTANT,\n"
+                                          "    COMPUTED_CONSTANT,\n"
+                                          "    ALGEBRAIC,\n"
+                                          "    EXTERNAL\n"
+                                          "};\n";
+
+        mVariableOfIntegrationVariableTypeString = "VariableType::VARIABLE_OF_INTEGRATION";
+        mStateVariableTypeString = "VariableType::STATE";
+        mConstantVariableTypeString = "VariableType::CONSTANT";
+        mComputedConstantVariableTypeString = "VariableType::COMPUTED_CONSTANT";
+        mAlgebraicVariableTypeString = "VariableType::ALGEBRAIC";
+        mExternalVariableTypeString = "VariableType::EXTERNAL";
+
+        mVariableInfoObjectString = "struct VariableInfo {\n"
+                                    "    const char *name;\n"
+                                    "    const char *units;\n"
+                                    "    const char *component;\n"
+                                    "    VariableType type;\n"
+                                    "};\n";
+
+        mInterfaceVoiInfoString = "";
+        mImplementationVoiInfoString = "constexpr VariableInfo VOI_INFO = [CODE];\n";
+
+        mInterfaceStateInfoString = "";
+        mImplementationStateInfoString = "constexpr std::array<VariableInfo, STATE_COUNT> STATE_INFO = {{\n"
+                                         "[CODE]}};\n";
+
+        mInterfaceVariableInfoString = "";
+        mImplementationVariableInfoString = "constexpr std::array<VariableInfo, VARIABLE_COUNT> VARIABLE_INFO = {{\n"
+                                            "[CODE]}};\n";
+
+        mVariableInfoEntryString = "{\"[NAME]\", \"[UNITS]\", \"[COMPONENT]\", [TYPE]}";
+
+        mVoiString = "voi";
+
+        mStatesArrayString = "states";
+        mRatesArrayString = "rates";
+        mVariablesArrayString = "variables";
+
+        mRushLarsenTausArrayString = "taus";
+        mRushLarsenSteadyStatesArrayString = "yInfs";
+        mLocalVariableNameString = "[NAME]_[INDEX]";
+        mLocalVariableDeclarationString = "T ";
+
+        mForwardEulerStateUpdateString = "        states[[INDEX]] += dt*rates[[INDEX]];\n";
+        mRushLarsenStateUpdateString = "        states[[INDEX]] = yInfs[[INDEX]]+(states[[INDEX]]-yInfs[[INDEX]])*exp(-dt/taus[[INDEX]]);\n";
+
+        mSensitivityNameString = "d[NAME]_d[PARAMETER]";
+        mChunkMethodNameString = "[NAME]Chunk[INDEX]";
+
+        mLookupTableDeclarationString = "template <typename T>\n"
+                                        "T lookupTable[INDEX][[SIZE]];\n";
+        mLookupTableEntryString = "lookupTable[INDEX]<T>[[COLUMN_COUNT]*i+[COLUMN]]";
+        mLookupTableValueCallString = "lookupTableValue<T>(lookupTable[INDEX]<T>, [COLUMN_COUNT], [COLUMN], [STATE], [MINIMUM], [STEP], [SIZE])";
+        mLookupTableErrorString = "maxError = lookupTableError<T>(maxError, [CODE], [VALUE]);\n";
+        mLookupTableValueMethodString = "template <typename T>\n"
+                                        "inline T lookupTableValue(T *table, size_t columnCount, size_t column, T x, T minimum, T step, size_t size)\n"
+                                        "{\n"
+                                        "    T position = (x-minimum)/step;\n"
+                                        "\n"
+                                        "    if (isnan(position)) {\n"
+                                        "        return NAN;\n"
+                                        "    }\n"
+                                        "\n"
+                                        "    if (position <= 0.0) {\n"
+                                        "        return table[column];\n"
+                                        "    }\n"
+                                        "\n"
+                                        "    if (position >= size-1) {\n"
+                                        "        return table[columnCount*(size-1)+column];\n"
+                                        "    }\n"
+                                        "\n"
+                                        "    size_t i = static_cast<size_t>(position);\n"
+                                        "    T fraction = position-i;\n"
+                                        "\n"
+                                        "    return (1.0-fraction)*table[columnCount*i+column]+fraction*table[columnCount*(i+1)+column];\n"
+                                        "}\n"
+                                        "\n"
+                                        "template <typename T>\n"
+                                        "inline T lookupTableError(T maxError, T exactValue, T value)\n"
+                                        "{\n"
+                                        "    if (isnan(maxError) || !isfinite(exactValue)) {\n"
+                                        "        return maxError;\n"
+                                        "    }\n"
+                                        "\n"
+                                        "    T error = fabs(exactValue-value);\n"
+                                        "\n"
+                                        "    return (error <= maxError)?maxError:error;\n"
+                                        "}\n";
+        mLookupTableInitialisationString = "    for (size_t i = 0; i < [SIZE]; ++i) {\n"
+                                           "        T row[[COLUMN_COUNT]];\n"
+                                           "\n"
+                                           "        [STATE] = [MINIMUM]+(i-0.001)*[STEP];\n"
+                                           "\n"
+                                           "[CODE]"
+                                           "\n"
+                                           "        for (size_t j = 0; j < [COLUMN_COUNT]; ++j) {\n"
+                                           "            row[j] = [ENTRY];\n"
+                                           "        }\n"
+                                           "\n"
+                                           "        [STATE] = [MINIMUM]+(i+0.001)*[STEP];\n"
+                                           "\n"
+                                           "[CODE]"
+                                           "\n"
+                                           "        for (size_t j = 0; j < [COLUMN_COUNT]; ++j) {\n"
+                                           "            [ENTRY] = 0.5*(row[j]+[ENTRY]);\n"
+                                           "        }\n"
+                                           "    }\n"
+                                           "\n"
+                                           "    for (size_t i = 0; i < [SIZE]-1; ++i) {\n"
+                                           "        [STATE] = [MINIMUM]+(i+0.5)*[STEP];\n"
+                                           "\n"
+                                           "[ERROR_CODE]"
+                                           "    }\n";
+
+        mEnsembleOpenmpPragmaString = "#pragma omp parallel for schedule(static, [BLOCK_SIZE])\n";
+        mEnsembleParameterAssignmentString = "    variables[[INDEX]] = parameters[[PARAMETER_INDEX]];\n";
+
+        mExternalVariableMethodTypeDefinitionFamString = "template <typename T>\n"
+                                                         "using ExternalVariable = T (*)(T *variables, size_t index);\n";
+        mExternalVariableMethodTypeDefinitionFdmString = "template <typename T>\n"
+                                                         "using ExternalVariable = T (*)(T voi, T *states, T *rates, T *variables, size_t index);\n";
+
+        mExternalVariableMethodCallFamString = "externalVariable(variables, [INDEX])";
+        mExternalVariableMethodCallFdmString = "externalVariable(voi, states, rates, variables, [INDEX])";
+
+        mRootFindingInfoObjectFamString = "template <typename T>\n"
+                                          "struct RootFindingInfo {\n"
+                                          "    T *variables;\n"
+                                          "};\n";
+        mRootFindingInfoObjectFdmString = "template <typename T>\n"
+                                          "struct RootFindingInfo {\n"
+                                          "    T voi;\n"
+                                          "    T *states;\n"
+                                          "    T *rates;\n"
+                                          "    T *variables;\n"
+                                          "};\n";
+        mExternNlaSolveMethodString = "template <typename T>\n"
+                                      "void nlaSolve(void (*objectiveFunction)(T *, T *, void *),\n"
+                                      "              T *u, size_t n, void *data);\n";
+        mFindRootCallFamString = "findRoot[INDEX](variables);\n";
+        mFindRootCallFdmString = "findRoot[INDEX](voi, states, rates, variables);\n";
+        mFindRootMethodFamString = "template <typename T>\n"
+                                   "inline void findRoot[INDEX](T *variables)\n"
+                                   "{\n"
+                                   "    RootFindingInfo<T> rfi = { variables };\n"
+                                   "    T u[[SIZE]];\n"
+                                   "\n"
+                                   "[CODE]}\n";
+        mFindRootMethodFdmString = "template <typename T>\n"
+                                   "inline void findRoot[INDEX](T voi, T *states, T *rates, T *variables)\n"
+                                   "{\n"
+                                   "    RootFindingInfo<T> rfi = { voi, states, rates, variables };\n"
+                                   "    T u[[SIZE]];\n"
+                                   "\n"
+                                   "[CODE]}\n";
+        mNlaSolveCallFamString = "nlaSolve(objectiveFunction[INDEX]<T>, u, [SIZE], &rfi);\n";
+        mNlaSolveCallFdmString = "nlaSolve(objectiveFunction[INDEX]<T>, u, [SIZE], &rfi);\n";
+        mObjectiveFunctionMethodFamString = "template <typename T>\n"
+                                            "inline void objectiveFunction[INDEX](T *u, T *f, void *data)\n"
+                                            "{\n"
+                                            "    T *variables = static_cast<RootFindingInfo<T> *>(data)->variables;\n"
+                                            "\n"
+                                            "[CODE]}\n";
+        mObjectiveFunctionMethodFdmString = "template <typename T>\n"
+                                            "inline void objectiveFunction[INDEX](T *u, T *f, void *data)\n"
+                                            "{\n"
+                                            "    T voi = static_cast<RootFindingInfo<T> *>(data)->voi;\n"
+                                            "    T *states = static_cast<RootFindingInfo<T> *>(data)->states;\n"
+                                            "    T *rates = static_cast<RootFindingInfo<T> *>(data)->rates;\n"
+                                            "    T *variables = static_cast<RootFindingInfo<T> *>(data)->variables;\n"
+                                            "\n"
+                                            "[CODE]}\n";
+        mUArrayString = "u";
+        mFArrayString = "f";
+
+        mInterfaceCreateStatesArrayMethodString = "";
+        mImplementationCreateStatesArrayMethodString = "template <typename T>\n"
+                                                       "inline T * createStatesArray()\n"
+                                                       "{\n"
+                                                       "    T *res = new T[STATE_COUNT];\n"
+                                                       "\n"
+                                                       "    for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                       "        res[i] = NAN;\n"
+                                                       "    }\n"
+                                                       "\n"
+                                                       "    return res;\n"
+                                                       "}\n";
+
+        mInterfaceCreateVariablesArrayMethodString = "";
+        mImplementationCreateVariablesArrayMethodString = "template <typename T>\n"
+                                                          "inline T * createVariablesArray()\n"
+                                                          "{\n"
+                                                          "    T *res = new T[VARIABLE_COUNT];\n"
+                                                          "\n"
+                                                          "    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {\n"
+                                                          "        res[i] = NAN;\n"
+                                                          "    }\n"
+                                                          "\n"
+                                                          "    return res;\n"
+                                                          "}\n";
+
+        mInterfaceDeleteArrayMethodString = "";
+        mImplementationDeleteArrayMethodString = "template <typename T>\n"
+                                                 "inline void deleteArray(T *array)\n"
+                                                 "{\n"
+                                                 "    delete[] array;\n"
+                                                 "}\n";
+
+        mInterfaceInitialiseVariablesMethodFamWoevString = "";
+        mImplementationInitialiseVariablesMethodFamWoevString = "template <typename T>\n"
+                                                                "inline void initialiseVariables(T *variables)\n"
+                                                                "{\n"
+                                                                "[CODE]}\n";
+
+        mInterfaceInitialiseVariablesMethodFamWevString = "";
+        mImplementationInitialiseVariablesMethodFamWevString = "template <typename T>\n"
+                                                               "inline void initialiseVariables(T *variables, ExternalVariable<T> externalVariable)\n"
+                                                               "{\n"
+                                                               "[CODE]}\n";
+
+        mInterfaceInitialiseVariablesMethodFdmWoevString = "";
+        mImplementationInitialiseVariablesMethodFdmWoevString = "template <typename T>\n"
+                                                                "inline void initialiseVariables(T *states, T *rates, T *variables)\n"
+                                                                "{\n"
+                                                                "[CODE]}\n";
+
+        mInterfaceInitialiseVariablesMethodFdmWevString = "";
+        mImplementationInitialiseVariablesMethodFdmWevString = "template <typename T>\n"
+                                                               "inline void initialiseVariables(T voi, T *states, T *rates, T *variables, ExternalVariable<T> externalVariable)\n"
+                                                               "{\n"
+                                                               "[CODE]}\n";
+
+        mInterfaceComputeComputedConstantsMethodString = "";
+        mImplementationComputeComputedConstantsMethodString = "template <typename T>\n"
+                                                              "inline void computeComputedConstants(T *variables)\n"
+                                                              "{\n"
+                                                              "[CODE]}\n";
+
+        mInterfaceComputeRatesMethodWoevString = "";
+        mImplementationComputeRatesMethodWoevString = "template <typename T>\n"
+                                                      "inline void computeRates(T voi, T *states, T *rates, T *variables)\n"
+                                                      "{\n"
+                                                      "[CODE]}\n";
+
+        mInterfaceComputeRatesMethodWevString = "";
+        mImplementationComputeRatesMethodWevString = "template <typename T>\n"
+                                                     "inline void computeRates(T voi, T *states, T *rates, T *variables, ExternalVariable<T> externalVariable)\n"
+                                                     "{\n"
+                                                     "[CODE]}\n";
+
+        mInterfaceComputeRushLarsenCoefficientsMethodString = "";
+        mImplementationComputeRushLarsenCoefficientsMethodString = "template <typename T>\n"
+                                                                   "inline void computeRushLarsenCoefficients(T voi, T *states, T *variables, T *taus, T *yInfs)\n"
+                                                                   "{\n"
+                                                                   "[CODE]}\n";
+        mImplementationComputeRatesMethodWithLocalVariablesString = "template <typename T>\n"
+                                                                    "inline void computeRates(T voi, T *states, T *rates, T *variables)\n"
+                                                                    "{\n"
+                                                                    "[CODE]}\n";
+
+        mInterfaceInitialiseLookupTablesMethodString = "";
+        mImplementationInitialiseLookupTablesMethodString = "template <typename T>\n"
+                                                            "inline T initialiseLookupTables(T *variables)\n"
+                                                            "{\n"
+                                                            "    T *states = createStatesArray<T>();\n"
+                                                            "    T maxError = 0.0;\n"
+                                                            "\n"
+                                                            "[CODE]\n"
+                                                            "    deleteArray(states);\n"
+                                                            "\n"
+                                                            "    return maxError;\n"
+                                                            "}\n";
+
+        mInterfaceInitialiseEnsembleMethodString = "";
+        mImplementationInitialiseEnsembleMethodString = "template <typename T>\n"
+                                                        "inline void initialiseEnsembleInstance(T *parameters, T *states, T *variables)\n"
+                                                        "{\n"
+                                                        "[CODE]"
+                                                        "}\n"
+                                                        "\n"
+                                                        "template <typename T>\n"
+                                                        "inline void initialiseEnsemble(size_t instanceCount, T *parameters, T *states, T *rates, T *variables)\n"
+                                                        "{\n"
+                                                        "[OPENMP_PRAGMA]    for (size_t i = 0; i < instanceCount; ++i) {\n"
+                                                        "        initialiseVariables(states+i*STATE_COUNT, rates+i*STATE_COUNT, variables+i*VARIABLE_COUNT);\n"
+                                                        "        initialiseEnsembleInstance(parameters+i*ENSEMBLE_PARAMETER_COUNT, states+i*STATE_COUNT, variables+i*VARIABLE_COUNT);\n"
+                                                        "        computeComputedConstants(variables+i*VARIABLE_COUNT);\n"
+                                                        "    }\n"
+                                                        "}\n";
+
+        mInterfaceComputeEnsembleRatesMethodString = "";
+        mImplementationComputeEnsembleRatesMethodString = "template <typename T>\n"
+                                                          "inline void computeEnsembleRates(size_t instanceCount, T voi, T *states, T *rates, T *variables)\n"
+                                                          "{\n"
+                                                          "[OPENMP_PRAGMA]    for (size_t i = 0; i < instanceCount; ++i) {\n"
+                                                          "        computeRates<T>(voi, states+i*STATE_COUNT, rates+i*STATE_COUNT, variables+i*VARIABLE_COUNT);\n"
+                                                          "    }\n"
+                                                          "}\n";
+
+        mInterfaceComputeEnsembleVariablesMethodString = "";
+        mImplementationComputeEnsembleVariablesMethodString = "template <typename T>\n"
+                                                              "inline void computeEnsembleVariables(size_t instanceCount, T voi, T *states, T *rates, T *variables)\n"
+                                                              "{\n"
+                                                              "[OPENMP_PRAGMA]    for (size_t i = 0; i < instanceCount; ++i) {\n"
+                                                              "        computeVariables<T>(voi, states+i*STATE_COUNT, rates+i*STATE_COUNT, variables+i*VARIABLE_COUNT);\n"
+                                                              "    }\n"
+                                                              "}\n";
+
+        mInterfaceIntegrateForwardEulerMethodString = "";
+        mImplementationIntegrateForwardEulerMethodString = "template <typename T>\n"
+                                                           "inline void integrateForwardEuler(T voi0, T dt, size_t nSteps, T *states, T *rates, T *variables, size_t outputStride, T *outputBuffer)\n"
+                                                           "{\n"
+                                                           "    for (size_t step = 0; step < nSteps; ++step) {\n"
+                                                           "        computeRates<T>(voi0+step*dt, states, rates, variables);\n"
+                                                           "\n"
+                                                           "        for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                           "            states[i] += dt*rates[i];\n"
+                                                           "        }\n"
+                                                           "\n"
+                                                           "        if ((outputBuffer != nullptr) && (outputStride != 0) && ((step+1)%outputStride == 0)) {\n"
+                                                           "            for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                           "                outputBuffer[i] = states[i];\n"
+                                                           "            }\n"
+                                                           "\n"
+                                                           "            outputBuffer += STATE_COUNT;\n"
+                                                           "        }\n"
+                                                           "    }\n"
+                                                           "}\n";
+
+        mInterfaceIntegrateRk4MethodString = "";
+        mImplementationIntegrateRk4MethodString = "template <typename T>\n"
+                                                  "inline void integrateRK4(T voi0, T dt, size_t nSteps, T *states, T *rates, T *variables, size_t outputStride, T *outputBuffer)\n"
+                                                  "{\n"
+                                                  "    T *k2 = createStatesArray<T>();\n"
+                                                  "    T *k3 = createStatesArray<T>();\n"
+                                                  "    T *k4 = createStatesArray<T>();\n"
+                                                  "    T *y = createStatesArray<T>();\n"
+                                                  "\n"
+                                                  "    for (size_t step = 0; step < nSteps; ++step) {\n"
+                                                  "        T voi = voi0+step*dt;\n"
+                                                  "\n"
+                                                  "        computeRates<T>(voi, states, rates, variables);\n"
+                                                  "\n"
+                                                  "        for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                  "            y[i] = states[i]+0.5*dt*rates[i];\n"
+                                                  "        }\n"
+                                                  "\n"
+                                                  "        computeRates<T>(voi+0.5*dt, y, k2, variables);\n"
+                                                  "\n"
+                                                  "        for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                  "            y[i] = states[i]+0.5*dt*k2[i];\n"
+                                                  "        }\n"
+                                                  "\n"
+                                                  "        computeRates<T>(voi+0.5*dt, y, k3, variables);\n"
+                                                  "\n"
+                                                  "        for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                  "            y[i] = states[i]+dt*k3[i];\n"
+                                                  "        }\n"
+                                                  "\n"
+                                                  "        computeRates<T>(voi+dt, y, k4, variables);\n"
+                                                  "\n"
+                                                  "        for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                  "            states[i] += dt*(rates[i]+2.0*(k2[i]+k3[i])+k4[i])/6.0;\n"
+                                                  "        }\n"
+                                                  "\n"
+                                                  "        if ((outputBuffer != nullptr) && (outputStride != 0) && ((step+1)%outputStride == 0)) {\n"
+                                                  "            for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                  "                outputBuffer[i] = states[i];\n"
+                                                  "            }\n"
+                                                  "\n"
+                                                  "            outputBuffer += STATE_COUNT;\n"
+                                                  "        }\n"
+                                                  "    }\n"
+                                                  "\n"
+                                                  "    deleteArray(k2);\n"
+                                                  "    deleteArray(k3);\n"
+                                                  "    deleteArray(k4);\n"
+                                                  "    deleteArray(y);\n"
+                                                  "}\n";
+
+        mInterfaceIntegrateRushLarsenMethodString = "";
+        mImplementationIntegrateRushLarsenMethodString = "template <typename T>\n"
+                                                         "inline void integrateRushLarsen(T voi0, T dt, size_t nSteps, T *states, T *rates, T *variables, size_t outputStride, T *outputBuffer)\n"
+                                                         "{\n"
+                                                         "    T *taus = createStatesArray<T>();\n"
+                                                         "    T *yInfs = createStatesArray<T>();\n"
+                                                         "\n"
+                                                         "    for (size_t step = 0; step < nSteps; ++step) {\n"
+                                                         "        T voi = voi0+step*dt;\n"
+                                                         "\n"
+                                                         "        computeRates<T>(voi, states, rates, variables);\n"
+                                                         "        computeRushLarsenCoefficients<T>(voi, states, variables, taus, yInfs);\n"
+                                                         "\n"
+                                                         "[CODE]\n"
+                                                         "        if ((outputBuffer != nullptr) && (outputStride != 0) && ((step+1)%outputStride == 0)) {\n"
+                                                         "            for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+                                                         "                outputBuffer[i] = states[i];\n"
+                                                         "            }\n"
+                                                         "\n"
+                                                         "            outputBuffer += STATE_COUNT;\n"
+                                                         "        }\n"
+                                                         "    }\n"
+                                                         "\n"
+                                                         "    deleteArray(taus);\n"
+                                                         "    deleteArray(yInfs);\n"
+                                                         "}\n";
+
+        mInterfaceComputeVariablesMethodFamWoevString = "";
+        mImplementationComputeVariablesMethodFamWoevString = "template <typename T>\n"
+                                                             "inline void computeVariables(T *variables)\n"
+                                                             "{\n"
+                                                             "[CODE]}\n";
+
+        mInterfaceComputeVariablesMethodFamWevString = "";
+        mImplementationComputeVariablesMethodFamWevString = "template <typename T>\n"
+                                                            "inline void computeVariables(T *variables, ExternalVariable<T> externalVariable)\n"
+                                                            "{\n"
+                                                            "[CODE]}\n";
+
+        mInterfaceComputeVariablesMethodFdmWoevString = "";
+        mImplementationComputeVariablesMethodFdmWoevString = "template <typename T>\n"
+                                                             "inline void computeVariables(T voi, T *states, T *rates, T *variables)\n"
+                                                             "{\n"
+                                                             "[CODE]}\n";
+
+        mInterfaceComputeVariablesMethodFdmWevString = "";
+        mImplementationComputeVariablesMethodFdmWevString = "template <typename T>\n"
+                                                            "inline void computeVariables(T voi, T *states, T *rates, T *variables, ExternalVariable<T> externalVariable)\n"
+                                                            "{\n"
+                                                            "[CODE]}\n";
+
+        mEmptyMethodString = "";
+
+        mIndentString = "    ";
+
+        mOpenArrayInitialiserString = "{";
+        mCloseArrayInitialiserString = "}";
+
+        mOpenArrayString = "[";
+        mCloseArrayString = "]";
+
+        mArrayElementSeparatorString = ",";
+
+        mStringDelimiterString = "\"";
+
+        mCommandSeparatorString = ";";
+    } else { // GeneratorProfile::Profile::PYTHON or GeneratorProfile::Profile::NUMPY.
+        // Whether the profile requires an interface to be generated.
+
+        mHasInterface = false;
+
+        // Whether the profile requires a method to compute the Rush-Larsen
+        // coefficients to be generated.
+
+        mHasComputeRushLarsenCoefficientsMethod = false;
+
+        // Whether the profile keeps purely intermediate algebraic variables as
+        // local variables in computeRates().
+
+        mHasLocalVariablesInComputeRates = false;
+
+        // Whether the profile requires methods to integrate the model using a
+        // fixed-step method to be generated.
+
+        mHasIntegrateMethods = false;
+
         // Equality.
 
         mEqualityString = " = ";
@@ -828,6 +1537,7 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mPiString = convertToString(M_PI);
         mInfString = "inf";
         mNanString = "nan";
+        mLiteralSuffixString = "";
 
         // Arithmetic functions.
 
@@ -925,6 +1635,10 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                                       "from math import *\n"
                                       "\n";
 
+        mNamespaceString = "";
+        mImplementationNamespaceBeginString = "";
+        mImplementationNamespaceEndString = "";
+
         mInterfaceVersionString = "";
         mImplementationVersionString = "__version__ = \"0.4.0\"\n";
 
@@ -937,6 +1651,9 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mInterfaceVariableCountString = "";
         mImplementationVariableCountString = "VARIABLE_COUNT = [VARIABLE_COUNT]\n";
 
+        mInterfaceEnsembleParameterCountString = "";
+        mImplementationEnsembleParameterCountString = "ENSEMBLE_PARAMETER_COUNT = [ENSEMBLE_PARAMETER_COUNT]\n";
+
         mVariableTypeObjectFamWoevString = "\n"
                                            "class VariableType(Enum):\n"
                                            "    CONSTANT = 0\n"
@@ -998,6 +1715,69 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mRatesArrayString = "rates";
         mVariablesArrayString = "variables";
 
+        mRushLarsenTausArrayString = "taus";
+        mRushLarsenSteadyStatesArrayString = "y_infs";
+        mLocalVariableNameString = "[NAME]_[INDEX]";
+        mLocalVariableDeclarationString = "";
+
+        mForwardEulerStateUpdateString = "        states[[INDEX]] += dt*rates[[INDEX]]\n";
+        mRushLarsenStateUpdateString = "        states[[INDEX]] = y_infs[[INDEX]]+(states[[INDEX]]-y_infs[[INDEX]])*exp(-dt/taus[[INDEX]])\n";
+
+        mSensitivityNameString = "d[NAME]_d[PARAMETER]";
+        mChunkMethodNameString = "[NAME]_chunk_[INDEX]";
+
+        mLookupTableDeclarationString = "lookup_table_[INDEX] = [nan]*[SIZE]\n";
+        mLookupTableEntryString = "lookup_table_[INDEX][[COLUMN_COUNT]*i+[COLUMN]]";
+        mLookupTableValueCallString = "lookup_table_value(lookup_table_[INDEX], [COLUMN_COUNT], [COLUMN], [STATE], [MINIMUM], [STEP], [SIZE])";
+        mLookupTableErrorString = "max_error = lookup_table_error(max_error, [CODE], [VALUE])\n";
+        mLookupTableValueMethodString = "\n"
+                                        "def lookup_table_value(table, column_count, column, x, minimum, step, size):\n"
+                                        "    position = (x-minimum)/step\n"
+                                        "\n"
+                                        "    if isnan(position):\n"
+                                        "        return nan\n"
+                                        "\n"
+                                        "    if position <= 0.0:\n"
+                                        "        return table[column]\n"
+                                        "\n"
+                                        "    if position >= size-1:\n"
+                                        "        return table[column_count*(size-1)+column]\n"
+                                        "\n"
+                                        "    i = int(position)\n"
+                                        "    fraction = position-i\n"
+                                        "\n"
+                                        "    return (1.0-fraction)*table[column_count*i+column]+fraction*table[column_count*(i+1)+column]\n"
+                                        "\n"
+                                        "\n"
+                                        "def lookup_table_error(max_error, exact_value, value):\n"
+                                        "    if isnan(max_error) or not isfinite(exact_value):\n"
+                                        "        return max_error\n"
+                                        "\n"
+                                        "    error = fabs(exact_value-value)\n"
+                                        "\n"
+                                        "    return max_error if error <= max_error else error\n";
+        mLookupTableInitialisationString = "    for i in range(0, [SIZE]):\n"
+                                           "        [STATE] = [MINIMUM]+(i-0.001)*[STEP]\n"
+                                           "\n"
+                                           "[CODE]"
+                                           "\n"
+                                           "        row = [[ENTRY] for j in range(0, [COLUMN_COUNT])]\n"
+                                           "\n"
+                                           "        [STATE] = [MINIMUM]+(i+0.001)*[STEP]\n"
+                                           "\n"
+                                           "[CODE]"
+                                           "\n"
+                                           "        for j in range(0, [COLUMN_COUNT]):\n"
+                                           "            [ENTRY] = 0.5*(row[j]+[ENTRY])\n"
+                                           "\n"
+                                           "    for i in range(0, [SIZE]-1):\n"
+                                           "        [STATE] = [MINIMUM]+(i+0.5)*[STEP]\n"
+                                           "\n"
+                                           "[ERROR_CODE]";
+
+        mEnsembleOpenmpPragmaString = "";
+        mEnsembleParameterAssignmentString = "    variables[[INDEX]] = parameters[[PARAMETER_INDEX]]\n";
+
         mExternalVariableMethodTypeDefinitionFamString = "";
         mExternalVariableMethodTypeDefinitionFdmString = "";
 
@@ -1087,6 +1867,111 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                                                      "def compute_rates(voi, states, rates, variables, external_variable):\n"
                                                      "[CODE]";
 
+        mInterfaceComputeRushLarsenCoefficientsMethodString = "";
+        mImplementationComputeRushLarsenCoefficientsMethodString = "\n"
+                                                                   "def compute_rush_larsen_coefficients(voi, states, variables, taus, y_infs):\n"
+                                                                   "[CODE]";
+        mImplementationComputeRatesMethodWithLocalVariablesString = "\n"
+                                                                    "def compute_rates(voi, states, rates, variables):\n"
+                                                                    "[CODE]";
+
+        mInterfaceInitialiseLookupTablesMethodString = "";
+        mImplementationInitialiseLookupTablesMethodString = "\n"
+                                                            "def initialise_lookup_tables(variables):\n"
+                                                            "    states = create_states_array()\n"
+                                                            "    max_error = 0.0\n"
+                                                            "\n"
+                                                            "[CODE]"
+                                                            "\n"
+                                                            "    return max_error\n";
+
+        mInterfaceInitialiseEnsembleMethodString = "";
+        mImplementationInitialiseEnsembleMethodString = "\n"
+                                                        "def initialise_ensemble_instance(parameters, states, variables):\n"
+                                                        "[CODE]"
+                                                        "\n"
+                                                        "\n"
+                                                        "def initialise_ensemble(parameters, states, rates, variables):\n"
+                                                        "    for i in range(0, len(states)):\n"
+                                                        "        initialise_variables(states[i], rates[i], variables[i])\n"
+                                                        "        initialise_ensemble_instance(parameters[i], states[i], variables[i])\n"
+                                                        "        compute_computed_constants(variables[i])\n";
+
+        mInterfaceComputeEnsembleRatesMethodString = "";
+        mImplementationComputeEnsembleRatesMethodString = "\n"
+                                                          "def compute_ensemble_rates(voi, states, rates, variables):\n"
+                                                          "    for i in range(0, len(states)):\n"
+                                                          "        compute_rates(voi, states[i], rates[i], variables[i])\n";
+
+        mInterfaceComputeEnsembleVariablesMethodString = "";
+        mImplementationComputeEnsembleVariablesMethodString = "\n"
+                                                              "def compute_ensemble_variables(voi, states, rates, variables):\n"
+                                                              "    for i in range(0, len(states)):\n"
+                                                              "        compute_variables(voi, states[i], rates[i], variables[i])\n";
+
+        mInterfaceIntegrateForwardEulerMethodString = "";
+        mImplementationIntegrateForwardEulerMethodString = "\n"
+                                                           "def integrate_forward_euler(voi0, dt, n_steps, states, rates, variables, output_stride, output_buffer):\n"
+                                                           "    for step in range(0, n_steps):\n"
+                                                           "        compute_rates(voi0+step*dt, states, rates, variables)\n"
+                                                           "\n"
+                                                           "        for i in range(0, STATE_COUNT):\n"
+                                                           "            states[i] += dt*rates[i]\n"
+                                                           "\n"
+                                                           "        if output_buffer is not None and output_stride != 0 and (step+1) % output_stride == 0:\n"
+                                                           "            output_buffer.append(states[:])\n";
+
+        mInterfaceIntegrateRk4MethodString = "";
+        mImplementationIntegrateRk4MethodString = "\n"
+                                                  "def integrate_rk4(voi0, dt, n_steps, states, rates, variables, output_stride, output_buffer):\n"
+                                                  "    k2 = create_states_array()\n"
+                                                  "    k3 = create_states_array()\n"
+                                                  "    k4 = create_states_array()\n"
+                                                  "    y = create_states_array()\n"
+                                                  "\n"
+                                                  "    for step in range(0, n_steps):\n"
+                                                  "        voi = voi0+step*dt\n"
+                                                  "\n"
+                                                  "        compute_rates(voi, states, rates, variables)\n"
+                                                  "\n"
+                                                  "        for i in range(0, STATE_COUNT):\n"
+                                                  "            y[i] = states[i]+0.5*dt*rates[i]\n"
+                                                  "\n"
+                                                  "        compute_rates(voi+0.5*dt, y, k2, variables)\n"
+                                                  "\n"
+                                                  "        for i in range(0, STATE_COUNT):\n"
+                                                  "            y[i] = states[i]+0.5*dt*k2[i]\n"
+                                                  "\n"
+                                                  "        compute_rates(voi+0.5*dt, y, k3, variables)\n"
+                                                  "\n"
+                                                  "        for i in range(0, STATE_COUNT):\n"
+                                                  "            y[i] = states[i]+dt*k3[i]\n"
+                                                  "\n"
+                                                  "        compute_rates(voi+dt, y, k4, variables)\n"
+                                                  "\n"
+                                                  "        for i in range(0, STATE_COUNT):\n"
+                                                  "            states[i] += dt*(rates[i]+2.0*(k2[i]+k3[i])+k4[i])/6.0\n"
+                                                  "\n"
+                                                  "        if output_buffer is not None and output_stride != 0 and (step+1) % output_stride == 0:\n"
+                                                  "            output_buffer.append(states[:])\n";
+
+        mInterfaceIntegrateRushLarsenMethodString = "";
+        mImplementationIntegrateRushLarsenMethodString = "\n"
+                                                         "def integrate_rush_larsen(voi0, dt, n_steps, states, rates, variables, output_stride, output_buffer):\n"
+                                                         "    taus = create_states_array()\n"
+                                                         "    y_infs = create_states_array()\n"
+                                                         "\n"
+                                                         "    for step in range(0, n_steps):\n"
+                                                         "        voi = voi0+step*dt\n"
+                                                         "\n"
+                                                         "        compute_rates(voi, states, rates, variables)\n"
+                                                         "        compute_rush_larsen_coefficients(voi, states, variables, taus, y_infs)\n"
+                                                         "\n"
+                                                         "[CODE]"
+                                                         "\n"
+                                                         "        if output_buffer is not None and output_stride != 0 and (step+1) % output_stride == 0:\n"
+                                                         "            output_buffer.append(states[:])\n";
+
         mInterfaceComputeVariablesMethodFamWoevString = "";
         mImplementationComputeVariablesMethodFamWoevString = "\n"
                                                              "def compute_variables(variables):\n"
@@ -1123,6 +2008,484 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
 
         mCommandSeparatorString = "";
     }
+
+    if ((profile == GeneratorProfile::Profile::C)
+        && (mPrecision != GeneratorProfile::Precision::DOUBLE)) {
+        applyPrecision();
+    }
+
+    if (profile == GeneratorProfile::Profile::NUMPY) {
+        applyVectorisation();
+    }
+}
+
+static bool isIdentifierCharacter(char character)
+{
+    return (std::isalnum(character) != 0) || (character == '_');
+}
+
+static std::string singlePrecisionLiteralsCode(const std::string &code)
+{
+    // Add an "f" suffix to all the floating-point literals (e.g. 1.0, 0.5e-3)
+    // in the given code, but not to version numbers (e.g. 0.5.0) nor to parts
+    // of identifiers.
+
+    std::string res;
+    auto size = code.size();
+    size_t i = 0;
+
+    while (i < size) {
+        if ((std::isdigit(code[i]) == 0)
+            || ((i != 0) && (isIdentifierCharacter(code[i - 1]) || (code[i - 1] == '.')))) {
+            res += code[i++];
+
+            continue;
+        }
+
+        auto j = i;
+
+        while ((j < size) && (std::isdigit(code[j]) != 0)) {
+            ++j;
+        }
+
+        auto isLiteral = (j + 1 < size) && (code[j] == '.') && (std::isdigit(code[j + 1]) != 0);
+
+        if (isLiteral) {
+            ++j;
+
+            while ((j < size) && (std::isdigit(code[j]) != 0)) {
+                ++j;
+            }
+
+            if ((j < size) && ((code[j] == 'e') || (code[j] == 'E'))) {
+                auto k = j + 1;
+
+                if ((k < size) && ((code[k] == '+') || (code[k] == '-'))) {
+                    ++k;
+                }
+
+                if ((k < size) && (std::isdigit(code[k]) != 0)) {
+                    j = k;
+
+                    while ((j < size) && (std::isdigit(code[j]) != 0)) {
+                        ++j;
+                    }
+                }
+            }
+
+            isLiteral = (j == size) || (!isIdentifierCharacter(code[j]) && (code[j] != '.'));
+        }
+
+        res += code.substr(i, j - i) + (isLiteral ? "f" : "");
+        i = j;
+    }
+
+    return res;
+}
+
+void GeneratorProfile::GeneratorProfileImpl::applyPrecision()
+{
+    static const std::vector<std::string GeneratorProfileImpl::*> CODE_STRINGS = {
+        &GeneratorProfileImpl::mTrueString,
+        &GeneratorProfileImpl::mFalseString,
+        &GeneratorProfileImpl::mEString,
+        &GeneratorProfileImpl::mPiString,
+        &GeneratorProfileImpl::mXorFunctionString,
+        &GeneratorProfileImpl::mMinFunctionString,
+        &GeneratorProfileImpl::mMaxFunctionString,
+        &GeneratorProfileImpl::mSecFunctionString,
+        &GeneratorProfileImpl::mCscFunctionString,
+        &GeneratorProfileImpl::mCotFunctionString,
+        &GeneratorProfileImpl::mSechFunctionString,
+        &GeneratorProfileImpl::mCschFunctionString,
+        &GeneratorProfileImpl::mCothFunctionString,
+        &GeneratorProfileImpl::mAsecFunctionString,
+        &GeneratorProfileImpl::mAcscFunctionString,
+        &GeneratorProfileImpl::mAcotFunctionString,
+        &GeneratorProfileImpl::mAsechFunctionString,
+        &GeneratorProfileImpl::mAcschFunctionString,
+        &GeneratorProfileImpl::mAcothFunctionString,
+        &GeneratorProfileImpl::mLocalVariableDeclarationString,
+        &GeneratorProfileImpl::mRushLarsenStateUpdateString,
+        &GeneratorProfileImpl::mLookupTableDeclarationString,
+        &GeneratorProfileImpl::mLookupTableErrorString,
+        &GeneratorProfileImpl::mLookupTableValueMethodString,
+        &GeneratorProfileImpl::mLookupTableInitialisationString,
+        &GeneratorProfileImpl::mExternalVariableMethodTypeDefinitionFamString,
+        &GeneratorProfileImpl::mExternalVariableMethodTypeDefinitionFdmString,
+        &GeneratorProfileImpl::mRootFindingInfoObjectFamString,
+        &GeneratorProfileImpl::mRootFindingInfoObjectFdmString,
+        &GeneratorProfileImpl::mExternNlaSolveMethodString,
+        &GeneratorProfileImpl::mFindRootMethodFamString,
+        &GeneratorProfileImpl::mFindRootMethodFdmString,
+        &GeneratorProfileImpl::mObjectiveFunctionMethodFamString,
+        &GeneratorProfileImpl::mObjectiveFunctionMethodFdmString,
+        &GeneratorProfileImpl::mInterfaceCreateStatesArrayMethodString,
+        &GeneratorProfileImpl::mImplementationCreateStatesArrayMethodString,
+        &GeneratorProfileImpl::mInterfaceCreateVariablesArrayMethodString,
+        &GeneratorProfileImpl::mImplementationCreateVariablesArrayMethodString,
+        &GeneratorProfileImpl::mInterfaceDeleteArrayMethodString,
+        &GeneratorProfileImpl::mImplementationDeleteArrayMethodString,
+        &GeneratorProfileImpl::mInterfaceInitialiseVariablesMethodFamWoevString,
+        &GeneratorProfileImpl::mImplementationInitialiseVariablesMethodFamWoevString,
+        &GeneratorProfileImpl::mInterfaceInitialiseVariablesMethodFamWevString,
+        &GeneratorProfileImpl::mImplementationInitialiseVariablesMethodFamWevString,
+        &GeneratorProfileImpl::mInterfaceInitialiseVariablesMethodFdmWoevString,
+        &GeneratorProfileImpl::mImplementationInitialiseVariablesMethodFdmWoevString,
+        &GeneratorProfileImpl::mInterfaceInitialiseVariablesMethodFdmWevString,
+        &GeneratorProfileImpl::mImplementationInitialiseVariablesMethodFdmWevString,
+        &GeneratorProfileImpl::mInterfaceComputeComputedConstantsMethodString,
+        &GeneratorProfileImpl::mImplementationComputeComputedConstantsMethodString,
+        &GeneratorProfileImpl::mInterfaceComputeRatesMethodWoevString,
+        &GeneratorProfileImpl::mImplementationComputeRatesMethodWoevString,
+        &GeneratorProfileImpl::mInterfaceComputeRatesMethodWevString,
+        &GeneratorProfileImpl::mImplementationComputeRatesMethodWevString,
+        &GeneratorProfileImpl::mInterfaceComputeRushLarsenCoefficientsMethodString,
+        &GeneratorProfileImpl::mImplementationComputeRushLarsenCoefficientsMethodString,
+        &GeneratorProfileImpl::mImplementationComputeRatesMethodWithLocalVariablesString,
+        &GeneratorProfileImpl::mInterfaceInitialiseLookupTablesMethodString,
+        &GeneratorProfileImpl::mImplementationInitialiseLookupTablesMethodString,
+        &GeneratorProfileImpl::mInterfaceInitialiseEnsembleMethodString,
+        &GeneratorProfileImpl::mImplementationInitialiseEnsembleMethodString,
+        &GeneratorProfileImpl::mInterfaceComputeEnsembleRatesMethodString,
+        &GeneratorProfileImpl::mImplementationComputeEnsembleRatesMethodString,
+        &GeneratorProfileImpl::mInterfaceComputeEnsembleVariablesMethodString,
+        &GeneratorProfileImpl::mImplementationComputeEnsembleVariablesMethodString,
+        &GeneratorProfileImpl::mInterfaceIntegrateForwardEulerMethodString,
+        &GeneratorProfileImpl::mImplementationIntegrateForwardEulerMethodString,
+        &GeneratorProfileImpl::mInterfaceIntegrateRk4MethodString,
+        &GeneratorProfileImpl::mImplementationIntegrateRk4MethodString,
+        &GeneratorProfileImpl::mInterfaceIntegrateRushLarsenMethodString,
+        &GeneratorProfileImpl::mImplementationIntegrateRushLarsenMethodString,
+        &GeneratorProfileImpl::mInterfaceComputeVariablesMethodFamWoevString,
+        &GeneratorProfileImpl::mImplementationComputeVariablesMethodFamWoevString,
+        &GeneratorProfileImpl::mInterfaceComputeVariablesMethodFamWevString,
+        &GeneratorProfileImpl::mImplementationComputeVariablesMethodFamWevString,
+        &GeneratorProfileImpl::mInterfaceComputeVariablesMethodFdmWoevString,
+        &GeneratorProfileImpl::mImplementationComputeVariablesMethodFdmWoevString,
+        &GeneratorProfileImpl::mInterfaceComputeVariablesMethodFdmWevString,
+        &GeneratorProfileImpl::mImplementationComputeVariablesMethodFdmWevString
+    };
+
+    if (mPrecision == GeneratorProfile::Precision::SINGLE) {
+        // Use float rather than double, the single-precision version of the
+        // mathematical functions, and single-precision literals.
+
+        static const std::regex DOUBLE_REGEX("\\bdouble\\b");
+        static const std::regex FUNCTION_REGEX("\\b(pow|sqrt|fabs|exp|log|log10|ceil|floor|fmod|fmax|sin|cos|tan|sinh|cosh|tanh|asin|acos|atan|asinh|acosh|atanh)\\(");
+
+        for (auto codeString : CODE_STRINGS) {
+            this->*codeString = singlePrecisionLiteralsCode(std::regex_replace(std::regex_replace(this->*codeString, DOUBLE_REGEX, "float"), FUNCTION_REGEX, "$1f("));
+        }
+
+        mPowerString = "powf";
+        mSquareRootString = "sqrtf";
+        mAbsoluteValueString = "fabsf";
+        mExponentialString = "expf";
+        mNaturalLogarithmString = "logf";
+        mCommonLogarithmString = "log10f";
+        mCeilingString = "ceilf";
+        mFloorString = "floorf";
+        mRemString = "fmodf";
+
+        mSinString = "sinf";
+        mCosString = "cosf";
+        mTanString = "tanf";
+        mSinhString = "sinhf";
+        mCoshString = "coshf";
+        mTanhString = "tanhf";
+        mAsinString = "asinf";
+        mAcosString = "acosf";
+        mAtanString = "atanf";
+        mAsinhString = "asinhf";
+        mAcoshString = "acoshf";
+        mAtanhString = "atanhf";
+
+        mLiteralSuffixString = "f";
+    } else { // GeneratorProfile::Precision::MIXED.
+        // Keep the variable of integration, states, and rates in double
+        // precision, but use single precision for all the other variables,
+        // including the local ones. Since both kinds of arrays now coexist,
+        // deleteArray() takes a void pointer.
+
+        for (auto codeString : CODE_STRINGS) {
+            auto &code = this->*codeString;
+
+            while (code.find("double *variables") != std::string::npos) {
+                code = replace(code, "double *variables", "float *variables");
+            }
+
+            code = replace(code, "double * restrict variables", "float * restrict variables");
+            code = replace(code, "double * createVariablesArray", "float * createVariablesArray");
+            code = replace(code, "double *res = (double *) malloc(VARIABLE_COUNT*sizeof(double))", "float *res = (float *) malloc(VARIABLE_COUNT*sizeof(float))");
+            code = replace(code, "deleteArray(double *array)", "deleteArray(void *array)");
+        }
+
+        mLocalVariableDeclarationString = "float ";
+    }
+}
+
+void GeneratorProfile::GeneratorProfileImpl::applyVectorisation()
+{
+    // Vectorise the Python profile using NumPy: each row of the states, rates,
+    // and variables arrays holds the value of a given state, rate, or variable
+    // for all the instances of a model (i.e. instances are along the last
+    // axis), so that the generated code computes all of them at once.
+
+    // Relational and logical operators.
+
+    mEqFunctionString = "\n"
+                        "def eq_func(x, y):\n"
+                        "    return numpy.where(x == y, 1.0, 0.0)\n";
+    mNeqFunctionString = "\n"
+                         "def neq_func(x, y):\n"
+                         "    return numpy.where(x != y, 1.0, 0.0)\n";
+    mLtFunctionString = "\n"
+                        "def lt_func(x, y):\n"
+                        "    return numpy.where(x < y, 1.0, 0.0)\n";
+    mLeqFunctionString = "\n"
+                         "def leq_func(x, y):\n"
+                         "    return numpy.where(x <= y, 1.0, 0.0)\n";
+    mGtFunctionString = "\n"
+                        "def gt_func(x, y):\n"
+                        "    return numpy.where(x > y, 1.0, 0.0)\n";
+    mGeqFunctionString = "\n"
+                         "def geq_func(x, y):\n"
+                         "    return numpy.where(x >= y, 1.0, 0.0)\n";
+    mAndFunctionString = "\n"
+                         "def and_func(x, y):\n"
+                         "    return numpy.where(numpy.logical_and(x, y), 1.0, 0.0)\n";
+    mOrFunctionString = "\n"
+                        "def or_func(x, y):\n"
+                        "    return numpy.where(numpy.logical_or(x, y), 1.0, 0.0)\n";
+    mXorFunctionString = "\n"
+                         "def xor_func(x, y):\n"
+                         "    return numpy.where(numpy.logical_xor(x, y), 1.0, 0.0)\n";
+    mNotFunctionString = "\n"
+                         "def not_func(x):\n"
+                         "    return numpy.where(numpy.logical_not(x), 1.0, 0.0)\n";
+
+    // Arithmetic operators and functions.
+
+    mPowerString = "numpy.power";
+    mSquareRootString = "numpy.sqrt";
+    mAbsoluteValueString = "numpy.fabs";
+    mExponentialString = "numpy.exp";
+    mNaturalLogarithmString = "numpy.log";
+    mCommonLogarithmString = "numpy.log10";
+    mCeilingString = "numpy.ceil";
+    mFloorString = "numpy.floor";
+    mMinString = "numpy.minimum";
+    mMaxString = "numpy.maximum";
+    mRemString = "numpy.fmod";
+
+    mMinFunctionString = "";
+    mMaxFunctionString = "";
+
+    // Trigonometric operators and functions.
+
+    mSinString = "numpy.sin";
+    mCosString = "numpy.cos";
+    mTanString = "numpy.tan";
+    mSinhString = "numpy.sinh";
+    mCoshString = "numpy.cosh";
+    mTanhString = "numpy.tanh";
+    mAsinString = "numpy.arcsin";
+    mAcosString = "numpy.arccos";
+    mAtanString = "numpy.arctan";
+    mAsinhString = "numpy.arcsinh";
+    mAcoshString = "numpy.arccosh";
+    mAtanhString = "numpy.arctanh";
+
+    mSecFunctionString = "\n"
+                         "def sec(x):\n"
+                         "    return 1.0/numpy.cos(x)\n";
+    mCscFunctionString = "\n"
+                         "def csc(x):\n"
+                         "    return 1.0/numpy.sin(x)\n";
+    mCotFunctionString = "\n"
+                         "def cot(x):\n"
+                         "    return 1.0/numpy.tan(x)\n";
+    mSechFunctionString = "\n"
+                          "def sech(x):\n"
+                          "    return 1.0/numpy.cosh(x)\n";
+    mCschFunctionString = "\n"
+                          "def csch(x):\n"
+                          "    return 1.0/numpy.sinh(x)\n";
+    mCothFunctionString = "\n"
+                          "def coth(x):\n"
+                          "    return 1.0/numpy.tanh(x)\n";
+    mAsecFunctionString = "\n"
+                          "def asec(x):\n"
+                          "    return numpy.arccos(1.0/x)\n";
+    mAcscFunctionString = "\n"
+                          "def acsc(x):\n"
+                          "    return numpy.arcsin(1.0/x)\n";
+    mAcotFunctionString = "\n"
+                          "def acot(x):\n"
+                          "    return numpy.arctan(1.0/x)\n";
+    mAsechFunctionString = "\n"
+                           "def asech(x):\n"
+                           "    one_over_x = 1.0/x\n"
+                           "\n"
+                           "    return numpy.log(one_over_x+numpy.sqrt(one_over_x*one_over_x-1.0))\n";
+    mAcschFunctionString = "\n"
+                           "def acsch(x):\n"
+                           "    one_over_x = 1.0/x\n"
+                           "\n"
+                           "    return numpy.log(one_over_x+numpy.sqrt(one_over_x*one_over_x+1.0))\n";
+    mAcothFunctionString = "\n"
+                           "def acoth(x):\n"
+                           "    one_over_x = 1.0/x\n"
+                           "\n"
+                           "    return 0.5*numpy.log((1.0+one_over_x)/(1.0-one_over_x))\n";
+
+    // Piecewise statement, which gets generated as nested calls to
+    // numpy.where(), i.e. all its pieces are evaluated.
+
+    mConditionalOperatorIfString = "numpy.where([CONDITION], [IF_STATEMENT]";
+    mConditionalOperatorElseString = ", [ELSE_STATEMENT])";
+
+    // Constants.
+
+    mInfString = "numpy.inf";
+    mNanString = "numpy.nan";
+
+    // Miscellaneous.
+
+    mImplementationHeaderString = "from enum import Enum\n"
+                                  "\n"
+                                  "import numpy\n"
+                                  "\n";
+
+    mRushLarsenStateUpdateString = "        states[[INDEX]] = y_infs[[INDEX]]+(states[[INDEX]]-y_infs[[INDEX]])*numpy.exp(-dt/taus[[INDEX]])\n";
+
+    // Lookup tables, which are not supported since their rows would have to be
+    // tabulated for each instance (the constants on which they depend may
+    // differ from one instance to another), i.e. lookup tables are ignored.
+
+    mLookupTableDeclarationString = "";
+    mLookupTableEntryString = "";
+    mLookupTableValueCallString = "";
+    mLookupTableErrorString = "";
+    mLookupTableValueMethodString = "";
+    mLookupTableInitialisationString = "";
+    mImplementationInitialiseLookupTablesMethodString = "";
+
+    // Ensemble methods, which are nothing more than the model methods since
+    // these already compute all the instances at once.
+
+    mEnsembleParameterAssignmentString = "    variables[[INDEX]] = parameters[[PARAMETER_INDEX]]\n";
+
+    mImplementationInitialiseEnsembleMethodString = "\n"
+                                                    "def initialise_ensemble(parameters, states, rates, variables):\n"
+                                                    "    initialise_variables(states, rates, variables)\n"
+                                                    "[CODE]"
+                                                    "    compute_computed_constants(variables)\n";
+    mImplementationComputeEnsembleRatesMethodString = "\n"
+                                                      "def compute_ensemble_rates(voi, states, rates, variables):\n"
+                                                      "    compute_rates(voi, states, rates, variables)\n";
+    mImplementationComputeEnsembleVariablesMethodString = "\n"
+                                                          "def compute_ensemble_variables(voi, states, rates, variables):\n"
+                                                          "    compute_variables(voi, states, rates, variables)\n";
+
+    // Root finding, where u holds the value of the unknowns for all the
+    // instances.
+
+    mFindRootMethodFamString = "\n"
+                               "def find_root_[INDEX](variables):\n"
+                               "    u = numpy.full(([SIZE], variables.shape[1]), numpy.nan)\n"
+                               "\n"
+                               "[CODE]";
+    mFindRootMethodFdmString = "\n"
+                               "def find_root_[INDEX](voi, states, rates, variables):\n"
+                               "    u = numpy.full(([SIZE], variables.shape[1]), numpy.nan)\n"
+                               "\n"
+                               "[CODE]";
+
+    // Arrays, which have one column per instance.
+
+    mImplementationCreateStatesArrayMethodString = "\n"
+                                                   "def create_states_array(instance_count=1):\n"
+                                                   "    return numpy.full((STATE_COUNT, instance_count), numpy.nan)\n";
+    mImplementationCreateVariablesArrayMethodString = "\n"
+                                                      "def create_variables_array(instance_count=1):\n"
+                                                      "    return numpy.full((VARIABLE_COUNT, instance_count), numpy.nan)\n";
+
+    // Integrate methods, which update all the states at once.
+
+    mImplementationIntegrateForwardEulerMethodString = "\n"
+                                                       "def integrate_forward_euler(voi0, dt, n_steps, states, rates, variables, output_stride, output_buffer):\n"
+                                                       "    for step in range(0, n_steps):\n"
+                                                       "        compute_rates(voi0+step*dt, states, rates, variables)\n"
+                                                       "\n"
+                                                       "        states += dt*rates\n"
+                                                       "\n"
+                                                       "        if output_buffer is not None and output_stride != 0 and (step+1) % output_stride == 0:\n"
+                                                       "            output_buffer.append(states.copy())\n";
+    mImplementationIntegrateRk4MethodString = "\n"
+                                              "def integrate_rk4(voi0, dt, n_steps, states, rates, variables, output_stride, output_buffer):\n"
+                                              "    k2 = numpy.empty_like(states)\n"
+                                              "    k3 = numpy.empty_like(states)\n"
+                                              "    k4 = numpy.empty_like(states)\n"
+                                              "\n"
+                                              "    for step in range(0, n_steps):\n"
+                                              "        voi = voi0+step*dt\n"
+                                              "\n"
+                                              "        compute_rates(voi, states, rates, variables)\n"
+                                              "        compute_rates(voi+0.5*dt, states+0.5*dt*rates, k2, variables)\n"
+                                              "        compute_rates(voi+0.5*dt, states+0.5*dt*k2, k3, variables)\n"
+                                              "        compute_rates(voi+dt, states+dt*k3, k4, variables)\n"
+                                              "\n"
+                                              "        states += dt*(rates+2.0*(k2+k3)+k4)/6.0\n"
+                                              "\n"
+                                              "        if output_buffer is not None and output_stride != 0 and (step+1) % output_stride == 0:\n"
+                                              "            output_buffer.append(states.copy())\n";
+    mImplementationIntegrateRushLarsenMethodString = "\n"
+                                                     "def integrate_rush_larsen(voi0, dt, n_steps, states, rates, variables, output_stride, output_buffer):\n"
+                                                     "    taus = numpy.empty_like(states)\n"
+                                                     "    y_infs = numpy.empty_like(states)\n"
+                                                     "\n"
+                                                     "    for step in range(0, n_steps):\n"
+                                                     "        voi = voi0+step*dt\n"
+                                                     "\n"
+                                                     "        compute_rates(voi, states, rates, variables)\n"
+                                                     "        compute_rush_larsen_coefficients(voi, states, variables, taus, y_infs)\n"
+                                                     "\n"
+                                                     "[CODE]"
+                                                     "\n"
+                                                     "        if output_buffer is not None and output_stride != 0 and (step+1) % output_stride == 0:\n"
+                                                     "            output_buffer.append(states.copy())\n";
+}
+
+const ProfileTemplate *GeneratorProfile::GeneratorProfileImpl::profileTemplate(const std::string &string,
+                                                                              const std::vector<std::string> &tags) const
+{
+    // Forget about our precompiled templates if we have been modified since
+    // we last compiled one of them.
+
+    if (mProfileTemplatesVersion != mVersion) {
+        mProfileTemplates.clear();
+
+        mProfileTemplatesVersion = mVersion;
+    }
+
+    // Retrieve (or compile, if needed) the template for the given string and
+    // tags.
+
+    auto key = string;
+
+    for (const auto &tag : tags) {
+        key += '\0' + tag;
+    }
+
+    auto profileTemplate = mProfileTemplates.find(key);
+
+    if (profileTemplate == mProfileTemplates.end()) {
+        profileTemplate = mProfileTemplates.emplace(key, compileProfileTemplate(string, tags)).first;
+    }
+
+    return &profileTemplate->second;
 }
 
 GeneratorProfile::GeneratorProfile(Profile profile)
@@ -1148,26 +2511,84 @@ GeneratorProfile::Profile GeneratorProfile::profile() const
 
 static const std::map<GeneratorProfile::Profile, std::string> profileToString = {
     {GeneratorProfile::Profile::C, "c"},
-    {GeneratorProfile::Profile::PYTHON, "python"}};
+    {GeneratorProfile::Profile::PYTHON, "python"},
+    {GeneratorProfile::Profile::CPP, "cpp"},
+    {GeneratorProfile::Profile::NUMPY, "numpy"}};
+
+std::string GeneratorProfile::profileAsString(Profile profile)
+{
+    return profileToString.at(profile);
+}
+
+void GeneratorProfile::setProfile(Profile profile)
+{
+    mPimpl->loadProfile(profile);
+}
+
+GeneratorProfile::Precision GeneratorProfile::precision() const
+{
+    return mPimpl->mPrecision;
+}
+
+static const std::map<GeneratorProfile::Precision, std::string> precisionToString = {
+    {GeneratorProfile::Precision::DOUBLE, "double"},
+    {GeneratorProfile::Precision::SINGLE, "single"},
+    {GeneratorProfile::Precision::MIXED, "mixed"}};
+
+std::string GeneratorProfile::precisionAsString(Precision precision)
+{
+    return precisionToString.at(precision);
+}
+
+void GeneratorProfile::setPrecision(Precision precision)
+{
+    mPimpl->mPrecision = precision;
+
+    mPimpl->loadProfile(mPimpl->mProfile);
+}
+
+bool GeneratorProfile::hasInterface() const
+{
+    return mPimpl->mHasInterface;
+}
+
+void GeneratorProfile::setHasInterface(bool hasInterface)
+{
+    mPimpl->mHasInterface = hasInterface;
+    ++mPimpl->mVersion;
+}
+
+bool GeneratorProfile::hasComputeRushLarsenCoefficientsMethod() const
+{
+    return mPimpl->mHasComputeRushLarsenCoefficientsMethod;
+}
+
+void GeneratorProfile::setHasComputeRushLarsenCoefficientsMethod(bool hasComputeRushLarsenCoefficientsMethod)
+{
+    mPimpl->mHasComputeRushLarsenCoefficientsMethod = hasComputeRushLarsenCoefficientsMethod;
+    ++mPimpl->mVersion;
+}
 
-std::string GeneratorProfile::profileAsString(Profile profile)
+bool GeneratorProfile::hasLocalVariablesInComputeRates() const
 {
-    return profileToString.at(profile);
+    return mPimpl->mHasLocalVariablesInComputeRates;
 }
 
-void GeneratorProfile::setProfile(Profile profile)
+void GeneratorProfile::setHasLocalVariablesInComputeRates(bool hasLocalVariablesInComputeRates)
 {
-    mPimpl->loadProfile(profile);
+    mPimpl->mHasLocalVariablesInComputeRates = hasLocalVariablesInComputeRates;
+    ++mPimpl->mVersion;
 }
 
-bool GeneratorProfile::hasInterface() const
+bool GeneratorProfile::hasIntegrateMethods() const
 {
-    return mPimpl->mHasInterface;
+    return mPimpl->mHasIntegrateMethods;
 }
 
-void GeneratorProfile::setHasInterface(bool hasInterface)
+void GeneratorProfile::setHasIntegrateMethods(bool hasIntegrateMethods)
 {
-    mPimpl->mHasInterface = hasInterface;
+    mPimpl->mHasIntegrateMethods = hasIntegrateMethods;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::equalityString() const
@@ -1178,6 +2599,7 @@ std::string GeneratorProfile::equalityString() const
 void GeneratorProfile::setEqualityString(const std::string &equalityString)
 {
     mPimpl->mEqualityString = equalityString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::eqString() const
@@ -1188,6 +2610,7 @@ std::string GeneratorProfile::eqString() const
 void GeneratorProfile::setEqString(const std::string &eqString)
 {
     mPimpl->mEqString = eqString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::neqString() const
@@ -1198,6 +2621,7 @@ std::string GeneratorProfile::neqString() const
 void GeneratorProfile::setNeqString(const std::string &neqString)
 {
     mPimpl->mNeqString = neqString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::ltString() const
@@ -1208,6 +2632,7 @@ std::string GeneratorProfile::ltString() const
 void GeneratorProfile::setLtString(const std::string &ltString)
 {
     mPimpl->mLtString = ltString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::leqString() const
@@ -1218,6 +2643,7 @@ std::string GeneratorProfile::leqString() const
 void GeneratorProfile::setLeqString(const std::string &leqString)
 {
     mPimpl->mLeqString = leqString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::gtString() const
@@ -1228,6 +2654,7 @@ std::string GeneratorProfile::gtString() const
 void GeneratorProfile::setGtString(const std::string &gtString)
 {
     mPimpl->mGtString = gtString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::geqString() const
@@ -1238,6 +2665,7 @@ std::string GeneratorProfile::geqString() const
 void GeneratorProfile::setGeqString(const std::string &geqString)
 {
     mPimpl->mGeqString = geqString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::andString() const
@@ -1248,6 +2676,7 @@ std::string GeneratorProfile::andString() const
 void GeneratorProfile::setAndString(const std::string &andString)
 {
     mPimpl->mAndString = andString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::orString() const
@@ -1258,6 +2687,7 @@ std::string GeneratorProfile::orString() const
 void GeneratorProfile::setOrString(const std::string &orString)
 {
     mPimpl->mOrString = orString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::xorString() const
@@ -1268,6 +2698,7 @@ std::string GeneratorProfile::xorString() const
 void GeneratorProfile::setXorString(const std::string &xorString)
 {
     mPimpl->mXorString = xorString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::notString() const
@@ -1278,6 +2709,7 @@ std::string GeneratorProfile::notString() const
 void GeneratorProfile::setNotString(const std::string &notString)
 {
     mPimpl->mNotString = notString;
+    ++mPimpl->mVersion;
 }
 
 bool GeneratorProfile::hasEqOperator() const
@@ -1288,6 +2720,7 @@ bool GeneratorProfile::hasEqOperator() const
 void GeneratorProfile::setHasEqOperator(bool hasEqOperator)
 {
     mPimpl->mHasEqOperator = hasEqOperator;
+    ++mPimpl->mVersion;
 }
 
 bool GeneratorProfile::hasNeqOperator() const
@@ -1298,6 +2731,7 @@ bool GeneratorProfile::hasNeqOperator() const
 void GeneratorProfile::setHasNeqOperator(bool hasNeqOperator)
 {
     mPimpl->mHasNeqOperator = hasNeqOperator;
+    ++mPimpl->mVersion;
 }
 
 bool GeneratorProfile::hasLtOperator() const
@@ -1308,6 +2742,7 @@ bool GeneratorProfile::hasLtOperator() const
 void GeneratorProfile::setHasLtOperator(bool hasLtOperator)
 {
     mPimpl->mHasLtOperator = hasLtOperator;
+    ++mPimpl->mVersion;
 }
 
 bool GeneratorProfile::hasLeqOperator() const
@@ -1318,6 +2753,7 @@ bool GeneratorProfile::hasLeqOperator() const
 void GeneratorProfile::setHasLeqOperator(bool hasLeqOperator)
 {
     mPimpl->mHasLeqOperator = hasLeqOperator;
+    ++mPimpl->mVersion;
 }
 
 bool GeneratorProfile::hasGtOperator() const
@@ -1328,6 +2764,7 @@ bool GeneratorProfile::hasGtOperator() const
 void GeneratorProfile::setHasGtOperator(bool hasGtOperator)
 {
     mPimpl->mHasGtOperator = hasGtOperator;
+    ++mPimpl->mVersion;
 }
 
 bool GeneratorProfile::hasGeqOperator() const
@@ -1338,6 +2775,7 @@ bool GeneratorProfile::hasGeqOperator() const
 void GeneratorProfile::setHasGeqOperator(bool hasGeqOperator)
 {
     mPimpl->mHasGeqOperator = hasGeqOperator;
+    ++mPimpl->mVersion;
 }
 
 bool GeneratorProfile::hasAndOperator() const
@@ -1348,6 +2786,7 @@ bool GeneratorProfile::hasAndOperator() const
 void GeneratorProfile::setHasAndOperator(bool hasAndOperator)
 {
     mPimpl->mHasAndOperator = hasAndOperator;
+    ++mPimpl->mVersion;
 }
 
 bool GeneratorProfile::hasOrOperator() const
@@ -1358,6 +2797,7 @@ bool GeneratorProfile::hasOrOperator() const
 void GeneratorProfile::setHasOrOperator(bool hasOrOperator)
 {
     mPimpl->mHasOrOperator = hasOrOperator;
+    ++mPimpl->mVersion;
 }
 
 bool GeneratorProfile::hasXorOperator() const
@@ -1368,6 +2808,7 @@ bool GeneratorProfile::hasXorOperator() const
 void GeneratorProfile::setHasXorOperator(bool hasXorOperator)
 {
     mPimpl->mHasXorOperator = hasXorOperator;
+    ++mPimpl->mVersion;
 }
 
 bool GeneratorProfile::hasNotOperator() const
@@ -1378,6 +2819,7 @@ bool GeneratorProfile::hasNotOperator() const
 void GeneratorProfile::setHasNotOperator(bool hasNotOperator)
 {
     mPimpl->mHasNotOperator = hasNotOperator;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::plusString() const
@@ -1388,6 +2830,7 @@ std::string GeneratorProfile::plusString() const
 void GeneratorProfile::setPlusString(const std::string &plusString)
 {
     mPimpl->mPlusString = plusString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::minusString() const
@@ -1398,6 +2841,7 @@ std::string GeneratorProfile::minusString() const
 void GeneratorProfile::setMinusString(const std::string &minusString)
 {
     mPimpl->mMinusString = minusString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::timesString() const
@@ -1408,6 +2852,7 @@ std::string GeneratorProfile::timesString() const
 void GeneratorProfile::setTimesString(const std::string &timesString)
 {
     mPimpl->mTimesString = timesString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::divideString() const
@@ -1418,6 +2863,7 @@ std::string GeneratorProfile::divideString() const
 void GeneratorProfile::setDivideString(const std::string &divideString)
 {
     mPimpl->mDivideString = divideString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::powerString() const
@@ -1428,6 +2874,7 @@ std::string GeneratorProfile::powerString() const
 void GeneratorProfile::setPowerString(const std::string &powerString)
 {
     mPimpl->mPowerString = powerString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::squareRootString() const
@@ -1438,6 +2885,7 @@ std::string GeneratorProfile::squareRootString() const
 void GeneratorProfile::setSquareRootString(const std::string &squareRootString)
 {
     mPimpl->mSquareRootString = squareRootString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::squareString() const
@@ -1448,6 +2896,7 @@ std::string GeneratorProfile::squareString() const
 void GeneratorProfile::setSquareString(const std::string &squareString)
 {
     mPimpl->mSquareString = squareString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::absoluteValueString() const
@@ -1458,6 +2907,7 @@ std::string GeneratorProfile::absoluteValueString() const
 void GeneratorProfile::setAbsoluteValueString(const std::string &absoluteValueString)
 {
     mPimpl->mAbsoluteValueString = absoluteValueString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::exponentialString() const
@@ -1468,6 +2918,7 @@ std::string GeneratorProfile::exponentialString() const
 void GeneratorProfile::setExponentialString(const std::string &exponentialString)
 {
     mPimpl->mExponentialString = exponentialString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::naturalLogarithmString() const
@@ -1478,6 +2929,7 @@ std::string GeneratorProfile::naturalLogarithmString() const
 void GeneratorProfile::setNaturalLogarithmString(const std::string &naturalLogarithmString)
 {
     mPimpl->mNaturalLogarithmString = naturalLogarithmString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::commonLogarithmString() const
@@ -1488,6 +2940,7 @@ std::string GeneratorProfile::commonLogarithmString() const
 void GeneratorProfile::setCommonLogarithmString(const std::string &commonLogarithmString)
 {
     mPimpl->mCommonLogarithmString = commonLogarithmString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::ceilingString() const
@@ -1498,6 +2951,7 @@ std::string GeneratorProfile::ceilingString() const
 void GeneratorProfile::setCeilingString(const std::string &ceilingString)
 {
     mPimpl->mCeilingString = ceilingString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::floorString() const
@@ -1508,6 +2962,7 @@ std::string GeneratorProfile::floorString() const
 void GeneratorProfile::setFloorString(const std::string &floorString)
 {
     mPimpl->mFloorString = floorString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::minString() const
@@ -1518,6 +2973,7 @@ std::string GeneratorProfile::minString() const
 void GeneratorProfile::setMinString(const std::string &minString)
 {
     mPimpl->mMinString = minString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::maxString() const
@@ -1528,6 +2984,7 @@ std::string GeneratorProfile::maxString() const
 void GeneratorProfile::setMaxString(const std::string &maxString)
 {
     mPimpl->mMaxString = maxString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::remString() const
@@ -1538,6 +2995,7 @@ std::string GeneratorProfile::remString() const
 void GeneratorProfile::setRemString(const std::string &remString)
 {
     mPimpl->mRemString = remString;
+    ++mPimpl->mVersion;
 }
 
 bool GeneratorProfile::hasPowerOperator() const
@@ -1548,6 +3006,7 @@ bool GeneratorProfile::hasPowerOperator() const
 void GeneratorProfile::setHasPowerOperator(bool hasPowerOperator)
 {
     mPimpl->mHasPowerOperator = hasPowerOperator;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::sinString() const
@@ -1558,6 +3017,7 @@ std::string GeneratorProfile::sinString() const
 void GeneratorProfile::setSinString(const std::string &sinString)
 {
     mPimpl->mSinString = sinString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::cosString() const
@@ -1568,6 +3028,7 @@ std::string GeneratorProfile::cosString() const
 void GeneratorProfile::setCosString(const std::string &cosString)
 {
     mPimpl->mCosString = cosString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::tanString() const
@@ -1578,6 +3039,7 @@ std::string GeneratorProfile::tanString() const
 void GeneratorProfile::setTanString(const std::string &tanString)
 {
     mPimpl->mTanString = tanString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::secString() const
@@ -1588,6 +3050,7 @@ std::string GeneratorProfile::secString() const
 void GeneratorProfile::setSecString(const std::string &secString)
 {
     mPimpl->mSecString = secString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::cscString() const
@@ -1598,6 +3061,7 @@ std::string GeneratorProfile::cscString() const
 void GeneratorProfile::setCscString(const std::string &cscString)
 {
     mPimpl->mCscString = cscString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::cotString() const
@@ -1608,6 +3072,7 @@ std::string GeneratorProfile::cotString() const
 void GeneratorProfile::setCotString(const std::string &cotString)
 {
     mPimpl->mCotString = cotString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::sinhString() const
@@ -1618,6 +3083,7 @@ std::string GeneratorProfile::sinhString() const
 void GeneratorProfile::setSinhString(const std::string &sinhString)
 {
     mPimpl->mSinhString = sinhString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::coshString() const
@@ -1628,6 +3094,7 @@ std::string GeneratorProfile::coshString() const
 void GeneratorProfile::setCoshString(const std::string &coshString)
 {
     mPimpl->mCoshString = coshString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::tanhString() const
@@ -1638,6 +3105,7 @@ std::string GeneratorProfile::tanhString() const
 void GeneratorProfile::setTanhString(const std::string &tanhString)
 {
     mPimpl->mTanhString = tanhString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::sechString() const
@@ -1648,6 +3116,7 @@ std::string GeneratorProfile::sechString() const
 void GeneratorProfile::setSechString(const std::string &sechString)
 {
     mPimpl->mSechString = sechString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::cschString() const
@@ -1658,6 +3127,7 @@ std::string GeneratorProfile::cschString() const
 void GeneratorProfile::setCschString(const std::string &cschString)
 {
     mPimpl->mCschString = cschString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::cothString() const
@@ -1668,6 +3138,7 @@ std::string GeneratorProfile::cothString() const
 void GeneratorProfile::setCothString(const std::string &cothString)
 {
     mPimpl->mCothString = cothString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::asinString() const
@@ -1678,6 +3149,7 @@ std::string GeneratorProfile::asinString() const
 void GeneratorProfile::setAsinString(const std::string &asinString)
 {
     mPimpl->mAsinString = asinString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::acosString() const
@@ -1688,6 +3160,7 @@ std::string GeneratorProfile::acosString() const
 void GeneratorProfile::setAcosString(const std::string &acosString)
 {
     mPimpl->mAcosString = acosString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::atanString() const
@@ -1698,6 +3171,7 @@ std::string GeneratorProfile::atanString() const
 void GeneratorProfile::setAtanString(const std::string &atanString)
 {
     mPimpl->mAtanString = atanString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::asecString() const
@@ -1708,6 +3182,7 @@ std::string GeneratorProfile::asecString() const
 void GeneratorProfile::setAsecString(const std::string &asecString)
 {
     mPimpl->mAsecString = asecString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::acscString() const
@@ -1718,6 +3193,7 @@ std::string GeneratorProfile::acscString() const
 void GeneratorProfile::setAcscString(const std::string &acscString)
 {
     mPimpl->mAcscString = acscString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::acotString() const
@@ -1728,6 +3204,7 @@ std::string GeneratorProfile::acotString() const
 void GeneratorProfile::setAcotString(const std::string &acotString)
 {
     mPimpl->mAcotString = acotString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::asinhString() const
@@ -1738,6 +3215,7 @@ std::string GeneratorProfile::asinhString() const
 void GeneratorProfile::setAsinhString(const std::string &asinhString)
 {
     mPimpl->mAsinhString = asinhString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::acoshString() const
@@ -1748,6 +3226,7 @@ std::string GeneratorProfile::acoshString() const
 void GeneratorProfile::setAcoshString(const std::string &acoshString)
 {
     mPimpl->mAcoshString = acoshString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::atanhString() const
@@ -1758,6 +3237,7 @@ std::string GeneratorProfile::atanhString() const
 void GeneratorProfile::setAtanhString(const std::string &atanhString)
 {
     mPimpl->mAtanhString = atanhString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::asechString() const
@@ -1768,6 +3248,7 @@ std::string GeneratorProfile::asechString() const
 void GeneratorProfile::setAsechString(const std::string &asechString)
 {
     mPimpl->mAsechString = asechString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::acschString() const
@@ -1778,6 +3259,7 @@ std::string GeneratorProfile::acschString() const
 void GeneratorProfile::setAcschString(const std::string &acschString)
 {
     mPimpl->mAcschString = acschString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::acothString() const
@@ -1788,6 +3270,7 @@ std::string GeneratorProfile::acothString() const
 void GeneratorProfile::setAcothString(const std::string &acothString)
 {
     mPimpl->mAcothString = acothString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::conditionalOperatorIfString() const
@@ -1798,6 +3281,7 @@ std::string GeneratorProfile::conditionalOperatorIfString() const
 void GeneratorProfile::setConditionalOperatorIfString(const std::string &conditionalOperatorIfString)
 {
     mPimpl->mConditionalOperatorIfString = conditionalOperatorIfString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::conditionalOperatorElseString() const
@@ -1808,6 +3292,7 @@ std::string GeneratorProfile::conditionalOperatorElseString() const
 void GeneratorProfile::setConditionalOperatorElseString(const std::string &conditionalOperatorElseString)
 {
     mPimpl->mConditionalOperatorElseString = conditionalOperatorElseString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::piecewiseIfString() const
@@ -1818,6 +3303,7 @@ std::string GeneratorProfile::piecewiseIfString() const
 void GeneratorProfile::setPiecewiseIfString(const std::string &piecewiseIfString)
 {
     mPimpl->mPiecewiseIfString = piecewiseIfString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::piecewiseElseString() const
@@ -1828,6 +3314,7 @@ std::string GeneratorProfile::piecewiseElseString() const
 void GeneratorProfile::setPiecewiseElseString(const std::string &piecewiseElseString)
 {
     mPimpl->mPiecewiseElseString = piecewiseElseString;
+    ++mPimpl->mVersion;
 }
 
 bool GeneratorProfile::hasConditionalOperator() const
@@ -1838,6 +3325,7 @@ bool GeneratorProfile::hasConditionalOperator() const
 void GeneratorProfile::setHasConditionalOperator(bool hasConditionalOperator)
 {
     mPimpl->mHasConditionalOperator = hasConditionalOperator;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::trueString() const
@@ -1848,6 +3336,7 @@ std::string GeneratorProfile::trueString() const
 void GeneratorProfile::setTrueString(const std::string &trueString)
 {
     mPimpl->mTrueString = trueString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::falseString() const
@@ -1858,6 +3347,7 @@ std::string GeneratorProfile::falseString() const
 void GeneratorProfile::setFalseString(const std::string &falseString)
 {
     mPimpl->mFalseString = falseString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::eString() const
@@ -1868,6 +3358,7 @@ std::string GeneratorProfile::eString() const
 void GeneratorProfile::setEString(const std::string &eString)
 {
     mPimpl->mEString = eString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::piString() const
@@ -1878,6 +3369,7 @@ std::string GeneratorProfile::piString() const
 void GeneratorProfile::setPiString(const std::string &piString)
 {
     mPimpl->mPiString = piString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::infString() const
@@ -1888,6 +3380,7 @@ std::string GeneratorProfile::infString() const
 void GeneratorProfile::setInfString(const std::string &infString)
 {
     mPimpl->mInfString = infString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::nanString() const
@@ -1898,6 +3391,18 @@ std::string GeneratorProfile::nanString() const
 void GeneratorProfile::setNanString(const std::string &nanString)
 {
     mPimpl->mNanString = nanString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::literalSuffixString() const
+{
+    return mPimpl->mLiteralSuffixString;
+}
+
+void GeneratorProfile::setLiteralSuffixString(const std::string &literalSuffixString)
+{
+    mPimpl->mLiteralSuffixString = literalSuffixString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::eqFunctionString() const
@@ -1908,6 +3413,7 @@ std::string GeneratorProfile::eqFunctionString() const
 void GeneratorProfile::setEqFunctionString(const std::string &eqFunctionString)
 {
     mPimpl->mEqFunctionString = eqFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::neqFunctionString() const
@@ -1918,6 +3424,7 @@ std::string GeneratorProfile::neqFunctionString() const
 void GeneratorProfile::setNeqFunctionString(const std::string &neqFunctionString)
 {
     mPimpl->mNeqFunctionString = neqFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::ltFunctionString() const
@@ -1928,6 +3435,7 @@ std::string GeneratorProfile::ltFunctionString() const
 void GeneratorProfile::setLtFunctionString(const std::string &ltFunctionString)
 {
     mPimpl->mLtFunctionString = ltFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::leqFunctionString() const
@@ -1938,6 +3446,7 @@ std::string GeneratorProfile::leqFunctionString() const
 void GeneratorProfile::setLeqFunctionString(const std::string &leqFunctionString)
 {
     mPimpl->mLeqFunctionString = leqFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::gtFunctionString() const
@@ -1948,6 +3457,7 @@ std::string GeneratorProfile::gtFunctionString() const
 void GeneratorProfile::setGtFunctionString(const std::string &gtFunctionString)
 {
     mPimpl->mGtFunctionString = gtFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::geqFunctionString() const
@@ -1958,6 +3468,7 @@ std::string GeneratorProfile::geqFunctionString() const
 void GeneratorProfile::setGeqFunctionString(const std::string &geqFunctionString)
 {
     mPimpl->mGeqFunctionString = geqFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::andFunctionString() const
@@ -1968,6 +3479,7 @@ std::string GeneratorProfile::andFunctionString() const
 void GeneratorProfile::setAndFunctionString(const std::string &andFunctionString)
 {
     mPimpl->mAndFunctionString = andFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::orFunctionString() const
@@ -1978,6 +3490,7 @@ std::string GeneratorProfile::orFunctionString() const
 void GeneratorProfile::setOrFunctionString(const std::string &orFunctionString)
 {
     mPimpl->mOrFunctionString = orFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::xorFunctionString() const
@@ -1988,6 +3501,7 @@ std::string GeneratorProfile::xorFunctionString() const
 void GeneratorProfile::setXorFunctionString(const std::string &xorFunctionString)
 {
     mPimpl->mXorFunctionString = xorFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::notFunctionString() const
@@ -1998,6 +3512,7 @@ std::string GeneratorProfile::notFunctionString() const
 void GeneratorProfile::setNotFunctionString(const std::string &notFunctionString)
 {
     mPimpl->mNotFunctionString = notFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::minFunctionString() const
@@ -2008,6 +3523,7 @@ std::string GeneratorProfile::minFunctionString() const
 void GeneratorProfile::setMinFunctionString(const std::string &minFunctionString)
 {
     mPimpl->mMinFunctionString = minFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::maxFunctionString() const
@@ -2018,6 +3534,7 @@ std::string GeneratorProfile::maxFunctionString() const
 void GeneratorProfile::setMaxFunctionString(const std::string &maxFunctionString)
 {
     mPimpl->mMaxFunctionString = maxFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::secFunctionString() const
@@ -2028,6 +3545,7 @@ std::string GeneratorProfile::secFunctionString() const
 void GeneratorProfile::setSecFunctionString(const std::string &secFunctionString)
 {
     mPimpl->mSecFunctionString = secFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::cscFunctionString() const
@@ -2038,6 +3556,7 @@ std::string GeneratorProfile::cscFunctionString() const
 void GeneratorProfile::setCscFunctionString(const std::string &cscFunctionString)
 {
     mPimpl->mCscFunctionString = cscFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::cotFunctionString() const
@@ -2048,6 +3567,7 @@ std::string GeneratorProfile::cotFunctionString() const
 void GeneratorProfile::setCotFunctionString(const std::string &cotFunctionString)
 {
     mPimpl->mCotFunctionString = cotFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::sechFunctionString() const
@@ -2058,6 +3578,7 @@ std::string GeneratorProfile::sechFunctionString() const
 void GeneratorProfile::setSechFunctionString(const std::string &sechFunctionString)
 {
     mPimpl->mSechFunctionString = sechFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::cschFunctionString() const
@@ -2068,6 +3589,7 @@ std::string GeneratorProfile::cschFunctionString() const
 void GeneratorProfile::setCschFunctionString(const std::string &cschFunctionString)
 {
     mPimpl->mCschFunctionString = cschFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::cothFunctionString() const
@@ -2078,6 +3600,7 @@ std::string GeneratorProfile::cothFunctionString() const
 void GeneratorProfile::setCothFunctionString(const std::string &cothFunctionString)
 {
     mPimpl->mCothFunctionString = cothFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::asecFunctionString() const
@@ -2088,6 +3611,7 @@ std::string GeneratorProfile::asecFunctionString() const
 void GeneratorProfile::setAsecFunctionString(const std::string &asecFunctionString)
 {
     mPimpl->mAsecFunctionString = asecFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::acscFunctionString() const
@@ -2098,6 +3622,7 @@ std::string GeneratorProfile::acscFunctionString() const
 void GeneratorProfile::setAcscFunctionString(const std::string &acscFunctionString)
 {
     mPimpl->mAcscFunctionString = acscFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::acotFunctionString() const
@@ -2108,6 +3633,7 @@ std::string GeneratorProfile::acotFunctionString() const
 void GeneratorProfile::setAcotFunctionString(const std::string &acotFunctionString)
 {
     mPimpl->mAcotFunctionString = acotFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::asechFunctionString() const
@@ -2118,6 +3644,7 @@ std::string GeneratorProfile::asechFunctionString() const
 void GeneratorProfile::setAsechFunctionString(const std::string &asechFunctionString)
 {
     mPimpl->mAsechFunctionString = asechFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::acschFunctionString() const
@@ -2128,6 +3655,7 @@ std::string GeneratorProfile::acschFunctionString() const
 void GeneratorProfile::setAcschFunctionString(const std::string &acschFunctionString)
 {
     mPimpl->mAcschFunctionString = acschFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::acothFunctionString() const
@@ -2138,6 +3666,7 @@ std::string GeneratorProfile::acothFunctionString() const
 void GeneratorProfile::setAcothFunctionString(const std::string &acothFunctionString)
 {
     mPimpl->mAcothFunctionString = acothFunctionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::commentString() const
@@ -2148,6 +3677,7 @@ std::string GeneratorProfile::commentString() const
 void GeneratorProfile::setCommentString(const std::string &commentString)
 {
     mPimpl->mCommentString = commentString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::originCommentString() const
@@ -2158,6 +3688,7 @@ std::string GeneratorProfile::originCommentString() const
 void GeneratorProfile::setOriginCommentString(const std::string &originCommentString)
 {
     mPimpl->mOriginCommentString = originCommentString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::interfaceFileNameString() const
@@ -2168,6 +3699,7 @@ std::string GeneratorProfile::interfaceFileNameString() const
 void GeneratorProfile::setInterfaceFileNameString(const std::string &interfaceFileNameString)
 {
     mPimpl->mInterfaceFileNameString = interfaceFileNameString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::interfaceHeaderString() const
@@ -2178,6 +3710,7 @@ std::string GeneratorProfile::interfaceHeaderString() const
 void GeneratorProfile::setInterfaceHeaderString(const std::string &interfaceHeaderString)
 {
     mPimpl->mInterfaceHeaderString = interfaceHeaderString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::implementationHeaderString() const
@@ -2188,6 +3721,40 @@ std::string GeneratorProfile::implementationHeaderString() const
 void GeneratorProfile::setImplementationHeaderString(const std::string &implementationHeaderString)
 {
     mPimpl->mImplementationHeaderString = implementationHeaderString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::namespaceString() const
+{
+    return mPimpl->mNamespaceString;
+}
+
+void GeneratorProfile::setNamespaceString(const std::string &namespaceString)
+{
+    mPimpl->mNamespaceString = namespaceString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::implementationNamespaceBeginString() const
+{
+    return mPimpl->mImplementationNamespaceBeginString;
+}
+
+void GeneratorProfile::setImplementationNamespaceBeginString(const std::string &implementationNamespaceBeginString)
+{
+    mPimpl->mImplementationNamespaceBeginString = implementationNamespaceBeginString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::implementationNamespaceEndString() const
+{
+    return mPimpl->mImplementationNamespaceEndString;
+}
+
+void GeneratorProfile::setImplementationNamespaceEndString(const std::string &implementationNamespaceEndString)
+{
+    mPimpl->mImplementationNamespaceEndString = implementationNamespaceEndString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::interfaceVersionString() const
@@ -2198,6 +3765,7 @@ std::string GeneratorProfile::interfaceVersionString() const
 void GeneratorProfile::setInterfaceVersionString(const std::string &interfaceVersionString)
 {
     mPimpl->mInterfaceVersionString = interfaceVersionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::implementationVersionString() const
@@ -2208,6 +3776,7 @@ std::string GeneratorProfile::implementationVersionString() const
 void GeneratorProfile::setImplementationVersionString(const std::string &implementationVersionString)
 {
     mPimpl->mImplementationVersionString = implementationVersionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::interfaceLibcellmlVersionString() const
@@ -2218,6 +3787,7 @@ std::string GeneratorProfile::interfaceLibcellmlVersionString() const
 void GeneratorProfile::setInterfaceLibcellmlVersionString(const std::string &interfaceLibcellmlVersionString)
 {
     mPimpl->mInterfaceLibcellmlVersionString = interfaceLibcellmlVersionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::implementationLibcellmlVersionString() const
@@ -2228,6 +3798,7 @@ std::string GeneratorProfile::implementationLibcellmlVersionString() const
 void GeneratorProfile::setImplementationLibcellmlVersionString(const std::string &implementationLibcellmlVersionString)
 {
     mPimpl->mImplementationLibcellmlVersionString = implementationLibcellmlVersionString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::interfaceStateCountString() const
@@ -2238,6 +3809,7 @@ std::string GeneratorProfile::interfaceStateCountString() const
 void GeneratorProfile::setInterfaceStateCountString(const std::string &interfaceStateCountString)
 {
     mPimpl->mInterfaceStateCountString = interfaceStateCountString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::implementationStateCountString() const
@@ -2248,6 +3820,7 @@ std::string GeneratorProfile::implementationStateCountString() const
 void GeneratorProfile::setImplementationStateCountString(const std::string &implementationStateCountString)
 {
     mPimpl->mImplementationStateCountString = implementationStateCountString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::interfaceVariableCountString() const
@@ -2258,6 +3831,7 @@ std::string GeneratorProfile::interfaceVariableCountString() const
 void GeneratorProfile::setInterfaceVariableCountString(const std::string &interfaceVariableCountString)
 {
     mPimpl->mInterfaceVariableCountString = interfaceVariableCountString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::implementationVariableCountString() const
@@ -2268,6 +3842,29 @@ std::string GeneratorProfile::implementationVariableCountString() const
 void GeneratorProfile::setImplementationVariableCountString(const std::string &implementationVariableCountString)
 {
     mPimpl->mImplementationVariableCountString = implementationVariableCountString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::interfaceEnsembleParameterCountString() const
+{
+    return mPimpl->mInterfaceEnsembleParameterCountString;
+}
+
+void GeneratorProfile::setInterfaceEnsembleParameterCountString(const std::string &interfaceEnsembleParameterCountString)
+{
+    mPimpl->mInterfaceEnsembleParameterCountString = interfaceEnsembleParameterCountString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::implementationEnsembleParameterCountString() const
+{
+    return mPimpl->mImplementationEnsembleParameterCountString;
+}
+
+void GeneratorProfile::setImplementationEnsembleParameterCountString(const std::string &implementationEnsembleParameterCountString)
+{
+    mPimpl->mImplementationEnsembleParameterCountString = implementationEnsembleParameterCountString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::variableTypeObjectString(bool forDifferentialModel,
@@ -2305,6 +3902,8 @@ void GeneratorProfile::setVariableTypeObjectString(bool forDifferentialModel,
             mPimpl->mVariableTypeObjectFamWoevString = variableTypeObjectString;
         }
     }
+
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::variableOfIntegrationVariableTypeString() const
@@ -2315,6 +3914,7 @@ std::string GeneratorProfile::variableOfIntegrationVariableTypeString() const
 void GeneratorProfile::setVariableOfIntegrationVariableTypeString(const std::string &variableOfIntegrationVariableTypeString)
 {
     mPimpl->mVariableOfIntegrationVariableTypeString = variableOfIntegrationVariableTypeString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::stateVariableTypeString() const
@@ -2325,6 +3925,7 @@ std::string GeneratorProfile::stateVariableTypeString() const
 void GeneratorProfile::setStateVariableTypeString(const std::string &stateVariableTypeString)
 {
     mPimpl->mStateVariableTypeString = stateVariableTypeString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::constantVariableTypeString() const
@@ -2335,6 +3936,7 @@ std::string GeneratorProfile::constantVariableTypeString() const
 void GeneratorProfile::setConstantVariableTypeString(const std::string &constantVariableTypeString)
 {
     mPimpl->mConstantVariableTypeString = constantVariableTypeString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::computedConstantVariableTypeString() const
@@ -2345,6 +3947,7 @@ std::string GeneratorProfile::computedConstantVariableTypeString() const
 void GeneratorProfile::setComputedConstantVariableTypeString(const std::string &computedConstantVariableTypeString)
 {
     mPimpl->mComputedConstantVariableTypeString = computedConstantVariableTypeString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::algebraicVariableTypeString() const
@@ -2355,6 +3958,7 @@ std::string GeneratorProfile::algebraicVariableTypeString() const
 void GeneratorProfile::setAlgebraicVariableTypeString(const std::string &algebraicVariableTypeString)
 {
     mPimpl->mAlgebraicVariableTypeString = algebraicVariableTypeString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::externalVariableTypeString() const
@@ -2365,6 +3969,7 @@ std::string GeneratorProfile::externalVariableTypeString() const
 void GeneratorProfile::setExternalVariableTypeString(const std::string &externalVariableTypeString)
 {
     mPimpl->mExternalVariableTypeString = externalVariableTypeString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::variableInfoObjectString() const
@@ -2375,6 +3980,7 @@ std::string GeneratorProfile::variableInfoObjectString() const
 void GeneratorProfile::setVariableInfoObjectString(const std::string &variableInfoObjectString)
 {
     mPimpl->mVariableInfoObjectString = variableInfoObjectString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::interfaceVoiInfoString() const
@@ -2385,6 +3991,7 @@ std::string GeneratorProfile::interfaceVoiInfoString() const
 void GeneratorProfile::setInterfaceVoiInfoString(const std::string &interfaceVoiInfoString)
 {
     mPimpl->mInterfaceVoiInfoString = interfaceVoiInfoString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::implementationVoiInfoString() const
@@ -2395,6 +4002,7 @@ std::string GeneratorProfile::implementationVoiInfoString() const
 void GeneratorProfile::setImplementationVoiInfoString(const std::string &implementationVoiInfoString)
 {
     mPimpl->mImplementationVoiInfoString = implementationVoiInfoString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::interfaceStateInfoString() const
@@ -2405,6 +4013,7 @@ std::string GeneratorProfile::interfaceStateInfoString() const
 void GeneratorProfile::setInterfaceStateInfoString(const std::string &interfaceStateInfoString)
 {
     mPimpl->mInterfaceStateInfoString = interfaceStateInfoString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::implementationStateInfoString() const
@@ -2415,6 +4024,7 @@ std::string GeneratorProfile::implementationStateInfoString() const
 void GeneratorProfile::setImplementationStateInfoString(const std::string &implementationStateInfoString)
 {
     mPimpl->mImplementationStateInfoString = implementationStateInfoString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::interfaceVariableInfoString() const
@@ -2425,6 +4035,7 @@ std::string GeneratorProfile::interfaceVariableInfoString() const
 void GeneratorProfile::setInterfaceVariableInfoString(const std::string &interfaceVariableInfoString)
 {
     mPimpl->mInterfaceVariableInfoString = interfaceVariableInfoString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::implementationVariableInfoString() const
@@ -2435,6 +4046,7 @@ std::string GeneratorProfile::implementationVariableInfoString() const
 void GeneratorProfile::setImplementationVariableInfoString(const std::string &implementationVariableInfoString)
 {
     mPimpl->mImplementationVariableInfoString = implementationVariableInfoString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::variableInfoEntryString() const
@@ -2445,6 +4057,7 @@ std::string GeneratorProfile::variableInfoEntryString() const
 void GeneratorProfile::setVariableInfoEntryString(const std::string &variableInfoEntryString)
 {
     mPimpl->mVariableInfoEntryString = variableInfoEntryString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::voiString() const
@@ -2455,6 +4068,7 @@ std::string GeneratorProfile::voiString() const
 void GeneratorProfile::setVoiString(const std::string &voiString)
 {
     mPimpl->mVoiString = voiString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::statesArrayString() const
@@ -2465,6 +4079,7 @@ std::string GeneratorProfile::statesArrayString() const
 void GeneratorProfile::setStatesArrayString(const std::string &statesArrayString)
 {
     mPimpl->mStatesArrayString = statesArrayString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::ratesArrayString() const
@@ -2475,6 +4090,95 @@ std::string GeneratorProfile::ratesArrayString() const
 void GeneratorProfile::setRatesArrayString(const std::string &ratesArrayString)
 {
     mPimpl->mRatesArrayString = ratesArrayString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::rushLarsenTausArrayString() const
+{
+    return mPimpl->mRushLarsenTausArrayString;
+}
+
+void GeneratorProfile::setRushLarsenTausArrayString(const std::string &rushLarsenTausArrayString)
+{
+    mPimpl->mRushLarsenTausArrayString = rushLarsenTausArrayString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::rushLarsenSteadyStatesArrayString() const
+{
+    return mPimpl->mRushLarsenSteadyStatesArrayString;
+}
+
+void GeneratorProfile::setRushLarsenSteadyStatesArrayString(const std::string &rushLarsenSteadyStatesArrayString)
+{
+    mPimpl->mRushLarsenSteadyStatesArrayString = rushLarsenSteadyStatesArrayString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::localVariableNameString() const
+{
+    return mPimpl->mLocalVariableNameString;
+}
+
+void GeneratorProfile::setLocalVariableNameString(const std::string &localVariableNameString)
+{
+    mPimpl->mLocalVariableNameString = localVariableNameString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::localVariableDeclarationString() const
+{
+    return mPimpl->mLocalVariableDeclarationString;
+}
+
+void GeneratorProfile::setLocalVariableDeclarationString(const std::string &localVariableDeclarationString)
+{
+    mPimpl->mLocalVariableDeclarationString = localVariableDeclarationString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::forwardEulerStateUpdateString() const
+{
+    return mPimpl->mForwardEulerStateUpdateString;
+}
+
+void GeneratorProfile::setForwardEulerStateUpdateString(const std::string &forwardEulerStateUpdateString)
+{
+    mPimpl->mForwardEulerStateUpdateString = forwardEulerStateUpdateString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::rushLarsenStateUpdateString() const
+{
+    return mPimpl->mRushLarsenStateUpdateString;
+}
+
+void GeneratorProfile::setRushLarsenStateUpdateString(const std::string &rushLarsenStateUpdateString)
+{
+    mPimpl->mRushLarsenStateUpdateString = rushLarsenStateUpdateString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::sensitivityNameString() const
+{
+    return mPimpl->mSensitivityNameString;
+}
+
+void GeneratorProfile::setSensitivityNameString(const std::string &sensitivityNameString)
+{
+    mPimpl->mSensitivityNameString = sensitivityNameString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::chunkMethodNameString() const
+{
+    return mPimpl->mChunkMethodNameString;
+}
+
+void GeneratorProfile::setChunkMethodNameString(const std::string &chunkMethodNameString)
+{
+    mPimpl->mChunkMethodNameString = chunkMethodNameString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::variablesArrayString() const
@@ -2485,6 +4189,95 @@ std::string GeneratorProfile::variablesArrayString() const
 void GeneratorProfile::setVariablesArrayString(const std::string &variablesArrayString)
 {
     mPimpl->mVariablesArrayString = variablesArrayString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::lookupTableDeclarationString() const
+{
+    return mPimpl->mLookupTableDeclarationString;
+}
+
+void GeneratorProfile::setLookupTableDeclarationString(const std::string &lookupTableDeclarationString)
+{
+    mPimpl->mLookupTableDeclarationString = lookupTableDeclarationString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::lookupTableEntryString() const
+{
+    return mPimpl->mLookupTableEntryString;
+}
+
+void GeneratorProfile::setLookupTableEntryString(const std::string &lookupTableEntryString)
+{
+    mPimpl->mLookupTableEntryString = lookupTableEntryString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::lookupTableValueCallString() const
+{
+    return mPimpl->mLookupTableValueCallString;
+}
+
+void GeneratorProfile::setLookupTableValueCallString(const std::string &lookupTableValueCallString)
+{
+    mPimpl->mLookupTableValueCallString = lookupTableValueCallString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::lookupTableErrorString() const
+{
+    return mPimpl->mLookupTableErrorString;
+}
+
+void GeneratorProfile::setLookupTableErrorString(const std::string &lookupTableErrorString)
+{
+    mPimpl->mLookupTableErrorString = lookupTableErrorString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::lookupTableValueMethodString() const
+{
+    return mPimpl->mLookupTableValueMethodString;
+}
+
+void GeneratorProfile::setLookupTableValueMethodString(const std::string &lookupTableValueMethodString)
+{
+    mPimpl->mLookupTableValueMethodString = lookupTableValueMethodString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::lookupTableInitialisationString() const
+{
+    return mPimpl->mLookupTableInitialisationString;
+}
+
+void GeneratorProfile::setLookupTableInitialisationString(const std::string &lookupTableInitialisationString)
+{
+    mPimpl->mLookupTableInitialisationString = lookupTableInitialisationString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::ensembleOpenmpPragmaString() const
+{
+    return mPimpl->mEnsembleOpenmpPragmaString;
+}
+
+void GeneratorProfile::setEnsembleOpenmpPragmaString(const std::string &ensembleOpenmpPragmaString)
+{
+    mPimpl->mEnsembleOpenmpPragmaString = ensembleOpenmpPragmaString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::ensembleParameterAssignmentString() const
+{
+    return mPimpl->mEnsembleParameterAssignmentString;
+}
+
+void GeneratorProfile::setEnsembleParameterAssignmentString(const std::string &ensembleParameterAssignmentString)
+{
+    mPimpl->mEnsembleParameterAssignmentString = ensembleParameterAssignmentString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::externalVariableMethodTypeDefinitionString(bool forDifferentialModel) const
@@ -2504,6 +4297,8 @@ void GeneratorProfile::setExternalVariableMethodTypeDefinitionString(bool forDif
     } else {
         mPimpl->mExternalVariableMethodTypeDefinitionFamString = externalVariableMethodTypeDefinitionString;
     }
+
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::externalVariableMethodCallString(bool forDifferentialModel) const
@@ -2523,6 +4318,8 @@ void GeneratorProfile::setExternalVariableMethodCallString(bool forDifferentialM
     } else {
         mPimpl->mExternalVariableMethodCallFamString = externalVariableMethodCallString;
     }
+
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::rootFindingInfoObjectString(bool forDifferentialModel) const
@@ -2542,6 +4339,8 @@ void GeneratorProfile::setRootFindingInfoObjectString(bool forDifferentialModel,
     } else {
         mPimpl->mRootFindingInfoObjectFamString = rootFindingInfoObjectString;
     }
+
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::externNlaSolveMethodString() const
@@ -2552,6 +4351,7 @@ std::string GeneratorProfile::externNlaSolveMethodString() const
 void GeneratorProfile::setExternNlaSolveMethodString(const std::string &externNlaSolveMethodString)
 {
     mPimpl->mExternNlaSolveMethodString = externNlaSolveMethodString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::findRootCallString(bool forDifferentialModel) const
@@ -2571,6 +4371,8 @@ void GeneratorProfile::setFindRootCallString(bool forDifferentialModel,
     } else {
         mPimpl->mFindRootCallFamString = findRootCallString;
     }
+
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::findRootMethodString(bool forDifferentialModel) const
@@ -2590,6 +4392,8 @@ void GeneratorProfile::setFindRootMethodString(bool forDifferentialModel,
     } else {
         mPimpl->mFindRootMethodFamString = findRootMethodString;
     }
+
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::nlaSolveCallString(bool forDifferentialModel) const
@@ -2609,6 +4413,8 @@ void GeneratorProfile::setNlaSolveCallString(bool forDifferentialModel,
     } else {
         mPimpl->mNlaSolveCallFamString = nlaSolveCallString;
     }
+
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::objectiveFunctionMethodString(bool forDifferentialModel) const
@@ -2628,6 +4434,8 @@ void GeneratorProfile::setObjectiveFunctionMethodString(bool forDifferentialMode
     } else {
         mPimpl->mObjectiveFunctionMethodFamString = objectiveFunctionMethodString;
     }
+
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::uArrayString() const
@@ -2638,6 +4446,7 @@ std::string GeneratorProfile::uArrayString() const
 void GeneratorProfile::setUArrayString(const std::string &uArrayString)
 {
     mPimpl->mUArrayString = uArrayString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::fArrayString() const
@@ -2648,6 +4457,7 @@ std::string GeneratorProfile::fArrayString() const
 void GeneratorProfile::setFArrayString(const std::string &fArrayString)
 {
     mPimpl->mFArrayString = fArrayString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::interfaceCreateStatesArrayMethodString() const
@@ -2658,6 +4468,7 @@ std::string GeneratorProfile::interfaceCreateStatesArrayMethodString() const
 void GeneratorProfile::setInterfaceCreateStatesArrayMethodString(const std::string &interfaceCreateStatesArrayMethodString)
 {
     mPimpl->mInterfaceCreateStatesArrayMethodString = interfaceCreateStatesArrayMethodString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::implementationCreateStatesArrayMethodString() const
@@ -2668,6 +4479,7 @@ std::string GeneratorProfile::implementationCreateStatesArrayMethodString() cons
 void GeneratorProfile::setImplementationCreateStatesArrayMethodString(const std::string &implementationCreateStatesArrayMethodString)
 {
     mPimpl->mImplementationCreateStatesArrayMethodString = implementationCreateStatesArrayMethodString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::interfaceCreateVariablesArrayMethodString() const
@@ -2678,6 +4490,7 @@ std::string GeneratorProfile::interfaceCreateVariablesArrayMethodString() const
 void GeneratorProfile::setInterfaceCreateVariablesArrayMethodString(const std::string &interfaceCreateVariablesArrayMethodString)
 {
     mPimpl->mInterfaceCreateVariablesArrayMethodString = interfaceCreateVariablesArrayMethodString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::implementationCreateVariablesArrayMethodString() const
@@ -2688,6 +4501,7 @@ std::string GeneratorProfile::implementationCreateVariablesArrayMethodString() c
 void GeneratorProfile::setImplementationCreateVariablesArrayMethodString(const std::string &implementationCreateVariablesArrayMethodString)
 {
     mPimpl->mImplementationCreateVariablesArrayMethodString = implementationCreateVariablesArrayMethodString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::interfaceDeleteArrayMethodString() const
@@ -2698,6 +4512,7 @@ std::string GeneratorProfile::interfaceDeleteArrayMethodString() const
 void GeneratorProfile::setInterfaceDeleteArrayMethodString(const std::string &interfaceDeleteArrayMethodString)
 {
     mPimpl->mInterfaceDeleteArrayMethodString = interfaceDeleteArrayMethodString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::implementationDeleteArrayMethodString() const
@@ -2708,6 +4523,7 @@ std::string GeneratorProfile::implementationDeleteArrayMethodString() const
 void GeneratorProfile::setImplementationDeleteArrayMethodString(const std::string &implementationDeleteArrayMethodString)
 {
     mPimpl->mImplementationDeleteArrayMethodString = implementationDeleteArrayMethodString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::interfaceInitialiseVariablesMethodString(bool forDifferentialModel,
@@ -2745,6 +4561,8 @@ void GeneratorProfile::setInterfaceInitialiseVariablesMethodString(bool forDiffe
             mPimpl->mInterfaceInitialiseVariablesMethodFamWoevString = interfaceInitialiseVariablesMethodString;
         }
     }
+
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::implementationInitialiseVariablesMethodString(bool forDifferentialModel,
@@ -2782,6 +4600,8 @@ void GeneratorProfile::setImplementationInitialiseVariablesMethodString(bool for
             mPimpl->mImplementationInitialiseVariablesMethodFamWoevString = implementationInitialiseVariablesMethodString;
         }
     }
+
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::interfaceComputeComputedConstantsMethodString() const
@@ -2792,6 +4612,7 @@ std::string GeneratorProfile::interfaceComputeComputedConstantsMethodString() co
 void GeneratorProfile::setInterfaceComputeComputedConstantsMethodString(const std::string &interfaceComputeComputedConstantsMethodString)
 {
     mPimpl->mInterfaceComputeComputedConstantsMethodString = interfaceComputeComputedConstantsMethodString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::implementationComputeComputedConstantsMethodString() const
@@ -2802,6 +4623,7 @@ std::string GeneratorProfile::implementationComputeComputedConstantsMethodString
 void GeneratorProfile::setImplementationComputeComputedConstantsMethodString(const std::string &implementationComputeComputedConstantsMethodString)
 {
     mPimpl->mImplementationComputeComputedConstantsMethodString = implementationComputeComputedConstantsMethodString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::interfaceComputeRatesMethodString(bool withExternalVariables) const
@@ -2821,6 +4643,8 @@ void GeneratorProfile::setInterfaceComputeRatesMethodString(bool withExternalVar
     } else {
         mPimpl->mInterfaceComputeRatesMethodWoevString = interfaceComputeRatesMethodString;
     }
+
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::implementationComputeRatesMethodString(bool withExternalVariables) const
@@ -2840,6 +4664,195 @@ void GeneratorProfile::setImplementationComputeRatesMethodString(bool withExtern
     } else {
         mPimpl->mImplementationComputeRatesMethodWoevString = implementationComputeRatesMethodString;
     }
+
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::interfaceComputeRushLarsenCoefficientsMethodString() const
+{
+    return mPimpl->mInterfaceComputeRushLarsenCoefficientsMethodString;
+}
+
+void GeneratorProfile::setInterfaceComputeRushLarsenCoefficientsMethodString(const std::string &interfaceComputeRushLarsenCoefficientsMethodString)
+{
+    mPimpl->mInterfaceComputeRushLarsenCoefficientsMethodString = interfaceComputeRushLarsenCoefficientsMethodString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::implementationComputeRushLarsenCoefficientsMethodString() const
+{
+    return mPimpl->mImplementationComputeRushLarsenCoefficientsMethodString;
+}
+
+void GeneratorProfile::setImplementationComputeRushLarsenCoefficientsMethodString(const std::string &implementationComputeRushLarsenCoefficientsMethodString)
+{
+    mPimpl->mImplementationComputeRushLarsenCoefficientsMethodString = implementationComputeRushLarsenCoefficientsMethodString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::implementationComputeRatesMethodWithLocalVariablesString() const
+{
+    return mPimpl->mImplementationComputeRatesMethodWithLocalVariablesString;
+}
+
+void GeneratorProfile::setImplementationComputeRatesMethodWithLocalVariablesString(const std::string &implementationComputeRatesMethodWithLocalVariablesString)
+{
+    mPimpl->mImplementationComputeRatesMethodWithLocalVariablesString = implementationComputeRatesMethodWithLocalVariablesString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::interfaceInitialiseLookupTablesMethodString() const
+{
+    return mPimpl->mInterfaceInitialiseLookupTablesMethodString;
+}
+
+void GeneratorProfile::setInterfaceInitialiseLookupTablesMethodString(const std::string &interfaceInitialiseLookupTablesMethodString)
+{
+    mPimpl->mInterfaceInitialiseLookupTablesMethodString = interfaceInitialiseLookupTablesMethodString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::implementationInitialiseLookupTablesMethodString() const
+{
+    return mPimpl->mImplementationInitialiseLookupTablesMethodString;
+}
+
+void GeneratorProfile::setImplementationInitialiseLookupTablesMethodString(const std::string &implementationInitialiseLookupTablesMethodString)
+{
+    mPimpl->mImplementationInitialiseLookupTablesMethodString = implementationInitialiseLookupTablesMethodString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::interfaceInitialiseEnsembleMethodString() const
+{
+    return mPimpl->mInterfaceInitialiseEnsembleMethodString;
+}
+
+void GeneratorProfile::setInterfaceInitialiseEnsembleMethodString(const std::string &interfaceInitialiseEnsembleMethodString)
+{
+    mPimpl->mInterfaceInitialiseEnsembleMethodString = interfaceInitialiseEnsembleMethodString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::implementationInitialiseEnsembleMethodString() const
+{
+    return mPimpl->mImplementationInitialiseEnsembleMethodString;
+}
+
+void GeneratorProfile::setImplementationInitialiseEnsembleMethodString(const std::string &implementationInitialiseEnsembleMethodString)
+{
+    mPimpl->mImplementationInitialiseEnsembleMethodString = implementationInitialiseEnsembleMethodString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::interfaceComputeEnsembleRatesMethodString() const
+{
+    return mPimpl->mInterfaceComputeEnsembleRatesMethodString;
+}
+
+void GeneratorProfile::setInterfaceComputeEnsembleRatesMethodString(const std::string &interfaceComputeEnsembleRatesMethodString)
+{
+    mPimpl->mInterfaceComputeEnsembleRatesMethodString = interfaceComputeEnsembleRatesMethodString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::implementationComputeEnsembleRatesMethodString() const
+{
+    return mPimpl->mImplementationComputeEnsembleRatesMethodString;
+}
+
+void GeneratorProfile::setImplementationComputeEnsembleRatesMethodString(const std::string &implementationComputeEnsembleRatesMethodString)
+{
+    mPimpl->mImplementationComputeEnsembleRatesMethodString = implementationComputeEnsembleRatesMethodString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::interfaceComputeEnsembleVariablesMethodString() const
+{
+    return mPimpl->mInterfaceComputeEnsembleVariablesMethodString;
+}
+
+void GeneratorProfile::setInterfaceComputeEnsembleVariablesMethodString(const std::string &interfaceComputeEnsembleVariablesMethodString)
+{
+    mPimpl->mInterfaceComputeEnsembleVariablesMethodString = interfaceComputeEnsembleVariablesMethodString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::implementationComputeEnsembleVariablesMethodString() const
+{
+    return mPimpl->mImplementationComputeEnsembleVariablesMethodString;
+}
+
+void GeneratorProfile::setImplementationComputeEnsembleVariablesMethodString(const std::string &implementationComputeEnsembleVariablesMethodString)
+{
+    mPimpl->mImplementationComputeEnsembleVariablesMethodString = implementationComputeEnsembleVariablesMethodString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::interfaceIntegrateForwardEulerMethodString() const
+{
+    return mPimpl->mInterfaceIntegrateForwardEulerMethodString;
+}
+
+void GeneratorProfile::setInterfaceIntegrateForwardEulerMethodString(const std::string &interfaceIntegrateForwardEulerMethodString)
+{
+    mPimpl->mInterfaceIntegrateForwardEulerMethodString = interfaceIntegrateForwardEulerMethodString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::implementationIntegrateForwardEulerMethodString() const
+{
+    return mPimpl->mImplementationIntegrateForwardEulerMethodString;
+}
+
+void GeneratorProfile::setImplementationIntegrateForwardEulerMethodString(const std::string &implementationIntegrateForwardEulerMethodString)
+{
+    mPimpl->mImplementationIntegrateForwardEulerMethodString = implementationIntegrateForwardEulerMethodString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::interfaceIntegrateRk4MethodString() const
+{
+    return mPimpl->mInterfaceIntegrateRk4MethodString;
+}
+
+void GeneratorProfile::setInterfaceIntegrateRk4MethodString(const std::string &interfaceIntegrateRk4MethodString)
+{
+    mPimpl->mInterfaceIntegrateRk4MethodString = interfaceIntegrateRk4MethodString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::implementationIntegrateRk4MethodString() const
+{
+    return mPimpl->mImplementationIntegrateRk4MethodString;
+}
+
+void GeneratorProfile::setImplementationIntegrateRk4MethodString(const std::string &implementationIntegrateRk4MethodString)
+{
+    mPimpl->mImplementationIntegrateRk4MethodString = implementationIntegrateRk4MethodString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::interfaceIntegrateRushLarsenMethodString() const
+{
+    return mPimpl->mInterfaceIntegrateRushLarsenMethodString;
+}
+
+void GeneratorProfile::setInterfaceIntegrateRushLarsenMethodString(const std::string &interfaceIntegrateRushLarsenMethodString)
+{
+    mPimpl->mInterfaceIntegrateRushLarsenMethodString = interfaceIntegrateRushLarsenMethodString;
+    ++mPimpl->mVersion;
+}
+
+std::string GeneratorProfile::implementationIntegrateRushLarsenMethodString() const
+{
+    return mPimpl->mImplementationIntegrateRushLarsenMethodString;
+}
+
+void GeneratorProfile::setImplementationIntegrateRushLarsenMethodString(const std::string &implementationIntegrateRushLarsenMethodString)
+{
+    mPimpl->mImplementationIntegrateRushLarsenMethodString = implementationIntegrateRushLarsenMethodString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::interfaceComputeVariablesMethodString(bool forDifferentialModel,
@@ -2877,6 +4890,8 @@ void GeneratorProfile::setInterfaceComputeVariablesMethodString(bool forDifferen
             mPimpl->mInterfaceComputeVariablesMethodFamWoevString = interfaceComputeVariablesMethodString;
         }
     }
+
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::implementationComputeVariablesMethodString(bool forDifferentialModel,
@@ -2914,6 +4929,8 @@ void GeneratorProfile::setImplementationComputeVariablesMethodString(bool forDif
             mPimpl->mImplementationComputeVariablesMethodFamWoevString = implementationComputeVariablesMethodString;
         }
     }
+
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::emptyMethodString() const
@@ -2924,6 +4941,7 @@ std::string GeneratorProfile::emptyMethodString() const
 void GeneratorProfile::setEmptyMethodString(const std::string &emptyMethodString)
 {
     mPimpl->mEmptyMethodString = emptyMethodString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::indentString() const
@@ -2934,6 +4952,7 @@ std::string GeneratorProfile::indentString() const
 void GeneratorProfile::setIndentString(const std::string &indentString)
 {
     mPimpl->mIndentString = indentString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::openArrayInitialiserString() const
@@ -2944,6 +4963,7 @@ std::string GeneratorProfile::openArrayInitialiserString() const
 void GeneratorProfile::setOpenArrayInitialiserString(const std::string &openArrayInitialiserString)
 {
     mPimpl->mOpenArrayInitialiserString = openArrayInitialiserString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::closeArrayInitialiserString() const
@@ -2954,6 +4974,7 @@ std::string GeneratorProfile::closeArrayInitialiserString() const
 void GeneratorProfile::setCloseArrayInitialiserString(const std::string &closeArrayInitialiserString)
 {
     mPimpl->mCloseArrayInitialiserString = closeArrayInitialiserString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::openArrayString() const
@@ -2964,6 +4985,7 @@ std::string GeneratorProfile::openArrayString() const
 void GeneratorProfile::setOpenArrayString(const std::string &openArrayString)
 {
     mPimpl->mOpenArrayString = openArrayString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::closeArrayString() const
@@ -2974,6 +4996,7 @@ std::string GeneratorProfile::closeArrayString() const
 void GeneratorProfile::setCloseArrayString(const std::string &closeArrayString)
 {
     mPimpl->mCloseArrayString = closeArrayString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::arrayElementSeparatorString() const
@@ -2984,6 +5007,7 @@ std::string GeneratorProfile::arrayElementSeparatorString() const
 void GeneratorProfile::setArrayElementSeparatorString(const std::string &arrayElementSeparatorString)
 {
     mPimpl->mArrayElementSeparatorString = arrayElementSeparatorString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::stringDelimiterString() const
@@ -2994,6 +5018,7 @@ std::string GeneratorProfile::stringDelimiterString() const
 void GeneratorProfile::setStringDelimiterString(const std::string &stringDelimiterString)
 {
     mPimpl->mStringDelimiterString = stringDelimiterString;
+    ++mPimpl->mVersion;
 }
 
 std::string GeneratorProfile::commandSeparatorString() const
@@ -3004,6 +5029,7 @@ std::string GeneratorProfile::commandSeparatorString() const
 void GeneratorProfile::setCommandSeparatorString(const std::string &commandSeparatorString)
 {
     mPimpl->mCommandSeparatorString = commandSeparatorString;
+    ++mPimpl->mVersion;
 }
 
 } // namespace libcellml
@@ -0,0 +1,392 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <unordered_map>
+
+#include "libcellml/generatorprofile.h"
+
+#include "generatorprofiletools.h"
+
+namespace libcellml {
+
+/**
+ * @brief The GeneratorProfile::GeneratorProfileImpl struct.
+ *
+ * The private implementation for the GeneratorProfile class.
+ */
+struct GeneratorProfile::GeneratorProfileImpl
+{
+    // Whether the profile is official.
+
+    GeneratorProfile::Profile mProfile = Profile::C;
+
+    // The precision of the profile.
+
+    GeneratorProfile::Precision mPrecision = Precision::DOUBLE;
+
+    // Whether the profile requires an interface to be generated.
+
+    bool mHasInterface = true;
+
+    // Whether the profile requires a method to compute the Rush-Larsen
+    // coefficients to be generated.
+
+    bool mHasComputeRushLarsenCoefficientsMethod = false;
+
+    // Whether the profile keeps purely intermediate algebraic variables as local
+    // variables in computeRates().
+
+    bool mHasLocalVariablesInComputeRates = false;
+
+    // Whether the profile requires methods to integrate the model using a
+    // fixed-step method to be generated.
+
+    bool mHasIntegrateMethods = false;
+
+    // Equality.
+
+    std::string mEqualityString;
+
+    // Relational and logical operators.
+
+    std::string mEqString;
+    std::string mNeqString;
+    std::string mLtString;
+    std::string mLeqString;
+    std::string mGtString;
+    std::string mGeqString;
+    std::string mAndString;
+    std::string mOrString;
+    std::string mXorString;
+    std::string mNotString;
+
+    bool mHasEqOperator = true;
+    bool mHasNeqOperator = true;
+    bool mHasLtOperator = true;
+    bool mHasLeqOperator = true;
+    bool mHasGtOperator = true;
+    bool mHasGeqOperator = true;
+    bool mHasAndOperator = true;
+    bool mHasOrOperator = true;
+    bool mHasXorOperator = true;
+    bool mHasNotOperator = true;
+
+    // Arithmetic operators.
+
+    std::string mPlusString;
+    std::string mMinusString;
+    std::string mTimesString;
+    std::string mDivideString;
+    std::string mPowerString;
+    std::string mSquareRootString;
+    std::string mSquareString;
+    std::string mAbsoluteValueString;
+    std::string mExponentialString;
+    std::string mNaturalLogarithmString;
+    std::string mCommonLogarithmString;
+    std::string mCeilingString;
+    std::string mFloorString;
+    std::string mMinString;
+    std::string mMaxString;
+    std::string mRemString;
+
+    bool mHasPowerOperator = false;
+
+    // Trigonometric operators.
+
+    std::string mSinString;
+    std::string mCosString;
+    std::string mTanString;
+    std::string mSecString;
+    std::string mCscString;
+    std::string mCotString;
+    std::string mSinhString;
+    std::string mCoshString;
+    std::string mTanhString;
+    std::string mSechString;
+    std::string mCschString;
+    std::string mCothString;
+    std::string mAsinString;
+    std::string mAcosString;
+    std::string mAtanString;
+    std::string mAsecString;
+    std::string mAcscString;
+    std::string mAcotString;
+    std::string mAsinhString;
+    std::string mAcoshString;
+    std::string mAtanhString;
+    std::string mAsechString;
+    std::string mAcschString;
+    std::string mAcothString;
+
+    // Piecewise statement.
+
+    std::string mConditionalOperatorIfString;
+    std::string mConditionalOperatorElseString;
+    std::string mPiecewiseIfString;
+    std::string mPiecewiseElseString;
+
+    bool mHasConditionalOperator = true;
+
+    // Constants.
+
+    std::string mTrueString;
+    std::string mFalseString;
+    std::string mEString;
+    std::string mPiString;
+    std::string mInfString;
+    std::string mNanString;
+    std::string mLiteralSuffixString;
+
+    // Arithmetic functions.
+
+    std::string mEqFunctionString;
+    std::string mNeqFunctionString;
+    std::string mLtFunctionString;
+    std::string mLeqFunctionString;
+    std::string mGtFunctionString;
+    std::string mGeqFunctionString;
+    std::string mAndFunctionString;
+    std::string mOrFunctionString;
+    std::string mXorFunctionString;
+    std::string mNotFunctionString;
+    std::string mMinFunctionString;
+    std::string mMaxFunctionString;
+
+    // Trigonometric functions.
+
+    std::string mSecFunctionString;
+    std::string mCscFunctionString;
+    std::string mCotFunctionString;
+    std::string mSechFunctionString;
+    std::string mCschFunctionString;
+    std::string mCothFunctionString;
+    std::string mAsecFunctionString;
+    std::string mAcscFunctionString;
+    std::string mAcotFunctionString;
+    std::string mAsechFunctionString;
+    std::string mAcschFunctionString;
+    std::string mAcothFunctionString;
+
+    // Miscellaneous.
+
+    std::string mCommentString;
+    std::string mOriginCommentString;
+
+    std::string mInterfaceFileNameString;
+
+    std::string mInterfaceHeaderString;
+    std::string mImplementationHeaderString;
+
+    std::string mNamespaceString;
+    std::string mImplementationNamespaceBeginString;
+    std::string mImplementationNamespaceEndString;
+
+    std::string mInterfaceVersionString;
+    std::string mImplementationVersionString;
+
+    std::string mInterfaceLibcellmlVersionString;
+    std::string mImplementationLibcellmlVersionString;
+
+    std::string mInterfaceStateCountString;
+    std::string mImplementationStateCountString;
+
+    std::string mInterfaceVariableCountString;
+    std::string mImplementationVariableCountString;
+
+    std::string mInterfaceEnsembleParameterCountString;
+    std::string mImplementationEnsembleParameterCountString;
+
+    std::string mVariableTypeObjectFamWoevString;
+    std::string mVariableTypeObjectFamWevString;
+    std::string mVariableTypeObjectFdmWoevString;
+    std::string mVariableTypeObjectFdmWevString;
+
+    std::string mVariableOfIntegrationVariableTypeString;
+    std::string mStateVariableTypeString;
+    std::string mConstantVariableTypeString;
+    std::string mComputedConstantVariableTypeString;
+    std::string mAlgebraicVariableTypeString;
+    std::string mExternalVariableTypeString;
+
+    std::string mVariableInfoObjectString;
+
+    std::string mInterfaceVoiInfoString;
+    std::string mImplementationVoiInfoString;
+
+    std::string mInterfaceStateInfoString;
+    std::string mImplementationStateInfoString;
+
+    std::string mInterfaceVariableInfoString;
+    std::string mImplementationVariableInfoString;
+
+    std::string mVariableInfoEntryString;
+
+    std::string mVoiString;
+
+    std::string mStatesArrayString;
+    std::string mRatesArrayString;
+    std::string mVariablesArrayString;
+
+    std::string mRushLarsenTausArrayString;
+    std::string mRushLarsenSteadyStatesArrayString;
+    std::string mLocalVariableNameString;
+    std::string mLocalVariableDeclarationString;
+
+    std::string mForwardEulerStateUpdateString;
+    std::string mRushLarsenStateUpdateString;
+
+    std::string mSensitivityNameString;
+    std::string mChunkMethodNameString;
+
+    std::string mLookupTableDeclarationString;
+    std::string mLookupTableEntryString;
+    std::string mLookupTableValueCallString;
+    std::string mLookupTableErrorString;
+    std::string mLookupTableValueMethodString;
+    std::string mLookupTableInitialisationString;
+
+    std::string mEnsembleOpenmpPragmaString;
+    std::string mEnsembleParameterAssignmentString;
+
+    std::string mExternalVariableMethodTypeDefinitionFamString;
+    std::string mExternalVariableMethodTypeDefinitionFdmString;
+
+    std::string mExternalVariableMethodCallFamString;
+    std::string mExternalVariableMethodCallFdmString;
+
+    std::string mRootFindingInfoObjectFamString;
+    std::string mRootFindingInfoObjectFdmString;
+    std::string mExternNlaSolveMethodString;
+    std::string mFindRootCallFamString;
+    std::string mFindRootCallFdmString;
+    std::string mFindRootMethodFamString;
+    std::string mFindRootMethodFdmString;
+    std::string mNlaSolveCallFamString;
+    std::string mNlaSolveCallFdmString;
+    std::string mObjectiveFunctionMethodFamString;
+    std::string mObjectiveFunctionMethodFdmString;
+    std::string mUArrayString;
+    std::string mFArrayString;
+
+    std::string mInterfaceCreateStatesArrayMethodString;
+    std::string mImplementationCreateStatesArrayMethodString;
+
+    std::string mInterfaceCreateVariablesArrayMethodString;
+    std::string mImplementationCreateVariablesArrayMethodString;
+
+    std::string mInterfaceDeleteArrayMethodString;
+    std::string mImplementationDeleteArrayMethodString;
+
+    std::string mInterfaceInitialiseVariablesMethodFamWoevString;
+    std::string mImplementationInitialiseVariablesMethodFamWoevString;
+
+    std::string mInterfaceInitialiseVariablesMethodFamWevString;
+    std::string mImplementationInitialiseVariablesMethodFamWevString;
+
+    std::string mInterfaceInitialiseVariablesMethodFdmWoevString;
+    std::string mImplementationInitialiseVariablesMethodFdmWoevString;
+
+    std::string mInterfaceInitialiseVariablesMethodFdmWevString;
+    std::string mImplementationInitialiseVariablesMethodFdmWevString;
+
+    std::string mInterfaceComputeComputedConstantsMethodString;
+    std::string mImplementationComputeComputedConstantsMethodString;
+
+    std::string mInterfaceComputeRatesMethodWoevString;
+    std::string mImplementationComputeRatesMethodWoevString;
+
+    std::string mInterfaceComputeRatesMethodWevString;
+    std::string mImplementationComputeRatesMethodWevString;
+
+    std::string mInterfaceComputeRushLarsenCoefficientsMethodString;
+    std::string mImplementationComputeRushLarsenCoefficientsMethodString;
+    std::string mImplementationComputeRatesMethodWithLocalVariablesString;
+
+    std::string mInterfaceInitialiseLookupTablesMethodString;
+    std::string mImplementationInitialiseLookupTablesMethodString;
+
+    std::string mInterfaceInitialiseEnsembleMethodString;
+    std::string mImplementationInitialiseEnsembleMethodString;
+
+    std::string mInterfaceComputeEnsembleRatesMethodString;
+    std::string mImplementationComputeEnsembleRatesMethodString;
+
+    std::string mInterfaceComputeEnsembleVariablesMethodString;
+    std::string mImplementationComputeEnsembleVariablesMethodString;
+
+    std::string mInterfaceIntegrateForwardEulerMethodString;
+    std::string mImplementationIntegrateForwardEulerMethodString;
+
+    std::string mInterfaceIntegrateRk4MethodString;
+    std::string mImplementationIntegrateRk4MethodString;
+
+    std::string mInterfaceIntegrateRushLarsenMethodString;
+    std::string mImplementationIntegrateRushLarsenMethodString;
+
+    std::string mInterfaceComputeVariablesMethodFamWoevString;
+    std::string mImplementationComputeVariablesMethodFamWoevString;
+
+    std::string mInterfaceComputeVariablesMethodFamWevString;
+    std::string mImplementationComputeVariablesMethodFamWevString;
+
+    std::string mInterfaceComputeVariablesMethodFdmWoevString;
+    std::string mImplementationComputeVariablesMethodFdmWoevString;
+
+    std::string mInterfaceComputeVariablesMethodFdmWevString;
+    std::string mImplementationComputeVariablesMethodFdmWevString;
+
+    std::string mEmptyMethodString;
+
+    std::string mIndentString;
+
+    std::string mOpenArrayInitialiserString;
+    std::string mCloseArrayInitialiserString;
+
+    std::string mOpenArrayString;
+    std::string mCloseArrayString;
+
+    std::string mArrayElementSeparatorString;
+
+    std::string mStringDelimiterString;
+
+    std::string mCommandSeparatorString;
+
+    // A counter that gets incremented every time the profile gets modified,
+    // so that anything that is derived from the profile (i.e. its SHA-1 value
+    // and its precompiled templates) can be cached.
+    // Note: a profile gets loaded upon creation, so its version is never zero,
+    //       meaning that a cached version of zero is never up to date.
+
+    size_t mVersion = 0;
+
+    mutable size_t mSha1ValueVersion = 0;
+    mutable std::string mSha1Value;
+
+    mutable size_t mProfileTemplatesVersion = 0;
+    mutable std::unordered_map<std::string, ProfileTemplate> mProfileTemplates;
+
+    void loadProfile(GeneratorProfile::Profile profile);
+    void applyPrecision();
+    void applyVectorisation();
+
+    const ProfileTemplate *profileTemplate(const std::string &string,
+                                           const std::vector<std::string> &tags) const;
+};
+
+} // namespace libcellml
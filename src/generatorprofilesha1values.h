@@ -24,7 +24,11 @@ namespace libcellml {
  * The content of this file is generated, do not edit this file directly.
  * See docs/dev_utilities.rst for further information.
  */
-static const char C_GENERATOR_PROFILE_SHA1[] = "1ac959303d5e8d6623cbe0979cb608ef48aff653";
-static const char PYTHON_GENERATOR_PROFILE_SHA1[] = "41f70a8d0486fdb3638b310814ebaa7d3ddd6771";
+static const char C_GENERATOR_PROFILE_SHA1[] = "5e4bec8ae66101e98712f7956362393b0e54df5e";
+static const char C_SINGLE_PRECISION_GENERATOR_PROFILE_SHA1[] = "56c99eaeb6319732bd517356de69c474a4d90384";
+static const char C_MIXED_PRECISION_GENERATOR_PROFILE_SHA1[] = "d105af38305dba13a3b6970c0cf8132147433441";
+static const char PYTHON_GENERATOR_PROFILE_SHA1[] = "08c04d5e2d9d4275ee18d8fc6c06e2fae0e2258f";
+static const char CPP_GENERATOR_PROFILE_SHA1[] = "9607b200c9788e93af863dd558c0bd3d8738112d";
+static const char NUMPY_GENERATOR_PROFILE_SHA1[] = "8b2e034350954232536cd22d136d05bcc56480ca";
 
 } // namespace libcellml
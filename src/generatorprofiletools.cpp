@@ -263,6 +263,54 @@ std::string sha1(const std::string &string)
     return result.str();
 }
 
+ProfileTemplate compileProfileTemplate(const std::string &string,
+                                       const std::vector<std::string> &tags)
+{
+    ProfileTemplate res;
+    size_t start = 0;
+
+    for (;;) {
+        // Look for the first tag that comes after our start position.
+
+        auto position = std::string::npos;
+        size_t tagIndex = 0;
+
+        for (size_t i = 0; i < tags.size(); ++i) {
+            auto tagPosition = tags[i].empty() ? std::string::npos : string.find(tags[i], start);
+
+            if (tagPosition < position) {
+                position = tagPosition;
+                tagIndex = i;
+            }
+        }
+
+        if (position == std::string::npos) {
+            res.mLiterals.push_back(string.substr(start));
+
+            return res;
+        }
+
+        res.mLiterals.push_back(string.substr(start, position - start));
+        res.mPlaceholders.push_back(tagIndex);
+
+        start = position + tags[tagIndex].length();
+    }
+}
+
+void appendProfileTemplate(std::string &code,
+                           const ProfileTemplate &profileTemplate,
+                           std::initializer_list<const std::string *> values)
+{
+    auto valuesBegin = values.begin();
+
+    code += profileTemplate.mLiterals.front();
+
+    for (size_t i = 0; i < profileTemplate.mPlaceholders.size(); ++i) {
+        code += **(valuesBegin + profileTemplate.mPlaceholders[i]);
+        code += profileTemplate.mLiterals[i + 1];
+    }
+}
+
 std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile)
 {
     // Whether the profile requires an interface to be generated.
@@ -274,6 +322,27 @@ std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile
                                TRUE_VALUE :
                                FALSE_VALUE;
 
+    // Whether the profile requires a method to compute the Rush-Larsen
+    // coefficients to be generated.
+
+    profileContents += generatorProfile->hasComputeRushLarsenCoefficientsMethod() ?
+                           TRUE_VALUE :
+                           FALSE_VALUE;
+
+    // Whether the profile keeps purely intermediate algebraic variables as local
+    // variables in computeRates().
+
+    profileContents += generatorProfile->hasLocalVariablesInComputeRates() ?
+                           TRUE_VALUE :
+                           FALSE_VALUE;
+
+    // Whether the profile requires methods to integrate the model using a
+    // fixed-step method to be generated.
+
+    profileContents += generatorProfile->hasIntegrateMethods() ?
+                           TRUE_VALUE :
+                           FALSE_VALUE;
+
     // Equality.
 
     profileContents += generatorProfile->equalityString();
@@ -390,7 +459,8 @@ std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile
                        + generatorProfile->eString()
                        + generatorProfile->piString()
                        + generatorProfile->infString()
-                       + generatorProfile->nanString();
+                       + generatorProfile->nanString()
+                       + generatorProfile->literalSuffixString();
 
     // Arithmetic functions.
 
@@ -423,9 +493,10 @@ std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile
                        + generatorProfile->acothFunctionString();
 
     // Miscellaneous.
-    // Note: we do NOT include interfaceFileNameString() since it may be the
-    //       only thing that someone might change, so that the generated file
-    //       works with the file name it is to be given.
+    // Note: we do NOT include interfaceFileNameString() and namespaceString()
+    //       since they may be the only things that someone might change, so
+    //       that the generated file works with the file name it is to be given
+    //       and can be used alongside the code generated for other models.
 
     profileContents += generatorProfile->commentString()
                        + generatorProfile->originCommentString();
@@ -433,6 +504,9 @@ std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile
     profileContents += generatorProfile->interfaceHeaderString()
                        + generatorProfile->implementationHeaderString();
 
+    profileContents += generatorProfile->implementationNamespaceBeginString()
+                       + generatorProfile->implementationNamespaceEndString();
+
     profileContents += generatorProfile->interfaceVersionString()
                        + generatorProfile->implementationVersionString();
 
@@ -445,6 +519,9 @@ std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile
     profileContents += generatorProfile->interfaceVariableCountString()
                        + generatorProfile->implementationVariableCountString();
 
+    profileContents += generatorProfile->interfaceEnsembleParameterCountString()
+                       + generatorProfile->implementationEnsembleParameterCountString();
+
     profileContents += generatorProfile->variableTypeObjectString(false, false);
     profileContents += generatorProfile->variableTypeObjectString(false, true);
     profileContents += generatorProfile->variableTypeObjectString(true, false);
@@ -476,6 +553,28 @@ std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile
                        + generatorProfile->ratesArrayString()
                        + generatorProfile->variablesArrayString();
 
+    profileContents += generatorProfile->rushLarsenTausArrayString()
+                       + generatorProfile->rushLarsenSteadyStatesArrayString();
+
+    profileContents += generatorProfile->localVariableNameString()
+                       + generatorProfile->localVariableDeclarationString();
+
+    profileContents += generatorProfile->forwardEulerStateUpdateString()
+                       + generatorProfile->rushLarsenStateUpdateString();
+
+    profileContents += generatorProfile->sensitivityNameString()
+                       + generatorProfile->chunkMethodNameString();
+
+    profileContents += generatorProfile->lookupTableDeclarationString()
+                       + generatorProfile->lookupTableEntryString()
+                       + generatorProfile->lookupTableValueCallString()
+                       + generatorProfile->lookupTableErrorString()
+                       + generatorProfile->lookupTableValueMethodString()
+                       + generatorProfile->lookupTableInitialisationString();
+
+    profileContents += generatorProfile->ensembleOpenmpPragmaString()
+                       + generatorProfile->ensembleParameterAssignmentString();
+
     profileContents += generatorProfile->externalVariableMethodTypeDefinitionString(false)
                        + generatorProfile->externalVariableMethodTypeDefinitionString(true);
 
@@ -526,6 +625,32 @@ std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile
     profileContents += generatorProfile->interfaceComputeRatesMethodString(true)
                        + generatorProfile->implementationComputeRatesMethodString(true);
 
+    profileContents += generatorProfile->interfaceComputeRushLarsenCoefficientsMethodString()
+                       + generatorProfile->implementationComputeRushLarsenCoefficientsMethodString();
+
+    profileContents += generatorProfile->implementationComputeRatesMethodWithLocalVariablesString();
+
+    profileContents += generatorProfile->interfaceInitialiseLookupTablesMethodString()
+                       + generatorProfile->implementationInitialiseLookupTablesMethodString();
+
+    profileContents += generatorProfile->interfaceInitialiseEnsembleMethodString()
+                       + generatorProfile->implementationInitialiseEnsembleMethodString();
+
+    profileContents += generatorProfile->interfaceComputeEnsembleRatesMethodString()
+                       + generatorProfile->implementationComputeEnsembleRatesMethodString();
+
+    profileContents += generatorProfile->interfaceComputeEnsembleVariablesMethodString()
+                       + generatorProfile->implementationComputeEnsembleVariablesMethodString();
+
+    profileContents += generatorProfile->interfaceIntegrateForwardEulerMethodString()
+                       + generatorProfile->implementationIntegrateForwardEulerMethodString();
+
+    profileContents += generatorProfile->interfaceIntegrateRk4MethodString()
+                       + generatorProfile->implementationIntegrateRk4MethodString();
+
+    profileContents += generatorProfile->interfaceIntegrateRushLarsenMethodString()
+                       + generatorProfile->implementationIntegrateRushLarsenMethodString();
+
     profileContents += generatorProfile->interfaceComputeVariablesMethodString(false, false)
                        + generatorProfile->implementationComputeVariablesMethodString(false, false);
 
@@ -16,7 +16,9 @@ limitations under the License.
 
 #pragma once
 
+#include <initializer_list>
 #include <string>
+#include <vector>
 
 #include <libcellml/types.h>
 
@@ -44,4 +46,48 @@ std::string sha1(const std::string &string);
  */
 std::string generatorProfileAsString(const GeneratorProfilePtr &generatorProfile);
 
+/**
+ * @brief A precompiled profile template.
+ *
+ * A profile template is a profile string (e.g. "[CONDITION]?[IF_STATEMENT]")
+ * that has been split into literal segments and placeholders, so that it can be
+ * instantiated in a single pass, i.e. without having to look for its
+ * placeholders every time that it gets instantiated.
+ */
+struct ProfileTemplate
+{
+    std::vector<std::string> mLiterals; /**< The literal segments, i.e. one more than there are placeholders. */
+    std::vector<size_t> mPlaceholders; /**< The index, in the list of tags, of each placeholder. */
+};
+
+/**
+ * @brief Compile the given @p string into a profile template.
+ *
+ * Compile the given @p string into a profile template, looking only for the
+ * given @p tags, so that anything else (e.g. "[nan]" or "res[i]") is kept as a
+ * literal.
+ *
+ * @param string The profile string to compile.
+ * @param tags The tags (e.g. "[CODE]") to look for in @p string.
+ *
+ * @return The compiled profile template.
+ */
+ProfileTemplate compileProfileTemplate(const std::string &string,
+                                       const std::vector<std::string> &tags);
+
+/**
+ * @brief Append an instance of the given @p profileTemplate to @p code.
+ *
+ * Append an instance of the given @p profileTemplate to @p code, replacing
+ * each placeholder with the value, in @p values, that corresponds to its tag.
+ *
+ * @param code The code to which the instantiated template is to be appended.
+ * @param profileTemplate The profile template to instantiate.
+ * @param values The values of the tags, in the order that the tags were given
+ * to compileProfileTemplate().
+ */
+void appendProfileTemplate(std::string &code,
+                           const ProfileTemplate &profileTemplate,
+                           std::initializer_list<const std::string *> values);
+
 } // namespace libcellml
@@ -0,0 +1,85 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "idindex.h"
+
+#include "libcellml/component.h"
+#include "libcellml/importsource.h"
+#include "libcellml/model.h"
+#include "libcellml/units.h"
+
+#include "entity_p.h"
+
+namespace libcellml {
+
+EntityRevisions IdIndexBase::identifierRevisions(const ModelPtr &model)
+{
+    EntityRevisions revisions;
+
+    if (model == nullptr) {
+        return revisions;
+    }
+
+    auto revision = [](const EntityPtr &entity) {
+        return entity->pFunc()->mRevision;
+    };
+    EntityPtr entity = model;
+
+    revisions.emplace_back(model.get(), entity->pFunc()->mTreeRevision);
+
+    for (size_t i = 0; i < model->unitsCount(); ++i) {
+        auto importSource = model->units(i)->importSource();
+
+        if (importSource != nullptr) {
+            revisions.emplace_back(importSource.get(), revision(importSource));
+        }
+    }
+
+    std::vector<ComponentPtr> components;
+
+    for (size_t i = 0; i < model->componentCount(); ++i) {
+        components.push_back(model->component(i));
+    }
+
+    while (!components.empty()) {
+        auto component = components.back();
+        auto importSource = component->importSource();
+
+        components.pop_back();
+
+        if (importSource != nullptr) {
+            revisions.emplace_back(importSource.get(), revision(importSource));
+        }
+
+        for (size_t i = 0; i < component->componentCount(); ++i) {
+            components.push_back(component->component(i));
+        }
+    }
+
+    return revisions;
+}
+
+bool IdIndexBase::isUpToDate(const EntityRevisions &revisions) const
+{
+    return !revisions.empty() && (revisions == mRevisions);
+}
+
+void IdIndexBase::invalidate()
+{
+    mRevisions.clear();
+}
+
+} // namespace libcellml
@@ -0,0 +1,193 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "libcellml/types.h"
+
+namespace libcellml {
+
+using EntityRevisions = std::vector<std::pair<const Entity *, size_t>>; /**< Type definition for a list of entities along with their revision. */
+
+/**
+ * @brief The IdIndexBase class.
+ *
+ * The non-template part of the IdIndex class, which keeps track of the
+ * revisions of the entities that the identifiers of a model depend on, so
+ * that an index can tell whether it still reflects its model.
+ */
+class IdIndexBase
+{
+public:
+    /**
+     * @brief Get the revisions that the identifiers of the @p model depend on.
+     *
+     * Get the revisions of the entities that the identifiers of the given
+     * @p model depend on, i.e. the tree revision of the @p model and the
+     * revisions of its import sources (which are not part of the model).
+     *
+     * @param model The @c Model for which we want the revisions.
+     *
+     * @return The revisions of the entities that the identifiers of the
+     * @p model depend on, or an empty list if the @p model is @c nullptr.
+     */
+    static EntityRevisions identifierRevisions(const ModelPtr &model);
+
+    /**
+     * @brief Test if this index was built from the given @p revisions.
+     *
+     * @param revisions The revisions that the identifiers of a model currently
+     * depend on.
+     *
+     * @return @c true if this index was built from the given non-empty
+     * @p revisions, @c false otherwise.
+     */
+    bool isUpToDate(const EntityRevisions &revisions) const;
+
+    /**
+     * @brief Mark this index as needing to be rebuilt.
+     */
+    void invalidate();
+
+protected:
+    EntityRevisions mRevisions; /**< Revisions from which this index was built. */
+};
+
+/**
+ * @brief The IdIndex class.
+ *
+ * The IdIndex class maps the identifiers of a model to the items that use
+ * them, in the order in which they were added.  Each identifier is stored
+ * only once and looked up through a hash table, while sorted lists of the
+ * identifiers are only built when asked for.
+ */
+template<typename T>
+class IdIndex: public IdIndexBase
+{
+public:
+    /**
+     * @brief Empty this index before it gets built from the given @p revisions.
+     *
+     * @param revisions The revisions that the identifiers of the model depend
+     * on, or an empty list if this index is not to be reused.
+     */
+    void reset(const EntityRevisions &revisions)
+    {
+        mItems.clear();
+        mItemCount = 0;
+        mRevisions = revisions;
+    }
+
+    /**
+     * @brief Add the given @p item to the items using the given @p id.
+     *
+     * @param id The identifier used by the @p item.
+     * @param item The item to add.
+     */
+    void add(const std::string &id, const T &item)
+    {
+        mItems[id].push_back(item);
+        ++mItemCount;
+    }
+
+    /**
+     * @brief Remove the item at @p index from the items using the given @p id.
+     *
+     * @param id The identifier used by the item.
+     * @param index The index of the item amongst the items using @p id.
+     */
+    void remove(const std::string &id, size_t index)
+    {
+        auto result = mItems.find(id);
+        if ((result != mItems.end()) && (index < result->second.size())) {
+            result->second.erase(result->second.begin() + ptrdiff_t(index));
+            --mItemCount;
+            if (result->second.empty()) {
+                mItems.erase(result);
+            }
+        }
+    }
+
+    /**
+     * @brief Get the number of items using the given @p id.
+     *
+     * @param id The identifier to look up.
+     *
+     * @return The number of items using @p id.
+     */
+    size_t count(const std::string &id) const
+    {
+        auto result = mItems.find(id);
+        return (result != mItems.end()) ? result->second.size() : 0;
+    }
+
+    /**
+     * @brief Get the items using the given @p id.
+     *
+     * @param id The identifier to look up.
+     *
+     * @return The items using @p id, in the order in which they were added.
+     */
+    const std::vector<T> &items(const std::string &id) const
+    {
+        static const std::vector<T> NO_ITEMS;
+        auto result = mItems.find(id);
+        return (result != mItems.end()) ? result->second : NO_ITEMS;
+    }
+
+    /**
+     * @brief Get the number of items in this index.
+     *
+     * @return The number of items, whether or not they share an identifier.
+     */
+    size_t size() const
+    {
+        return mItemCount;
+    }
+
+    /**
+     * @brief Get the identifiers in this index.
+     *
+     * @param duplicatesOnly Whether to only list the identifiers used by
+     * several items.
+     *
+     * @return The (duplicate) identifiers in this index, in alphabetical order.
+     */
+    std::vector<std::string> ids(bool duplicatesOnly = false) const
+    {
+        std::vector<std::string> ids;
+        for (const auto &item : mItems) {
+            if (!duplicatesOnly || (item.second.size() > 1)) {
+                ids.push_back(item.first);
+            }
+        }
+        std::sort(ids.begin(), ids.end());
+
+        return ids;
+    }
+
+private:
+    std::unordered_map<std::string, std::vector<T>> mItems; /**< Items using a given identifier. */
+    size_t mItemCount = 0; /**< Number of items in this index. */
+};
+
+} // namespace libcellml
@@ -18,6 +18,8 @@ limitations under the License.
 
 #include "libcellml/importsource.h"
 
+#include "entity_p.h"
+
 namespace libcellml {
 
 /**
@@ -54,6 +56,8 @@ ImportSourcePtr ImportedEntity::importSource() const
 void ImportedEntity::setImportSource(const ImportSourcePtr &importSource)
 {
     mPimpl->mImportSource = importSource;
+
+    Entity::EntityImpl::markModified(dynamic_cast<Entity *>(this));
 }
 
 std::string ImportedEntity::importReference() const
@@ -64,6 +68,8 @@ std::string ImportedEntity::importReference() const
 void ImportedEntity::setImportReference(const std::string &reference)
 {
     mPimpl->mImportReference = reference;
+
+    Entity::EntityImpl::markModified(dynamic_cast<Entity *>(this));
 }
 
 bool ImportedEntity::isResolved() const
@@ -35,6 +35,7 @@ limitations under the License.
 #include "commonutils.h"
 #include "issue_p.h"
 #include "logger_p.h"
+#include "unitsgraph.h"
 #include "utilities.h"
 
 namespace libcellml {
@@ -71,7 +72,7 @@ public:
     bool fetchUnits(const UnitsPtr &importUnits, const std::string &baseFile, History &history);
 
     bool checkForImportCycles(const ImportSourcePtr &importSource, const History &history, const HistoryEpochPtr &h, const std::string &action);
-    bool checkUnitsForCycles(const UnitsPtr &units, History &history);
+    bool checkUnitsForCycles(const UnitsPtr &units, History &history, UnitsGraphs &unitsGraphs);
     bool checkComponentForCycles(const ComponentPtr &component, History &history);
 
     /**
@@ -143,16 +144,19 @@ std::string Importer::ImporterImpl::resolvingUrl(const ImportSourcePtr &importSo
     return modelUrl(model);
 }
 
-bool Importer::ImporterImpl::checkUnitsForCycles(const UnitsPtr &units, History &history)
+bool Importer::ImporterImpl::checkUnitsForCycles(const UnitsPtr &units, History &history, UnitsGraphs &unitsGraphs)
 {
     // Even if these units are not imported, they might have imported children.
     if (!units->isImport()) {
+        auto model = owningModel(units);
         for (size_t index = 0; index < units->unitCount(); ++index) {
             std::string ref = units->unitAttributeReference(index);
-            // If the child units are imported, check them too.
-            auto model = owningModel(units);
-            if (model->hasUnits(ref)) {
-                if (checkUnitsForCycles(model->units(ref), history)) {
+            // If the child units are imported, check them too, unless they
+            // are part of a cycle of local units, which would never end.
+            if (!isStandardUnitName(ref) && model->hasUnits(ref)) {
+                auto childUnits = model->units(ref);
+                if (!unitsGraph(unitsGraphs, model).isCyclicDependency(units, childUnits)
+                    && checkUnitsForCycles(childUnits, history, unitsGraphs)) {
                     return true;
                 }
             }
@@ -175,7 +179,7 @@ bool Importer::ImporterImpl::checkUnitsForCycles(const UnitsPtr &units, History
     auto model = units->importSource()->model();
     if (model == nullptr) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Units '" + units->name() + "' requires a model imported from '" + resolvingUrl + "' which is not available in the importer.");
+        issue->mPimpl->setDescription("Units '%1' requires a model imported from '%2' which is not available in the importer.", {units->name(), resolvingUrl});
         issue->mPimpl->mItem->mPimpl->setImportSource(units->importSource());
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_NULL_MODEL);
         addIssue(issue);
@@ -184,18 +188,26 @@ bool Importer::ImporterImpl::checkUnitsForCycles(const UnitsPtr &units, History
     auto importedUnits = model->units(units->importReference());
     if (importedUnits == nullptr) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Units '" + units->name() + "' imports units named '" + units->importReference() + "' from the model imported from '" + resolvingUrl + "'. The units could not be found.");
+        issue->mPimpl->setDescription("Units '%1' imports units named '%2' from the model imported from '%3'. The units could not be found.", {units->name(), units->importReference(), resolvingUrl});
         issue->mPimpl->mItem->mPimpl->setImportSource(units->importSource());
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_MISSING_UNITS);
         addIssue(issue);
         return true;
     }
 
-    return checkUnitsForCycles(importedUnits, history);
+    return checkUnitsForCycles(importedUnits, history, unitsGraphs);
 }
 
 bool Importer::ImporterImpl::checkComponentForCycles(const ComponentPtr &component, History &history)
 {
+    // Note: unlike units, which can depend on several other units, an imported
+    //       component refers to exactly one component, so following its import
+    //       references is a walk along a chain rather than through a graph.
+    //       Also, the encapsulation hierarchy is a tree, so it cannot have any
+    //       cycles of its own. Hence, the history is enough to detect a cycle,
+    //       and there is nothing to gain from grouping components into
+    //       strongly connected components as is done for units.
+
     std::string resolvingUrl = ImporterImpl::resolvingUrl(component->importSource());
     auto componentModel = owningModel(component);
     auto h = createHistoryEpoch(component, modelUrl(componentModel), resolvingUrl);
@@ -210,7 +222,7 @@ bool Importer::ImporterImpl::checkComponentForCycles(const ComponentPtr &compone
     auto model = component->importSource()->model();
     if (model == nullptr) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Component '" + component->name() + "' requires a model imported from '" + resolvingUrl + "' which is not available in the importer.");
+        issue->mPimpl->setDescription("Component '%1' requires a model imported from '%2' which is not available in the importer.", {component->name(), resolvingUrl});
         issue->mPimpl->mItem->mPimpl->setImportSource(component->importSource());
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_NULL_MODEL);
         addIssue(issue);
@@ -219,7 +231,7 @@ bool Importer::ImporterImpl::checkComponentForCycles(const ComponentPtr &compone
     auto importedComponent = model->component(component->importReference(), true);
     if (importedComponent == nullptr) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Component '" + component->name() + "' imports a component named '" + component->importReference() + "' from the model imported from '" + resolvingUrl + "'. The component could not be found.");
+        issue->mPimpl->setDescription("Component '%1' imports a component named '%2' from the model imported from '%3'. The component could not be found.", {component->name(), component->importReference(), resolvingUrl});
         issue->mPimpl->mItem->mPimpl->setImportSource(component->importSource());
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_MISSING_COMPONENT);
         addIssue(issue);
@@ -236,10 +248,11 @@ bool Importer::ImporterImpl::checkComponentForCycles(const ComponentPtr &compone
 bool Importer::ImporterImpl::hasImportIssues(const ModelPtr &model)
 {
     History history;
+    UnitsGraphs unitsGraphs;
 
     for (const UnitsPtr &units : getImportedUnits(model)) {
         history.clear();
-        if (checkUnitsForCycles(units, history)) {
+        if (checkUnitsForCycles(units, history, unitsGraphs)) {
             return true;
         }
     }
@@ -346,7 +359,7 @@ bool Importer::ImporterImpl::fetchModel(const ImportSourcePtr &importSource, con
         std::ifstream file(url);
         if (!file.good()) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("The attempt to resolve imports with the model at '" + url + "' failed: the file could not be opened.");
+            issue->mPimpl->setDescription("The attempt to resolve imports with the model at '%1' failed: the file could not be opened.", {url});
             issue->mPimpl->mItem->mPimpl->setImportSource(importSource);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_MISSING_FILE);
             addIssue(issue);
@@ -368,7 +381,7 @@ bool Importer::ImporterImpl::fetchModel(const ImportSourcePtr &importSource, con
             for (size_t index = 0; index < errorCount; ++index) {
                 if (parser->error(index)->referenceRule() == Issue::ReferenceRule::XML) {
                     auto issue = Issue::IssueImpl::create();
-                    issue->mPimpl->setDescription("The attempt to import the model at '" + url + "' failed: the file is not valid XML.");
+                    issue->mPimpl->setDescription("The attempt to import the model at '%1' failed: the file is not valid XML.", {url});
                     issue->mPimpl->mItem->mPimpl->setImportSource(importSource);
                     if (mImporter->isStrict()) {
                         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_NULL_MODEL);
@@ -484,7 +497,7 @@ bool Importer::ImporterImpl::fetchComponent(const ComponentPtr &importComponent,
 
     if (encounteredRelatedError) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Encountered an error when resolving component '" + importComponent->name() + "' from '" + resolvingUrl + "'.");
+        issue->mPimpl->setDescription("Encountered an error when resolving component '%1' from '%2'.", {importComponent->name(), resolvingUrl});
         issue->mPimpl->mItem->mPimpl->setComponent(importComponent);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_ERROR_IMPORTING_UNITS);
         addIssue(issue);
@@ -524,7 +537,7 @@ bool Importer::ImporterImpl::fetchComponent(const ComponentPtr &importComponent,
             auto units = sourceModel->units(unitName);
             if (units == nullptr) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Import of component '" + importComponent->name() + "' from '" + resolvingUrl + "' requires units named '" + unitName + "' which cannot be found.");
+                issue->mPimpl->setDescription("Import of component '%1' from '%2' requires units named '%3' which cannot be found.", {importComponent->name(), resolvingUrl, unitName});
                 issue->mPimpl->mItem->mPimpl->setComponent(importComponent);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_MISSING_COMPONENT);
                 addIssue(issue);
@@ -536,7 +549,7 @@ bool Importer::ImporterImpl::fetchComponent(const ComponentPtr &importComponent,
         }
     } else {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Import of component '" + importComponent->name() + "' from '" + resolvingUrl + "' requires component named '" + importComponent->importReference() + "' which cannot be found.");
+        issue->mPimpl->setDescription("Import of component '%1' from '%2' requires component named '%3' which cannot be found.", {importComponent->name(), resolvingUrl, importComponent->importReference()});
         issue->mPimpl->mItem->mPimpl->setComponent(importComponent);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_MISSING_COMPONENT);
         addIssue(issue);
@@ -575,7 +588,7 @@ bool Importer::ImporterImpl::fetchUnits(const UnitsPtr &importUnits, const std::
 
     if (encounteredRelatedError) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Encountered an error when resolving units '" + importUnits->name() + "' from '" + resolvingUrl + "'.");
+        issue->mPimpl->setDescription("Encountered an error when resolving units '%1' from '%2'.", {importUnits->name(), resolvingUrl});
         issue->mPimpl->mItem->mPimpl->setUnits(importUnits);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_ERROR_IMPORTING_UNITS);
         addIssue(issue);
@@ -611,7 +624,7 @@ bool Importer::ImporterImpl::fetchUnits(const UnitsPtr &importUnits, const std::
             auto sourceUnit = sourceModel->units(reference);
             if (sourceUnit == nullptr) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Import of units '" + importUnits->name() + "' from '" + resolvingUrl + "' requires units named '" + importUnits->importReference() + "', which relies on child units named '" + reference + "', which cannot be found.");
+                issue->mPimpl->setDescription("Import of units '%1' from '%2' requires units named '%3', which relies on child units named '%4', which cannot be found.", {importUnits->name(), resolvingUrl, importUnits->importReference(), reference});
                 issue->mPimpl->mItem->mPimpl->setUnits(sourceUnits);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_MISSING_UNITS);
                 addIssue(issue);
@@ -625,7 +638,7 @@ bool Importer::ImporterImpl::fetchUnits(const UnitsPtr &importUnits, const std::
         }
     } else {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Import of units '" + importUnits->name() + "' from '" + resolvingUrl + "' requires units named '" + importUnits->importReference() + "' which cannot be found.");
+        issue->mPimpl->setDescription("Import of units '%1' from '%2' requires units named '%3' which cannot be found.", {importUnits->name(), resolvingUrl, importUnits->importReference()});
         issue->mPimpl->mItem->mPimpl->setUnits(importUnits);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORTER_MISSING_UNITS);
         addIssue(issue);
@@ -654,21 +667,28 @@ bool Importer::resolveImports(ModelPtr &model, const std::string &basePath)
     clearImports(model);
     auto normalisedBasePath = normalisePath(basePath);
 
+    // Note: the issues logged while resolving an import may get modified or
+    //       removed, so they only get streamed once the import is resolved.
+
     for (const UnitsPtr &units : getImportedUnits(model)) {
         history.clear();
+        pFunc()->holdIssueStreaming();
         if (!pFunc()->fetchUnits(units, normalisedBasePath, history)) {
             // Get the last issue recorded and change its object to be the top-level importing item.
             issue(issueCount() - 1)->mPimpl->mItem->mPimpl->setUnits(units);
             status = false;
         }
+        pFunc()->releaseIssueStreaming();
     }
 
     for (const ComponentPtr &component : getImportedComponents(model)) {
         history.clear();
+        pFunc()->holdIssueStreaming();
         if (!pFunc()->fetchComponent(component, normalisedBasePath, history)) {
             issue(issueCount() - 1)->mPimpl->mItem->mPimpl->setComponent(component);
             status = false;
         }
+        pFunc()->releaseIssueStreaming();
     }
 
     return status;
@@ -75,6 +75,8 @@ std::string ImportSource::url() const
 void ImportSource::setUrl(const std::string &url)
 {
     pFunc()->mUrl = url;
+
+    EntityImpl::markModified(this);
 }
 
 ModelPtr ImportSource::model() const
@@ -92,11 +94,15 @@ void ImportSource::setModel(const ModelPtr &model)
     } else {
         pFunc()->mModel = model;
     }
+
+    EntityImpl::markModified(this);
 }
 
 void ImportSource::removeModel()
 {
     pFunc()->mModel.reset();
+
+    EntityImpl::markModified(this);
 }
 
 bool ImportSource::hasModel() const
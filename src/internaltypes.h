@@ -38,6 +38,7 @@ using NameList = std::vector<std::string>; /**< Type definition for list of name
 using DescriptionList = std::vector<std::pair<VariablePtr, std::string>>; /**< Type definition for list of variables and associated description. */
 using StringStringMap = std::map<std::string, std::string>; /**< Type definition for map of string to string. */
 using UniqueNames = std::set<std::string>; /**< Type definition for a set of unique names. */
+using NameSet = std::unordered_set<std::string>; /**< Type definition for a hashed set of names. */
 
 // VariableMap
 using VariableMap = std::vector<VariablePairPtr>; /**< Type definition for vector of VariablePair.*/
@@ -50,7 +51,6 @@ using ComponentMapIterator = ComponentMap::const_iterator; /**< Type definition
 
 using VariablePtrs = std::vector<VariablePtr>; /**< Type definition for list of variables. */
 
-using IdMap = std::map<std::string, std::pair<int, std::vector<std::string>>>; /**< Type definition for map of IDs in Validator. **/
 using ImportLibrary = std::map<std::string, ModelPtr>; /** Type definition for library map of imported models. */
 using IdList = std::unordered_set<std::string>; /**< Type definition for list of identifiers. */
 
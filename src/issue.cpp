@@ -26,9 +26,56 @@ IssuePtr Issue::IssueImpl::create()
     return std::shared_ptr<Issue> {new Issue {}};
 }
 
+std::string formatDescription(const char *format, const std::vector<std::string> &arguments)
+{
+    std::string description;
+
+    for (auto character = format; *character != '\0'; ++character) {
+        if ((character[0] == '%') && (character[1] >= '1') && (character[1] <= '9')) {
+            description += arguments[size_t(character[1] - '1')];
+
+            ++character;
+        } else {
+            description += *character;
+        }
+    }
+
+    return description;
+}
+
+std::string Issue::IssueImpl::description()
+{
+    std::lock_guard<std::mutex> lock(mDescriptionMutex);
+
+    if (mDescriptionFormatter != nullptr) {
+        mDescription = mDescriptionFormatter();
+        mDescriptionFormatter = nullptr;
+    }
+
+    return mDescription;
+}
+
 void Issue::IssueImpl::setDescription(const std::string &description)
 {
+    std::lock_guard<std::mutex> lock(mDescriptionMutex);
+
     mDescription = description;
+    mDescriptionFormatter = nullptr;
+}
+
+void Issue::IssueImpl::setDescription(const char *format, std::vector<std::string> arguments)
+{
+    setDescription([format, arguments = std::move(arguments)]() {
+        return formatDescription(format, arguments);
+    });
+}
+
+void Issue::IssueImpl::setDescription(const std::function<std::string()> &formatter)
+{
+    std::lock_guard<std::mutex> lock(mDescriptionMutex);
+
+    mDescription.clear();
+    mDescriptionFormatter = formatter;
 }
 
 void Issue::IssueImpl::setLevel(Issue::Level level)
@@ -53,7 +100,7 @@ Issue::~Issue()
 
 std::string Issue::description() const
 {
-    return mPimpl->mDescription;
+    return mPimpl->description();
 }
 
 Issue::Level Issue::level() const
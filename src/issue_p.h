@@ -18,6 +18,11 @@ limitations under the License.
 
 #include "libcellml/issue.h"
 
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include "anycellmlelement_p.h"
 
 namespace libcellml {
@@ -29,7 +34,9 @@ namespace libcellml {
  */
 struct Issue::IssueImpl
 {
-    std::string mDescription; /**< The string description for why this issue was raised. */
+    std::string mDescription; /**< The string description for why this issue was raised, once formatted. */
+    std::function<std::string()> mDescriptionFormatter; /**< The function formatting the description, until it is first needed. */
+    std::mutex mDescriptionMutex; /**< The mutex guarding the formatting of the description. */
     Issue::Level mLevel = Issue::Level::ERROR; /**< The Issue::Level enum value for this issue. */
     Issue::ReferenceRule mReferenceRule = Issue::ReferenceRule::UNDEFINED; /**< The Issue::ReferenceRule enum value for this issue. */
     AnyCellmlElementPtr mItem = AnyCellmlElement::AnyCellmlElementImpl::create(); /**< The item for this issue. */
@@ -43,7 +50,43 @@ struct Issue::IssueImpl
      */
     static IssuePtr create();
 
+    /**
+     * @brief Get the description of this issue.
+     *
+     * Get the description of this issue, formatting it if this is the first
+     * time that it is needed.
+     *
+     * @return The description of this issue.
+     */
+    std::string description();
+
     void setDescription(const std::string &description);
+
+    /**
+     * @brief Set the description of this issue from a format and its arguments.
+     *
+     * Set the description of this issue from the given @p format, in which
+     * @c %1 to @c %9 stand for the corresponding entries of @p arguments.
+     * The description is only formatted when it is first needed, so that
+     * issues that are only counted or checked for their reference rule do not
+     * pay for it.
+     *
+     * @param format The format of the description, which must be a string
+     * literal since it is only used once the description is needed.
+     * @param arguments The names and values that go in the description.
+     */
+    void setDescription(const char *format, std::vector<std::string> arguments);
+
+    /**
+     * @brief Set the function that formats the description of this issue.
+     *
+     * Set the function that formats the description of this issue when it is
+     * first needed.  The function must only depend on values that it owns,
+     * so that the description does not depend on when it gets formatted.
+     *
+     * @param formatter The function that formats the description.
+     */
+    void setDescription(const std::function<std::string()> &formatter);
     void setLevel(Level level);
     void setReferenceRule(ReferenceRule referenceRule);
 };
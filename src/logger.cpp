@@ -43,49 +43,82 @@ Logger::Logger(LoggerImpl *derivedPimpl)
 
 Logger::~Logger() = default;
 
+IssuePtr Logger::LoggerImpl::issue(const std::vector<size_t> &indexes, size_t droppedCount, size_t index) const
+{
+    IssuePtr issue = nullptr;
+    if ((index >= droppedCount) && (index - droppedCount < indexes.size())) {
+        issue = mIssues.at(indexes.at(index - droppedCount));
+    }
+    return issue;
+}
+
 size_t Logger::errorCount() const
 {
-    return pFunc()->mErrors.size();
+    return pFunc()->mDroppedErrorCount + pFunc()->mErrors.size();
 }
 
 IssuePtr Logger::error(size_t index) const
 {
-    IssuePtr issue = nullptr;
-    if (index < pFunc()->mErrors.size()) {
-        issue = pFunc()->mIssues.at(pFunc()->mErrors.at(index));
-    }
-    return issue;
+    return pFunc()->issue(pFunc()->mErrors, pFunc()->mDroppedErrorCount, index);
 }
 
 size_t Logger::warningCount() const
 {
-    return pFunc()->mWarnings.size();
+    return pFunc()->mDroppedWarningCount + pFunc()->mWarnings.size();
 }
 
 IssuePtr Logger::warning(size_t index) const
 {
-    IssuePtr issue = nullptr;
-    if (index < pFunc()->mWarnings.size()) {
-        issue = pFunc()->mIssues.at(pFunc()->mWarnings.at(index));
-    }
-    return issue;
+    return pFunc()->issue(pFunc()->mWarnings, pFunc()->mDroppedWarningCount, index);
 }
 
 size_t Logger::messageCount() const
 {
-    return pFunc()->mMessages.size();
+    return pFunc()->mDroppedMessageCount + pFunc()->mMessages.size();
 }
 
 IssuePtr Logger::message(size_t index) const
 {
-    IssuePtr issue = nullptr;
-    if (index < pFunc()->mMessages.size()) {
-        issue = pFunc()->mIssues.at(pFunc()->mMessages.at(index));
-    }
-    return issue;
+    return pFunc()->issue(pFunc()->mMessages, pFunc()->mDroppedMessageCount, index);
+}
+
+void Logger::setIssueCallback(const IssueCallback &callback)
+{
+    // Only the issues logged from now on are to be streamed.
+
+    pFunc()->mIssueCallback = callback;
+    pFunc()->mIssueStreamingCancelled = false;
+    pFunc()->mStreamedIssueCount = pFunc()->mIssues.size();
+}
+
+IssueCallback Logger::issueCallback() const
+{
+    return pFunc()->mIssueCallback;
+}
+
+void Logger::setRetainIssues(bool retainIssues)
+{
+    pFunc()->mRetainIssues = retainIssues;
+}
+
+bool Logger::retainIssues() const
+{
+    return pFunc()->mRetainIssues;
 }
 
 void Logger::LoggerImpl::removeAllIssues()
+{
+    removeStoredIssues();
+
+    mIssueStreamingCancelled = false;
+    mStreamedIssueCount = 0;
+    mDroppedIssueCount = 0;
+    mDroppedErrorCount = 0;
+    mDroppedWarningCount = 0;
+    mDroppedMessageCount = 0;
+}
+
+void Logger::LoggerImpl::removeStoredIssues()
 {
     mIssues.clear();
     mErrors.clear();
@@ -95,10 +128,77 @@ void Logger::LoggerImpl::removeAllIssues()
 
 void Logger::LoggerImpl::removeError(size_t index)
 {
+    // Note: the error must be one that has not been streamed, i.e. one that was
+    //       logged while the streaming of issues was held back.
+
+    index -= mDroppedErrorCount;
+
     mIssues.erase(mIssues.begin() + ptrdiff_t(mErrors.at(index)));
     mErrors.erase(mErrors.begin() + ptrdiff_t(index));
 }
 
+void Logger::LoggerImpl::holdIssueStreaming()
+{
+    ++mIssueStreamingHoldCount;
+}
+
+void Logger::LoggerImpl::releaseIssueStreaming()
+{
+    if (--mIssueStreamingHoldCount == 0) {
+        streamIssues();
+    }
+}
+
+/**
+ * @brief Drop the given number of issues from the given @p indexes.
+ *
+ * Drop the indexes of the first @p issueCount issues from the given
+ * @p indexes and shift the remaining ones accordingly.
+ *
+ * @param indexes The indexes of the stored issues of a given level.
+ * @param issueCount The number of issues that are being dropped.
+ *
+ * @return The number of indexes that were dropped.
+ */
+size_t dropIssueIndexes(std::vector<size_t> &indexes, size_t issueCount)
+{
+    auto droppedCount = size_t(std::lower_bound(indexes.begin(), indexes.end(), issueCount) - indexes.begin());
+
+    indexes.erase(indexes.begin(), indexes.begin() + ptrdiff_t(droppedCount));
+
+    for (auto &index : indexes) {
+        index -= issueCount;
+    }
+
+    return droppedCount;
+}
+
+void Logger::LoggerImpl::streamIssues()
+{
+    if ((mIssueCallback == nullptr) || mIssueStreamingCancelled) {
+        return;
+    }
+
+    while (mStreamedIssueCount < mIssues.size()) {
+        if (!mIssueCallback(mIssues[mStreamedIssueCount++])) {
+            mIssueStreamingCancelled = true;
+
+            break;
+        }
+    }
+
+    if (!mRetainIssues) {
+        mIssues.erase(mIssues.begin(), mIssues.begin() + ptrdiff_t(mStreamedIssueCount));
+
+        mDroppedIssueCount += mStreamedIssueCount;
+        mDroppedErrorCount += dropIssueIndexes(mErrors, mStreamedIssueCount);
+        mDroppedWarningCount += dropIssueIndexes(mWarnings, mStreamedIssueCount);
+        mDroppedMessageCount += dropIssueIndexes(mMessages, mStreamedIssueCount);
+
+        mStreamedIssueCount = 0;
+    }
+}
+
 void Logger::LoggerImpl::addIssue(const IssuePtr &issue)
 {
     // When an issue is added, update the appropriate array based on its level.
@@ -117,18 +217,22 @@ void Logger::LoggerImpl::addIssue(const IssuePtr &issue)
         mMessages.push_back(index);
         break;
     }
+
+    if (mIssueStreamingHoldCount == 0) {
+        streamIssues();
+    }
 }
 
 size_t Logger::issueCount() const
 {
-    return pFunc()->mIssues.size();
+    return pFunc()->mDroppedIssueCount + pFunc()->mIssues.size();
 }
 
 IssuePtr Logger::issue(size_t index) const
 {
     IssuePtr issue = nullptr;
-    if (index < pFunc()->mIssues.size()) {
-        issue = pFunc()->mIssues.at(index);
+    if ((index >= pFunc()->mDroppedIssueCount) && (index - pFunc()->mDroppedIssueCount < pFunc()->mIssues.size())) {
+        issue = pFunc()->mIssues.at(index - pFunc()->mDroppedIssueCount);
     }
     return issue;
 }
@@ -35,6 +35,33 @@ public:
     std::vector<size_t> mMessages;
     std::vector<IssuePtr> mIssues;
 
+    IssueCallback mIssueCallback; /**< Function to which issues are streamed, if any. */
+    bool mRetainIssues = true; /**< Whether streamed issues are kept in this logger. */
+    bool mIssueStreamingCancelled = false; /**< Whether the callback has cancelled the streaming of issues. */
+    size_t mIssueStreamingHoldCount = 0; /**< Number of pending requests to hold back the streaming of issues. */
+    size_t mStreamedIssueCount = 0; /**< Number of issues, at the start of mIssues, that have been streamed. */
+
+    size_t mDroppedIssueCount = 0; /**< Number of streamed issues that were not retained. */
+    size_t mDroppedErrorCount = 0; /**< Number of streamed errors that were not retained. */
+    size_t mDroppedWarningCount = 0; /**< Number of streamed warnings that were not retained. */
+    size_t mDroppedMessageCount = 0; /**< Number of streamed messages that were not retained. */
+
+    /**
+     * @brief Get the issue at the given @p index of the given @p indexes.
+     *
+     * Get the issue at the given @p index of the given @p indexes, taking into
+     * account the given number of streamed issues that were not retained.
+     *
+     * @param indexes The indexes of the stored issues of a given level.
+     * @param droppedCount The number of streamed issues of that level that
+     * were not retained.
+     * @param index The index of the issue.
+     *
+     * @return The issue at the given @p index or @c nullptr if that index is
+     * not valid or the issue was not retained.
+     */
+    IssuePtr issue(const std::vector<size_t> &indexes, size_t droppedCount, size_t index) const;
+
     /**
      * @brief Add an issue to the logger.
      *
@@ -44,6 +71,34 @@ public:
      */
     void addIssue(const IssuePtr &issue);
 
+    /**
+     * @brief Hold back the streaming of issues.
+     *
+     * Hold back the streaming of the issues that get logged from now on, for
+     * when they may still get modified or removed.  The streaming resumes
+     * once every hold has been released.
+     */
+    void holdIssueStreaming();
+
+    /**
+     * @brief Release a hold on the streaming of issues.
+     *
+     * Release a hold on the streaming of issues and, if it was the last one,
+     * stream the issues that were held back.
+     */
+    void releaseIssueStreaming();
+
+    /**
+     * @brief Stream the issues that have not yet been streamed.
+     *
+     * Pass, in order, the issues that have not yet been streamed to the issue
+     * callback, if any, unless the streaming has been cancelled.  Streamed
+     * issues are then dropped if they are not to be retained.  This can be
+     * called while the streaming of issues is held back, as long as the issues
+     * logged so far are final.
+     */
+    void streamIssues();
+
     /**
      * @brief Remove issue of level ERROR at the specified @p index.
      *
@@ -61,9 +116,19 @@ public:
     /**
      * @brief Clear the issues from the logger.
      *
-     * Clear the issues from the logger.
+     * Clear the issues from the logger, including the streamed ones that were
+     * not retained, and reset the streaming of issues.
      */
     void removeAllIssues();
+
+    /**
+     * @brief Clear the stored issues from the logger.
+     *
+     * Clear the issues that are stored in the logger, so that they can be
+     * logged again, in the same order, possibly with others.  Unlike
+     * removeAllIssues(), this leaves the streaming of issues untouched.
+     */
+    void removeStoredIssues();
 };
 
 } // namespace libcellml
@@ -42,8 +42,12 @@ namespace libcellml {
 
 std::vector<UnitsPtr>::const_iterator Model::ModelImpl::findUnits(const std::string &name) const
 {
-    return std::find_if(mUnits.begin(), mUnits.end(),
-                        [=](const UnitsPtr &u) -> bool { return u->name() == name; });
+    auto index = mUnitsNames.find(name);
+    if (index == NameIndex::npos) {
+        return mUnits.end();
+    }
+
+    return mUnits.begin() + ptrdiff_t(index);
 }
 
 std::vector<UnitsPtr>::const_iterator Model::ModelImpl::findUnits(const UnitsPtr &units) const
@@ -122,7 +126,10 @@ bool Model::addUnits(const UnitsPtr &units)
         otherParent->removeUnits(units);
     }
     pFunc()->mUnits.push_back(units);
+    pFunc()->mUnitsNames.append(units.get());
     units->pFunc()->setParent(thisModel);
+    units->pFunc()->mNameIndex = &pFunc()->mUnitsNames;
+    EntityImpl::markModified(this);
 
     return true;
 }
@@ -133,7 +140,10 @@ bool Model::removeUnits(size_t index)
     if (index < pFunc()->mUnits.size()) {
         auto result = pFunc()->mUnits.begin() + ptrdiff_t(index);
         (*result)->pFunc()->removeParent();
+        (*result)->pFunc()->mNameIndex = nullptr;
+        pFunc()->mUnitsNames.remove(index);
         pFunc()->mUnits.erase(result);
+        EntityImpl::markModified(this);
         status = true;
     }
 
@@ -146,7 +156,10 @@ bool Model::removeUnits(const std::string &name)
     auto result = pFunc()->findUnits(name);
     if (result != pFunc()->mUnits.end()) {
         (*result)->pFunc()->removeParent();
+        (*result)->pFunc()->mNameIndex = nullptr;
+        pFunc()->mUnitsNames.remove(size_t(result - pFunc()->mUnits.begin()));
         pFunc()->mUnits.erase(result);
+        EntityImpl::markModified(this);
         status = true;
     }
 
@@ -159,7 +172,10 @@ bool Model::removeUnits(const UnitsPtr &units)
     auto result = pFunc()->findUnits(units);
     if (result != pFunc()->mUnits.end()) {
         units->pFunc()->removeParent();
+        units->pFunc()->mNameIndex = nullptr;
+        pFunc()->mUnitsNames.remove(size_t(result - pFunc()->mUnits.begin()));
         pFunc()->mUnits.erase(result);
+        EntityImpl::markModified(this);
         status = true;
     }
 
@@ -170,8 +186,12 @@ void Model::removeAllUnits()
 {
     for (const auto &u : pFunc()->mUnits) {
         u->pFunc()->removeParent();
+        u->pFunc()->mNameIndex = nullptr;
     }
     pFunc()->mUnits.clear();
+    pFunc()->mUnitsNames.clear();
+
+    EntityImpl::markModified(this);
 }
 
 bool Model::hasUnits(const std::string &name) const
@@ -227,7 +247,9 @@ bool Model::replaceUnits(size_t index, const UnitsPtr &units)
     bool status = false;
     if (removeUnits(index)) {
         pFunc()->mUnits.insert(pFunc()->mUnits.begin() + ptrdiff_t(index), units);
+        pFunc()->mUnitsNames.insert(index, units.get());
         units->pFunc()->setParent(shared_from_this());
+        units->pFunc()->mNameIndex = &pFunc()->mUnitsNames;
         status = true;
     }
 
@@ -33,6 +33,7 @@ class Model::ModelImpl: public ComponentEntityImpl
 {
 public:
     std::vector<UnitsPtr> mUnits;
+    NameIndex mUnitsNames; /**< Index of the names of the units in mUnits. */
 
     std::vector<UnitsPtr>::const_iterator findUnits(const std::string &name) const;
     std::vector<UnitsPtr>::const_iterator findUnits(const UnitsPtr &units) const;
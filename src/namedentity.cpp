@@ -20,6 +20,13 @@ limitations under the License.
 
 namespace libcellml {
 
+void NamedEntity::NamedEntityImpl::updateNameIndex(const NamedEntity *entity, const std::string &oldName)
+{
+    if ((mNameIndex != nullptr) && entity->hasParent()) {
+        mNameIndex->rename(entity, oldName);
+    }
+}
+
 NamedEntity::NamedEntityImpl *NamedEntity::pFunc()
 {
     return reinterpret_cast<NamedEntity::NamedEntityImpl *>(Entity::pFunc());
@@ -37,7 +44,11 @@ NamedEntity::NamedEntity(NamedEntity::NamedEntityImpl *pImpl)
 
 void NamedEntity::setName(const std::string &name)
 {
+    auto oldName = pFunc()->mName;
     pFunc()->mName = name;
+    pFunc()->updateNameIndex(this, oldName);
+
+    EntityImpl::markModified(this);
 }
 
 std::string NamedEntity::name() const
@@ -47,7 +58,11 @@ std::string NamedEntity::name() const
 
 void NamedEntity::removeName()
 {
+    auto oldName = pFunc()->mName;
     pFunc()->mName = "";
+    pFunc()->updateNameIndex(this, oldName);
+
+    EntityImpl::markModified(this);
 }
 
 bool NamedEntity::doEquals(const EntityPtr &other) const
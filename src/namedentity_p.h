@@ -18,6 +18,7 @@ limitations under the License.
 
 #include "libcellml/namedentity.h"
 
+#include "nameindex.h"
 #include "parentedentity_p.h"
 
 namespace libcellml {
@@ -31,6 +32,19 @@ class NamedEntity::NamedEntityImpl: public ParentedEntityImpl
 {
 public:
     std::string mName; /**< Entity name represented as a std::string. */
+    NameIndex *mNameIndex = nullptr; /**< Name index of the parent list holding this entity, if any. */
+
+    /**
+     * @brief Update the name index of the parent of the given @p entity.
+     *
+     * Update the name index of the list holding the given @p entity after
+     * it has been renamed from @p oldName.  Nothing is done if the entity
+     * is not held by a parent.
+     *
+     * @param entity The @ref NamedEntity that has been renamed.
+     * @param oldName The name of the @p entity before it was renamed.
+     */
+    void updateNameIndex(const NamedEntity *entity, const std::string &oldName);
 };
 
 } // namespace libcellml
@@ -0,0 +1,104 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "nameindex.h"
+
+#include "libcellml/namedentity.h"
+
+namespace libcellml {
+
+size_t NameIndex::find(const std::string &name) const
+{
+    auto result = mFirstIndexes.find(name);
+    if (result != mFirstIndexes.end()) {
+        return result->second;
+    }
+
+    return npos;
+}
+
+void NameIndex::append(const NamedEntity *entity)
+{
+    mFirstIndexes.emplace(entity->name(), mEntities.size());
+    mEntities.push_back(entity);
+}
+
+void NameIndex::insert(size_t index, const NamedEntity *entity)
+{
+    if (index == mEntities.size()) {
+        append(entity);
+    } else {
+        mEntities.insert(mEntities.begin() + ptrdiff_t(index), entity);
+        rebuild();
+    }
+}
+
+void NameIndex::remove(size_t index)
+{
+    if (index + 1 == mEntities.size()) {
+        auto result = mFirstIndexes.find(mEntities.back()->name());
+        if ((result != mFirstIndexes.end()) && (result->second == index)) {
+            mFirstIndexes.erase(result);
+        }
+        mEntities.pop_back();
+    } else if (index < mEntities.size()) {
+        mEntities.erase(mEntities.begin() + ptrdiff_t(index));
+        rebuild();
+    }
+}
+
+void NameIndex::clear()
+{
+    mEntities.clear();
+    mFirstIndexes.clear();
+}
+
+void NameIndex::rename(const NamedEntity *entity, const std::string &oldName)
+{
+    size_t index = 0;
+    while ((index < mEntities.size()) && (mEntities[index] != entity)) {
+        ++index;
+    }
+    if (index == mEntities.size()) {
+        return;
+    }
+
+    auto result = mFirstIndexes.find(oldName);
+    if ((result != mFirstIndexes.end()) && (result->second == index)) {
+        mFirstIndexes.erase(result);
+        for (size_t i = index + 1; i < mEntities.size(); ++i) {
+            if (mEntities[i]->name() == oldName) {
+                mFirstIndexes.emplace(oldName, i);
+                break;
+            }
+        }
+    }
+
+    auto inserted = mFirstIndexes.emplace(entity->name(), index);
+    if (!inserted.second && (inserted.first->second > index)) {
+        inserted.first->second = index;
+    }
+}
+
+void NameIndex::rebuild()
+{
+    mFirstIndexes.clear();
+    for (size_t i = 0; i < mEntities.size(); ++i) {
+        mFirstIndexes.emplace(mEntities[i]->name(), i);
+    }
+}
+
+} // namespace libcellml
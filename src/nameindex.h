@@ -0,0 +1,97 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace libcellml {
+
+class NamedEntity; /**< Forward declaration of the NamedEntity class. */
+
+/**
+ * @brief The NameIndex class.
+ *
+ * The NameIndex class mirrors a list of named entities held by a parent
+ * entity and maps each name to the position of the first entity with that
+ * name, so that looking up an entity by name does not require a linear
+ * search of the list.  The index is kept consistent eagerly by the owning
+ * entity whenever the list changes or one of its entities is renamed, so
+ * that lookups never modify the index.
+ */
+class NameIndex
+{
+public:
+    static const size_t npos = static_cast<size_t>(-1); /**< Value returned when a name is not in the index. */
+
+    /**
+     * @brief Get the position of the first entity with the given @p name.
+     *
+     * Get the position of the first entity with the given @p name,
+     * or @c npos if no entity has that name.
+     *
+     * @param name The name to look up.
+     *
+     * @return The position of the first entity named @p name, or @c npos.
+     */
+    size_t find(const std::string &name) const;
+
+    /**
+     * @brief Add the given @p entity at the end of the index.
+     *
+     * @param entity The entity that was appended to the list.
+     */
+    void append(const NamedEntity *entity);
+
+    /**
+     * @brief Insert the given @p entity at position @p index.
+     *
+     * @param index The position at which the entity was inserted in the list.
+     * @param entity The entity that was inserted in the list.
+     */
+    void insert(size_t index, const NamedEntity *entity);
+
+    /**
+     * @brief Remove the entity at position @p index.
+     *
+     * @param index The position from which an entity was removed from the list.
+     */
+    void remove(size_t index);
+
+    /**
+     * @brief Remove all the entities from the index.
+     */
+    void clear();
+
+    /**
+     * @brief Update the index after @p entity was renamed from @p oldName.
+     *
+     * @param entity The entity that was renamed, which already has its new name.
+     * @param oldName The name that the entity had before being renamed.
+     */
+    void rename(const NamedEntity *entity, const std::string &oldName);
+
+private:
+    void rebuild(); /**< Recompute the first position of each name. */
+
+    std::vector<const NamedEntity *> mEntities; /**< Entities in the same order as in the indexed list. */
+    std::unordered_map<std::string, size_t> mFirstIndexes; /**< Position of the first entity with a given name. */
+};
+
+} // namespace libcellml
@@ -38,6 +38,8 @@ ParentedEntityPtr ParentedEntity::parent() const
 void ParentedEntity::ParentedEntityImpl::removeParent()
 {
     mParent = {};
+
+    markModified();
 }
 
 bool ParentedEntity::hasParent() const
@@ -67,6 +69,8 @@ bool ParentedEntity::hasAncestor(const ParentedEntityPtr &entity) const
 void ParentedEntity::ParentedEntityImpl::setParent(const ParentedEntityPtr &parent)
 {
     mParent = parent;
+
+    markModified();
 }
 
 } // namespace libcellml
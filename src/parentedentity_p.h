@@ -35,7 +35,8 @@ public:
     /**
      * @brief Sets the given entity as the parent of this entity.
      *
-     * Set the parent of the entity to the entity given.
+     * Set the parent of the entity to the entity given, and mark the entity
+     * as modified.
      *
      * @param parent An @c Entity.
      */
@@ -44,7 +45,8 @@ public:
     /**
      * @brief Clear the pointer to the parent entity.
      *
-     * Clears the pointer to the parent entity.
+     * Clears the pointer to the parent entity, and marks the entity as
+     * modified.
      */
     void removeParent();
 
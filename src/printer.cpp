@@ -284,6 +284,7 @@ std::string Printer::PrinterImpl::printComponent(const ComponentPtr &component,
                 repr += printReset(component->reset(i), idList, autoIds);
             }
             if (!component->math().empty()) {
+                holdIssueStreaming();
                 size_t startIssueCount = mPrinter->issueCount();
                 repr += printMath(component->math());
                 size_t endIssueCount = mPrinter->issueCount();
@@ -291,6 +292,7 @@ std::string Printer::PrinterImpl::printComponent(const ComponentPtr &component,
                     auto issue = mPrinter->issue(current);
                     issue->mPimpl->mItem->mPimpl->setComponent(component);
                 }
+                releaseIssueStreaming();
             }
 
             repr += "</component>";
@@ -411,6 +413,7 @@ std::string Printer::PrinterImpl::printReset(const ResetPtr &reset, IdList &idLi
         repr += " id=\"" + makeUniqueId(idList) + "\"";
     }
 
+    holdIssueStreaming();
     size_t startIssueCount = mPrinter->issueCount();
     std::string testValue = printResetChild("test_value", reset->testValueId(), reset->testValue(), idList, autoIds);
     if (!testValue.empty()) {
@@ -435,6 +438,7 @@ std::string Printer::PrinterImpl::printReset(const ResetPtr &reset, IdList &idLi
     } else {
         repr += "/>";
     }
+    releaseIssueStreaming();
     return repr;
 }
 
@@ -66,6 +66,8 @@ void Reset::setOrder(int order)
 {
     pFunc()->mOrder = order;
     pFunc()->mOrderSet = true;
+
+    EntityImpl::markModified(this);
 }
 
 int Reset::order() const
@@ -77,6 +79,8 @@ void Reset::removeOrder()
 {
     pFunc()->mOrderSet = false;
     pFunc()->mOrder = 0;
+
+    EntityImpl::markModified(this);
 }
 
 bool Reset::isOrderSet()
@@ -87,6 +91,8 @@ bool Reset::isOrderSet()
 void Reset::setVariable(const VariablePtr &variable)
 {
     pFunc()->mVariable = variable;
+
+    EntityImpl::markModified(this);
 }
 
 VariablePtr Reset::variable() const
@@ -97,6 +103,8 @@ VariablePtr Reset::variable() const
 void Reset::setTestVariable(const VariablePtr &variable)
 {
     pFunc()->mTestVariable = variable;
+
+    EntityImpl::markModified(this);
 }
 
 VariablePtr Reset::testVariable() const
@@ -107,6 +115,8 @@ VariablePtr Reset::testVariable() const
 void Reset::appendTestValue(const std::string &math)
 {
     pFunc()->mTestValue.append(math);
+
+    EntityImpl::markModified(this);
 }
 
 std::string Reset::testValue() const
@@ -117,11 +127,15 @@ std::string Reset::testValue() const
 void Reset::setTestValueId(const std::string &id)
 {
     pFunc()->mTestValueId = id;
+
+    EntityImpl::markModified(this);
 }
 
 void Reset::removeTestValueId()
 {
     pFunc()->mTestValueId = "";
+
+    EntityImpl::markModified(this);
 }
 
 std::string Reset::testValueId() const
@@ -132,16 +146,22 @@ std::string Reset::testValueId() const
 void Reset::setTestValue(const std::string &math)
 {
     pFunc()->mTestValue = math;
+
+    EntityImpl::markModified(this);
 }
 
 void Reset::removeTestValue()
 {
     pFunc()->mTestValue = "";
+
+    EntityImpl::markModified(this);
 }
 
 void Reset::appendResetValue(const std::string &math)
 {
     pFunc()->mResetValue.append(math);
+
+    EntityImpl::markModified(this);
 }
 
 std::string Reset::resetValue() const
@@ -152,21 +172,29 @@ std::string Reset::resetValue() const
 void Reset::setResetValue(const std::string &math)
 {
     pFunc()->mResetValue = math;
+
+    EntityImpl::markModified(this);
 }
 
 void Reset::removeResetValue()
 {
     pFunc()->mResetValue = "";
+
+    EntityImpl::markModified(this);
 }
 
 void Reset::setResetValueId(const std::string &id)
 {
     pFunc()->mResetValueId = id;
+
+    EntityImpl::markModified(this);
 }
 
 void Reset::removeResetValueId()
 {
     pFunc()->mResetValueId = "";
+
+    EntityImpl::markModified(this);
 }
 
 std::string Reset::resetValueId() const
@@ -368,6 +368,8 @@ void Units::addUnit(const std::string &reference, const std::string &prefix, dou
     ud.mId = id;
 
     pFunc()->mUnitDefinitions.push_back(ud);
+
+    EntityImpl::markModified(this);
 }
 
 void Units::addUnit(const std::string &reference, Prefix prefix, double exponent,
@@ -462,6 +464,7 @@ void Units::setUnitAttributeReference(size_t index, const std::string &reference
         UnitDefinition unitDefinition = pFunc()->mUnitDefinitions.at(index);
         unitDefinition.mReference = reference;
         pFunc()->mUnitDefinitions[index] = unitDefinition;
+        EntityImpl::markModified(this);
     }
 }
 
@@ -502,6 +505,7 @@ bool Units::setUnitId(size_t index, const std::string &id)
 {
     if (index < pFunc()->mUnitDefinitions.size()) {
         pFunc()->mUnitDefinitions[index].mId = id;
+        EntityImpl::markModified(this);
         return true;
     }
     return false;
@@ -521,6 +525,7 @@ bool Units::removeUnit(const std::string &reference)
     auto result = pFunc()->findUnit(reference);
     if (result != pFunc()->mUnitDefinitions.end()) {
         pFunc()->mUnitDefinitions.erase(result);
+        EntityImpl::markModified(this);
         status = true;
     }
 
@@ -532,6 +537,7 @@ bool Units::removeUnit(size_t index)
     bool status = false;
     if (index < pFunc()->mUnitDefinitions.size()) {
         pFunc()->mUnitDefinitions.erase(pFunc()->mUnitDefinitions.begin() + ptrdiff_t(index));
+        EntityImpl::markModified(this);
         status = true;
     }
 
@@ -547,6 +553,8 @@ bool Units::removeUnit(StandardUnit standardUnit)
 void Units::removeAllUnits()
 {
     pFunc()->mUnitDefinitions.clear();
+
+    EntityImpl::markModified(this);
 }
 
 void Units::setSourceUnits(ImportSourcePtr &importSource, const std::string &name)
@@ -0,0 +1,240 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include "unitsgraph.h"
+
+#include <algorithm>
+
+#include "libcellml/model.h"
+#include "libcellml/units.h"
+
+#include "utilities.h"
+
+namespace libcellml {
+
+/**
+ * @brief Get the strongly connected components of the given @p graph.
+ *
+ * Get the strongly connected components of the given @p graph using Tarjan's
+ * algorithm.  The depth-first search is done using an explicit stack rather
+ * than recursion, so that a long chain of dependencies cannot exhaust the
+ * call stack.
+ *
+ * @param graph The indexes of the nodes that each node points to.
+ *
+ * @return The strongly connected component of each node.
+ */
+std::vector<size_t> stronglyConnectedComponents(const std::vector<std::vector<size_t>> &graph)
+{
+    const size_t unvisited = graph.size();
+    std::vector<size_t> indexes(graph.size(), unvisited);
+    std::vector<size_t> lowLinks(graph.size(), 0);
+    std::vector<bool> onStack(graph.size(), false);
+    std::vector<size_t> components(graph.size(), 0);
+    std::vector<size_t> stack;
+    std::vector<std::pair<size_t, size_t>> path; // Node and position of the next edge to follow from it.
+    size_t index = 0;
+    size_t componentCount = 0;
+
+    auto visit = [&](size_t node) {
+        indexes[node] = index;
+        lowLinks[node] = index;
+        ++index;
+        stack.push_back(node);
+        onStack[node] = true;
+        path.emplace_back(node, 0);
+    };
+
+    for (size_t root = 0; root < graph.size(); ++root) {
+        if (indexes[root] != unvisited) {
+            continue;
+        }
+
+        visit(root);
+
+        while (!path.empty()) {
+            auto node = path.back().first;
+            auto edge = path.back().second;
+
+            if (edge < graph[node].size()) {
+                auto next = graph[node][edge];
+
+                ++path.back().second;
+
+                if (indexes[next] == unvisited) {
+                    visit(next);
+                } else if (onStack[next]) {
+                    lowLinks[node] = std::min(lowLinks[node], indexes[next]);
+                }
+            } else {
+                if (lowLinks[node] == indexes[node]) {
+                    size_t member;
+
+                    do {
+                        member = stack.back();
+                        stack.pop_back();
+                        onStack[member] = false;
+                        components[member] = componentCount;
+                    } while (member != node);
+
+                    ++componentCount;
+                }
+
+                path.pop_back();
+
+                if (!path.empty()) {
+                    auto parent = path.back().first;
+
+                    lowLinks[parent] = std::min(lowLinks[parent], lowLinks[node]);
+                }
+            }
+        }
+    }
+
+    return components;
+}
+
+UnitsGraph::UnitsGraph(const ModelPtr &model)
+{
+    for (size_t i = 0; i < model->unitsCount(); ++i) {
+        auto units = model->units(i);
+
+        mIndexes.emplace(units.get(), i);
+        mUnits.push_back(units);
+    }
+
+    mDependencies.resize(mUnits.size());
+
+    for (size_t i = 0; i < mUnits.size(); ++i) {
+        for (size_t j = 0; j < mUnits[i]->unitCount(); ++j) {
+            auto reference = mUnits[i]->unitAttributeReference(j);
+
+            if (!isStandardUnitName(reference) && model->hasUnits(reference)) {
+                mDependencies[i].push_back(index(model->units(reference)));
+            }
+        }
+    }
+
+    mComponents = stronglyConnectedComponents(mDependencies);
+
+    // A strongly connected component contains a cycle if one of its units
+    // depends on a units of the same component, be it itself.  The cycle is
+    // reported for the first units of the component.
+
+    std::vector<bool> cyclicComponents(mUnits.size(), false);
+
+    for (size_t i = 0; i < mUnits.size(); ++i) {
+        for (auto dependency : mDependencies[i]) {
+            if (mComponents[dependency] == mComponents[i]) {
+                cyclicComponents[mComponents[i]] = true;
+            }
+        }
+    }
+
+    mCycleStarts.resize(mUnits.size(), false);
+
+    for (size_t i = 0; i < mUnits.size(); ++i) {
+        if (cyclicComponents[mComponents[i]]) {
+            mCycleStarts[i] = true;
+            cyclicComponents[mComponents[i]] = false;
+        }
+    }
+}
+
+size_t UnitsGraph::index(const UnitsPtr &units) const
+{
+    auto result = mIndexes.find(units.get());
+    if (result != mIndexes.end()) {
+        return result->second;
+    }
+
+    return mUnits.size();
+}
+
+bool UnitsGraph::isCyclicDependency(const UnitsPtr &units, const UnitsPtr &dependency) const
+{
+    auto unitsIndex = index(units);
+    auto dependencyIndex = index(dependency);
+
+    return (unitsIndex != mUnits.size())
+           && (dependencyIndex != mUnits.size())
+           && (mComponents[unitsIndex] == mComponents[dependencyIndex]);
+}
+
+std::vector<UnitsPtr> UnitsGraph::cycle(const UnitsPtr &units) const
+{
+    auto start = index(units);
+
+    if ((start == mUnits.size()) || !mCycleStarts[start]) {
+        return {};
+    }
+
+    // Look for a path back to the given units, following dependencies in the
+    // order of the unit elements and staying in the strongly connected
+    // component of the units, which is where all the paths back to it are.
+
+    std::vector<bool> visited(mUnits.size(), false);
+    std::vector<std::pair<size_t, size_t>> path = {{start, 0}};
+
+    visited[start] = true;
+
+    while (!path.empty()) {
+        auto node = path.back().first;
+        auto edge = path.back().second;
+
+        if (edge == mDependencies[node].size()) {
+            path.pop_back();
+
+            continue;
+        }
+
+        auto next = mDependencies[node][edge];
+
+        ++path.back().second;
+
+        if (next == start) {
+            std::vector<UnitsPtr> cycle;
+
+            for (const auto &step : path) {
+                cycle.push_back(mUnits[step.first]);
+            }
+
+            cycle.push_back(units);
+
+            return cycle;
+        }
+
+        if (!visited[next] && (mComponents[next] == mComponents[start])) {
+            visited[next] = true;
+            path.emplace_back(next, 0);
+        }
+    }
+
+    return {};
+}
+
+const UnitsGraph &unitsGraph(UnitsGraphs &unitsGraphs, const ModelPtr &model)
+{
+    auto result = unitsGraphs.find(model.get());
+    if (result == unitsGraphs.end()) {
+        result = unitsGraphs.emplace(model.get(), UnitsGraph(model)).first;
+    }
+
+    return result->second;
+}
+
+} // namespace libcellml
@@ -0,0 +1,105 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include "libcellml/types.h"
+
+namespace libcellml {
+
+/**
+ * @brief The UnitsGraph class.
+ *
+ * The UnitsGraph class records which units of a model depend on which other
+ * units of the same model, through the units references of their unit
+ * elements.  The strongly connected components of that graph are computed
+ * once, using Tarjan's algorithm, so that finding all the cycles of units in
+ * a model takes a time that is linear in the number of units and unit
+ * elements, and each cycle is found exactly once.
+ */
+class UnitsGraph
+{
+public:
+    /**
+     * @brief Create a UnitsGraph for the given @p model.
+     *
+     * @param model The model whose units are to be put in the graph.
+     */
+    explicit UnitsGraph(const ModelPtr &model);
+
+    /**
+     * @brief Test whether @p units and @p dependency are part of the same cycle.
+     *
+     * Test whether @p dependency depends, directly or not, on @p units and
+     * @p units depends, directly or not, on @p dependency.  Following such a
+     * dependency never terminates, so it must not be followed.
+     *
+     * @param units The units that depends on @p dependency.
+     * @param dependency The units that @p units depends on.
+     *
+     * @return @c true if @p units and @p dependency are part of the same
+     * cycle, @c false otherwise.
+     */
+    bool isCyclicDependency(const UnitsPtr &units, const UnitsPtr &dependency) const;
+
+    /**
+     * @brief Get the cycle of units that starts with the given @p units.
+     *
+     * Get the cycle of units that starts and ends with the given @p units,
+     * if @p units is the first units of the model that is part of a cycle of
+     * units.  Only one cycle is returned for a given group of units that
+     * depend on each other, so that it only gets reported once.
+     *
+     * @param units The units for which we want a cycle.
+     *
+     * @return The units that make up the cycle, starting and ending with
+     * @p units, or an empty list if there is no cycle to report for
+     * @p units.
+     */
+    std::vector<UnitsPtr> cycle(const UnitsPtr &units) const;
+
+private:
+    size_t index(const UnitsPtr &units) const; /**< Index of the given units in the graph, or the number of units if not found. */
+
+    std::vector<UnitsPtr> mUnits; /**< Units in the same order as in the model. */
+    std::unordered_map<const Units *, size_t> mIndexes; /**< Index of each units in the graph. */
+    std::vector<std::vector<size_t>> mDependencies; /**< Indexes of the units that each units depends on. */
+    std::vector<size_t> mComponents; /**< Strongly connected component of each units. */
+    std::vector<bool> mCycleStarts; /**< Whether a units is the one for which the cycle of its strongly connected component is reported. */
+};
+
+using UnitsGraphs = std::unordered_map<const Model *, UnitsGraph>; /**< Type definition for the units graphs of several models. */
+
+/**
+ * @brief Get the units graph of the given @p model.
+ *
+ * Get the units graph of the given @p model from @p unitsGraphs, creating it
+ * if it is not already there, so that the units graph of a model only gets
+ * created once however many of its units get visited.
+ *
+ * @param unitsGraphs The units graphs created so far.
+ * @param model The model whose units graph we want.
+ *
+ * @return The @c UnitsGraph of the @p model.
+ */
+const UnitsGraph &unitsGraph(UnitsGraphs &unitsGraphs, const ModelPtr &model);
+
+} // namespace libcellml
@@ -124,6 +124,23 @@ std::string convertToString(double value, bool fullPrecision)
     return strs.str();
 }
 
+std::string convertToRoundTripString(double value)
+{
+    auto res = convertToString(value);
+    double resValue = 0.0;
+    std::istringstream in(res);
+
+    in >> resValue;
+
+    if (resValue != value) {
+        std::ostringstream strs;
+        strs << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+        res = strs.str();
+    }
+
+    return res;
+}
+
 bool convertToInt(const std::string &in, int &out)
 {
     if (!isCellMLInteger(in)) {
@@ -255,6 +255,20 @@ std::string convertToString(size_t value);
  */
 std::string convertToString(double value, bool fullPrecision = true);
 
+/**
+ * @brief Convert a @c double to a round-trip @c std::string format.
+ *
+ * Convert the @p value to @c std::string representation, using as few
+ * significant digits as possible (i.e. @c digits10 or, if needed,
+ * @c max_digits10) for that representation to be converted back to exactly
+ * the same @c double.
+ *
+ * @param value The @c double value number to convert.
+ *
+ * @return Round-trip @c std::string representation of the @p value.
+ */
+std::string convertToRoundTripString(double value);
+
 /**
  * @brief Check if the @p input @c std::string has any non-whitespace characters.
  *
@@ -17,6 +17,7 @@ limitations under the License.
 #include "libcellml/validator.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <libxml/uri.h>
 #include <map>
@@ -24,6 +25,8 @@ limitations under the License.
 #include <set>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
+#include <unordered_map>
 
 #include "libcellml/component.h"
 #include "libcellml/importsource.h"
@@ -34,9 +37,12 @@ limitations under the License.
 
 #include "anycellmlelement_p.h"
 #include "commonutils.h"
+#include "entity_p.h"
+#include "idindex.h"
 #include "issue_p.h"
 #include "logger_p.h"
 #include "namespaces.h"
+#include "unitsgraph.h"
 #include "utilities.h"
 #include "xmldoc.h"
 #include "xmlutils.h"
@@ -48,6 +54,89 @@ namespace libcellml {
  */
 using IssuesList = std::vector<Strings>;
 
+/**
+ * Type definition for an index of the identifiers of a model, along with a
+ * description of the items using them.
+ */
+using IdMap = IdIndex<std::string>;
+
+/**
+ * Type definition for a list of identifiers found in math, along with a
+ * description of the MathML element using them.
+ */
+using MathIds = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * @brief The CachedMathIds struct.
+ *
+ * The identifiers found in some math, collected while the math was parsed
+ * for its validation so that checking that identifiers are unique does not
+ * require parsing it again, and the number of the last validation that
+ * collected or used them.
+ */
+struct CachedMathIds
+{
+    MathIds mIds;
+    size_t mValidationCount = 0;
+};
+
+/**
+ * Type definition for cached math identifiers, keyed by the math they were
+ * found in.
+ */
+using CachedMathIdsMap = std::unordered_map<std::string, CachedMathIds>;
+
+/**
+ * @brief The DeferredComponentValidation struct.
+ *
+ * A component which validation has been deferred so that it can be done in
+ * parallel, along with the number of issues that had been logged when it would
+ * otherwise have been validated, and the issues logged and the math identifiers
+ * collected by its validation.
+ */
+struct DeferredComponentValidation
+{
+    ComponentPtr mComponent;
+    size_t mIssueCount = 0;
+    std::vector<IssuePtr> mIssues;
+    CachedMathIdsMap mCachedMathIds;
+};
+
+/**
+ * Type definition for a list of deferred component validations.
+ */
+using DeferredComponentValidations = std::vector<DeferredComponentValidation>;
+
+/**
+ * @brief The CachedValidation struct.
+ *
+ * The issues logged by the validation of a part of a model, along with the
+ * revisions of the entities that the validation depends on, so that the issues
+ * can be reused for as long as none of those entities gets modified, and the
+ * number of the last validation that reused or logged them.
+ */
+struct CachedValidation
+{
+    EntityRevisions mEntityRevisions;
+    std::vector<IssuePtr> mIssues;
+    size_t mValidationCount = 0;
+};
+
+/**
+ * @brief The CachedEquivalenceNetworkValidation struct.
+ *
+ * The issues logged by the validation of an equivalence network, for each of
+ * the variables from which the network was validated, along with the revisions
+ * of the entities that the validation depends on, and the number of the last
+ * validation that reused or logged them.
+ */
+struct CachedEquivalenceNetworkValidation
+{
+    EntityRevisions mEntityRevisions;
+    std::vector<std::vector<IssuePtr>> mVariableIssues;
+    size_t mValidationCount = 0;
+};
+
 /**
  * @brief Validate that equivalent variable pairs in the @p model
  * have equivalent units.
@@ -277,6 +366,456 @@ bool isValidXmlName(const std::string &name)
     return true;
 }
 
+/**
+ * @brief The content models of the MathML elements supported by CellML.
+ *
+ * The content models, as declared in the W3C MathML DTD, of the MathML
+ * elements supported by CellML.
+ */
+enum class MathmlContentModel
+{
+    EMPTY, /**< The element has no content. */
+    MIXED, /**< The element has text and any of the allowed elements as content. */
+    ELEMENTS, /**< The element has any number of the allowed elements as content. */
+    PIECEWISE /**< The element has any number of piece elements, optionally followed by an otherwise element, as content. */
+};
+
+/**
+ * @brief The types of the attributes of the MathML elements supported by CellML.
+ *
+ * The types, as declared in the W3C MathML DTD, of the attributes of the
+ * MathML elements supported by CellML.
+ */
+enum class MathmlAttributeType
+{
+    CDATA, /**< The attribute has any value. */
+    ID, /**< The attribute has a unique identifier as a value. */
+    IDREF, /**< The attribute has a reference to an identifier as a value. */
+    ENUMERATION /**< The attribute has one of the enumerated values as a value. */
+};
+
+/**
+ * Type definition for the declarations of the attributes of a MathML element,
+ * keyed by their qualified name, with their type and, for an enumeration,
+ * their allowed values.
+ */
+using MathmlAttributeDeclarations = std::map<std::string, std::pair<MathmlAttributeType, NameList>>;
+
+/**
+ * @brief The MathmlElementDeclaration struct.
+ *
+ * The declaration, as found in the W3C MathML DTD, of a MathML element
+ * supported by CellML.
+ */
+struct MathmlElementDeclaration
+{
+    MathmlContentModel mContentModel = MathmlContentModel::EMPTY; /**< Content model of the element. */
+    std::set<std::string> mChildren; /**< Elements allowed in the content of the element. */
+    std::string mExpectedContent; /**< Content model of the element, as reported by the W3C MathML DTD validation. */
+    MathmlAttributeDeclarations mAttributes; /**< Attributes of the element. */
+};
+
+/**
+ * @brief List of the presentation MathML elements.
+ *
+ * The presentation MathML elements, in the order in which they appear in the
+ * content models of the W3C MathML DTD.
+ */
+static const NameList mathmlPresentationElements = {
+    "mi", "mn", "mo", "mtext", "ms", "mspace", "mrow", "mfrac", "msqrt", "mroot", "menclose", "mstyle", "merror",
+    "mpadded", "mphantom", "mfenced", "msub", "msup", "msubsup", "munder", "mover", "munderover", "mmultiscripts",
+    "mtable", "mtr", "mlabeledtr", "mtd", "maligngroup", "malignmark", "maction"
+};
+
+/**
+ * @brief List of the content MathML elements allowed in content MathML.
+ *
+ * The content MathML elements allowed in the content of, for instance, an
+ * @c apply element, in the order in which they appear in the W3C MathML DTD.
+ */
+static const NameList mathmlContentExpressionElements = {
+    "csymbol", "ci", "cn", "apply", "reln", "lambda", "condition", "declare", "sep", "semantics", "annotation",
+    "annotation-xml", "integers", "reals", "rationals", "naturalnumbers", "complexes", "primes", "exponentiale",
+    "imaginaryi", "notanumber", "true", "false", "emptyset", "pi", "eulergamma", "infinity", "interval", "list",
+    "matrix", "matrixrow", "set", "vector", "piecewise", "lowlimit", "uplimit", "bvar", "degree", "logbase",
+    "momentabout", "domainofapplication", "inverse", "ident", "domain", "codomain", "image", "abs", "conjugate",
+    "exp", "factorial", "arg", "real", "imaginary", "floor", "ceiling", "not", "ln", "sin", "cos", "tan", "sec",
+    "csc", "cot", "sinh", "cosh", "tanh", "sech", "csch", "coth", "arcsin", "arccos", "arctan", "arccosh", "arccot",
+    "arccoth", "arccsc", "arccsch", "arcsec", "arcsech", "arcsinh", "arctanh", "determinant", "transpose", "card",
+    "quotient", "divide", "power", "rem", "implies", "vectorproduct", "scalarproduct", "outerproduct", "setdiff",
+    "fn", "compose", "plus", "times", "max", "min", "gcd", "lcm", "and", "or", "xor", "union", "intersect",
+    "cartesianproduct", "mean", "sdev", "variance", "median", "mode", "selector", "root", "minus", "log", "int",
+    "diff", "partialdiff", "divergence", "grad", "curl", "laplacian", "sum", "product", "limit", "moment", "exists",
+    "forall", "neq", "factorof", "in", "notin", "notsubset", "notprsubset", "tendsto", "eq", "leq", "lt", "geq",
+    "gt", "equivalent", "approx", "subset", "prsubset"
+};
+
+/**
+ * @brief List of the content MathML elements allowed in a @c math element.
+ *
+ * The content MathML elements allowed in the content of a @c math element,
+ * in the order in which they appear in the W3C MathML DTD.
+ */
+static const NameList mathmlMathContentElements = {
+    "ci", "csymbol", "cn", "integers", "reals", "rationals", "naturalnumbers", "complexes", "primes", "exponentiale",
+    "imaginaryi", "notanumber", "true", "false", "emptyset", "pi", "eulergamma", "infinity", "apply", "fn", "lambda",
+    "reln", "interval", "list", "matrix", "matrixrow", "set", "vector", "piecewise", "semantics", "declare"
+};
+
+/**
+ * @brief Create the declarations of the MathML elements supported by CellML.
+ *
+ * Create the declarations, as found in the W3C MathML DTD, of the MathML
+ * elements supported by CellML, keyed by their name.
+ *
+ * @return The declarations of the MathML elements supported by CellML.
+ */
+std::map<std::string, MathmlElementDeclaration> createMathmlElementDeclarations()
+{
+    static const NameList renderers = {"css", "mathplayer-dl", "mathplayer", "techexplorer-plugin", "techexplorer"};
+    static const NameList overflows = {"scroll", "elide", "truncate", "scale"};
+
+    MathmlAttributeDeclarations commonAttributes = {
+        {"other", {MathmlAttributeType::CDATA, {}}},
+        {"xref", {MathmlAttributeType::IDREF, {}}},
+        {"id", {MathmlAttributeType::ID, {}}},
+        {"style", {MathmlAttributeType::CDATA, {}}},
+        {"class", {MathmlAttributeType::CDATA, {}}},
+        {"xlink:type", {MathmlAttributeType::CDATA, {}}},
+        {"xlink:href", {MathmlAttributeType::CDATA, {}}},
+        {"pref:renderer", {MathmlAttributeType::ENUMERATION, renderers}},
+    };
+    MathmlAttributeDeclarations definitionAttributes = commonAttributes;
+    definitionAttributes.emplace("encoding", std::make_pair(MathmlAttributeType::CDATA, NameList()));
+    definitionAttributes.emplace("definitionURL", std::make_pair(MathmlAttributeType::CDATA, NameList()));
+    MathmlAttributeDeclarations ciAttributes = definitionAttributes;
+    ciAttributes.emplace("type", std::make_pair(MathmlAttributeType::CDATA, NameList()));
+    MathmlAttributeDeclarations cnAttributes = ciAttributes;
+    cnAttributes.emplace("base", std::make_pair(MathmlAttributeType::CDATA, NameList()));
+    MathmlAttributeDeclarations mathAttributes = commonAttributes;
+    for (const auto &name : {"alttext", "altimg", "baseline", "width", "height", "name", "type", "display", "mode", "macros", "xsi:schemaLocation"}) {
+        mathAttributes.emplace(name, std::make_pair(MathmlAttributeType::CDATA, NameList()));
+    }
+    mathAttributes.emplace("overflow", std::make_pair(MathmlAttributeType::ENUMERATION, overflows));
+
+    auto contentModel = [](const NameList &names) {
+        std::string model;
+        for (const auto &name : names) {
+            model += (model.empty() ? "(" : " | ") + name;
+        }
+        return model + ")*";
+    };
+
+    NameList contentExpressionElements = mathmlContentExpressionElements;
+    contentExpressionElements.insert(contentExpressionElements.end(), mathmlPresentationElements.begin(), mathmlPresentationElements.end());
+    NameList mathElements = mathmlPresentationElements;
+    mathElements.insert(mathElements.end(), mathmlMathContentElements.begin(), mathmlMathContentElements.end());
+    std::set<std::string> ciElements(mathmlPresentationElements.begin(), mathmlPresentationElements.end());
+    ciElements.insert("mglyph");
+    std::set<std::string> cnElements = ciElements;
+    cnElements.insert("sep");
+
+    MathmlElementDeclaration contentExpressionDeclaration = {MathmlContentModel::ELEMENTS,
+                                                             {contentExpressionElements.begin(), contentExpressionElements.end()},
+                                                             contentModel(contentExpressionElements),
+                                                             commonAttributes};
+    std::map<std::string, MathmlElementDeclaration> declarations;
+    for (const auto &name : supportedMathMLElements) {
+        declarations[name] = {MathmlContentModel::EMPTY, {}, {}, definitionAttributes};
+    }
+    for (const auto &name : {"apply", "bvar", "logbase", "degree", "piece", "otherwise"}) {
+        declarations[name] = contentExpressionDeclaration;
+    }
+    declarations["math"] = {MathmlContentModel::ELEMENTS, {mathElements.begin(), mathElements.end()}, contentModel(mathElements), mathAttributes};
+    declarations["piecewise"] = {MathmlContentModel::PIECEWISE, {"piece", "otherwise"}, "(piece* , otherwise?)", commonAttributes};
+    declarations["ci"] = {MathmlContentModel::MIXED, ciElements, {}, ciAttributes};
+    declarations["cn"] = {MathmlContentModel::MIXED, cnElements, {}, cnAttributes};
+    declarations["sep"] = {MathmlContentModel::EMPTY, {}, {}, {{"pref:renderer", {MathmlAttributeType::ENUMERATION, renderers}}}};
+
+    return declarations;
+}
+
+/**
+ * @brief Map of the declarations of the MathML elements supported by CellML.
+ *
+ * The declarations, as found in the W3C MathML DTD, of the MathML elements
+ * supported by CellML, keyed by their name.
+ */
+static const std::map<std::string, MathmlElementDeclaration> mathmlElementDeclarations = createMathmlElementDeclarations();
+
+/**
+ * @brief Set of the elements declared in the W3C MathML DTD.
+ *
+ * The MathML elements declared in the W3C MathML DTD, whether or not they are
+ * supported by CellML.
+ */
+static const std::set<std::string> mathmlDeclaredElements = [] {
+    std::set<std::string> elements(mathmlContentExpressionElements.begin(), mathmlContentExpressionElements.end());
+    elements.insert(mathmlPresentationElements.begin(), mathmlPresentationElements.end());
+    elements.insert({"math", "mglyph", "mprescripts", "none", "piece", "otherwise"});
+    return elements;
+}();
+
+/**
+ * @brief Map of the namespace definitions with a fixed value in the W3C MathML DTD.
+ *
+ * The namespace definitions that the W3C MathML DTD allows on the MathML
+ * elements supported by CellML, keyed by their prefix, with their fixed
+ * namespace URI.
+ */
+static const std::map<std::string, std::string> mathmlFixedNamespaces = {
+    {"pref", "http://www.w3.org/2002/Math/preference"},
+    {"xlink", "http://www.w3.org/1999/xlink"},
+};
+
+/**
+ * @brief Test if @p value is a valid XML name token.
+ *
+ * An XML name token is defined here: https://www.w3.org/TR/xml11/#NT-Nmtoken.
+ *
+ * @param value The @c std::string to test.
+ *
+ * @return True if the value is a valid XML name token.
+ */
+bool isValidXmlNmtoken(const std::string &value)
+{
+    if (value.empty()) {
+        return false;
+    }
+    auto breakdown = characterBreakdown(value);
+    return std::all_of(breakdown.begin(), breakdown.end(), isNameChar);
+}
+
+/**
+ * @brief Get the list of elements found in the content of @p node.
+ *
+ * Get the list of elements found in the content of the given @p node, in the
+ * form that the W3C MathML DTD validation reports it, i.e. a list of the
+ * qualified name of the elements, with @c CDATA for text which is not blank.
+ *
+ * @param node The node for which to get the list of elements.
+ *
+ * @return The @c std::string list of elements.
+ */
+std::string mathmlContentList(const XmlNodePtr &node)
+{
+    // Mimic the 5000 character buffer which the list is built in.
+
+    static const size_t BUFFER_SIZE = 5000;
+
+    std::string list = "(";
+    auto child = node->firstChild();
+    while (child != nullptr) {
+        std::string item;
+        if (child->isElement()) {
+            item = child->namespacePrefix().empty() ? child->name() : child->namespacePrefix() + ":" + child->name();
+        } else if (child->isText() && !child->isBlank()) {
+            item = "CDATA";
+        }
+        if ((BUFFER_SIZE - list.size() < 50)
+            || (child->isElement() && (BUFFER_SIZE - list.size() < item.size() + 10))) {
+            if (list.back() != '.') {
+                list += " ...";
+            }
+            return list;
+        }
+        child = child->next();
+        if (!item.empty()) {
+            list += item;
+            if (child != nullptr) {
+                list += " ";
+            }
+        }
+    }
+    return list + ")";
+}
+
+/**
+ * @brief Test if the content of @p node follows its element declaration.
+ *
+ * Test if the elements in the content of the given @p node are allowed by
+ * the given element @p declaration, which has element content, and that the
+ * content of the @p node has no text that is not blank.
+ *
+ * @param node The node for which to test the content.
+ * @param declaration The declaration of the element of the @p node.
+ *
+ * @return @c true if the content of the @p node follows its declaration,
+ * @c false otherwise.
+ */
+bool isValidMathmlElementContent(const XmlNodePtr &node, const MathmlElementDeclaration &declaration)
+{
+    bool hasOtherwise = false;
+    for (auto child = node->firstChild(); child != nullptr; child = child->next()) {
+        if (child->isText() && !child->isBlank()) {
+            return false;
+        }
+        if (child->isElement()) {
+            auto name = child->namespacePrefix().empty() ? child->name() : child->namespacePrefix() + ":" + child->name();
+            if (declaration.mChildren.count(name) == 0) {
+                return false;
+            }
+            if (declaration.mContentModel == MathmlContentModel::PIECEWISE) {
+                // An otherwise element can only be the last element of a
+                // piecewise element.
+
+                if (hasOtherwise) {
+                    return false;
+                }
+                hasOtherwise = name == "otherwise";
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Type definition for a list of references to identifiers, as pairs of
+ * attribute name and attribute value.
+ */
+using MathmlIdReferences = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * @brief Validate the element @p node against the W3C MathML DTD.
+ *
+ * Validate the content, attributes and namespace definitions of the given
+ * element @p node, and then of its child elements, against the declarations
+ * of the MathML elements supported by CellML. The errors are reported in the
+ * same way and order as by the W3C MathML DTD validation. Elements that are
+ * declared in the W3C MathML DTD, but that are not supported by CellML, are
+ * not validated since they are reported as not supported anyway.
+ *
+ * @param node The element node to validate.
+ * @param ids The identifiers defined so far.
+ * @param idReferences The references to identifiers found so far.
+ * @param errors The errors found so far.
+ */
+void validateMathmlDtdElement(const XmlNodePtr &node, std::set<std::string> &ids, MathmlIdReferences &idReferences, Strings &errors)
+{
+    auto name = node->name();
+    auto declarationIt = mathmlElementDeclarations.find(name);
+    const MathmlElementDeclaration *declaration = (declarationIt == mathmlElementDeclarations.end()) ? nullptr : &declarationIt->second;
+
+    if ((declaration != nullptr) || (mathmlDeclaredElements.count(name) == 0)) {
+        if (declaration == nullptr) {
+            errors.push_back("No declaration for element " + name + ".");
+        } else {
+            // Check the content of the element.
+
+            if (declaration->mContentModel == MathmlContentModel::EMPTY) {
+                if (node->firstChild() != nullptr) {
+                    errors.push_back("Element " + name + " was declared EMPTY this one has content.");
+                }
+            } else if (declaration->mContentModel == MathmlContentModel::MIXED) {
+                for (auto child = node->firstChild(); child != nullptr; child = child->next()) {
+                    if (child->isElement() && (declaration->mChildren.count(child->name()) == 0)) {
+                        errors.push_back("Element " + child->name() + " is not declared in " + name + " list of possible children.");
+                    }
+                }
+            } else if (!isValidMathmlElementContent(node, *declaration)) {
+                errors.push_back("Element " + name + " content does not follow the DTD, expecting " + declaration->mExpectedContent + ", got " + mathmlContentList(node) + ".");
+            }
+
+            // Check the namespace definitions that have a fixed value.
+
+            auto namespaces = node->definedNamespaces();
+            for (const auto &fixedNamespace : mathmlFixedNamespaces) {
+                auto namespaceIt = namespaces.find(fixedNamespace.first);
+                if ((namespaceIt != namespaces.end()) && (namespaceIt->second != fixedNamespace.second)) {
+                    errors.push_back("Element " + name + " namespace name for " + fixedNamespace.first + " does not match the DTD.");
+                }
+            }
+        }
+
+        // Check the attributes of the element.
+
+        for (auto attribute = node->firstAttribute(); attribute != nullptr; attribute = attribute->next()) {
+            auto attributeName = attribute->name();
+            auto qualifiedName = attribute->namespacePrefix().empty() ? attributeName : attribute->namespacePrefix() + ":" + attributeName;
+            const std::pair<MathmlAttributeType, NameList> *attributeDeclaration = nullptr;
+            if (declaration != nullptr) {
+                auto attributeIt = declaration->mAttributes.find(qualifiedName);
+                if (attributeIt != declaration->mAttributes.end()) {
+                    attributeDeclaration = &attributeIt->second;
+                }
+            }
+            if (attributeDeclaration == nullptr) {
+                errors.push_back("No declaration for attribute " + attributeName + " of element " + name + ".");
+                continue;
+            }
+            auto type = attributeDeclaration->first;
+            auto value = attribute->value();
+            bool isValidValue = true;
+            if ((type == MathmlAttributeType::ID) || (type == MathmlAttributeType::IDREF)) {
+                isValidValue = !value.empty() && isValidXmlName(value);
+            } else if (type == MathmlAttributeType::ENUMERATION) {
+                isValidValue = isValidXmlNmtoken(value);
+            }
+            if (!isValidValue) {
+                errors.push_back("Syntax of value for attribute " + attributeName + " of " + name + " is not valid.");
+            }
+            if ((type == MathmlAttributeType::ID) && !value.empty() && !ids.insert(value).second) {
+                errors.push_back("ID " + value + " already defined.");
+            } else if (type == MathmlAttributeType::IDREF) {
+                idReferences.emplace_back(attributeName, value);
+            } else if ((type == MathmlAttributeType::ENUMERATION)
+                       && (std::find(attributeDeclaration->second.begin(), attributeDeclaration->second.end(), value) == attributeDeclaration->second.end())) {
+                errors.push_back("Value \"" + value + "\" for attribute " + attributeName + " of " + name + " is not among the enumerated set.");
+            }
+        }
+
+        // Check the namespace definitions of the element.
+
+        for (const auto &namespaceDefinition : node->definedNamespaces()) {
+            auto attributeName = namespaceDefinition.first.empty() ? "xmlns" : "xmlns:" + namespaceDefinition.first;
+            auto fixedNamespaceIt = mathmlFixedNamespaces.find(namespaceDefinition.first);
+            if ((declaration == nullptr)
+                || (!namespaceDefinition.first.empty() && (fixedNamespaceIt == mathmlFixedNamespaces.end()))) {
+                errors.push_back("No declaration for attribute " + attributeName + " of element " + name + ".");
+            } else if ((fixedNamespaceIt != mathmlFixedNamespaces.end()) && (namespaceDefinition.second != fixedNamespaceIt->second)) {
+                errors.push_back("Value for attribute " + attributeName + " of " + name + " is different from default \"" + fixedNamespaceIt->second + "\".");
+                errors.push_back("Value for attribute " + attributeName + " of " + name + " must be \"" + fixedNamespaceIt->second + "\".");
+            }
+        }
+    }
+
+    for (auto child = node->firstChild(); child != nullptr; child = child->next()) {
+        if (child->isElement()) {
+            validateMathmlDtdElement(child, ids, idReferences, errors);
+        }
+    }
+}
+
+/**
+ * @brief Validate the @p mathNode against the W3C MathML DTD.
+ *
+ * Validate the given @p mathNode, i.e. a @c math element node, against the
+ * declarations of the MathML elements supported by CellML, without having to
+ * serialise, parse and validate it using the W3C MathML DTD itself. The
+ * errors are reported in the same way and order as by the W3C MathML DTD
+ * validation.
+ *
+ * @param mathNode The @c math element node to validate.
+ *
+ * @return The list of errors found.
+ */
+Strings mathmlDtdErrors(const XmlNodePtr &mathNode)
+{
+    Strings errors;
+    std::set<std::string> ids;
+    MathmlIdReferences idReferences;
+
+    validateMathmlDtdElement(mathNode, ids, idReferences, errors);
+
+    for (const auto &idReference : idReferences) {
+        if (ids.count(idReference.second) == 0) {
+            errors.push_back("IDREF attribute " + idReference.first + " references an unknown ID \"" + idReference.second + "\".");
+        }
+    }
+
+    return errors;
+}
+
 /**
  * @brief The Validator::ValidatorImpl class.
  *
@@ -286,6 +825,243 @@ class Validator::ValidatorImpl: public LoggerImpl
 {
 public:
     Validator *mValidator = nullptr;
+    size_t mThreadCount = 1;
+    bool mIncremental = false;
+    size_t mMaximumErrorCount = 0;
+    bool mMathMLDtdValidation = true;
+    bool mMathMLDtdCompatibility = false;
+    bool mUniqueIdValidation = true;
+
+    size_t mValidationCount = 0; /**< Number of validations done by this validator, used to discard stale cached validations. */
+    const Model *mCachedModel = nullptr; /**< Model for which validations are cached. */
+    Strings mCachedModelContext; /**< Name of the model and of its units, which the validation of a component depends on. */
+    EntityRevisions mCachedUnitsRevisions; /**< Revisions of the units of the model, which the validation of an equivalence network depends on. */
+    std::map<const Component *, CachedValidation> mCachedComponentValidations; /**< Cached validations of the components of the model. */
+    CachedValidation mCachedUnitsValidation; /**< Cached validation of the units of the model. */
+    std::map<const Variable *, CachedEquivalenceNetworkValidation> mCachedEquivalenceNetworkValidations; /**< Cached validations of the equivalence networks of the model, keyed by their first variable. */
+    EntityRevisions mEquivalenceNetworkRevisions; /**< Revisions of the entities that the equivalence networks of the model depend on. */
+    CachedValidation mCachedIdentifierValidation; /**< Cached validation of the identifiers of the model. */
+    CachedMathIdsMap mCachedMathIds; /**< Identifiers found in the math validated by this validator. */
+
+    std::unordered_map<std::string, size_t> mIssueDescriptionCounts; /**< Number of logged issues with a given description, for the issues that may get checked for duplications. */
+    UnitsGraphs mUnitsGraphs; /**< Dependencies between the units of the models whose units are being validated. */
+
+    /**
+     * @brief Add an issue to the validator.
+     *
+     * Add the given @p issue to the validator and index its description, so
+     * that checking for duplicate issues does not require going through all
+     * the logged issues.
+     *
+     * @param issue The @c IssuePtr to add.
+     */
+    void addIssue(const IssuePtr &issue);
+
+    /**
+     * @brief Clear the issues from the validator.
+     *
+     * Clear the issues from the validator, as well as their indexes.
+     */
+    void removeAllIssues();
+
+    /**
+     * @brief Clear the stored issues from the validator.
+     *
+     * Clear the issues that are stored in the validator, as well as their
+     * indexes, so that they can be logged again.
+     */
+    void removeStoredIssues();
+
+    /**
+     * @brief Set the description of an issue that has already been logged.
+     *
+     * Set the description of the given @p issue, which has already been
+     * logged, and update the indexes accordingly.
+     *
+     * @param issue The @c IssuePtr for which to set the description.
+     * @param description The new description of the @p issue.
+     */
+    void setIssueDescription(const IssuePtr &issue, const std::string &description);
+
+    /**
+     * @brief Update the indexes of the given @p issue.
+     *
+     * Add the description of the given @p issue to, or remove it from, the
+     * indexes of the logged issues.
+     *
+     * @param issue The @c IssuePtr to index.
+     * @param increment @c 1 to add the @p issue to the indexes, @c -1 to remove
+     * it from them.
+     */
+    void indexIssue(const IssuePtr &issue, int increment);
+
+    /**
+     * @brief Test if the maximum number of errors has been reached.
+     *
+     * Test if this validator has a maximum number of errors and has already
+     * logged at least that many errors, in which case the validation of the
+     * model should stop.
+     *
+     * @return @c true if the maximum number of errors has been reached,
+     * @c false otherwise.
+     */
+    bool hasReachedMaximumErrorCount() const;
+
+    /**
+     * @brief Test if the validation of the model should stop.
+     *
+     * Test if the maximum number of errors has been reached or if the issue
+     * callback has cancelled the streaming of issues.
+     *
+     * @return @c true if the validation of the model should stop, @c false
+     * otherwise.
+     */
+    bool hasStoppedValidation() const;
+
+    /**
+     * @brief Stream the issues that have been logged so far.
+     *
+     * Stream the issues that have been logged so far, which must be final,
+     * after having removed those logged after the maximum number of errors,
+     * if it has been reached.
+     */
+    void streamValidatedIssues();
+
+    /**
+     * @brief Remove the issues logged after the maximum number of errors.
+     *
+     * Remove the issues that were logged after the last error allowed by the
+     * maximum number of errors, so that the issues are the same as the first
+     * ones of a full validation.
+     */
+    void removeIssuesAfterMaximumErrorCount();
+
+    /**
+     * @brief Get the revision of the given @p entity.
+     *
+     * Get the revision of the given @p entity, i.e. a value that changes
+     * whenever the @p entity gets modified.
+     *
+     * @param entity The @c Entity for which we want the revision.
+     *
+     * @return The revision of the @p entity, or zero if it is @c nullptr.
+     */
+    static size_t revision(const EntityPtr &entity);
+
+    /**
+     * @brief Get the tree revision of the given @p entity.
+     *
+     * Get the tree revision of the given @p entity, i.e. a value that changes
+     * whenever the @p entity or one of its descendants gets modified.
+     *
+     * @param entity The @c Entity for which we want the tree revision.
+     *
+     * @return The tree revision of the @p entity.
+     */
+    static size_t treeRevision(const EntityPtr &entity);
+
+    /**
+     * @brief Clear the cached validations.
+     *
+     * Clear all the validations cached by this validator.
+     */
+    void clearValidationCaches();
+
+    /**
+     * @brief Prepare the cached validations for the validation of @p model.
+     *
+     * Prepare the cached validations for the validation of the given @p model
+     * by discarding those that cannot be reused, i.e. all of them if the
+     * @p model is not the model that was last validated, those of the
+     * components and units if the name of the @p model or of one of its units
+     * has changed, and those of the equivalence networks if one of its units
+     * has been modified.
+     *
+     * @param model The model about to be validated.
+     */
+    void prepareValidationCaches(const ModelPtr &model);
+
+    /**
+     * @brief Discard the stale cached validations.
+     *
+     * Discard the cached validations of the components and equivalence
+     * networks that were not part of the model that was just validated.
+     */
+    void pruneValidationCaches();
+
+    /**
+     * @brief Add the issues of the given cached validation, if up to date.
+     *
+     * Add the issues of the given @p cachedValidation to this validator if
+     * this validator is incremental and the given @p entityRevisions are those
+     * for which the validation was cached.
+     *
+     * @param cachedValidation The cached validation.
+     * @param entityRevisions The revisions of the entities that the validation
+     * depends on, or an empty list if the validation cannot be cached.
+     *
+     * @return @c true if the issues were added, @c false otherwise.
+     */
+    bool addCachedIssues(CachedValidation &cachedValidation, const EntityRevisions &entityRevisions);
+
+    /**
+     * @brief Cache the given issues.
+     *
+     * Cache the given @p issues in the given @p cachedValidation along with
+     * the given @p entityRevisions, if this validator is incremental and the
+     * validation was not stopped because of the maximum number of errors.
+     *
+     * @param cachedValidation The cached validation.
+     * @param entityRevisions The revisions of the entities that the validation
+     * depends on, or an empty list if the validation cannot be cached.
+     * @param issues The issues logged by the validation.
+     */
+    void cacheIssues(CachedValidation &cachedValidation, const EntityRevisions &entityRevisions, const std::vector<IssuePtr> &issues);
+
+    /**
+     * @brief Get the revisions that the validation of the @p component depends on.
+     *
+     * Get the revisions of the entities that the validation of the given
+     * @p component depends on, i.e. the @p component itself, its variables
+     * and their units.
+     *
+     * @param component The component to validate.
+     *
+     * @return The revisions of the entities that the validation of the
+     * @p component depends on, or an empty list if this validator is not
+     * incremental or if the validation of the @p component cannot be cached
+     * (i.e. it is imported or it has resets).
+     */
+    EntityRevisions componentRevisions(const ComponentPtr &component) const;
+
+    /**
+     * @brief Get the revisions that the validation of the units of the @p model depends on.
+     *
+     * Get the revisions of the units of the given @p model.
+     *
+     * @param model The model which units are to be validated.
+     *
+     * @return The revisions of the units of the @p model, or an empty list if
+     * this validator is not incremental or if the validation of the units
+     * cannot be cached (i.e. some of them are imported).
+     */
+    EntityRevisions unitsRevisions(const ModelPtr &model) const;
+
+    /**
+     * @brief Get the revisions that the validation of the identifiers of the @p model depends on.
+     *
+     * Get the revisions of the entities that the validation of the identifiers
+     * of the given @p model depends on, i.e. the tree revision of the
+     * @p model, the revisions of its import sources and the revisions of the
+     * entities that its equivalence networks depend on.
+     *
+     * @param model The model which identifiers are to be validated.
+     *
+     * @return The revisions of the entities that the validation of the
+     * identifiers of the @p model depends on, or an empty list if this
+     * validator is not incremental.
+     */
+    EntityRevisions identifierRevisions(const ModelPtr &model) const;
 
     /**
      * @brief Utility function to construct an @c Issue if required for a given CellML identifier string.
@@ -308,9 +1084,9 @@ public:
      *
      * @param model The model the name is used in.
      * @param name The name of the component to validate.
-     * @param names The list of component names already used in the model.
+     * @param names The set of component names already used in the model.
      */
-    void validateUniqueName(const ModelPtr &model, const std::string &name, NameList &names);
+    void validateUniqueName(const ModelPtr &model, const std::string &name, NameSet &names);
 
     /**
      * @brief Validate the @p component using the CellML 2.0 Specification.
@@ -331,12 +1107,29 @@ public:
      *
      * @param model The model the @p component comes from.
      * @param component The @c Component to validate.
-     * @param componentNames The list of already used component names used
+     * @param componentNames The set of already used component names used
      * to track repeated component names.
      * @param history The history of visited components.
      * @param modelsVisited The list of visited models.
+     * @param deferredComponentValidations The list of deferred component
+     * validations to which the validation of the components is to be added,
+     * or @c nullptr if the components are to be validated straightaway.
+     */
+    void validateComponentTree(const ModelPtr &model, const ComponentPtr &component, NameSet &componentNames, History &history, std::vector<ModelPtr> &modelsVisited, DeferredComponentValidations *deferredComponentValidations);
+
+    /**
+     * @brief Validate the deferred components of the @p model in parallel.
+     *
+     * Validate the deferred components of the given @p model using a pool of
+     * threads, each with its own issue buffer, and then merge the issues into
+     * the @c Validator in the same order as if the components had been
+     * validated straightaway.
+     *
+     * @param model The model the deferred components come from.
+     * @param deferredComponentValidations The list of deferred component
+     * validations.
      */
-    void validateComponentTree(const ModelPtr &model, const ComponentPtr &component, NameList &componentNames, History &history, std::vector<ModelPtr> &modelsVisited);
+    void validateDeferredComponents(const ModelPtr &model, DeferredComponentValidations &deferredComponentValidations);
 
     /**
      * @brief Validate the @p units using the CellML 2.0 Specification.
@@ -345,7 +1138,7 @@ public:
      * the CellML 2.0 Specification. Any issues will be logged in the @c Validator.
      *
      * @param units The units to validate.
-     * @param history The history of units visited.
+     * @param history The history of imported units visited.
      * @param modelsVisited The list of visited models.
      * @param sourceUrl The source URL of the @p units.
      */
@@ -361,6 +1154,20 @@ public:
      */
     void validateConnections(const ModelPtr &model);
 
+    /**
+     * @brief Validate the variable connections in the @p model incrementally.
+     *
+     * Validate the variable connections in the given @p model, one equivalence
+     * network at a time, reusing the cached validation of the equivalence
+     * networks that have not been modified. Any issues will be logged in the
+     * @c Validator in the same order as by validateConnections().
+     *
+     * @param model The model which may contain variable connections to validate.
+     * @param variables The variables of the @p model that have equivalent
+     * variables.
+     */
+    void validateConnectionsIncrementally(const ModelPtr &model, const VariablePtrs &variables);
+
     /**
      * @brief Validate the units of the given variables equivalent variables.
      *
@@ -412,9 +1219,9 @@ public:
      * Any issues will be logged in the @c Validator.
      *
      * @param variable The variable to validate.
-     * @param variableNames A vector list of the name attributes of the @p variable and its siblings.
+     * @param variableNames The set of the name attributes of the siblings preceding the @p variable.
      */
-    void validateVariable(const VariablePtr &variable, const NameList &variableNames);
+    void validateVariable(const VariablePtr &variable, const NameSet &variableNames);
 
     /**
      * @brief Validate the @p reset using the CellML 2.0 Specification.
@@ -466,9 +1273,8 @@ public:
      *
      * @param node The node @c ci element from the document.
      * @param component The component the @p node is a part of.
-     * @param variableNames A list of variable names.
      */
-    void validateAndCleanCiNode(const XmlNodePtr &node, const ComponentPtr &component, const NameList &variableNames);
+    void validateAndCleanCiNode(const XmlNodePtr &node, const ComponentPtr &component);
 
     /**
      * @brief Validate the text of a @c cn element.
@@ -492,9 +1298,8 @@ public:
      *
      * @param node The @ref XmlNode to validate CellML entities on and remove @c cellml:units from.
      * @param component The component that the math @c XmlNode @p node is contained within.
-     * @param variableNames A @c vector list of the names of variables found within the @p component.
      */
-    void validateAndCleanMathCiCnNodes(XmlNodePtr &node, const ComponentPtr &component, const NameList &variableNames);
+    void validateAndCleanMathCiCnNodes(XmlNodePtr &node, const ComponentPtr &component);
 
     /**
      * @brief Add a MathML-related issue.
@@ -608,19 +1413,31 @@ public:
      */
     void addIdMapItem(const std::string &id, const std::string &info, IdMap &idMap);
 
-    /** @brief Utility function to parse MathML children and add element identifiers to idMap.
+    /** @brief Utility function to collect the identifiers of MathML elements.
      *
-     * Utility function to parse MathML children and add element identifiers to idMap.
+     * Utility function to collect the identifiers of the given MathML element
+     * and of its children.
      *
      * @param node XMLNode to read.
-     * @param infoRef @c std::string reference information for the math.
-     * @param idMap The IdMap under construction.
+     * @param mathIds The list of identifiers under construction.
+     */
+    void collectMathIds(const XmlNodePtr &node, MathIds &mathIds);
+
+    /** @brief Utility function to cache the identifiers found in math.
+     *
+     * Utility function to cache the identifiers found in the given math
+     * @p input, unless they have already been cached or identifiers are not
+     * checked for uniqueness.
+     *
+     * @param input The @c std::string MathML string.
+     * @param docs The XML documents parsed from @p input.
      */
-    void buildMathChildIdMap(const XmlNodePtr &node, const std::string &infoRef, IdMap &idMap);
+    void cacheMathIds(const std::string &input, const std::vector<XmlDocPtr> &docs);
 
-    /** @brief Utility function to parse math and add element identifiers to idMap.
+    /** @brief Utility function to add the identifiers found in math to idMap.
      *
-     * Utility function to parse math and add element identifiers to idMap.
+     * Utility function to add the identifiers found in math to idMap, parsing
+     * the math only if it was not parsed while it was validated.
      *
      * @param infoRef @c std::string reference information for the math.
      * @param idMap The IdMap under construction.
@@ -639,22 +1456,12 @@ public:
      */
     void validateImportSource(const ImportSourcePtr &importSource, const std::string &importName, const std::string &importType);
 
-    /**
-     * @brief Check if the @p names are already part of a cyclic issues.
-     *
-     * Check to see if the @p names have already been reported in a cyclic issue.
-     *
-     * @param names The names that make up the cycle.
-     *
-     * @return @c true if the @p names have already been reported in a cyclic issue, @c false otherwise.
-     */
-    bool hasCycleAlreadyBeenReported(NameList names) const;
-
     /**
      * @brief Check to see if the @p description is already present in the issues.
      *
      * Check to see if the @p description has already been reported in
-     * existing issues.
+     * existing issues.  Only the issues with a @c UNITS_NAME_UNIQUE or an
+     * @c IMPORT_UNITS_REF reference rule are checked.
      *
      * @param description The description to check for prior existence.
      *
@@ -678,116 +1485,573 @@ public:
      */
     void handleErrorsFromImports(size_t initialErrorCount, bool isOriginatingModel, const std::string &type,
                                  const std::string &name, const History &history, const ComponentPtr &component,
-                                 const UnitsPtr &units) const;
+                                 const UnitsPtr &units);
 };
 
-bool checkForLocalCycles(const History &history, const HistoryEpochPtr &h)
+Validator::ValidatorImpl *Validator::pFunc()
 {
-    return std::find_if(history.begin(), history.end(),
-                        [=](const HistoryEpochPtr &i) -> bool { return (i->mName == h->mName) && (i->mSourceUrl == h->mSourceUrl); })
-           != history.end();
+    return reinterpret_cast<Validator::ValidatorImpl *>(Logger::pFunc());
 }
 
-Validator::ValidatorImpl *Validator::pFunc()
+const Validator::ValidatorImpl *Validator::pFunc() const
 {
-    return reinterpret_cast<Validator::ValidatorImpl *>(Logger::pFunc());
+    return reinterpret_cast<Validator::ValidatorImpl const *>(Logger::pFunc());
+}
+
+Validator::Validator()
+    : Logger(new ValidatorImpl())
+{
+    pFunc()->mValidator = this;
+}
+
+Validator::~Validator()
+{
+    delete pFunc();
+}
+
+ValidatorPtr Validator::create() noexcept
+{
+    return std::shared_ptr<Validator> {new Validator {}};
+}
+
+size_t Validator::threadCount() const
+{
+    return pFunc()->mThreadCount;
+}
+
+void Validator::setThreadCount(size_t threadCount)
+{
+    pFunc()->mThreadCount = threadCount;
+}
+
+bool Validator::isIncremental() const
+{
+    return pFunc()->mIncremental;
+}
+
+void Validator::setIncremental(bool incremental)
+{
+    pFunc()->mIncremental = incremental;
+
+    if (!incremental) {
+        pFunc()->clearValidationCaches();
+    }
+}
+
+size_t Validator::maximumErrorCount() const
+{
+    return pFunc()->mMaximumErrorCount;
+}
+
+void Validator::setMaximumErrorCount(size_t maximumErrorCount)
+{
+    pFunc()->mMaximumErrorCount = maximumErrorCount;
+}
+
+bool Validator::hasMathMLDtdValidation() const
+{
+    return pFunc()->mMathMLDtdValidation;
+}
+
+void Validator::setHasMathMLDtdValidation(bool mathMLDtdValidation)
+{
+    if (mathMLDtdValidation != pFunc()->mMathMLDtdValidation) {
+        // The cached validations of components may have been done with or
+        // without MathML DTD validation, so they cannot be reused.
+
+        pFunc()->mMathMLDtdValidation = mathMLDtdValidation;
+
+        pFunc()->clearValidationCaches();
+    }
+}
+
+bool Validator::hasMathMLDtdCompatibility() const
+{
+    return pFunc()->mMathMLDtdCompatibility;
+}
+
+void Validator::setHasMathMLDtdCompatibility(bool mathMLDtdCompatibility)
+{
+    if (mathMLDtdCompatibility != pFunc()->mMathMLDtdCompatibility) {
+        // The cached validations of components may have been done with or
+        // without the W3C MathML DTD itself, so they cannot be reused.
+
+        pFunc()->mMathMLDtdCompatibility = mathMLDtdCompatibility;
+
+        pFunc()->clearValidationCaches();
+    }
+}
+
+bool Validator::hasUniqueIdValidation() const
+{
+    return pFunc()->mUniqueIdValidation;
+}
+
+void Validator::setHasUniqueIdValidation(bool uniqueIdValidation)
+{
+    if (uniqueIdValidation != pFunc()->mUniqueIdValidation) {
+        pFunc()->mUniqueIdValidation = uniqueIdValidation;
+
+        pFunc()->mCachedIdentifierValidation = {};
+    }
+}
+
+void Validator::validateModel(const ModelPtr &model)
+{
+    // Clear any pre-existing issues in ths validator instance.
+    pFunc()->removeAllIssues();
+
+    // Hold back the streaming of issues since some of them may get modified or
+    // removed, and only stream them once a part of the model has been
+    // validated.
+    pFunc()->holdIssueStreaming();
+
+    if (model == nullptr) {
+        auto issue = Issue::IssueImpl::create();
+        issue->mPimpl->setReferenceRule(Issue::ReferenceRule::INVALID_ARGUMENT);
+        issue->mPimpl->setDescription("The model is null.");
+        pFunc()->addIssue(issue);
+    } else {
+        // Check for a valid name attribute.
+        if (!isCellmlIdentifier(model->name())) {
+            auto issue = pFunc()->makeIssueIllegalIdentifier(model->name());
+            issue->mPimpl->mItem->mPimpl->setModel(model);
+            issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MODEL_NAME);
+            issue->mPimpl->setDescription("Model '%1' does not have a valid name attribute. %2", {model->name(), issue->description()});
+            pFunc()->addIssue(issue);
+        }
+        // Check for a valid identifier.
+        if (!isValidXmlName(model->id())) {
+            auto issue = Issue::IssueImpl::create();
+            issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
+            issue->mPimpl->mItem->mPimpl->setModel(model);
+            issue->mPimpl->setDescription("Model '%1' does not have a valid 'id' attribute, '%2'.", {model->name(), model->id()});
+            pFunc()->addIssue(issue);
+        }
+        pFunc()->prepareValidationCaches(model);
+        std::vector<ModelPtr> modelsVisited = {model};
+        // Check for components in this model.
+        if (model->componentCount() > 0) {
+            NameSet componentNames;
+            History history;
+            DeferredComponentValidations deferredComponentValidations;
+            bool parallelValidation = (pFunc()->mThreadCount != 1) && (pFunc()->mMaximumErrorCount == 0);
+            for (size_t i = 0; (i < model->componentCount()) && !pFunc()->hasStoppedValidation(); ++i) {
+                history.clear();
+                ComponentPtr component = model->component(i);
+                pFunc()->validateComponentTree(model, component, componentNames, history, modelsVisited,
+                                               parallelValidation ? &deferredComponentValidations : nullptr);
+                if (!parallelValidation) {
+                    pFunc()->streamValidatedIssues();
+                }
+            }
+            if (parallelValidation) {
+                pFunc()->validateDeferredComponents(model, deferredComponentValidations);
+                pFunc()->streamValidatedIssues();
+            }
+        }
+        // Check for units in this model.
+        if ((model->unitsCount() > 0) && !pFunc()->hasStoppedValidation()) {
+            auto unitsRevisions = pFunc()->unitsRevisions(model);
+            if (!pFunc()->addCachedIssues(pFunc()->mCachedUnitsValidation, unitsRevisions)) {
+                auto issueCount = pFunc()->mIssues.size();
+                History history;
+                for (size_t i = 0; (i < model->unitsCount()) && !pFunc()->hasReachedMaximumErrorCount(); ++i) {
+                    history.clear();
+                    UnitsPtr units = model->units(i);
+                    pFunc()->validateUnits(units, history, modelsVisited);
+                }
+                pFunc()->mUnitsGraphs.clear();
+                pFunc()->cacheIssues(pFunc()->mCachedUnitsValidation, unitsRevisions,
+                                     {pFunc()->mIssues.begin() + ptrdiff_t(issueCount), pFunc()->mIssues.end()});
+            }
+            pFunc()->streamValidatedIssues();
+        }
+
+        // Validate any connections / variable equivalence networks in the model.
+        if (!pFunc()->hasStoppedValidation()) {
+            pFunc()->validateConnections(model);
+            pFunc()->streamValidatedIssues();
+        }
+
+        // Check identifiers across the model are unique.
+        if (!pFunc()->hasStoppedValidation()) {
+            auto identifierRevisions = pFunc()->identifierRevisions(model);
+            if (!pFunc()->addCachedIssues(pFunc()->mCachedIdentifierValidation, identifierRevisions)) {
+                auto issueCount = pFunc()->mIssues.size();
+                pFunc()->checkUniqueIds(model);
+                pFunc()->cacheIssues(pFunc()->mCachedIdentifierValidation, identifierRevisions,
+                                     {pFunc()->mIssues.begin() + ptrdiff_t(issueCount), pFunc()->mIssues.end()});
+            }
+        }
+
+        pFunc()->pruneValidationCaches();
+    }
+
+    if (pFunc()->hasReachedMaximumErrorCount()) {
+        pFunc()->removeIssuesAfterMaximumErrorCount();
+    }
+
+    pFunc()->releaseIssueStreaming();
+}
+
+bool Validator::ValidatorImpl::hasReachedMaximumErrorCount() const
+{
+    return (mMaximumErrorCount != 0) && (mDroppedErrorCount + mErrors.size() >= mMaximumErrorCount);
+}
+
+bool Validator::ValidatorImpl::hasStoppedValidation() const
+{
+    return hasReachedMaximumErrorCount() || mIssueStreamingCancelled;
+}
+
+void Validator::ValidatorImpl::streamValidatedIssues()
+{
+    if (hasReachedMaximumErrorCount()) {
+        removeIssuesAfterMaximumErrorCount();
+    }
+
+    streamIssues();
+}
+
+void Validator::ValidatorImpl::removeIssuesAfterMaximumErrorCount()
+{
+    // Note: the issues are only streamed once they are final, i.e. once those
+    //       after the last error allowed have been removed, so if that error
+    //       has been streamed and dropped then there is nothing to remove.
+
+    if (mDroppedErrorCount >= mMaximumErrorCount) {
+        return;
+    }
+
+    auto issues = mIssues;
+    auto issueCount = mErrors[mMaximumErrorCount - mDroppedErrorCount - 1] + 1;
+
+    removeStoredIssues();
+
+    for (size_t i = 0; i < issueCount; ++i) {
+        addIssue(issues[i]);
+    }
+}
+
+size_t Validator::ValidatorImpl::revision(const EntityPtr &entity)
+{
+    return (entity != nullptr) ? entity->pFunc()->mRevision : 0;
+}
+
+size_t Validator::ValidatorImpl::treeRevision(const EntityPtr &entity)
+{
+    return entity->pFunc()->mTreeRevision;
+}
+
+void Validator::ValidatorImpl::clearValidationCaches()
+{
+    mCachedModel = nullptr;
+    mCachedModelContext.clear();
+    mCachedUnitsRevisions.clear();
+    mCachedComponentValidations.clear();
+    mCachedUnitsValidation = {};
+    mCachedEquivalenceNetworkValidations.clear();
+    mEquivalenceNetworkRevisions.clear();
+    mCachedIdentifierValidation = {};
+    mCachedMathIds.clear();
+}
+
+void Validator::ValidatorImpl::prepareValidationCaches(const ModelPtr &model)
+{
+    ++mValidationCount;
+
+    if (!mIncremental || (model.get() != mCachedModel)) {
+        clearValidationCaches();
+
+        if (!mIncremental) {
+            return;
+        }
+
+        mCachedModel = model.get();
+    }
+
+    // The validation of a component depends on the name of the model and of
+    // its units while the validation of an equivalence network depends on the
+    // definition of the units of the model.
+
+    Strings modelContext = {model->name()};
+    EntityRevisions unitsRevisions;
+
+    for (size_t i = 0; i < model->unitsCount(); ++i) {
+        auto units = model->units(i);
+
+        modelContext.push_back(units->name());
+        unitsRevisions.emplace_back(units.get(), revision(units));
+    }
+
+    if (modelContext != mCachedModelContext) {
+        mCachedModelContext = modelContext;
+        mCachedComponentValidations.clear();
+        mCachedUnitsValidation = {};
+    }
+
+    if (unitsRevisions != mCachedUnitsRevisions) {
+        mCachedUnitsRevisions = unitsRevisions;
+        mCachedEquivalenceNetworkValidations.clear();
+    }
+
+    mEquivalenceNetworkRevisions.clear();
+}
+
+void Validator::ValidatorImpl::pruneValidationCaches()
+{
+    for (auto it = mCachedComponentValidations.begin(); it != mCachedComponentValidations.end();) {
+        it = (it->second.mValidationCount != mValidationCount) ? mCachedComponentValidations.erase(it) : std::next(it);
+    }
+
+    for (auto it = mCachedEquivalenceNetworkValidations.begin(); it != mCachedEquivalenceNetworkValidations.end();) {
+        it = (it->second.mValidationCount != mValidationCount) ? mCachedEquivalenceNetworkValidations.erase(it) : std::next(it);
+    }
 }
 
-Validator::Validator()
-    : Logger(new ValidatorImpl())
+bool Validator::ValidatorImpl::addCachedIssues(CachedValidation &cachedValidation, const EntityRevisions &entityRevisions)
 {
-    pFunc()->mValidator = this;
+    if (entityRevisions.empty() || (cachedValidation.mEntityRevisions != entityRevisions)) {
+        return false;
+    }
+
+    for (const auto &issue : cachedValidation.mIssues) {
+        addIssue(issue);
+    }
+
+    cachedValidation.mValidationCount = mValidationCount;
+
+    return true;
 }
 
-Validator::~Validator()
+void Validator::ValidatorImpl::cacheIssues(CachedValidation &cachedValidation, const EntityRevisions &entityRevisions, const std::vector<IssuePtr> &issues)
 {
-    delete pFunc();
+    if (entityRevisions.empty() || hasReachedMaximumErrorCount()) {
+        // Note: the validation may have been stopped before it was complete,
+        //       in which case its issues cannot be reused.
+
+        return;
+    }
+
+    cachedValidation.mEntityRevisions = entityRevisions;
+    cachedValidation.mIssues = issues;
+    cachedValidation.mValidationCount = mValidationCount;
 }
 
-ValidatorPtr Validator::create() noexcept
+EntityRevisions Validator::ValidatorImpl::componentRevisions(const ComponentPtr &component) const
 {
-    return std::shared_ptr<Validator> {new Validator {}};
+    // The validation of an imported component depends on the model it is
+    // imported from, and that of a component with resets depends on the
+    // components of the variables referenced by its resets, so neither can be
+    // cached.
+
+    EntityRevisions revisions;
+
+    if (!mIncremental || component->isImport() || (component->resetCount() > 0)) {
+        return revisions;
+    }
+
+    revisions.emplace_back(component.get(), revision(component));
+
+    for (size_t i = 0; i < component->variableCount(); ++i) {
+        auto variable = component->variable(i);
+        auto units = variable->units();
+
+        revisions.emplace_back(variable.get(), revision(variable));
+        revisions.emplace_back(units.get(), revision(units));
+    }
+
+    return revisions;
 }
 
-void Validator::validateModel(const ModelPtr &model)
+EntityRevisions Validator::ValidatorImpl::unitsRevisions(const ModelPtr &model) const
 {
-    // Clear any pre-existing issues in ths validator instance.
-    pFunc()->removeAllIssues();
+    // The validation of imported units depends on the model they are imported
+    // from, so it cannot be cached.
 
-    if (model == nullptr) {
-        auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setReferenceRule(Issue::ReferenceRule::INVALID_ARGUMENT);
-        issue->mPimpl->setDescription("The model is null.");
-        pFunc()->addIssue(issue);
-    } else {
-        // Check for a valid name attribute.
-        if (!isCellmlIdentifier(model->name())) {
-            auto issue = pFunc()->makeIssueIllegalIdentifier(model->name());
-            issue->mPimpl->mItem->mPimpl->setModel(model);
-            issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MODEL_NAME);
-            issue->mPimpl->setDescription("Model '" + model->name() + "' does not have a valid name attribute. " + issue->description());
-            pFunc()->addIssue(issue);
-        }
-        // Check for a valid identifier.
-        if (!isValidXmlName(model->id())) {
-            auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
-            issue->mPimpl->mItem->mPimpl->setModel(model);
-            issue->mPimpl->setDescription("Model '" + model->name() + "' does not have a valid 'id' attribute, '" + model->id() + "'.");
-            pFunc()->addIssue(issue);
-        }
-        std::vector<ModelPtr> modelsVisited = {model};
-        // Check for components in this model.
-        if (model->componentCount() > 0) {
-            NameList componentNames;
-            History history;
-            for (size_t i = 0; i < model->componentCount(); ++i) {
-                history.clear();
-                ComponentPtr component = model->component(i);
-                pFunc()->validateComponentTree(model, component, componentNames, history, modelsVisited);
-            }
-        }
-        // Check for units in this model.
-        if (model->unitsCount() > 0) {
-            History history;
-            for (size_t i = 0; i < model->unitsCount(); ++i) {
-                history.clear();
-                UnitsPtr units = model->units(i);
-                pFunc()->validateUnits(units, history, modelsVisited);
-            }
+    EntityRevisions revisions;
+
+    if (!mIncremental) {
+        return revisions;
+    }
+
+    for (size_t i = 0; i < model->unitsCount(); ++i) {
+        auto units = model->units(i);
+
+        if (units->isImport()) {
+            return {};
         }
 
-        // Validate any connections / variable equivalence networks in the model.
-        pFunc()->validateConnections(model);
+        revisions.emplace_back(units.get(), revision(units));
+    }
 
-        // Check identifiers across the model are unique.
-        pFunc()->checkUniqueIds(model);
+    return revisions;
+}
+
+EntityRevisions Validator::ValidatorImpl::identifierRevisions(const ModelPtr &model) const
+{
+    // The validation of the identifiers of a model depends on the entities
+    // that its identifiers depend on and on its equivalent variables that are
+    // not part of the model (since their name is used to describe duplicate
+    // identifiers).
+
+    EntityRevisions revisions;
+
+    if (!mIncremental) {
+        return revisions;
     }
+
+    revisions = IdIndexBase::identifierRevisions(model);
+
+    revisions.insert(revisions.end(), mEquivalenceNetworkRevisions.begin(), mEquivalenceNetworkRevisions.end());
+
+    return revisions;
 }
 
-void Validator::ValidatorImpl::validateUniqueName(const ModelPtr &model, const std::string &name, NameList &names)
+void Validator::ValidatorImpl::validateUniqueName(const ModelPtr &model, const std::string &name, NameSet &names)
 {
     if (!name.empty()) {
-        if (std::find(names.begin(), names.end(), name) != names.end()) {
+        if (!names.insert(name).second) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Model '" + model->name() + "' contains multiple components with the name '" + name + "'. Valid component names must be unique to their model.");
+            issue->mPimpl->setDescription("Model '%1' contains multiple components with the name '%2'. Valid component names must be unique to their model.", {model->name(), name});
             issue->mPimpl->mItem->mPimpl->setModel(model);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::COMPONENT_NAME_UNIQUE);
             addIssue(issue);
-        } else {
-            names.push_back(name);
         }
     }
 }
 
-void Validator::ValidatorImpl::validateComponentTree(const ModelPtr &model, const ComponentPtr &component, NameList &componentNames, History &history, std::vector<ModelPtr> &modelsVisited)
+void Validator::ValidatorImpl::validateComponentTree(const ModelPtr &model, const ComponentPtr &component, NameSet &componentNames, History &history, std::vector<ModelPtr> &modelsVisited, DeferredComponentValidations *deferredComponentValidations)
 {
     validateUniqueName(model, component->name(), componentNames);
     for (size_t i = 0; i < component->componentCount(); ++i) {
         auto childComponent = component->component(i);
-        validateComponentTree(model, childComponent, componentNames, history, modelsVisited);
+        validateComponentTree(model, childComponent, componentNames, history, modelsVisited, deferredComponentValidations);
+    }
+    if (hasReachedMaximumErrorCount()) {
+        return;
+    }
+    auto revisions = componentRevisions(component);
+    if (!revisions.empty() && addCachedIssues(mCachedComponentValidations[component.get()], revisions)) {
+        return;
+    }
+    if (deferredComponentValidations != nullptr) {
+        deferredComponentValidations->push_back({component, mIssues.size(), {}, {}});
+    } else {
+        auto issueCount = mIssues.size();
+        validateComponent(component, history, modelsVisited);
+        if (!revisions.empty()) {
+            cacheIssues(mCachedComponentValidations[component.get()], revisions,
+                        {mIssues.begin() + ptrdiff_t(issueCount), mIssues.end()});
+        }
+    }
+}
+
+void Validator::ValidatorImpl::validateDeferredComponents(const ModelPtr &model, DeferredComponentValidations &deferredComponentValidations)
+{
+    // Validate our deferred components using a pool of threads, each of which
+    // has its own validator (and therefore its own issue buffer) and picks the
+    // next deferred component to validate until there are none left.
+    // Note: a component is validated independently of the other components,
+    //       except for the issues already logged, which only matter for the
+    //       validation of units and connections.
+
+    auto threadCount = (mThreadCount == 0) ?
+                           std::max(std::thread::hardware_concurrency(), 1U) :
+                           mThreadCount;
+
+#ifdef __EMSCRIPTEN__
+    // Threads are not available, so validate our deferred components on the
+    // calling thread.
+
+    threadCount = 1;
+#endif
+
+    threadCount = std::min(threadCount, deferredComponentValidations.size());
+
+    std::atomic<size_t> nextDeferredComponentValidation(0);
+    auto validateComponents = [&]() {
+        auto validator = Validator::create();
+        History history;
+
+        validator->pFunc()->mMathMLDtdValidation = mMathMLDtdValidation;
+        validator->pFunc()->mMathMLDtdCompatibility = mMathMLDtdCompatibility;
+        validator->pFunc()->mUniqueIdValidation = mUniqueIdValidation;
+        std::vector<ModelPtr> modelsVisited = {model};
+
+        for (auto i = nextDeferredComponentValidation++; i < deferredComponentValidations.size(); i = nextDeferredComponentValidation++) {
+            auto &deferredComponentValidation = deferredComponentValidations[i];
+
+            validator->pFunc()->removeAllIssues();
+            validator->pFunc()->validateComponent(deferredComponentValidation.mComponent, history, modelsVisited);
+
+            deferredComponentValidation.mIssues = validator->pFunc()->mIssues;
+            deferredComponentValidation.mCachedMathIds = std::move(validator->pFunc()->mCachedMathIds);
+
+            validator->pFunc()->mCachedMathIds.clear();
+        }
+    };
+
+    if (threadCount > 1) {
+        std::vector<std::thread> threads;
+
+        threads.reserve(threadCount - 1);
+
+        for (size_t i = 1; i < threadCount; ++i) {
+            threads.emplace_back(validateComponents);
+        }
+
+        validateComponents();
+
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    } else {
+        validateComponents();
+    }
+
+    // Merge the issues of our deferred components with the issues that have
+    // already been logged (i.e. the ones about non-unique component names), in
+    // the order in which they would have been logged by a serial validation.
+
+    auto issues = mIssues;
+    size_t issueIndex = 0;
+
+    removeStoredIssues();
+
+    for (const auto &deferredComponentValidation : deferredComponentValidations) {
+        for (; issueIndex < deferredComponentValidation.mIssueCount; ++issueIndex) {
+            addIssue(issues[issueIndex]);
+        }
+
+        for (const auto &issue : deferredComponentValidation.mIssues) {
+            addIssue(issue);
+        }
+    }
+
+    for (; issueIndex < issues.size(); ++issueIndex) {
+        addIssue(issues[issueIndex]);
+    }
+
+    // Keep track of the math identifiers collected while validating our
+    // deferred components.
+
+    for (auto &deferredComponentValidation : deferredComponentValidations) {
+        for (auto &cachedMathIds : deferredComponentValidation.mCachedMathIds) {
+            mCachedMathIds.insert(std::move(cachedMathIds)).first->second.mValidationCount = mValidationCount;
+        }
+    }
+
+    // Cache the issues of our deferred components, if possible.
+
+    for (const auto &deferredComponentValidation : deferredComponentValidations) {
+        auto revisions = componentRevisions(deferredComponentValidation.mComponent);
+        if (!revisions.empty()) {
+            cacheIssues(mCachedComponentValidations[deferredComponentValidation.mComponent.get()], revisions,
+                        deferredComponentValidation.mIssues);
+        }
     }
-    validateComponent(component, history, modelsVisited);
 }
 
 void Validator::ValidatorImpl::validateImportSource(const ImportSourcePtr &importSource, const std::string &importName, const std::string &importType)
@@ -799,13 +2063,13 @@ void Validator::ValidatorImpl::validateImportSource(const ImportSourcePtr &impor
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setImportSource(importSource);
-        issue->mPimpl->setDescription("Import of " + importType + " '" + importName + "' does not have a valid 'id' attribute, '" + importSource->id() + "'.");
+        issue->mPimpl->setDescription("Import of %1 '%2' does not have a valid 'id' attribute, '%3'.", {importType, importName, importSource->id()});
         addIssue(issue);
     }
 
     if (url.empty()) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Import of " + importType + " '" + importName + "' does not have a valid locator xlink:href attribute.");
+        issue->mPimpl->setDescription("Import of %1 '%2' does not have a valid locator xlink:href attribute.", {importType, importName});
         issue->mPimpl->mItem->mPimpl->setImportSource(importSource);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_HREF);
         addIssue(issue);
@@ -813,7 +2077,7 @@ void Validator::ValidatorImpl::validateImportSource(const ImportSourcePtr &impor
         xmlURIPtr uri = xmlParseURI(url.c_str());
         if (uri == nullptr) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Import of " + importType + " '" + importName + "' has an invalid URI in the xlink:href attribute.");
+            issue->mPimpl->setDescription("Import of %1 '%2' has an invalid URI in the xlink:href attribute.", {importType, importName});
             issue->mPimpl->mItem->mPimpl->setImportSource(importSource);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_HREF);
             addIssue(issue);
@@ -824,7 +2088,7 @@ void Validator::ValidatorImpl::validateImportSource(const ImportSourcePtr &impor
     }
 }
 
-void Validator::ValidatorImpl::handleErrorsFromImports(size_t initialErrorCount, bool isOriginatingModel, const std::string &type, const std::string &name, const History &history, const ComponentPtr &component, const UnitsPtr &units) const
+void Validator::ValidatorImpl::handleErrorsFromImports(size_t initialErrorCount, bool isOriginatingModel, const std::string &type, const std::string &name, const History &history, const ComponentPtr &component, const UnitsPtr &units)
 {
     static const std::string skipThis = "Cyclic dependencies";
     static const std::string notOriginMarker = "NOT ORIGIN: ";
@@ -879,12 +2143,12 @@ void Validator::ValidatorImpl::handleErrorsFromImports(size_t initialErrorCount,
                 }
 
                 os << description.substr(originalDescriptionStart);
-                issue->mPimpl->setDescription(os.str());
+                setIssueDescription(issue, os.str());
             } else {
                 // Get name, reference, and import source from history.
                 auto h = history.back();
                 os << notOriginMarker << dataBoundaryMarker << h->mName << dataSeparator << h->mReferenceName << dataSeparator << h->mDestinationUrl << dataBoundaryMarker << description;
-                issue->mPimpl->setDescription(os.str());
+                setIssueDescription(issue, os.str());
             }
         }
     }
@@ -906,7 +2170,7 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component,
     if (!isCellmlIdentifier(componentName)) {
         auto issue = makeIssueIllegalIdentifier(componentName);
         issue->mPimpl->mItem->mPimpl->setComponent(component);
-        issue->mPimpl->setDescription(descriptionPrefix + "'" + componentName + "' does not have a valid name attribute. " + issue->description());
+        issue->mPimpl->setDescription("%1'%2' does not have a valid name attribute. %3", {descriptionPrefix, componentName, issue->description()});
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::COMPONENT_NAME);
         addIssue(issue);
     }
@@ -915,7 +2179,7 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component,
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setComponent(component);
-        issue->mPimpl->setDescription(descriptionPrefix + "'" + componentName + "' does not have a valid 'id' attribute, '" + component->id() + "'.");
+        issue->mPimpl->setDescription("%1'%2' does not have a valid 'id' attribute, '%3'.", {descriptionPrefix, componentName, component->id()});
         addIssue(issue);
     }
 
@@ -925,7 +2189,7 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component,
 
         if (!isCellmlIdentifier(componentRef)) {
             auto issue = makeIssueIllegalIdentifier(componentRef);
-            issue->mPimpl->setDescription(descriptionPrefix + "'" + componentName + "' does not have a valid component_ref attribute. " + issue->description());
+            issue->mPimpl->setDescription("%1'%2' does not have a valid component_ref attribute. %3", {descriptionPrefix, componentName, issue->description()});
             issue->mPimpl->mItem->mPimpl->setComponent(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_COMPONENT_COMPONENT_REF);
             addIssue(issue);
@@ -955,7 +2219,7 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component,
                 history.pop_back();
             } else {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription(descriptionPrefix + "'" + componentName + "' refers to component '" + componentRef + "' which does not appear in '" + component->importSource()->url() + "'.");
+                issue->mPimpl->setDescription("%1'%2' refers to component '%3' which does not appear in '%4'.", {descriptionPrefix, componentName, componentRef, component->importSource()->url()});
                 issue->mPimpl->mItem->mPimpl->setComponent(component);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_COMPONENT_COMPONENT_REF);
                 addIssue(issue);
@@ -964,21 +2228,21 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component,
 
     } else {
         // Check for variables in this component.
-        NameList variableNames;
+        NameSet variableNames;
         // Validate variable(s).
         for (size_t i = 0; i < component->variableCount(); ++i) {
             VariablePtr variable = component->variable(i);
             validateVariable(variable, variableNames);
-            variableNames.push_back(variable->name());
+            variableNames.insert(variable->name());
         }
         // Check for resets in this component.
-        for (size_t i = 0; i < component->resetCount(); ++i) {
+        for (size_t i = 0; (i < component->resetCount()) && !hasReachedMaximumErrorCount(); ++i) {
             ResetPtr reset = component->reset(i);
             validateReset(reset, component);
         }
 
         // Validate math through the private implementation (for XML handling).
-        if (!component->math().empty()) {
+        if (!component->math().empty() && !hasReachedMaximumErrorCount()) {
             validateMath(component->math(), component);
         }
     }
@@ -986,79 +2250,66 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component,
     handleErrorsFromImports(initialIssueCount, isOriginatingModel, "Component", componentName, history, component, nullptr);
 }
 
-std::set<std::string> namesInCycle(NameList allNames)
+void Validator::ValidatorImpl::addIssue(const IssuePtr &issue)
 {
-    std::string cycleStartName = allNames.back();
-    allNames.pop_back();
-    std::reverse(allNames.begin(), allNames.end());
-    std::set<std::string> namesInCycle = {cycleStartName};
-    std::string name = *allNames.begin();
-    while (name != cycleStartName) {
-        namesInCycle.emplace(name);
-        allNames.erase(allNames.begin());
-        name = *allNames.begin();
-    }
+    LoggerImpl::addIssue(issue);
 
-    return namesInCycle;
+    indexIssue(issue, 1);
 }
 
-bool Validator::ValidatorImpl::hasCycleAlreadyBeenReported(NameList names) const
+void Validator::ValidatorImpl::removeAllIssues()
 {
-    std::set<std::string> testNamesInCycle = namesInCycle(std::move(names));
-    bool found = false;
-    for (size_t i = 0; !found && (i < mValidator->issueCount()); ++i) {
-        auto issue = mValidator->issue(i);
-        if (issue->description().substr(0, 20) == "Cyclic units exist: ") {
-            // Remove prefix to loop information.
-            auto loop = issue->description().substr(20);
-            // Remove suffix to loop information.
-            loop.pop_back();
-            auto parts = split(loop, " -> ");
-            auto existingNamesInCycle = namesInCycle(parts);
-            found = testNamesInCycle == existingNamesInCycle;
-        }
+    LoggerImpl::removeAllIssues();
+
+    mIssueDescriptionCounts.clear();
+}
+
+void Validator::ValidatorImpl::removeStoredIssues()
+{
+    LoggerImpl::removeStoredIssues();
+
+    mIssueDescriptionCounts.clear();
+}
+
+void Validator::ValidatorImpl::setIssueDescription(const IssuePtr &issue, const std::string &description)
+{
+    indexIssue(issue, -1);
+
+    issue->mPimpl->setDescription(description);
+
+    indexIssue(issue, 1);
+}
+
+void Validator::ValidatorImpl::indexIssue(const IssuePtr &issue, int increment)
+{
+    // Only the issues that may get checked for duplications are indexed, so
+    // that the description of the other issues does not get formatted.
+
+    auto referenceRule = issue->referenceRule();
+
+    if ((referenceRule != Issue::ReferenceRule::UNITS_NAME_UNIQUE)
+        && (referenceRule != Issue::ReferenceRule::IMPORT_UNITS_REF)) {
+        return;
     }
 
-    return found;
+    auto description = issue->description();
+    auto &count = mIssueDescriptionCounts[description];
+
+    count += size_t(increment);
+
+    if (count == 0) {
+        mIssueDescriptionCounts.erase(description);
+    }
 }
 
 bool Validator::ValidatorImpl::checkIssuesForDuplications(const std::string &description) const
 {
-    size_t count = mValidator->issueCount();
-    for (size_t i = 0; i < count; ++i) {
-        if (mValidator->issue(count - 1 - i)->description() == description) {
-            return true;
-        }
-    }
-    return false;
+    return mIssueDescriptionCounts.find(description) != mIssueDescriptionCounts.end();
 }
 
 void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &history, std::vector<ModelPtr> &modelsVisited, const std::string &sourceUrl)
 {
     auto h = createHistoryEpoch(units, sourceUrl);
-    if (checkForLocalCycles(history, h)) {
-        history.push_back(h);
-        std::string des;
-        Strings names;
-        for (const auto &entry : history) {
-            if (!des.empty()) {
-                des += " -> ";
-            }
-            auto tmp = "'" + entry->mName + "'";
-            names.push_back(tmp);
-            des += tmp;
-        }
-        if (!hasCycleAlreadyBeenReported(names)) {
-            auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Cyclic units exist: " + des + ".");
-            issue->mPimpl->mItem->mPimpl->setUnits(units);
-            issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNIT_CIRCULAR_REF);
-            addIssue(issue);
-        }
-        history.pop_back();
-        return;
-    }
-
     std::string unitsName = units->name();
     size_t initialIssueCount = mValidator->issueCount();
     bool isOriginatingModel = modelsVisited.size() == 1;
@@ -1093,7 +2344,7 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
         size_t currentIssueCount = mValidator->issueCount();
         if (!isCellmlIdentifier(unitsRef)) {
             auto issue = makeIssueIllegalIdentifier(unitsRef);
-            issue->mPimpl->setDescription("Imported units '" + unitsName + "' does not have a valid units_ref attribute. " + issue->description());
+            issue->mPimpl->setDescription("Imported units '%1' does not have a valid units_ref attribute. %2", {unitsName, issue->description()});
             issue->mPimpl->mItem->mPimpl->setUnits(units);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_UNITS_REF);
             addIssue(issue);
@@ -1142,7 +2393,7 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
                 }
             } else {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Imported units '" + units->name() + "' refers to units '" + unitsRef + "' which does not appear in '" + importSource->url() + "'.");
+                issue->mPimpl->setDescription("Imported units '%1' refers to units '%2' which does not appear in '%3'.", {units->name(), unitsRef, importSource->url()});
                 issue->mPimpl->mItem->mPimpl->setUnits(units);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_UNITS_REF);
                 addIssue(issue);
@@ -1165,10 +2416,10 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
         auto issue = makeIssueIllegalIdentifier(unitsName);
         issue->mPimpl->mItem->mPimpl->setUnits(units);
         if (units->isImport()) {
-            issue->mPimpl->setDescription("Imported units '" + unitsName + "' does not have a valid name attribute. " + issue->description());
+            issue->mPimpl->setDescription("Imported units '%1' does not have a valid name attribute. %2", {unitsName, issue->description()});
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::IMPORT_UNITS_NAME);
         } else {
-            issue->mPimpl->setDescription("Units '" + unitsName + "' does not have a valid name attribute. " + issue->description());
+            issue->mPimpl->setDescription("Units '%1' does not have a valid name attribute. %2", {unitsName, issue->description()});
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNITS_NAME);
         }
         addIssue(issue);
@@ -1176,7 +2427,7 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
         // Check for a matching standard units.
         if (isStandardUnitName(unitsName)) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Units is named '" + unitsName + "' which is a protected standard unit name.");
+            issue->mPimpl->setDescription("Units is named '%1' which is a protected standard unit name.", {unitsName});
             issue->mPimpl->mItem->mPimpl->setUnits(units);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNITS_STANDARD);
             addIssue(issue);
@@ -1191,7 +2442,7 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
         if (units->isImport()) {
             descriptionStart = "Imported units";
         }
-        issue->mPimpl->setDescription(descriptionStart + " '" + unitsName + "' does not have a valid 'id' attribute, '" + units->id() + "'.");
+        issue->mPimpl->setDescription("%1 '%2' does not have a valid 'id' attribute, '%3'.", {descriptionStart, unitsName, units->id()});
         addIssue(issue);
     }
 
@@ -1202,6 +2453,23 @@ void Validator::ValidatorImpl::validateUnits(const UnitsPtr &units, History &his
         }
         history.pop_back();
     }
+    // Check for a cycle of units, which is reported once, for the first units
+    // of the model that is part of it.
+    auto cycle = unitsGraph(mUnitsGraphs, model).cycle(units);
+    if (!cycle.empty()) {
+        std::string description;
+        for (const auto &cycleUnits : cycle) {
+            if (!description.empty()) {
+                description += " -> ";
+            }
+            description += "'" + cycleUnits->name() + "'";
+        }
+        auto issue = Issue::IssueImpl::create();
+        issue->mPimpl->setDescription("Cyclic units exist: %1.", {description});
+        issue->mPimpl->mItem->mPimpl->setUnits(units);
+        issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNIT_CIRCULAR_REF);
+        addIssue(issue);
+    }
 
     handleErrorsFromImports(initialIssueCount, isOriginatingModel, "Units", unitsName, history, nullptr, units);
 }
@@ -1219,17 +2487,24 @@ void Validator::ValidatorImpl::validateUnitsUnitsItem(size_t index, const UnitsP
     if (isCellmlIdentifier(reference)) {
         ModelPtr model = owningModel(units);
         if (model->hasUnits(reference) && !isStandardUnitName(reference)) {
-            validateUnits(model->units(reference), history, modelsVisited);
+            // The units of the originating model are all validated in turn, but
+            // those of an imported model only get validated through the units
+            // that depend on them.  A dependency within a cycle of units is not
+            // followed, since the cycle is reported on its own.
+            auto dependency = model->units(reference);
+            if ((modelsVisited.size() > 1) && !unitsGraph(mUnitsGraphs, model).isCyclicDependency(units, dependency)) {
+                validateUnits(dependency, history, modelsVisited);
+            }
         } else if (!model->hasUnits(reference) && !isStandardUnitName(reference)) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Units reference '" + reference + "' in units '" + units->name() + "' is not a valid reference to a local units or a standard unit type.");
+            issue->mPimpl->setDescription("Units reference '%1' in units '%2' is not a valid reference to a local units or a standard unit type.", {reference, units->name()});
             issue->mPimpl->mItem->mPimpl->setUnitsItem(UnitsItem::create(units, index));
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNIT_UNITS_REF);
             addIssue(issue);
         }
     } else {
         auto issue = makeIssueIllegalIdentifier(reference);
-        issue->mPimpl->setDescription("Unit in units '" + units->name() + "' does not have a valid units reference. The reference given is '" + reference + "'. " + issue->description());
+        issue->mPimpl->setDescription("Unit in units '%1' does not have a valid units reference. The reference given is '%2'. %3", {units->name(), reference, issue->description()});
         issue->mPimpl->mItem->mPimpl->setUnitsItem(UnitsItem::create(units, index));
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNIT_UNITS_REF);
         addIssue(issue);
@@ -1239,14 +2514,14 @@ void Validator::ValidatorImpl::validateUnitsUnitsItem(size_t index, const UnitsP
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setUnitsItem(UnitsItem::create(units, index));
-        issue->mPimpl->setDescription("Unit in units '" + units->name() + "' does not have a valid 'id' attribute, '" + units->id() + "'.");
+        issue->mPimpl->setDescription("Unit in units '%1' does not have a valid 'id' attribute, '%2'.", {units->name(), units->id()});
         addIssue(issue);
     }
     if (!prefix.empty()) {
         if (!isStandardPrefixName(prefix)) {
             if (!isCellMLInteger(prefix)) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Prefix '" + prefix + "' of a unit referencing '" + reference + "' in units '" + units->name() + "' is not a valid integer or an SI prefix.");
+                issue->mPimpl->setDescription("Prefix '%1' of a unit referencing '%2' in units '%3' is not a valid integer or an SI prefix.", {prefix, reference, units->name()});
                 issue->mPimpl->mItem->mPimpl->setUnitsItem(UnitsItem::create(units, index));
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNIT_PREFIX);
                 addIssue(issue);
@@ -1256,7 +2531,7 @@ void Validator::ValidatorImpl::validateUnitsUnitsItem(size_t index, const UnitsP
                     (void)test;
                 } catch (std::out_of_range &) {
                     auto issue = Issue::IssueImpl::create();
-                    issue->mPimpl->setDescription("Prefix '" + prefix + "' of a unit referencing '" + reference + "' in units '" + units->name() + "' is out of the integer range.");
+                    issue->mPimpl->setDescription("Prefix '%1' of a unit referencing '%2' in units '%3' is out of the integer range.", {prefix, reference, units->name()});
                     issue->mPimpl->mItem->mPimpl->setUnitsItem(UnitsItem::create(units, index));
                     issue->mPimpl->setReferenceRule(Issue::ReferenceRule::UNIT_PREFIX);
                     addIssue(issue);
@@ -1266,14 +2541,14 @@ void Validator::ValidatorImpl::validateUnitsUnitsItem(size_t index, const UnitsP
     }
 }
 
-void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, const NameList &variableNames)
+void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, const NameSet &variableNames)
 {
     ComponentPtr component = owningComponent(variable);
     auto variableName = variable->name();
     if (!variableName.empty()) {
-        if (std::find(variableNames.begin(), variableNames.end(), variableName) != variableNames.end()) {
+        if (variableNames.count(variableName) > 0) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Component '" + component->name() + "' contains multiple variables with the name '" + variableName + "'. Valid variable names must be unique to their component.");
+            issue->mPimpl->setDescription("Component '%1' contains multiple variables with the name '%2'. Valid variable names must be unique to their component.", {component->name(), variableName});
             issue->mPimpl->mItem->mPimpl->setComponent(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_NAME);
             addIssue(issue);
@@ -1283,7 +2558,7 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
     // Check for a valid name attribute.
     if (!isCellmlIdentifier(variableName)) {
         auto issue = makeIssueIllegalIdentifier(variableName);
-        issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' does not have a valid name attribute. " + issue->description());
+        issue->mPimpl->setDescription("Variable '%1' in component '%2' does not have a valid name attribute. %3", {variableName, component->name(), issue->description()});
         issue->mPimpl->mItem->mPimpl->setVariable(variable);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_NAME);
         addIssue(issue);
@@ -1293,13 +2568,13 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
         auto issue = Issue::IssueImpl::create();
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
         issue->mPimpl->mItem->mPimpl->setVariable(variable);
-        issue->mPimpl->setDescription("Variable '" + variableName + "' does not have a valid 'id' attribute, '" + variable->id() + "'.");
+        issue->mPimpl->setDescription("Variable '%1' does not have a valid 'id' attribute, '%2'.", {variableName, variable->id()});
         addIssue(issue);
     }
     // Check for a valid units attribute.
     if (variable->units() == nullptr) {
         auto issue = Issue::IssueImpl::create();
-        issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' does not have any units specified.");
+        issue->mPimpl->setDescription("Variable '%1' in component '%2' does not have any units specified.", {variableName, component->name()});
         issue->mPimpl->mItem->mPimpl->setVariable(variable);
         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_UNITS);
         addIssue(issue);
@@ -1307,7 +2582,7 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
         std::string unitsName = variable->units()->name();
         if (!isCellmlIdentifier(unitsName)) {
             auto issue = makeIssueIllegalIdentifier(unitsName);
-            issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' does not have a valid units attribute. The attribute given is '" + unitsName + "'. " + issue->description());
+            issue->mPimpl->setDescription("Variable '%1' in component '%2' does not have a valid units attribute. The attribute given is '%3'. %4", {variableName, component->name(), unitsName, issue->description()});
             issue->mPimpl->mItem->mPimpl->setVariable(variable);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_UNITS);
             addIssue(issue);
@@ -1315,7 +2590,7 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
             ModelPtr model = owningModel(component);
             if (!model->hasUnits(unitsName)) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' has a units reference '" + unitsName + "' which is neither standard nor defined in the parent model.");
+                issue->mPimpl->setDescription("Variable '%1' in component '%2' has a units reference '%3' which is neither standard nor defined in the parent model.", {variableName, component->name(), unitsName});
                 issue->mPimpl->mItem->mPimpl->setVariable(variable);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_UNITS);
                 addIssue(issue);
@@ -1327,7 +2602,7 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
         std::string interfaceType = variable->interfaceType();
         if ((interfaceType != "public") && (interfaceType != "private") && (interfaceType != "none") && (interfaceType != "public_and_private")) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' has an invalid interface attribute value '" + interfaceType + "'.");
+            issue->mPimpl->setDescription("Variable '%1' in component '%2' has an invalid interface attribute value '%3'.", {variableName, component->name(), interfaceType});
             issue->mPimpl->mItem->mPimpl->setVariable(variable);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_INTERFACE);
             addIssue(issue);
@@ -1341,7 +2616,7 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
             // Otherwise, check that the initial value can be converted to a double
             if (!isCellMLReal(initialValue)) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Variable '" + variableName + "' in component '" + component->name() + "' has an invalid initial value '" + initialValue + "'. Initial values must be a real number string or a variable reference.");
+                issue->mPimpl->setDescription("Variable '%1' in component '%2' has an invalid initial value '%3'. Initial values must be a real number string or a variable reference.", {variableName, component->name(), initialValue});
                 issue->mPimpl->mItem->mPimpl->setVariable(variable);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::VARIABLE_INITIAL_VALUE);
                 addIssue(issue);
@@ -1491,12 +2766,13 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
 {
     // Parse as XML first.
     std::vector<XmlDocPtr> docs = multiRootXml(input);
+    cacheMathIds(input, docs);
     for (const auto &doc : docs) {
         // Copy any XML parsing issues into the common validator issue handler.
         if (doc->xmlErrorCount() > 0) {
             for (size_t i = 0; i < doc->xmlErrorCount(); ++i) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("LibXml2 error: " + doc->xmlError(i));
+                issue->mPimpl->setDescription("LibXml2 error: %1", {doc->xmlError(i)});
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML);
                 addIssue(issue);
             }
@@ -1504,7 +2780,7 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
         XmlNodePtr node = doc->rootNode();
         if (node == nullptr) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Could not get a valid XML root node from the math on component '" + component->name() + "'.");
+            issue->mPimpl->setDescription("Could not get a valid XML root node from the math on component '%1'.", {component->name()});
             issue->mPimpl->mItem->mPimpl->setComponent(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML);
             addIssue(issue);
@@ -1512,7 +2788,7 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
         }
         if (!node->isMathmlElement("math")) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Math root node is of invalid type '" + node->name() + "' on component '" + component->name() + "'. A valid math root node should be of type 'math'.");
+            issue->mPimpl->setDescription("Math root node is of invalid type '%1' on component '%2'. A valid math root node should be of type 'math'.", {node->name(), component->name()});
             issue->mPimpl->mItem->mPimpl->setComponent(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML);
             addIssue(issue);
@@ -1520,36 +2796,36 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
         }
 
         XmlNodePtr nodeCopy = node;
-        NameList variableNames;
-        for (size_t i = 0; i < component->variableCount(); ++i) {
-            std::string variableName = component->variable(i)->name();
-            if (std::find(variableNames.begin(), variableNames.end(), variableName) == variableNames.end()) {
-                variableNames.push_back(variableName);
-            }
-        }
-
         validateMathMLElements(nodeCopy, component);
 
         // Iterate through ci/cn elements and remove cellml units attributes.
         XmlNodePtr mathNode = node;
-        validateAndCleanMathCiCnNodes(node, component, variableNames);
+        validateAndCleanMathCiCnNodes(node, component);
 
         // Remove the cellml namespace definition.
         if (mathNode->hasNamespaceDefinition(CELLML_2_0_NS)) {
             mathNode->removeNamespaceDefinition(CELLML_2_0_NS);
         }
 
-        // Get the MathML string with cellml:units attributes and namespace already removed.
-        std::string cleanMathml = mathNode->convertToString();
-
-        // Parse/validate the clean math string with the W3C MathML DTD.
-        XmlDocPtr mathmlDoc = std::make_shared<XmlDoc>();
-        mathmlDoc->parseMathML(cleanMathml);
-        // Copy any MathML validation errors into the common validator error handler.
-        if (mathmlDoc->xmlErrorCount() > 0) {
-            for (size_t i = 0; i < mathmlDoc->xmlErrorCount(); ++i) {
+        // Validate the clean math against the W3C MathML DTD, unless we have
+        // been asked not to validate it. By default, this is done natively.
+        // In compatibility mode, the clean math is serialised, and then
+        // parsed and validated using the W3C MathML DTD itself.
+        if (mMathMLDtdValidation) {
+            Strings dtdErrors;
+            if (mMathMLDtdCompatibility) {
+                XmlDocPtr mathmlDoc = std::make_shared<XmlDoc>();
+                mathmlDoc->parseMathML(mathNode->convertToString());
+                for (size_t i = 0; i < mathmlDoc->xmlErrorCount(); ++i) {
+                    dtdErrors.push_back(mathmlDoc->xmlError(i));
+                }
+            } else {
+                dtdErrors = mathmlDtdErrors(mathNode);
+            }
+            // Copy any MathML validation errors into the common validator error handler.
+            for (const auto &dtdError : dtdErrors) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("W3C MathML DTD error: " + mathmlDoc->xmlError(i));
+                issue->mPimpl->setDescription("W3C MathML DTD error: %1", {dtdError});
                 issue->mPimpl->mItem->mPimpl->setMath(component);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_MATHML);
                 addIssue(issue);
@@ -1559,8 +2835,6 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
         // Make sure that the different MathML elements for the right number of
         // children/siblings, type, etc.
 
-        mathNode = mathmlDoc->rootNode();
-
         auto childCount = mathmlChildCount(mathNode);
 
         for (size_t i = 0; i < childCount; ++i) {
@@ -1576,7 +2850,7 @@ bool Validator::ValidatorImpl::validateCnUnits(const ComponentPtr &component, co
     }
 
     IssuePtr issue = makeIssueIllegalIdentifier(unitsName);
-    issue->mPimpl->setDescription("Math cn element with the value '" + textNode + "' does not have a valid cellml:units attribute. " + issue->description());
+    issue->mPimpl->setDescription("Math cn element with the value '%1' does not have a valid cellml:units attribute. %2", {textNode, issue->description()});
     issue->mPimpl->mItem->mPimpl->setMath(component);
     issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_CN_UNITS);
     addIssue(issue);
@@ -1610,7 +2884,7 @@ void Validator::ValidatorImpl::validateAndCleanCnNode(const XmlNodePtr &node, co
             } else if (attribute->inNamespaceUri(CELLML_2_0_NS)) {
                 cellmlAttributesToRemove.push_back(attribute);
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Math " + node->name() + " element has an invalid attribute type '" + attribute->name() + "' in the cellml namespace. Attribute 'units' is the only CellML namespace attribute allowed.");
+                issue->mPimpl->setDescription("Math %1 element has an invalid attribute type '%2' in the cellml namespace. Attribute 'units' is the only CellML namespace attribute allowed.", {node->name(), attribute->name()});
                 issue->mPimpl->mItem->mPimpl->setMath(component);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_MATHML);
                 addIssue(issue);
@@ -1632,7 +2906,7 @@ void Validator::ValidatorImpl::validateAndCleanCnNode(const XmlNodePtr &node, co
             // Check for a matching standard units.
             if (!isStandardUnitName(unitsName)) {
                 auto issue = Issue::IssueImpl::create();
-                issue->mPimpl->setDescription("Math has a " + node->name() + " element with a cellml:units attribute '" + unitsName + "' that is not a valid reference to units in the model '" + model->name() + "' or a standard unit.");
+                issue->mPimpl->setDescription("Math has a %1 element with a cellml:units attribute '%2' that is not a valid reference to units in the model '%3' or a standard unit.", {node->name(), unitsName, model->name()});
                 issue->mPimpl->mItem->mPimpl->setMath(component);
                 issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_CN_UNITS);
                 addIssue(issue);
@@ -1650,15 +2924,15 @@ void Validator::ValidatorImpl::validateAndCleanCnNode(const XmlNodePtr &node, co
     }
 }
 
-void Validator::ValidatorImpl::validateAndCleanCiNode(const XmlNodePtr &node, const ComponentPtr &component, const NameList &variableNames)
+void Validator::ValidatorImpl::validateAndCleanCiNode(const XmlNodePtr &node, const ComponentPtr &component)
 {
     XmlNodePtr childNode = node->firstChild();
     std::string textInNode = text(childNode);
     if (!textInNode.empty()) {
         // Check whether we can find this text as a variable name in this component.
-        if (std::find(variableNames.begin(), variableNames.end(), textInNode) == variableNames.end()) {
+        if (!component->hasVariable(textInNode)) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("MathML ci element has the child text '" + textInNode + "' which does not correspond with any variable names present in component '" + component->name() + "'.");
+            issue->mPimpl->setDescription("MathML ci element has the child text '%1' which does not correspond with any variable names present in component '%2'.", {textInNode, component->name()});
             issue->mPimpl->mItem->mPimpl->setMath(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_CI_VARIABLE_REF);
             addIssue(issue);
@@ -1666,22 +2940,22 @@ void Validator::ValidatorImpl::validateAndCleanCiNode(const XmlNodePtr &node, co
     }
 }
 
-void Validator::ValidatorImpl::validateAndCleanMathCiCnNodes(XmlNodePtr &node, const ComponentPtr &component, const NameList &variableNames)
+void Validator::ValidatorImpl::validateAndCleanMathCiCnNodes(XmlNodePtr &node, const ComponentPtr &component)
 {
     if (node->isMathmlElement("cn")) {
         validateAndCleanCnNode(node, component);
     } else if (node->isMathmlElement("ci")) {
-        validateAndCleanCiNode(node, component, variableNames);
+        validateAndCleanCiNode(node, component);
     }
     // Check children for ci/cn.
     XmlNodePtr childNode = node->firstChild();
     if (childNode != nullptr) {
-        validateAndCleanMathCiCnNodes(childNode, component, variableNames);
+        validateAndCleanMathCiCnNodes(childNode, component);
     }
     // Check siblings for ci/cn.
     node = node->next();
     if (node != nullptr) {
-        validateAndCleanMathCiCnNodes(node, component, variableNames);
+        validateAndCleanMathCiCnNodes(node, component);
     }
 }
 
@@ -1691,7 +2965,7 @@ void Validator::ValidatorImpl::validateMathMLElements(const XmlNodePtr &node, co
     if (childNode != nullptr) {
         if (!childNode->isComment() && !childNode->isText() && !isSupportedMathMLElement(childNode)) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Math has a '" + childNode->name() + "' element that is not a supported MathML element.");
+            issue->mPimpl->setDescription("Math has a '%1' element that is not a supported MathML element.", {childNode->name()});
             issue->mPimpl->mItem->mPimpl->setMath(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_CHILD);
             addIssue(issue);
@@ -1703,7 +2977,7 @@ void Validator::ValidatorImpl::validateMathMLElements(const XmlNodePtr &node, co
     if (nextNode != nullptr) {
         if (!nextNode->isComment() && !nextNode->isText() && !isSupportedMathMLElement(nextNode)) {
             auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setDescription("Math has a '" + nextNode->name() + "' element that is not a supported MathML element.");
+            issue->mPimpl->setDescription("Math has a '%1' element that is not a supported MathML element.", {nextNode->name()});
             issue->mPimpl->mItem->mPimpl->setMath(component);
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::MATH_CHILD);
             addIssue(issue);
@@ -2291,7 +3565,7 @@ void Validator::ValidatorImpl::validateVariableInterface(const VariablePtr &vari
                     std::string equivalentComponentName = equivalentComponent->name();
 
                     IssuePtr err = Issue::IssueImpl::create();
-                    err->mPimpl->setDescription("The equivalence between '" + variable->name() + "' in component '" + componentName + "'  and '" + equivalentVariable->name() + "' in component '" + equivalentComponentName + "' is invalid. Component '" + componentName + "' and '" + equivalentComponentName + "' are neither siblings nor in a parent/child relationship.");
+                    err->mPimpl->setDescription("The equivalence between '%1' in component '%2'  and '%3' in component '%4' is invalid. Component '%2' and '%4' are neither siblings nor in a parent/child relationship.", {variable->name(), componentName, equivalentVariable->name(), equivalentComponentName});
                     err->mPimpl->mItem->mPimpl->setMapVariables(variable, equivalentVariable);
                     err->mPimpl->setReferenceRule(Issue::ReferenceRule::MAP_VARIABLES_AVAILABLE_INTERFACE);
                     addIssue(err);
@@ -2303,9 +3577,9 @@ void Validator::ValidatorImpl::validateVariableInterface(const VariablePtr &vari
         if (!interfaceTypeIsCompatible(interfaceType, interfaceTypeString)) {
             IssuePtr err = Issue::IssueImpl::create();
             if (interfaceTypeString.empty()) {
-                err->mPimpl->setDescription("Variable '" + variable->name() + "' in component '" + componentName + "' has no interface type set. The interface type required is '" + interfaceTypeToString.find(interfaceType)->second + "'.");
+                err->mPimpl->setDescription("Variable '%1' in component '%2' has no interface type set. The interface type required is '%3'.", {variable->name(), componentName, interfaceTypeToString.find(interfaceType)->second});
             } else {
-                err->mPimpl->setDescription("Variable '" + variable->name() + "' in component '" + componentName + "' has an interface type set to '" + interfaceTypeString + "' which is not the correct interface type for this variable. The interface type required is '" + interfaceTypeToString.find(interfaceType)->second + "'.");
+                err->mPimpl->setDescription("Variable '%1' in component '%2' has an interface type set to '%3' which is not the correct interface type for this variable. The interface type required is '%4'.", {variable->name(), componentName, interfaceTypeString, interfaceTypeToString.find(interfaceType)->second});
             }
             err->mPimpl->mItem->mPimpl->setVariable(variable);
             err->mPimpl->setReferenceRule(Issue::ReferenceRule::MAP_VARIABLES_AVAILABLE_INTERFACE);
@@ -2348,7 +3622,7 @@ void Validator::ValidatorImpl::validateEquivalenceUnits(const ModelPtr &model, c
                 VariablePairPtr pair = VariablePair::create(variable, equivalentVariable);
                 alreadyReported.push_back(pair);
                 IssuePtr err = Issue::IssueImpl::create();
-                err->mPimpl->setDescription("Variable '" + variable->name() + "' in component '" + parentComponent->name() + "' has units of '" + variable->units()->name() + "' and an equivalent variable '" + equivalentVariable->name() + "' in component '" + equivalentComponent->name() + "' with non-matching units of '" + equivalentVariable->units()->name() + "'. The mismatch is: " + hints);
+                err->mPimpl->setDescription("Variable '%1' in component '%2' has units of '%3' and an equivalent variable '%4' in component '%5' with non-matching units of '%6'. The mismatch is: %7", {variable->name(), parentComponent->name(), variable->units()->name(), equivalentVariable->name(), equivalentComponent->name(), equivalentVariable->units()->name(), hints});
                 err->mPimpl->mItem->mPimpl->setMapVariables(variable, equivalentVariable);
                 err->mPimpl->setReferenceRule(Issue::ReferenceRule::MAP_VARIABLES_IDENTICAL_UNIT_REDUCTION);
                 addIssue(err);
@@ -2364,7 +3638,7 @@ void Validator::ValidatorImpl::validateEquivalenceStructure(const VariablePtr &v
         auto component = owningComponent(equivalentVariable);
         if (component == nullptr) {
             IssuePtr err = Issue::IssueImpl::create();
-            err->mPimpl->setDescription("Variable '" + equivalentVariable->name() + "' is an equivalent variable to '" + variable->name() + "' but '" + equivalentVariable->name() + "' has no parent component.");
+            err->mPimpl->setDescription("Variable '%1' is an equivalent variable to '%2' but '%1' has no parent component.", {equivalentVariable->name(), variable->name()});
             err->mPimpl->mItem->mPimpl->setMapVariables(variable, equivalentVariable);
             err->mPimpl->setReferenceRule(Issue::ReferenceRule::MAP_VARIABLES_VARIABLE1);
             addIssue(err);
@@ -2383,7 +3657,16 @@ void Validator::ValidatorImpl::validateConnections(const ModelPtr &model)
         findAllVariablesWithEquivalences(model->component(index), variables);
     }
 
+    if (mIncremental && (mMaximumErrorCount == 0)) {
+        validateConnectionsIncrementally(model, variables);
+
+        return;
+    }
+
     for (const VariablePtr &variable : variables) {
+        if (hasReachedMaximumErrorCount()) {
+            break;
+        }
         auto parentComponent = owningComponent(variable);
         if (parentComponent->isImport()) {
             continue;
@@ -2394,6 +3677,108 @@ void Validator::ValidatorImpl::validateConnections(const ModelPtr &model)
     }
 }
 
+void Validator::ValidatorImpl::validateConnectionsIncrementally(const ModelPtr &model, const VariablePtrs &variables)
+{
+    // Split our variables into equivalence networks, keeping track of the
+    // revisions of the entities that the validation of a network depends on,
+    // i.e. the variables in the network, their component and their units.
+    // Note: the issues about the variables of a network only depend on the
+    //       variables that come before them in the same network, so each
+    //       network can be validated on its own.
+
+    std::map<const Variable *, size_t> networkIndices;
+    std::vector<std::vector<size_t>> networkVariableIndices;
+    std::vector<EntityRevisions> networkRevisions;
+
+    for (size_t i = 0; i < variables.size(); ++i) {
+        const auto &variable = variables[i];
+
+        if (networkIndices.count(variable.get()) == 0) {
+            auto networkIndex = networkVariableIndices.size();
+            VariablePtrs networkVariables = {variable};
+            EntityRevisions revisions;
+
+            networkIndices[variable.get()] = networkIndex;
+
+            for (size_t j = 0; j < networkVariables.size(); ++j) {
+                auto networkVariable = networkVariables[j];
+                auto parent = networkVariable->parent();
+                auto units = networkVariable->units();
+
+                revisions.emplace_back(networkVariable.get(), revision(networkVariable));
+                revisions.emplace_back(parent.get(), revision(parent));
+                revisions.emplace_back(units.get(), revision(units));
+
+                for (size_t k = 0; k < networkVariable->equivalentVariableCount(); ++k) {
+                    auto equivalentVariable = networkVariable->equivalentVariable(k);
+
+                    if (networkIndices.count(equivalentVariable.get()) == 0) {
+                        networkIndices[equivalentVariable.get()] = networkIndex;
+                        networkVariables.push_back(equivalentVariable);
+                    }
+                }
+            }
+
+            networkVariableIndices.emplace_back();
+            networkRevisions.push_back(revisions);
+            mEquivalenceNetworkRevisions.insert(mEquivalenceNetworkRevisions.end(), revisions.begin(), revisions.end());
+        }
+
+        networkVariableIndices[networkIndices[variable.get()]].push_back(i);
+    }
+
+    // Validate the networks that have been modified and reuse the issues of
+    // the others, before logging the issues in variable order.
+
+    auto issues = mIssues;
+    std::vector<std::vector<IssuePtr>> variableIssues(variables.size());
+
+    for (size_t i = 0; i < networkVariableIndices.size(); ++i) {
+        const auto &variableIndices = networkVariableIndices[i];
+        auto &cachedValidation = mCachedEquivalenceNetworkValidations[variables[variableIndices.front()].get()];
+
+        if (cachedValidation.mEntityRevisions != networkRevisions[i]) {
+            VariableMap interfaceErrorsAlreadyReported;
+            VariableMap equivalentUnitErrorsAlreadyReported;
+
+            cachedValidation.mEntityRevisions = networkRevisions[i];
+            cachedValidation.mVariableIssues.clear();
+
+            for (auto variableIndex : variableIndices) {
+                const auto &variable = variables[variableIndex];
+
+                removeStoredIssues();
+
+                if (!owningComponent(variable)->isImport()) {
+                    validateVariableInterface(variable, interfaceErrorsAlreadyReported);
+                    validateEquivalenceUnits(model, variable, equivalentUnitErrorsAlreadyReported);
+                    validateEquivalenceStructure(variable);
+                }
+
+                cachedValidation.mVariableIssues.push_back(mIssues);
+            }
+        }
+
+        cachedValidation.mValidationCount = mValidationCount;
+
+        for (size_t j = 0; j < variableIndices.size(); ++j) {
+            variableIssues[variableIndices[j]] = cachedValidation.mVariableIssues[j];
+        }
+    }
+
+    removeStoredIssues();
+
+    for (const auto &issue : issues) {
+        addIssue(issue);
+    }
+
+    for (const auto &issuesOfVariable : variableIssues) {
+        for (const auto &issue : issuesOfVariable) {
+            addIssue(issue);
+        }
+    }
+}
+
 bool Validator::ValidatorImpl::isSupportedMathMLElement(const XmlNodePtr &node) const
 {
     return (node->namespaceUri() == MATHML_NS)
@@ -2538,41 +3923,43 @@ void Validator::ValidatorImpl::checkUniqueIds(const ModelPtr &model)
 {
     auto idMap = buildModelIdMap(model);
 
-    for (const auto &id : idMap) {
-        if (id.second.first > 1) {
-            auto desc = "Duplicated identifier attribute '" + id.first + "' has been found in:\n";
-            size_t i = 0;
-            size_t iMax = id.second.second.size();
-            for (const auto &item : id.second.second) {
-                desc += item;
-                ++i;
-                if (i < iMax - 1) {
-                    desc += ";\n";
-                } else if (i == iMax - 1) {
-                    desc += "; and\n";
-                } else { /* i == iMax */
-                    desc += ".\n";
-                }
+    for (const auto &id : idMap.ids(true)) {
+        const auto &items = idMap.items(id);
+        auto desc = "Duplicated identifier attribute '" + id + "' has been found in:\n";
+        size_t i = 0;
+        size_t iMax = items.size();
+        for (const auto &item : items) {
+            desc += item;
+            ++i;
+            if (i < iMax - 1) {
+                desc += ";\n";
+            } else if (i == iMax - 1) {
+                desc += "; and\n";
+            } else { /* i == iMax */
+                desc += ".\n";
             }
-            auto issue = Issue::IssueImpl::create();
-            issue->mPimpl->setReferenceRule(Issue::ReferenceRule::DATA_REPR_IDENTIFIER_IDENTICAL);
-            issue->mPimpl->setDescription(desc);
-            issue->mPimpl->mItem->mPimpl->setModel(model);
-            addIssue(issue);
         }
+        auto issue = Issue::IssueImpl::create();
+        issue->mPimpl->setReferenceRule(Issue::ReferenceRule::DATA_REPR_IDENTIFIER_IDENTICAL);
+        issue->mPimpl->setDescription(desc);
+        issue->mPimpl->mItem->mPimpl->setModel(model);
+        addIssue(issue);
+    }
+
+    // Forget about the identifiers of math that is no longer in the model.
+
+    for (auto it = mCachedMathIds.begin(); it != mCachedMathIds.end();) {
+        it = (it->second.mValidationCount != mValidationCount) ? mCachedMathIds.erase(it) : std::next(it);
     }
 }
 
 void Validator::ValidatorImpl::addIdMapItem(const std::string &id, const std::string &info, IdMap &idMap)
 {
-    if (idMap.count(id) > 0) {
-        idMap[id].second.emplace_back(info);
-        idMap[id] = std::make_pair(idMap[id].first + 1, idMap[id].second);
-    } else {
-        Strings infos;
-        infos.emplace_back(info);
-        idMap.emplace(id, std::make_pair(1, infos));
+    if (!mUniqueIdValidation) {
+        return;
     }
+
+    idMap.add(id, info);
 }
 
 IdMap Validator::ValidatorImpl::buildModelIdMap(const ModelPtr &model)
@@ -2621,7 +4008,7 @@ IdMap Validator::ValidatorImpl::buildModelIdMap(const ModelPtr &model)
             auto issue = Issue::IssueImpl::create();
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
             issue->mPimpl->mItem->mPimpl->setModel(model);
-            issue->mPimpl->setDescription("Model '" + model->name() + "' does not have a valid encapsulation 'id' attribute, '" + model->encapsulationId() + "'.");
+            issue->mPimpl->setDescription("Model '%1' does not have a valid encapsulation 'id' attribute, '%2'.", {model->name(), model->encapsulationId()});
             addIssue(issue);
         }
 
@@ -2682,7 +4069,7 @@ void Validator::ValidatorImpl::buildComponentIdMap(const ComponentPtr &component
                         auto issue = Issue::IssueImpl::create();
                         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
                         issue->mPimpl->mItem->mPimpl->setMapVariables(item, equiv);
-                        issue->mPimpl->setDescription("Variable equivalence " + mappingDescription + ", does not have a valid map_variables 'id' attribute, '" + mappingId + "'.");
+                        issue->mPimpl->setDescription("Variable equivalence %1, does not have a valid map_variables 'id' attribute, '%2'.", {mappingDescription, mappingId});
                         addIssue(issue);
                     }
 
@@ -2702,7 +4089,7 @@ void Validator::ValidatorImpl::buildComponentIdMap(const ComponentPtr &component
                         auto issue = Issue::IssueImpl::create();
                         issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
                         issue->mPimpl->mItem->mPimpl->setConnection(item, equiv);
-                        issue->mPimpl->setDescription("Connection " + connectionDescription + ", does not have a valid connection 'id' attribute, '" + connectionId + "'.");
+                        issue->mPimpl->setDescription("Connection %1, does not have a valid connection 'id' attribute, '%2'.", {connectionDescription, connectionId});
                         addIssue(issue);
                     }
 
@@ -2752,7 +4139,7 @@ void Validator::ValidatorImpl::buildComponentIdMap(const ComponentPtr &component
             auto issue = Issue::IssueImpl::create();
             issue->mPimpl->setReferenceRule(Issue::ReferenceRule::XML_ID_ATTRIBUTE);
             issue->mPimpl->mItem->mPimpl->setComponent(component);
-            issue->mPimpl->setDescription("Component '" + component->name() + "' does not have a valid encapsulation 'id' attribute, '" + component->encapsulationId() + "'.");
+            issue->mPimpl->setDescription("Component '%1' does not have a valid encapsulation 'id' attribute, '%2'.", {component->name(), component->encapsulationId()});
             addIssue(issue);
         }
 
@@ -2768,23 +4155,55 @@ void Validator::ValidatorImpl::buildComponentIdMap(const ComponentPtr &component
 
 void Validator::ValidatorImpl::buildMathIdMap(const std::string &infoRef, IdMap &idMap, const std::string &input)
 {
-    std::vector<XmlDocPtr> docs = multiRootXml(input);
+    if (!mUniqueIdValidation) {
+        // The identifiers in math are only needed to check that identifiers
+        // are unique, so there is no need to parse it.
 
-    for (const auto &doc : docs) {
-        XmlNodePtr node = doc->rootNode();
-        if (node == nullptr) {
-            return;
-        }
-        if (!node->isMathmlElement("math")) {
-            continue;
+        return;
+    }
+
+    auto cachedMathIds = mCachedMathIds.find(input);
+    if (cachedMathIds == mCachedMathIds.end()) {
+        cacheMathIds(input, multiRootXml(input));
+        cachedMathIds = mCachedMathIds.find(input);
+    }
+
+    cachedMathIds->second.mValidationCount = mValidationCount;
+
+    for (const auto &mathId : cachedMathIds->second.mIds) {
+        addIdMapItem(mathId.first, " - " + mathId.second + "in " + infoRef, idMap);
+    }
+}
+
+void Validator::ValidatorImpl::cacheMathIds(const std::string &input, const std::vector<XmlDocPtr> &docs)
+{
+    if (!mUniqueIdValidation) {
+        return;
+    }
+
+    // Note: the identifiers found in some math only depend on that math, so
+    //       they never need to be collected again.
+
+    auto cachedMathIds = mCachedMathIds.emplace(input, CachedMathIds());
+
+    cachedMathIds.first->second.mValidationCount = mValidationCount;
+
+    if (cachedMathIds.second) {
+        for (const auto &doc : docs) {
+            XmlNodePtr node = doc->rootNode();
+            if (node == nullptr) {
+                return;
+            }
+            if (!node->isMathmlElement("math")) {
+                continue;
+            }
+            collectMathIds(node, cachedMathIds.first->second.mIds);
         }
-        buildMathChildIdMap(node, infoRef, idMap);
     }
 }
 
-void Validator::ValidatorImpl::buildMathChildIdMap(const XmlNodePtr &node, const std::string &infoRef, IdMap &idMap)
+void Validator::ValidatorImpl::collectMathIds(const XmlNodePtr &node, MathIds &mathIds)
 {
-    std::string info;
     XmlAttributePtr attribute = node->firstAttribute();
     while (attribute != nullptr) {
         if (attribute->isType("id")) {
@@ -2794,14 +4213,13 @@ void Validator::ValidatorImpl::buildMathChildIdMap(const XmlNodePtr &node, const
                     variable = "'" + node->firstChild()->convertToString() + "' ";
                 }
             }
-            info = " - MathML " + node->name() + " element " + variable + "in " + infoRef;
-            addIdMapItem(attribute->value(), info, idMap);
+            mathIds.emplace_back(attribute->value(), "MathML " + node->name() + " element " + variable);
         }
         attribute = attribute->next();
     }
     XmlNodePtr childNode = node->firstChild();
     while (childNode != nullptr) {
-        buildMathChildIdMap(childNode, infoRef, idMap);
+        collectMathIds(childNode, mathIds);
         childNode = childNode->next();
     }
 }
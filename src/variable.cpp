@@ -142,6 +142,8 @@ void Variable::removeAllEquivalences()
         }
     }
     pFunc()->mEquivalentVariables.clear();
+
+    EntityImpl::markModified(this);
 }
 
 VariablePtr Variable::equivalentVariable(size_t index) const
@@ -253,6 +255,7 @@ bool Variable::VariableImpl::setEquivalentTo(const VariablePtr &equivalentVariab
     if (!hasEquivalentVariable(equivalentVariable)) {
         VariableWeakPtr weakEquivalentVariable = equivalentVariable;
         mEquivalentVariables.push_back(weakEquivalentVariable);
+        markModified(mVariable);
         return true;
     }
 
@@ -274,6 +277,7 @@ bool Variable::VariableImpl::unsetEquivalentTo(const VariablePtr &equivalentVari
         if (connectionIdResult != mConnectionIdMap.end()) {
             mConnectionIdMap.erase(connectionIdResult);
         }
+        markModified(mVariable);
         status = true;
     }
 
@@ -284,6 +288,7 @@ void Variable::VariableImpl::setEquivalentMappingId(const VariablePtr &equivalen
 {
     VariableWeakPtr weakEquivalentVariable = equivalentVariable;
     mMappingIdMap[weakEquivalentVariable] = id;
+    markModified(mVariable);
 }
 
 std::string Variable::VariableImpl::equivalentMappingId(const VariablePtr &equivalentVariable) const
@@ -298,6 +303,7 @@ void Variable::VariableImpl::setEquivalentConnectionId(const VariablePtr &equiva
 {
     VariableWeakPtr weakEquivalentVariable = equivalentVariable;
     mConnectionIdMap[weakEquivalentVariable] = id;
+    markModified(mVariable);
 }
 
 std::string Variable::VariableImpl::equivalentConnectionId(const VariablePtr &equivalentVariable) const
@@ -311,16 +317,22 @@ std::string Variable::VariableImpl::equivalentConnectionId(const VariablePtr &eq
 void Variable::setUnits(const std::string &name)
 {
     pFunc()->mUnits = Units::create(name);
+
+    EntityImpl::markModified(this);
 }
 
 void Variable::setUnits(const UnitsPtr &units)
 {
     pFunc()->mUnits = units;
+
+    EntityImpl::markModified(this);
 }
 
 void Variable::removeUnits()
 {
     pFunc()->mUnits = nullptr;
+
+    EntityImpl::markModified(this);
 }
 
 UnitsPtr Variable::units() const
@@ -331,16 +343,22 @@ UnitsPtr Variable::units() const
 void Variable::setInitialValue(const std::string &initialValue)
 {
     pFunc()->mInitialValue = initialValue;
+
+    EntityImpl::markModified(this);
 }
 
 void Variable::setInitialValue(double initialValue)
 {
     pFunc()->mInitialValue = convertToString(initialValue);
+
+    EntityImpl::markModified(this);
 }
 
 void Variable::setInitialValue(const VariablePtr &variable)
 {
     pFunc()->mInitialValue = variable->name();
+
+    EntityImpl::markModified(this);
 }
 
 std::string Variable::initialValue() const
@@ -351,11 +369,15 @@ std::string Variable::initialValue() const
 void Variable::removeInitialValue()
 {
     pFunc()->mInitialValue.clear();
+
+    EntityImpl::markModified(this);
 }
 
 void Variable::setInterfaceType(const std::string &interfaceType)
 {
     pFunc()->mInterfaceType = interfaceType;
+
+    EntityImpl::markModified(this);
 }
 
 void Variable::setInterfaceType(Variable::InterfaceType interfaceType)
@@ -371,6 +393,8 @@ std::string Variable::interfaceType() const
 void Variable::removeInterfaceType()
 {
     pFunc()->mInterfaceType.clear();
+
+    EntityImpl::markModified(this);
 }
 
 bool Variable::hasInterfaceType(InterfaceType interfaceType) const
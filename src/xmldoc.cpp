@@ -19,6 +19,7 @@ limitations under the License.
 #include <cstring>
 #include <libxml/tree.h>
 #include <libxml/xmlerror.h>
+#include <mutex>
 #include <regex>
 #include <sstream>
 #include <string>
@@ -52,6 +53,47 @@ void structuredErrorCallback(void *userData, xmlErrorPtr error)
     doc->addXmlError(errorString);
 }
 
+/**
+ * @brief The mutex and the number of documents being parsed.
+ *
+ * The libxml2 parser is initialised before parsing a document and cleaned up
+ * once it has been parsed. However, cleaning up the parser while a document is
+ * being parsed in another thread is not safe, so the parser is only cleaned up
+ * once no document is being parsed anymore.
+ */
+std::mutex parserMutex;
+size_t parsedDocumentCount = 0;
+
+/**
+ * @brief Initialise the libxml2 parser.
+ *
+ * Initialise the libxml2 parser and keep track of the number of documents being
+ * parsed.
+ */
+void initialiseParser()
+{
+    std::lock_guard<std::mutex> lock(parserMutex);
+
+    ++parsedDocumentCount;
+
+    xmlInitParser();
+}
+
+/**
+ * @brief Clean up the libxml2 parser.
+ *
+ * Clean up the libxml2 parser, if no other document is being parsed.
+ */
+void cleanUpParser()
+{
+    std::lock_guard<std::mutex> lock(parserMutex);
+
+    if (--parsedDocumentCount == 0) {
+        xmlCleanupParser();
+        xmlCleanupGlobals();
+    }
+}
+
 /**
  * @brief The XmlDoc::XmlDocImpl struct.
  *
@@ -81,15 +123,14 @@ XmlDoc::~XmlDoc()
 
 void XmlDoc::parse(const std::string &input)
 {
-    xmlInitParser();
+    initialiseParser();
     xmlParserCtxtPtr context = xmlNewParserCtxt();
     context->_private = reinterpret_cast<void *>(this);
     xmlSetStructuredErrorFunc(context, structuredErrorCallback);
     mPimpl->mXmlDocPtr = xmlCtxtReadDoc(context, reinterpret_cast<const xmlChar *>(input.c_str()), "/", nullptr, 0);
     xmlFreeParserCtxt(context);
     xmlSetStructuredErrorFunc(nullptr, nullptr);
-    xmlCleanupParser();
-    xmlCleanupGlobals();
+    cleanUpParser();
 }
 
 std::string decompressMathMLDTD()
@@ -110,13 +151,9 @@ void XmlDoc::parseMathML(const std::string &input)
     // Decompress the MathML DTD.
     int sizeMathmlDTDUncompressed = MATHML_DTD_LEN;
 
-    static std::string mathMLDTD;
+    static const std::string mathMLDTD = decompressMathMLDTD();
 
-    if (mathMLDTD.empty()) {
-        mathMLDTD = decompressMathMLDTD();
-    }
-
-    xmlInitParser();
+    initialiseParser();
     xmlParserCtxtPtr context = xmlNewParserCtxt();
     context->_private = reinterpret_cast<void *>(this);
     xmlSetStructuredErrorFunc(context, structuredErrorCallback);
@@ -128,8 +165,7 @@ void XmlDoc::parseMathML(const std::string &input)
     xmlFreeDtd(dtd);
     xmlFreeParserCtxt(context);
     xmlSetStructuredErrorFunc(nullptr, nullptr);
-    xmlCleanupParser();
-    xmlCleanupGlobals();
+    cleanUpParser();
 }
 
 std::string XmlDoc::prettyPrint() const
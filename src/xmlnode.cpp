@@ -61,6 +61,14 @@ std::string XmlNode::namespaceUri() const
     return reinterpret_cast<const char *>(mPimpl->mXmlNodePtr->ns->href);
 }
 
+std::string XmlNode::namespacePrefix() const
+{
+    if ((mPimpl->mXmlNodePtr->ns == nullptr) || (mPimpl->mXmlNodePtr->ns->prefix == nullptr)) {
+        return {};
+    }
+    return reinterpret_cast<const char *>(mPimpl->mXmlNodePtr->ns->prefix);
+}
+
 void XmlNode::addNamespaceDefinition(const std::string &uri, const std::string &prefix)
 {
     xmlNsPtr nsPtr = xmlNewNs(mPimpl->mXmlNodePtr, reinterpret_cast<const xmlChar *>(uri.c_str()), reinterpret_cast<const xmlChar *>(prefix.c_str()));
@@ -222,6 +230,11 @@ bool XmlNode::isComment() const
     return mPimpl->mXmlNodePtr->type == XML_COMMENT_NODE;
 }
 
+bool XmlNode::isBlank() const
+{
+    return isText() && (xmlIsBlankNode(mPimpl->mXmlNodePtr) == 1);
+}
+
 std::string XmlNode::name() const
 {
     return reinterpret_cast<const char *>(mPimpl->mXmlNodePtr->name);
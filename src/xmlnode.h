@@ -63,6 +63,16 @@ public:
      */
     std::string namespaceUri() const;
 
+    /**
+     * @brief Get the namespace prefix of the XML element.
+     *
+     * Get the namespace prefix of the XML element. If the XML element is in
+     * the default namespace or in no namespace, returns an empty string.
+     *
+     * @return A @c std::string representation of the XML namespace prefix.
+     */
+    std::string namespacePrefix() const;
+
     /**
      * @brief Add a namespace definition to this XML element.
      *
@@ -279,6 +289,17 @@ public:
      */
     bool isComment() const;
 
+    /**
+     * @brief Check if this @c XmlNode is a blank text node.
+     *
+     * Checks whether this @c XmlNode is a text node that only contains
+     * whitespace characters. Returns @c true if so, and @c false otherwise.
+     *
+     * @return @c true if this @c XmlNode is a blank text node and @c false
+     * otherwise.
+     */
+    bool isBlank() const;
+
     /**
      * @brief Get the name of the XML element.
      *
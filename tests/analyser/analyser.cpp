@@ -971,3 +971,192 @@ TEST(Analyser, overconstrainedNlaSystem)
 
     EXPECT_EQ(libcellml::AnalyserModel::Type::OVERCONSTRAINED, analyser->model()->type());
 }
+
+TEST(Analyser, gatingVariables)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/gating_variables/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    const std::map<std::string, bool> expectedGatingVariables = {
+        {"a", true},
+        {"b", true},
+        {"c", true},
+        {"d", false},
+        {"e", false},
+        {"f", false},
+    };
+    auto analyserModel = analyser->model();
+
+    EXPECT_EQ(expectedGatingVariables.size(), analyserModel->stateCount());
+
+    for (const auto &state : analyserModel->states()) {
+        EXPECT_EQ(expectedGatingVariables.at(state->variable()->name()), state->isGatingVariable());
+    }
+
+    for (const auto &variable : analyserModel->variables()) {
+        EXPECT_FALSE(variable->isGatingVariable());
+    }
+}
+
+TEST(Analyser, gatingVariablesInHodgkinHuxleySquidAxonModel1952)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+
+    EXPECT_FALSE(analyserModel->state(0)->isGatingVariable());
+    EXPECT_TRUE(analyserModel->state(1)->isGatingVariable());
+    EXPECT_TRUE(analyserModel->state(2)->isGatingVariable());
+    EXPECT_TRUE(analyserModel->state(3)->isGatingVariable());
+}
+
+TEST(Analyser, lookupTableStatesInHodgkinHuxleySquidAxonModel1952)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    const std::vector<std::string> expectedTabulatedVariables = {
+        "alpha_m",
+        "beta_m",
+        "alpha_h",
+        "beta_h",
+        "alpha_n",
+        "beta_n",
+    };
+    auto analyserModel = analyser->model();
+
+    for (const auto &equation : analyserModel->equations()) {
+        if ((equation->variableCount() == 1)
+            && (std::find(expectedTabulatedVariables.begin(), expectedTabulatedVariables.end(), equation->variable(0)->variable()->name()) != expectedTabulatedVariables.end())) {
+            EXPECT_EQ(analyserModel->state(0), equation->lookupTableState());
+        } else {
+            EXPECT_EQ(nullptr, equation->lookupTableState());
+        }
+    }
+}
+
+TEST(Analyser, noLookupTableStateForEquationDependingOnConstant)
+{
+    // alpha_m depends on a constant rather than on a literal, so it must not be
+    // tabulated since its lookup table would otherwise go stale should the
+    // value of that constant change.
+
+    auto modelContents = fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml");
+
+    modelContents.replace(modelContents.find("<variable name=\"alpha_m\""), 0, "<variable initial_value=\"0.1\" name=\"k\" units=\"per_millivolt_millisecond\"/>\n");
+    const std::string literal = "<cn cellml:units=\"per_millivolt_millisecond\">0.1</cn>";
+
+    modelContents.replace(modelContents.find(literal), literal.size(), "<ci>k</ci>");
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(modelContents);
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    size_t tabulatedEquationCount = 0;
+
+    for (const auto &equation : analyserModel->equations()) {
+        if (equation->lookupTableState() != nullptr) {
+            EXPECT_NE("alpha_m", equation->variable(0)->variable()->name());
+
+            ++tabulatedEquationCount;
+        }
+    }
+
+    EXPECT_EQ(size_t(5), tabulatedEquationCount);
+}
+
+TEST(Analyser, issueStreaming)
+{
+    auto parser = libcellml::Parser::create();
+    auto analyser = libcellml::Analyser::create();
+    std::vector<libcellml::IssuePtr> streamedIssues;
+    size_t maximumStreamedIssueCount = 0;
+
+    analyser->setIssueCallback([&](const libcellml::IssuePtr &issue) {
+        streamedIssues.push_back(issue);
+
+        return (maximumStreamedIssueCount == 0) || (streamedIssues.size() < maximumStreamedIssueCount);
+    });
+
+    // Check that the validation issues get streamed, in the same order as
+    // those of a full analysis, and that cancelling their streaming stops the
+    // validation.
+
+    auto model = parser->parseModel(fileContents("annotator/invalid_ids_on_every_element.cellml"));
+    auto fullAnalyser = libcellml::Analyser::create();
+
+    fullAnalyser->analyseModel(model);
+
+    EXPECT_LT(size_t(1), fullAnalyser->issueCount());
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(fullAnalyser->issueCount(), streamedIssues.size());
+    EXPECT_EQ(fullAnalyser->issueCount(), analyser->issueCount());
+
+    for (size_t i = 0; i < std::min(fullAnalyser->issueCount(), streamedIssues.size()); ++i) {
+        EXPECT_EQ(fullAnalyser->issue(i)->description(), streamedIssues[i]->description());
+        EXPECT_EQ(streamedIssues[i], analyser->issue(i));
+    }
+
+    maximumStreamedIssueCount = 1;
+
+    streamedIssues.clear();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(1), streamedIssues.size());
+    EXPECT_EQ(fullAnalyser->issue(0)->description(), streamedIssues[0]->description());
+    EXPECT_LT(analyser->issueCount(), fullAnalyser->issueCount());
+    EXPECT_EQ(libcellml::AnalyserModel::Type::INVALID, analyser->model()->type());
+
+    // Check that cancelling the streaming of issues stops the analysis.
+
+    model = parser->parseModel(fileContents("analyser/units/ci.cellml"));
+
+    fullAnalyser->analyseModel(model);
+
+    EXPECT_LT(size_t(1), fullAnalyser->warningCount());
+    EXPECT_NE(libcellml::AnalyserModel::Type::UNKNOWN, fullAnalyser->model()->type());
+
+    streamedIssues.clear();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(1), streamedIssues.size());
+    EXPECT_EQ(fullAnalyser->issue(0)->description(), streamedIssues[0]->description());
+    EXPECT_EQ(libcellml::AnalyserModel::Type::UNKNOWN, analyser->model()->type());
+}
@@ -0,0 +1,186 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <libcellml>
+
+static bool isAcyclic(const libcellml::AnalyserModelPtr &analyserModel)
+{
+    // Check, using Kahn's algorithm, that the dependency structure of the
+    // equations is a directed acyclic graph.
+
+    auto rowOffsets = analyserModel->equationDependencyRowOffsets();
+    auto columnIndices = analyserModel->equationDependencyColumnIndices();
+    auto equationCount = analyserModel->equationCount();
+    std::vector<size_t> remainingDependencyCounts(equationCount);
+    std::vector<size_t> readyEquations;
+    size_t processedEquationCount = 0;
+
+    for (size_t i = 0; i < equationCount; ++i) {
+        remainingDependencyCounts[i] = rowOffsets[i + 1] - rowOffsets[i];
+
+        if (remainingDependencyCounts[i] == 0) {
+            readyEquations.push_back(i);
+        }
+    }
+
+    while (!readyEquations.empty()) {
+        auto equation = readyEquations.back();
+
+        readyEquations.pop_back();
+
+        ++processedEquationCount;
+
+        for (size_t i = 0; i < equationCount; ++i) {
+            for (auto j = rowOffsets[i]; j < rowOffsets[i + 1]; ++j) {
+                if ((columnIndices[j] == equation) && (--remainingDependencyCounts[i] == 0)) {
+                    readyEquations.push_back(i);
+                }
+            }
+        }
+    }
+
+    return processedEquationCount == equationCount;
+}
+
+TEST(AnalyserModel, jacobianSparsityPattern)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    const std::vector<size_t> expectedRowOffsets = {0, 4, 6, 8, 10};
+    const std::vector<size_t> expectedColumnIndices = {0, 1, 2, 3, 0, 1, 0, 2, 0, 3};
+
+    EXPECT_EQ(size_t(10), analyserModel->jacobianNonZeroCount());
+    EXPECT_EQ(expectedRowOffsets, analyserModel->jacobianRowOffsets());
+    EXPECT_EQ(expectedColumnIndices, analyserModel->jacobianColumnIndices());
+
+    auto stateDependencies = analyserModel->stateDependencies(2);
+
+    EXPECT_EQ(size_t(2), stateDependencies.size());
+    EXPECT_EQ(analyserModel->state(0), stateDependencies[0]);
+    EXPECT_EQ(analyserModel->state(2), stateDependencies[1]);
+
+    EXPECT_EQ(size_t(0), analyserModel->stateDependencies(4).size());
+}
+
+TEST(AnalyserModel, jacobianSparsityPatternWithExternalVariable)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+    auto externalVariable = libcellml::AnalyserExternalVariable::create(model->component("potassium_channel_n_gate")->variable("alpha_n"));
+
+    externalVariable->addDependency(model->component("sodium_channel_m_gate")->variable("m"));
+
+    analyser->addExternalVariable(externalVariable);
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    const std::vector<size_t> expectedRowOffsets = {0, 4, 6, 8, 11};
+    const std::vector<size_t> expectedColumnIndices = {0, 1, 2, 3, 0, 1, 0, 2, 0, 2, 3};
+
+    EXPECT_EQ(expectedRowOffsets, analyserModel->jacobianRowOffsets());
+    EXPECT_EQ(expectedColumnIndices, analyserModel->jacobianColumnIndices());
+}
+
+TEST(AnalyserModel, equationDependencyStructure)
+{
+    auto parser = libcellml::Parser::create();
+    auto analyser = libcellml::Analyser::create();
+
+    for (const auto &fileName : {"generator/algebraic_system_with_various_dependencies/model.not.ordered.cellml",
+                                 "generator/hodgkin_huxley_squid_axon_model_1952/model.cellml",
+                                 "generator/noble_model_1962/model.cellml",
+                                 "generator/robertson_model_1966/model.dae.cellml",
+                                 "generator/fabbri_fantini_wilders_severi_human_san_model_2017/model.cellml"}) {
+        auto model = parser->parseModel(fileContents(fileName));
+
+        EXPECT_EQ(size_t(0), parser->issueCount());
+
+        analyser->analyseModel(model);
+
+        EXPECT_EQ(size_t(0), analyser->errorCount());
+
+        auto analyserModel = analyser->model();
+        auto rowOffsets = analyserModel->equationDependencyRowOffsets();
+        auto columnIndices = analyserModel->equationDependencyColumnIndices();
+
+        EXPECT_EQ(analyserModel->equationCount() + 1, rowOffsets.size());
+        EXPECT_EQ(columnIndices.size(), rowOffsets.back());
+
+        for (size_t i = 0; i < analyserModel->equationCount(); ++i) {
+            for (auto j = rowOffsets[i]; j < rowOffsets[i + 1]; ++j) {
+                auto dependency = analyserModel->equation(columnIndices[j]);
+
+                EXPECT_NE(libcellml::AnalyserEquation::Type::ODE, dependency->type());
+                EXPECT_NE(i, columnIndices[j]);
+            }
+        }
+
+        EXPECT_TRUE(isAcyclic(analyserModel));
+
+        // The row offsets of our Jacobian must be consistent with our states.
+
+        auto jacobianRowOffsets = analyserModel->jacobianRowOffsets();
+
+        EXPECT_EQ(analyserModel->stateCount() + 1, jacobianRowOffsets.size());
+        EXPECT_EQ(analyserModel->jacobianNonZeroCount(), jacobianRowOffsets.back());
+    }
+}
+
+TEST(AnalyserModel, referenceAccessors)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    auto analyserModel = analyser->model();
+
+    EXPECT_EQ(analyserModel->states(), analyserModel->statesRef());
+    EXPECT_EQ(analyserModel->variables(), analyserModel->variablesRef());
+    EXPECT_EQ(analyserModel->equations(), analyserModel->equationsRef());
+    EXPECT_EQ(&analyserModel->statesRef(), &analyserModel->statesRef());
+
+    analyser->analyseModel(parser->parseModel(fileContents("invalid_cellml_2.0.xml")));
+
+    analyserModel = analyser->model();
+
+    EXPECT_FALSE(analyserModel->isValid());
+    EXPECT_TRUE(analyserModel->statesRef().empty());
+    EXPECT_TRUE(analyserModel->variablesRef().empty());
+    EXPECT_TRUE(analyserModel->equationsRef().empty());
+}
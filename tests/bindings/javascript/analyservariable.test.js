@@ -56,6 +56,10 @@ describe("Analyser Variable tests", () => {
         const av = am.variable(10)
         expect(av.variable().name()).toBe("alpha_m")
     });
+    test('Checking Analyser Variable isGatingVariable.', () => {
+        expect(am.state(0).isGatingVariable()).toBe(false)
+        expect(am.state(1).isGatingVariable()).toBe(true)
+    });
     test('Checking Analyser Equation equationCount.', () => {
         const av = am.variable(14)
         expect(av.equationCount()).toBe(1)
@@ -50,6 +50,114 @@ describe("Generator tests", () => {
         expect(g.model()).toBeDefined()
         expect(g.model().stateCount()).toBe(1)
     })
+    test('Checking Generator lookup table manipulation.', () => {
+        const g = new libcellml.Generator()
+        const p = new libcellml.Parser(true)
+
+        m = p.parseModel(basicModel)
+
+        const v = m.componentByIndex(0).variableByIndex(0)
+
+        expect(g.lookupTableCount()).toBe(0)
+        expect(g.addLookupTable(v, 0.0, 1.0, 0.1)).toBe(true)
+        expect(g.addLookupTable(v, 0.0, 1.0, 0.1)).toBe(false)
+        expect(g.containsLookupTable(v)).toBe(true)
+        expect(g.lookupTableCount()).toBe(1)
+        expect(g.removeLookupTable(v)).toBe(true)
+        expect(g.removeLookupTable(v)).toBe(false)
+
+        g.addLookupTable(v, 0.0, 1.0, 0.1)
+        g.removeAllLookupTables()
+
+        expect(g.lookupTableCount()).toBe(0)
+    })
+    test('Checking Generator constant specialisation.', () => {
+        const g = new libcellml.Generator()
+        const p = new libcellml.Parser(true)
+
+        m = p.parseModel(basicModel)
+
+        const v = m.componentByIndex(0).variableByIndex(0)
+
+        expect(g.hasConstantSpecialisation()).toBe(false)
+        g.setConstantSpecialisation(true)
+        expect(g.hasConstantSpecialisation()).toBe(true)
+
+        expect(g.constantOverrideCount()).toBe(0)
+        expect(g.addConstantOverride(v, 2.0)).toBe(true)
+        expect(g.addConstantOverride(v, 3.0)).toBe(false)
+        expect(g.containsConstantOverride(v)).toBe(true)
+        expect(g.constantOverrideCount()).toBe(1)
+        expect(g.removeConstantOverride(v)).toBe(true)
+        expect(g.removeConstantOverride(v)).toBe(false)
+
+        g.addConstantOverride(v, 2.0)
+        g.removeAllConstantOverrides()
+
+        expect(g.constantOverrideCount()).toBe(0)
+    })
+    test('Checking Generator ensemble parameters.', () => {
+        const g = new libcellml.Generator()
+        const p = new libcellml.Parser(true)
+
+        m = p.parseModel(basicModel)
+
+        const v = m.componentByIndex(0).variableByIndex(0)
+
+        expect(g.ensembleParameterCount()).toBe(0)
+        expect(g.addEnsembleParameter(v)).toBe(true)
+        expect(g.addEnsembleParameter(v)).toBe(false)
+        expect(g.containsEnsembleParameter(v)).toBe(true)
+        expect(g.ensembleParameterCount()).toBe(1)
+        expect(g.removeEnsembleParameter(v)).toBe(true)
+        expect(g.removeEnsembleParameter(v)).toBe(false)
+
+        g.addEnsembleParameter(v)
+        g.removeAllEnsembleParameters()
+
+        expect(g.ensembleParameterCount()).toBe(0)
+    })
+    test('Checking Generator sensitivity parameters.', () => {
+        const g = new libcellml.Generator()
+        const p = new libcellml.Parser(true)
+
+        m = p.parseModel(basicModel)
+
+        const v = m.componentByIndex(0).variableByIndex(0)
+
+        expect(g.sensitivityParameterCount()).toBe(0)
+        expect(g.addSensitivityParameter(v)).toBe(true)
+        expect(g.addSensitivityParameter(v)).toBe(false)
+        expect(g.containsSensitivityParameter(v)).toBe(true)
+        expect(g.sensitivityParameterCount()).toBe(1)
+        expect(g.removeSensitivityParameter(v)).toBe(true)
+        expect(g.removeSensitivityParameter(v)).toBe(false)
+
+        g.addSensitivityParameter(v)
+        g.removeAllSensitivityParameters()
+
+        expect(g.sensitivityParameterCount()).toBe(0)
+    })
+    test('Checking Generator implementation chunks.', () => {
+        const g = new libcellml.Generator()
+        const p = new libcellml.Parser(true)
+
+        m = p.parseModel(basicModel)
+        a = new libcellml.Analyser()
+
+        a.analyseModel(m)
+
+        g.setModel(a.model())
+
+        expect(g.implementationChunkCount()).toBe(0)
+        expect(g.implementationChunkCode(0)).toBe('')
+
+        g.setImplementationChunkCount(2)
+
+        expect(g.implementationChunkCount()).toBe(2)
+        expect(g.implementationChunkCode(0)).not.toBe('')
+        expect(g.implementationChunkCode(2)).toBe('')
+    })
     test('Checking Generator code generation.', () => {
         const g = new libcellml.Generator()
         const p = new libcellml.Parser(true)
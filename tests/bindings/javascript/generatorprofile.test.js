@@ -29,6 +29,28 @@ describe("GeneratorProfile tests", () => {
     x.setProfile(libcellml.GeneratorProfile.Profile.PYTHON)
     expect(x.profile()).toBe(libcellml.GeneratorProfile.Profile.PYTHON)
     expect(libcellml.GeneratorProfile.profileAsString(x.profile())).toBe("python")
+
+    x.setProfile(libcellml.GeneratorProfile.Profile.CPP)
+    expect(x.profile()).toBe(libcellml.GeneratorProfile.Profile.CPP)
+    expect(libcellml.GeneratorProfile.profileAsString(x.profile())).toBe("cpp")
+
+    x.setProfile(libcellml.GeneratorProfile.Profile.NUMPY)
+    expect(x.profile()).toBe(libcellml.GeneratorProfile.Profile.NUMPY)
+    expect(libcellml.GeneratorProfile.profileAsString(x.profile())).toBe("numpy")
+  });
+  test("Checking GeneratorProfile.precision.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+    expect(x.precision()).toBe(libcellml.GeneratorProfile.Precision.DOUBLE)
+    expect(libcellml.GeneratorProfile.precisionAsString(x.precision())).toBe("double")
+
+    x.setPrecision(libcellml.GeneratorProfile.Precision.SINGLE)
+    expect(x.precision()).toBe(libcellml.GeneratorProfile.Precision.SINGLE)
+    expect(libcellml.GeneratorProfile.precisionAsString(x.precision())).toBe("single")
+    expect(x.exponentialString()).toBe("expf")
+
+    x.setPrecision(libcellml.GeneratorProfile.Precision.MIXED)
+    expect(x.precision()).toBe(libcellml.GeneratorProfile.Precision.MIXED)
+    expect(libcellml.GeneratorProfile.precisionAsString(x.precision())).toBe("mixed")
   });
   test("Checking GeneratorProfile.hasInterface.", () => {
     const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
@@ -36,6 +58,24 @@ describe("GeneratorProfile tests", () => {
     x.setHasInterface(true)
     expect(x.hasInterface()).toBe(true)
   });
+  test("Checking GeneratorProfile.hasComputeRushLarsenCoefficientsMethod.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setHasComputeRushLarsenCoefficientsMethod(true)
+    expect(x.hasComputeRushLarsenCoefficientsMethod()).toBe(true)
+  });
+  test("Checking GeneratorProfile.hasLocalVariablesInComputeRates.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setHasLocalVariablesInComputeRates(true)
+    expect(x.hasLocalVariablesInComputeRates()).toBe(true)
+  });
+  test("Checking GeneratorProfile.hasIntegrateMethods.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setHasIntegrateMethods(true)
+    expect(x.hasIntegrateMethods()).toBe(true)
+  });
   test("Checking GeneratorProfile.equalityString.", () => {
     const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
 
@@ -474,6 +514,12 @@ describe("GeneratorProfile tests", () => {
     x.setNanString("something")
     expect(x.nanString()).toBe("something")
   });
+  test("Checking GeneratorProfile.literalSuffixString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setLiteralSuffixString("something")
+    expect(x.literalSuffixString()).toBe("something")
+  });
   test("Checking GeneratorProfile.eqFunctionString.", () => {
     const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
 
@@ -648,6 +694,24 @@ describe("GeneratorProfile tests", () => {
     x.setImplementationHeaderString("something")
     expect(x.implementationHeaderString()).toBe("something")
   });
+  test("Checking GeneratorProfile.namespaceString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setNamespaceString("something")
+    expect(x.namespaceString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationNamespaceBeginString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationNamespaceBeginString("something")
+    expect(x.implementationNamespaceBeginString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationNamespaceEndString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationNamespaceEndString("something")
+    expect(x.implementationNamespaceEndString()).toBe("something")
+  });
   test("Checking GeneratorProfile.interfaceVersionString.", () => {
     const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
 
@@ -696,6 +760,18 @@ describe("GeneratorProfile tests", () => {
     x.setImplementationVariableCountString("something")
     expect(x.implementationVariableCountString()).toBe("something")
   });
+  test("Checking GeneratorProfile.interfaceEnsembleParameterCountString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceEnsembleParameterCountString("something")
+    expect(x.interfaceEnsembleParameterCountString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationEnsembleParameterCountString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationEnsembleParameterCountString("something")
+    expect(x.implementationEnsembleParameterCountString()).toBe("something")
+  });
   test("Checking GeneratorProfile.variableTypeObjectString.", () => {
     const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
 
@@ -879,6 +955,102 @@ describe("GeneratorProfile tests", () => {
     x.setVariablesArrayString("something")
     expect(x.variablesArrayString()).toBe("something")
   });
+  test("Checking GeneratorProfile.rushLarsenTausArrayString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setRushLarsenTausArrayString("something")
+    expect(x.rushLarsenTausArrayString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.rushLarsenSteadyStatesArrayString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setRushLarsenSteadyStatesArrayString("something")
+    expect(x.rushLarsenSteadyStatesArrayString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.localVariableNameString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setLocalVariableNameString("something")
+    expect(x.localVariableNameString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.localVariableDeclarationString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setLocalVariableDeclarationString("something")
+    expect(x.localVariableDeclarationString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.forwardEulerStateUpdateString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setForwardEulerStateUpdateString("something")
+    expect(x.forwardEulerStateUpdateString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.rushLarsenStateUpdateString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setRushLarsenStateUpdateString("something")
+    expect(x.rushLarsenStateUpdateString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.sensitivityNameString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setSensitivityNameString("something")
+    expect(x.sensitivityNameString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.chunkMethodNameString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setChunkMethodNameString("something")
+    expect(x.chunkMethodNameString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.lookupTableDeclarationString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setLookupTableDeclarationString("something")
+    expect(x.lookupTableDeclarationString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.lookupTableEntryString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setLookupTableEntryString("something")
+    expect(x.lookupTableEntryString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.lookupTableValueCallString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setLookupTableValueCallString("something")
+    expect(x.lookupTableValueCallString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.lookupTableErrorString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setLookupTableErrorString("something")
+    expect(x.lookupTableErrorString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.lookupTableValueMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setLookupTableValueMethodString("something")
+    expect(x.lookupTableValueMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.lookupTableInitialisationString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setLookupTableInitialisationString("something")
+    expect(x.lookupTableInitialisationString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.ensembleOpenmpPragmaString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setEnsembleOpenmpPragmaString("something")
+    expect(x.ensembleOpenmpPragmaString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.ensembleParameterAssignmentString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setEnsembleParameterAssignmentString("something")
+    expect(x.ensembleParameterAssignmentString()).toBe("something")
+  });
   test("Checking GeneratorProfile.externalVariableMethodTypeDefinitionString.", () => {
     const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
 
@@ -993,6 +1165,108 @@ describe("GeneratorProfile tests", () => {
     x.setImplementationComputeRatesMethodString(true, "something")
     expect(x.implementationComputeRatesMethodString(true)).toBe("something")
   });
+  test("Checking GeneratorProfile.interfaceComputeRushLarsenCoefficientsMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceComputeRushLarsenCoefficientsMethodString("something")
+    expect(x.interfaceComputeRushLarsenCoefficientsMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationComputeRushLarsenCoefficientsMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationComputeRushLarsenCoefficientsMethodString("something")
+    expect(x.implementationComputeRushLarsenCoefficientsMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationComputeRatesMethodWithLocalVariablesString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationComputeRatesMethodWithLocalVariablesString("something")
+    expect(x.implementationComputeRatesMethodWithLocalVariablesString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceInitialiseLookupTablesMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceInitialiseLookupTablesMethodString("something")
+    expect(x.interfaceInitialiseLookupTablesMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationInitialiseLookupTablesMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationInitialiseLookupTablesMethodString("something")
+    expect(x.implementationInitialiseLookupTablesMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceInitialiseEnsembleMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceInitialiseEnsembleMethodString("something")
+    expect(x.interfaceInitialiseEnsembleMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationInitialiseEnsembleMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationInitialiseEnsembleMethodString("something")
+    expect(x.implementationInitialiseEnsembleMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceComputeEnsembleRatesMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceComputeEnsembleRatesMethodString("something")
+    expect(x.interfaceComputeEnsembleRatesMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationComputeEnsembleRatesMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationComputeEnsembleRatesMethodString("something")
+    expect(x.implementationComputeEnsembleRatesMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceComputeEnsembleVariablesMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceComputeEnsembleVariablesMethodString("something")
+    expect(x.interfaceComputeEnsembleVariablesMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationComputeEnsembleVariablesMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationComputeEnsembleVariablesMethodString("something")
+    expect(x.implementationComputeEnsembleVariablesMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceIntegrateForwardEulerMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceIntegrateForwardEulerMethodString("something")
+    expect(x.interfaceIntegrateForwardEulerMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationIntegrateForwardEulerMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationIntegrateForwardEulerMethodString("something")
+    expect(x.implementationIntegrateForwardEulerMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceIntegrateRk4MethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceIntegrateRk4MethodString("something")
+    expect(x.interfaceIntegrateRk4MethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationIntegrateRk4MethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationIntegrateRk4MethodString("something")
+    expect(x.implementationIntegrateRk4MethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.interfaceIntegrateRushLarsenMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setInterfaceIntegrateRushLarsenMethodString("something")
+    expect(x.interfaceIntegrateRushLarsenMethodString()).toBe("something")
+  });
+  test("Checking GeneratorProfile.implementationIntegrateRushLarsenMethodString.", () => {
+    const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
+
+    x.setImplementationIntegrateRushLarsenMethodString("something")
+    expect(x.implementationIntegrateRushLarsenMethodString()).toBe("something")
+  });
   test("Checking GeneratorProfile.interfaceComputeVariablesMethodString.", () => {
     const x = new libcellml.GeneratorProfile(libcellml.GeneratorProfile.Profile.C)
 
@@ -33,6 +33,88 @@ describe("Validator tests", () => {
 
     expect(x.issueCount()).toBe(0)
 
+    x.delete()
+  });
+  test("Checking Validator thread count.", () => {
+    const x = new libcellml.Validator()
+    const p = new libcellml.Parser(true)
+
+    expect(x.threadCount()).toBe(1)
+
+    x.setThreadCount(4)
+
+    expect(x.threadCount()).toBe(4)
+
+    const m = p.parseModel(sineModel)
+
+    x.validateModel(m)
+
+    expect(x.issueCount()).toBe(0)
+
+    x.delete()
+  });
+  test("Checking Validator incremental.", () => {
+    const x = new libcellml.Validator()
+    const p = new libcellml.Parser(true)
+
+    expect(x.isIncremental()).toBe(false)
+
+    x.setIncremental(true)
+
+    expect(x.isIncremental()).toBe(true)
+
+    const m = p.parseModel(sineModel)
+
+    x.validateModel(m)
+
+    expect(x.issueCount()).toBe(0)
+
+    x.validateModel(m)
+
+    expect(x.issueCount()).toBe(0)
+
+    x.delete()
+  });
+  test("Checking Validator bounded validation.", () => {
+    const x = new libcellml.Validator()
+    const p = new libcellml.Parser(true)
+
+    expect(x.maximumErrorCount()).toBe(0)
+    expect(x.hasMathMLDtdValidation()).toBe(true)
+    expect(x.hasUniqueIdValidation()).toBe(true)
+
+    x.setMaximumErrorCount(1)
+    x.setHasMathMLDtdValidation(false)
+    x.setHasUniqueIdValidation(false)
+
+    expect(x.maximumErrorCount()).toBe(1)
+    expect(x.hasMathMLDtdValidation()).toBe(false)
+    expect(x.hasUniqueIdValidation()).toBe(false)
+
+    const m = p.parseModel(sineModel)
+
+    x.validateModel(m)
+
+    expect(x.issueCount()).toBe(0)
+
+    x.delete()
+  });
+  test("Checking Validator MathML DTD compatibility.", () => {
+    const x = new libcellml.Validator()
+    const p = new libcellml.Parser(true)
+
+    expect(x.hasMathMLDtdCompatibility()).toBe(false)
+
+    x.setHasMathMLDtdCompatibility(true)
+
+    expect(x.hasMathMLDtdCompatibility()).toBe(true)
+
+    const m = p.parseModel(sineModel)
+
+    x.validateModel(m)
+
+    expect(x.issueCount()).toBe(0)
+
     x.delete()
   });
 })
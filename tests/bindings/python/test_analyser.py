@@ -160,6 +160,7 @@ class AnalyserTestCase(unittest.TestCase):
         self.assertEqual(3, av.index())
         self.assertIsNotNone(av.initialisingVariable())
         self.assertIsNotNone(av.variable())
+        self.assertFalse(av.isGatingVariable())
         self.assertEqual(1, av.equationCount())
         self.assertIsNotNone(av.equations())
         self.assertIsNone(av.equation(0))
@@ -180,6 +181,7 @@ class AnalyserTestCase(unittest.TestCase):
         self.assertIsNotNone(ae.nlaSiblings())
         self.assertIsNone(ae.nlaSibling(0))
         self.assertTrue(ae.isStateRateBased())
+        self.assertIsNone(ae.lookupTableState())
         self.assertEqual(1, ae.variableCount())
         self.assertIsNotNone(ae.variables())
         self.assertIsNotNone(ae.variable(0))
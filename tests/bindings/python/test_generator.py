@@ -55,6 +55,133 @@ class GeneratorTestCase(unittest.TestCase):
         self.assertEqual("x = a", Generator.equationCode(am.equation(0).ast()))
         self.assertEqual("x = a", Generator_equationCode(am.equation(0).ast()))
 
+    def test_lookup_tables(self):
+        from libcellml import Generator
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+        v = m.component('membrane').variable('V')
+
+        g = Generator()
+
+        self.assertEqual(0, g.lookupTableCount())
+        self.assertTrue(g.addLookupTable(v, -100.0, 100.0, 0.01))
+        self.assertFalse(g.addLookupTable(v, -100.0, 100.0, 0.01))
+        self.assertTrue(g.containsLookupTable(v))
+        self.assertEqual(1, g.lookupTableCount())
+        self.assertTrue(g.removeLookupTable(v))
+        self.assertFalse(g.removeLookupTable(v))
+
+        g.addLookupTable(v, -100.0, 100.0, 0.01)
+        g.removeAllLookupTables()
+
+        self.assertEqual(0, g.lookupTableCount())
+
+    def test_constant_specialisation(self):
+        from libcellml import Generator
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+        v = m.component('membrane').variable('Cm')
+
+        g = Generator()
+
+        self.assertFalse(g.hasConstantSpecialisation())
+        g.setConstantSpecialisation(True)
+        self.assertTrue(g.hasConstantSpecialisation())
+
+        self.assertEqual(0, g.constantOverrideCount())
+        self.assertTrue(g.addConstantOverride(v, 2.0))
+        self.assertFalse(g.addConstantOverride(v, 3.0))
+        self.assertTrue(g.containsConstantOverride(v))
+        self.assertEqual(1, g.constantOverrideCount())
+        self.assertTrue(g.removeConstantOverride(v))
+        self.assertFalse(g.removeConstantOverride(v))
+
+        g.addConstantOverride(v, 2.0)
+        g.removeAllConstantOverrides()
+
+        self.assertEqual(0, g.constantOverrideCount())
+
+    def test_ensemble_parameters(self):
+        from libcellml import Generator
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+        v = m.component('membrane').variable('Cm')
+
+        g = Generator()
+
+        self.assertEqual(0, g.ensembleParameterCount())
+        self.assertTrue(g.addEnsembleParameter(v))
+        self.assertFalse(g.addEnsembleParameter(v))
+        self.assertTrue(g.containsEnsembleParameter(v))
+        self.assertEqual(1, g.ensembleParameterCount())
+        self.assertTrue(g.removeEnsembleParameter(v))
+        self.assertFalse(g.removeEnsembleParameter(v))
+
+        g.addEnsembleParameter(v)
+        g.removeAllEnsembleParameters()
+
+        self.assertEqual(0, g.ensembleParameterCount())
+
+    def test_sensitivity_parameters(self):
+        from libcellml import Generator
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+        v = m.component('membrane').variable('Cm')
+
+        g = Generator()
+
+        self.assertEqual(0, g.sensitivityParameterCount())
+        self.assertTrue(g.addSensitivityParameter(v))
+        self.assertFalse(g.addSensitivityParameter(v))
+        self.assertTrue(g.containsSensitivityParameter(v))
+        self.assertEqual(1, g.sensitivityParameterCount())
+        self.assertTrue(g.removeSensitivityParameter(v))
+        self.assertFalse(g.removeSensitivityParameter(v))
+
+        g.addSensitivityParameter(v)
+        g.removeAllSensitivityParameters()
+
+        self.assertEqual(0, g.sensitivityParameterCount())
+
+    def test_implementation_chunks(self):
+        from libcellml import Analyser
+        from libcellml import Generator
+        from libcellml import Parser
+        from test_resources import file_contents
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+        a = Analyser()
+
+        a.analyseModel(m)
+
+        g = Generator()
+
+        g.setModel(a.model())
+
+        self.assertEqual(0, g.implementationChunkCount())
+        self.assertEqual('', g.implementationChunkCode(0))
+
+        g.setImplementationChunkCount(2)
+
+        self.assertEqual(2, g.implementationChunkCount())
+        self.assertEqual(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.chunks.c'), g.implementationCode())
+        self.assertEqual(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.chunks.chunk0.c'), g.implementationChunkCode(0))
+        self.assertEqual(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.chunks.chunk1.c'), g.implementationChunkCode(1))
+        self.assertEqual('', g.implementationChunkCode(2))
+
 
 if __name__ == '__main__':
     unittest.main()
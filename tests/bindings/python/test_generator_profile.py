@@ -33,6 +33,35 @@ class GeneratorProfileTestCase(unittest.TestCase):
         pp = GeneratorProfile(GeneratorProfile.Profile.PYTHON)
         self.assertEqual(GeneratorProfile.Profile.PYTHON, pp.profile())
 
+        # Create a C++ profile.
+        cp = GeneratorProfile(GeneratorProfile.Profile.CPP)
+        self.assertEqual(GeneratorProfile.Profile.CPP, cp.profile())
+        self.assertEqual("cpp", GeneratorProfile.profileAsString(cp.profile()))
+        self.assertFalse(cp.hasInterface())
+
+        # Create a NumPy profile.
+        npp = GeneratorProfile(GeneratorProfile.Profile.NUMPY)
+        self.assertEqual(GeneratorProfile.Profile.NUMPY, npp.profile())
+        self.assertEqual("numpy", GeneratorProfile.profileAsString(npp.profile()))
+        self.assertEqual("numpy.exp", npp.exponentialString())
+
+    def test_precision(self):
+        from libcellml import GeneratorProfile
+
+        p = GeneratorProfile()
+        self.assertEqual(GeneratorProfile.Precision.DOUBLE, p.precision())
+        self.assertEqual("double", GeneratorProfile.precisionAsString(p.precision()))
+
+        p.setPrecision(GeneratorProfile.Precision.SINGLE)
+        self.assertEqual(GeneratorProfile.Precision.SINGLE, p.precision())
+        self.assertEqual("single", GeneratorProfile.precisionAsString(p.precision()))
+        self.assertEqual("expf", p.exponentialString())
+
+        p.setPrecision(GeneratorProfile.Precision.MIXED)
+        self.assertEqual(GeneratorProfile.Precision.MIXED, p.precision())
+        self.assertEqual("mixed", GeneratorProfile.precisionAsString(p.precision()))
+        self.assertEqual("exp", p.exponentialString())
+
     @unittest.skip('Create tests script')
     def test_create_tests(self):
         import re
@@ -783,6 +812,158 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setImplementationComputeRatesMethodString(True, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeRatesMethodString(True))
 
+    def test_implementation_compute_rush_larsen_coefficients_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual(
+            'void computeRushLarsenCoefficients(double voi, double *states, double *variables, double *taus, double *yInfs)\n{\n[CODE]}\n',
+            g.implementationComputeRushLarsenCoefficientsMethodString())
+        g.setImplementationComputeRushLarsenCoefficientsMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeRushLarsenCoefficientsMethodString())
+
+    def test_implementation_compute_rates_method_with_local_variables_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual(
+            'void computeRates(double voi, double * restrict states, double * restrict rates, double * restrict variables)\n{\n[CODE]}\n',
+            g.implementationComputeRatesMethodWithLocalVariablesString())
+        g.setImplementationComputeRatesMethodWithLocalVariablesString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeRatesMethodWithLocalVariablesString())
+
+    def test_implementation_initialise_lookup_tables_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('double initialiseLookupTables(double *variables)\n{\n    double *states = createStatesArray();\n    double maxError = 0.0;\n\n[CODE]\n    deleteArray(states);\n\n    return maxError;\n}\n',
+                         g.implementationInitialiseLookupTablesMethodString())
+        g.setImplementationInitialiseLookupTablesMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationInitialiseLookupTablesMethodString())
+
+    def test_interface_initialise_ensemble_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void initialiseEnsemble(size_t instanceCount, double *parameters, double *states, double *rates, double *variables);\n',
+                         g.interfaceInitialiseEnsembleMethodString())
+        g.setInterfaceInitialiseEnsembleMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceInitialiseEnsembleMethodString())
+
+    def test_implementation_initialise_ensemble_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('static void initialiseEnsembleInstance(double *parameters, double *states, double *variables)\n{\n[CODE]}\n\nvoid initialiseEnsemble(size_t instanceCount, double *parameters, double *states, double *rates, double *variables)\n{\n[OPENMP_PRAGMA]    for (size_t i = 0; i < instanceCount; ++i) {\n        initialiseVariables(states+i*STATE_COUNT, rates+i*STATE_COUNT, variables+i*VARIABLE_COUNT);\n        initialiseEnsembleInstance(parameters+i*ENSEMBLE_PARAMETER_COUNT, states+i*STATE_COUNT, variables+i*VARIABLE_COUNT);\n        computeComputedConstants(variables+i*VARIABLE_COUNT);\n    }\n}\n',
+                         g.implementationInitialiseEnsembleMethodString())
+        g.setImplementationInitialiseEnsembleMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationInitialiseEnsembleMethodString())
+
+    def test_interface_compute_ensemble_rates_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void computeEnsembleRates(size_t instanceCount, double voi, double *states, double *rates, double *variables);\n',
+                         g.interfaceComputeEnsembleRatesMethodString())
+        g.setInterfaceComputeEnsembleRatesMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeEnsembleRatesMethodString())
+
+    def test_implementation_compute_ensemble_rates_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void computeEnsembleRates(size_t instanceCount, double voi, double *states, double *rates, double *variables)\n{\n[OPENMP_PRAGMA]    for (size_t i = 0; i < instanceCount; ++i) {\n        computeRates(voi, states+i*STATE_COUNT, rates+i*STATE_COUNT, variables+i*VARIABLE_COUNT);\n    }\n}\n',
+                         g.implementationComputeEnsembleRatesMethodString())
+        g.setImplementationComputeEnsembleRatesMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeEnsembleRatesMethodString())
+
+    def test_interface_compute_ensemble_variables_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void computeEnsembleVariables(size_t instanceCount, double voi, double *states, double *rates, double *variables);\n',
+                         g.interfaceComputeEnsembleVariablesMethodString())
+        g.setInterfaceComputeEnsembleVariablesMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeEnsembleVariablesMethodString())
+
+    def test_implementation_compute_ensemble_variables_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void computeEnsembleVariables(size_t instanceCount, double voi, double *states, double *rates, double *variables)\n{\n[OPENMP_PRAGMA]    for (size_t i = 0; i < instanceCount; ++i) {\n        computeVariables(voi, states+i*STATE_COUNT, rates+i*STATE_COUNT, variables+i*VARIABLE_COUNT);\n    }\n}\n',
+                         g.implementationComputeEnsembleVariablesMethodString())
+        g.setImplementationComputeEnsembleVariablesMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationComputeEnsembleVariablesMethodString())
+
+    def test_interface_integrate_forward_euler_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void integrateForwardEuler(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer);\n',
+                         g.interfaceIntegrateForwardEulerMethodString())
+        g.setInterfaceIntegrateForwardEulerMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceIntegrateForwardEulerMethodString())
+
+    def test_implementation_integrate_forward_euler_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void integrateForwardEuler(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer)\n{\n    for (size_t step = 0; step < nSteps; ++step) {\n        computeRates(voi0+step*dt, states, rates, variables);\n\n        for (size_t i = 0; i < STATE_COUNT; ++i) {\n            states[i] += dt*rates[i];\n        }\n\n        if ((outputBuffer != NULL) && (outputStride != 0) && ((step+1)%outputStride == 0)) {\n            for (size_t i = 0; i < STATE_COUNT; ++i) {\n                outputBuffer[i] = states[i];\n            }\n\n            outputBuffer += STATE_COUNT;\n        }\n    }\n}\n',
+                         g.implementationIntegrateForwardEulerMethodString())
+        g.setImplementationIntegrateForwardEulerMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationIntegrateForwardEulerMethodString())
+
+    def test_interface_integrate_rk4_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void integrateRK4(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer);\n',
+                         g.interfaceIntegrateRk4MethodString())
+        g.setInterfaceIntegrateRk4MethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceIntegrateRk4MethodString())
+
+    def test_implementation_integrate_rk4_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void integrateRK4(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer)\n{\n    double *k2 = createStatesArray();\n    double *k3 = createStatesArray();\n    double *k4 = createStatesArray();\n    double *y = createStatesArray();\n\n    for (size_t step = 0; step < nSteps; ++step) {\n        double voi = voi0+step*dt;\n\n        computeRates(voi, states, rates, variables);\n\n        for (size_t i = 0; i < STATE_COUNT; ++i) {\n            y[i] = states[i]+0.5*dt*rates[i];\n        }\n\n        computeRates(voi+0.5*dt, y, k2, variables);\n\n        for (size_t i = 0; i < STATE_COUNT; ++i) {\n            y[i] = states[i]+0.5*dt*k2[i];\n        }\n\n        computeRates(voi+0.5*dt, y, k3, variables);\n\n        for (size_t i = 0; i < STATE_COUNT; ++i) {\n            y[i] = states[i]+dt*k3[i];\n        }\n\n        computeRates(voi+dt, y, k4, variables);\n\n        for (size_t i = 0; i < STATE_COUNT; ++i) {\n            states[i] += dt*(rates[i]+2.0*(k2[i]+k3[i])+k4[i])/6.0;\n        }\n\n        if ((outputBuffer != NULL) && (outputStride != 0) && ((step+1)%outputStride == 0)) {\n            for (size_t i = 0; i < STATE_COUNT; ++i) {\n                outputBuffer[i] = states[i];\n            }\n\n            outputBuffer += STATE_COUNT;\n        }\n    }\n\n    deleteArray(k2);\n    deleteArray(k3);\n    deleteArray(k4);\n    deleteArray(y);\n}\n',
+                         g.implementationIntegrateRk4MethodString())
+        g.setImplementationIntegrateRk4MethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationIntegrateRk4MethodString())
+
+    def test_interface_integrate_rush_larsen_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void integrateRushLarsen(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer);\n',
+                         g.interfaceIntegrateRushLarsenMethodString())
+        g.setInterfaceIntegrateRushLarsenMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceIntegrateRushLarsenMethodString())
+
+    def test_implementation_integrate_rush_larsen_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('void integrateRushLarsen(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer)\n{\n    double *taus = createStatesArray();\n    double *yInfs = createStatesArray();\n\n    for (size_t step = 0; step < nSteps; ++step) {\n        double voi = voi0+step*dt;\n\n        computeRates(voi, states, rates, variables);\n        computeRushLarsenCoefficients(voi, states, variables, taus, yInfs);\n\n[CODE]\n        if ((outputBuffer != NULL) && (outputStride != 0) && ((step+1)%outputStride == 0)) {\n            for (size_t i = 0; i < STATE_COUNT; ++i) {\n                outputBuffer[i] = states[i];\n            }\n\n            outputBuffer += STATE_COUNT;\n        }\n    }\n\n    deleteArray(taus);\n    deleteArray(yInfs);\n}\n',
+                         g.implementationIntegrateRushLarsenMethodString())
+        g.setImplementationIntegrateRushLarsenMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationIntegrateRushLarsenMethodString())
+
     def test_implementation_compute_variables_method_string(self):
         from libcellml import GeneratorProfile
 
@@ -854,6 +1035,24 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setImplementationHeaderString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationHeaderString())
 
+    def test_implementation_namespace_begin_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('', g.implementationNamespaceBeginString())
+        g.setImplementationNamespaceBeginString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationNamespaceBeginString())
+
+    def test_implementation_namespace_end_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('', g.implementationNamespaceEndString())
+        g.setImplementationNamespaceEndString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationNamespaceEndString())
+
     def test_implementation_initialise_constants_method_string(self):
         from libcellml import GeneratorProfile
 
@@ -916,6 +1115,25 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setImplementationVariableCountString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationVariableCountString())
 
+    def test_interface_ensemble_parameter_count_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('extern const size_t ENSEMBLE_PARAMETER_COUNT;\n', g.interfaceEnsembleParameterCountString())
+        g.setInterfaceEnsembleParameterCountString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceEnsembleParameterCountString())
+
+    def test_implementation_ensemble_parameter_count_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('const size_t ENSEMBLE_PARAMETER_COUNT = [ENSEMBLE_PARAMETER_COUNT];\n',
+                         g.implementationEnsembleParameterCountString())
+        g.setImplementationEnsembleParameterCountString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationEnsembleParameterCountString())
+
     def test_implementation_variable_info_string(self):
         from libcellml import GeneratorProfile
 
@@ -989,6 +1207,27 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setInterfaceComputeRatesMethodString(True, GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeRatesMethodString(True))
 
+    def test_interface_compute_rush_larsen_coefficients_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual(
+            'void computeRushLarsenCoefficients(double voi, double *states, double *variables, double *taus, double *yInfs);\n',
+            g.interfaceComputeRushLarsenCoefficientsMethodString())
+        g.setInterfaceComputeRushLarsenCoefficientsMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceComputeRushLarsenCoefficientsMethodString())
+
+    def test_interface_initialise_lookup_tables_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('double initialiseLookupTables(double *variables);\n',
+                         g.interfaceInitialiseLookupTablesMethodString())
+        g.setInterfaceInitialiseLookupTablesMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.interfaceInitialiseLookupTablesMethodString())
+
     def test_interface_compute_variables_method_string(self):
         from libcellml import GeneratorProfile
 
@@ -1232,6 +1471,15 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setMinusString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.minusString())
 
+    def test_namespace_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('', g.namespaceString())
+        g.setNamespaceString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.namespaceString())
+
     def test_nan_string(self):
         from libcellml import GeneratorProfile
 
@@ -1241,6 +1489,15 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setNanString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.nanString())
 
+    def test_literal_suffix_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual("", g.literalSuffixString())
+        g.setLiteralSuffixString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.literalSuffixString())
+
     def test_natural_logarithm_string(self):
         from libcellml import GeneratorProfile
 
@@ -1580,6 +1837,158 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setVariablesArrayString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.variablesArrayString())
 
+    def test_rush_larsen_taus_array_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('taus', g.rushLarsenTausArrayString())
+        g.setRushLarsenTausArrayString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.rushLarsenTausArrayString())
+
+    def test_rush_larsen_steady_states_array_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('yInfs', g.rushLarsenSteadyStatesArrayString())
+        g.setRushLarsenSteadyStatesArrayString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.rushLarsenSteadyStatesArrayString())
+
+    def test_local_variable_name_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('[NAME]_[INDEX]', g.localVariableNameString())
+        g.setLocalVariableNameString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.localVariableNameString())
+
+    def test_local_variable_declaration_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('double ', g.localVariableDeclarationString())
+        g.setLocalVariableDeclarationString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.localVariableDeclarationString())
+
+    def test_forward_euler_state_update_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('        states[[INDEX]] += dt*rates[[INDEX]];\n', g.forwardEulerStateUpdateString())
+        g.setForwardEulerStateUpdateString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.forwardEulerStateUpdateString())
+
+    def test_rush_larsen_state_update_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('        states[[INDEX]] = yInfs[[INDEX]]+(states[[INDEX]]-yInfs[[INDEX]])*exp(-dt/taus[[INDEX]]);\n',
+                         g.rushLarsenStateUpdateString())
+        g.setRushLarsenStateUpdateString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.rushLarsenStateUpdateString())
+
+    def test_sensitivity_name_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual("d[NAME]_d[PARAMETER]", g.sensitivityNameString())
+        g.setSensitivityNameString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.sensitivityNameString())
+
+    def test_chunk_method_name_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual("[NAME]_chunk_[INDEX]", g.chunkMethodNameString())
+        g.setChunkMethodNameString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.chunkMethodNameString())
+
+    def test_lookup_table_declaration_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('static double lookupTable[INDEX][[SIZE]];\n',
+                         g.lookupTableDeclarationString())
+        g.setLookupTableDeclarationString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.lookupTableDeclarationString())
+
+    def test_lookup_table_entry_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('lookupTable[INDEX][[COLUMN_COUNT]*i+[COLUMN]]',
+                         g.lookupTableEntryString())
+        g.setLookupTableEntryString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.lookupTableEntryString())
+
+    def test_lookup_table_value_call_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('lookupTableValue(lookupTable[INDEX], [COLUMN_COUNT], [COLUMN], [STATE], [MINIMUM], [STEP], [SIZE])',
+                         g.lookupTableValueCallString())
+        g.setLookupTableValueCallString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.lookupTableValueCallString())
+
+    def test_lookup_table_error_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('maxError = lookupTableError(maxError, [CODE], [VALUE]);\n',
+                         g.lookupTableErrorString())
+        g.setLookupTableErrorString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.lookupTableErrorString())
+
+    def test_lookup_table_value_method_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('static double lookupTableValue(double *table, size_t columnCount, size_t column, double x, double minimum, double step, size_t size)\n{\n    double position = (x-minimum)/step;\n\n    if (isnan(position)) {\n        return NAN;\n    }\n\n    if (position <= 0.0) {\n        return table[column];\n    }\n\n    if (position >= size-1) {\n        return table[columnCount*(size-1)+column];\n    }\n\n    size_t i = (size_t) position;\n    double fraction = position-i;\n\n    return (1.0-fraction)*table[columnCount*i+column]+fraction*table[columnCount*(i+1)+column];\n}\n\nstatic double lookupTableError(double maxError, double exactValue, double value)\n{\n    if (isnan(maxError) || !isfinite(exactValue)) {\n        return maxError;\n    }\n\n    double error = fabs(exactValue-value);\n\n    return (error <= maxError)?maxError:error;\n}\n',
+                         g.lookupTableValueMethodString())
+        g.setLookupTableValueMethodString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.lookupTableValueMethodString())
+
+    def test_lookup_table_initialisation_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('    for (size_t i = 0; i < [SIZE]; ++i) {\n        double row[[COLUMN_COUNT]];\n\n        [STATE] = [MINIMUM]+(i-0.001)*[STEP];\n\n[CODE]\n        for (size_t j = 0; j < [COLUMN_COUNT]; ++j) {\n            row[j] = [ENTRY];\n        }\n\n        [STATE] = [MINIMUM]+(i+0.001)*[STEP];\n\n[CODE]\n        for (size_t j = 0; j < [COLUMN_COUNT]; ++j) {\n            [ENTRY] = 0.5*(row[j]+[ENTRY]);\n        }\n    }\n\n    for (size_t i = 0; i < [SIZE]-1; ++i) {\n        [STATE] = [MINIMUM]+(i+0.5)*[STEP];\n\n[ERROR_CODE]    }\n',
+                         g.lookupTableInitialisationString())
+        g.setLookupTableInitialisationString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.lookupTableInitialisationString())
+
+    def test_ensemble_openmp_pragma_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('#pragma omp parallel for schedule(static, [BLOCK_SIZE])\n', g.ensembleOpenmpPragmaString())
+        g.setEnsembleOpenmpPragmaString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.ensembleOpenmpPragmaString())
+
+    def test_ensemble_parameter_assignment_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('    variables[[INDEX]] = parameters[[PARAMETER_INDEX]];\n',
+                         g.ensembleParameterAssignmentString())
+        g.setEnsembleParameterAssignmentString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.ensembleParameterAssignmentString())
+
     def test_external_variable_method_type_definition_string(self):
         from libcellml import GeneratorProfile
 
@@ -1741,6 +2150,33 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setHasInterface(False)
         self.assertFalse(g.hasInterface())
 
+    def test_has_compute_rush_larsen_coefficients_method(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertFalse(g.hasComputeRushLarsenCoefficientsMethod())
+        g.setHasComputeRushLarsenCoefficientsMethod(True)
+        self.assertTrue(g.hasComputeRushLarsenCoefficientsMethod())
+
+    def test_has_local_variables_in_compute_rates(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertFalse(g.hasLocalVariablesInComputeRates())
+        g.setHasLocalVariablesInComputeRates(True)
+        self.assertTrue(g.hasLocalVariablesInComputeRates())
+
+    def test_has_integrate_methods(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertFalse(g.hasIntegrateMethods())
+        g.setHasIntegrateMethods(True)
+        self.assertTrue(g.hasIntegrateMethods())
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -33,6 +33,114 @@ class ValidatorTestCase(unittest.TestCase):
         v = Validator()
         v.validateModel(libcellml.Model())
 
+    def test_thread_count(self):
+        from libcellml import Parser
+        from libcellml import Validator
+        from test_resources import file_contents
+
+        v = Validator()
+
+        self.assertEqual(1, v.threadCount())
+
+        v.setThreadCount(4)
+
+        self.assertEqual(4, v.threadCount())
+
+        p = Parser()
+        m = p.parseModel(file_contents('invalid_cellml_2.0.xml'))
+
+        v.validateModel(m)
+
+        s = Validator()
+
+        s.validateModel(m)
+
+        self.assertEqual(s.issueCount(), v.issueCount())
+
+        for i in range(s.issueCount()):
+            self.assertEqual(s.issue(i).description(), v.issue(i).description())
+
+    def test_incremental(self):
+        from libcellml import Parser
+        from libcellml import Validator
+        from test_resources import file_contents
+
+        v = Validator()
+
+        self.assertFalse(v.isIncremental())
+
+        v.setIncremental(True)
+
+        self.assertTrue(v.isIncremental())
+
+        p = Parser()
+        m = p.parseModel(file_contents('invalid_cellml_2.0.xml'))
+
+        v.validateModel(m)
+
+        m.component(0).setName('renamed_component')
+
+        v.validateModel(m)
+
+        s = Validator()
+
+        s.validateModel(m)
+
+        self.assertEqual(s.issueCount(), v.issueCount())
+
+        for i in range(s.issueCount()):
+            self.assertEqual(s.issue(i).description(), v.issue(i).description())
+
+    def test_bounded_validation(self):
+        from libcellml import Parser
+        from libcellml import Validator
+        from test_resources import file_contents
+
+        v = Validator()
+
+        self.assertEqual(0, v.maximumErrorCount())
+        self.assertTrue(v.hasMathMLDtdValidation())
+        self.assertTrue(v.hasUniqueIdValidation())
+
+        v.setMaximumErrorCount(1)
+        v.setHasMathMLDtdValidation(False)
+        v.setHasUniqueIdValidation(False)
+
+        self.assertEqual(1, v.maximumErrorCount())
+        self.assertFalse(v.hasMathMLDtdValidation())
+        self.assertFalse(v.hasUniqueIdValidation())
+
+        p = Parser()
+        m = p.parseModel(file_contents('invalid_cellml_2.0.xml'))
+
+        v.validateModel(m)
+
+        self.assertEqual(1, v.errorCount())
+
+    def test_mathml_dtd_compatibility(self):
+        from libcellml import Parser
+        from libcellml import Validator
+        from test_resources import file_contents
+
+        v = Validator()
+
+        self.assertFalse(v.hasMathMLDtdCompatibility())
+
+        v.setHasMathMLDtdCompatibility(True)
+
+        self.assertTrue(v.hasMathMLDtdCompatibility())
+
+        p = Parser()
+        m = p.parseModel(file_contents('invalid_cellml_2.0.xml'))
+
+        v.validateModel(m)
+        compatibility_error_count = v.errorCount()
+
+        v.setHasMathMLDtdCompatibility(False)
+        v.validateModel(m)
+
+        self.assertEqual(compatibility_error_count, v.errorCount())
+
 
 if __name__ == '__main__':
     unittest.main()
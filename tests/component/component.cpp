@@ -740,3 +740,111 @@ TEST(Component, definedComponentImport)
 
     EXPECT_FALSE(c->isDefined());
 }
+
+TEST(Component, variableLookupByNameAfterChanges)
+{
+    libcellml::ComponentPtr c = libcellml::Component::create("component");
+    libcellml::VariablePtr v1 = libcellml::Variable::create("v1");
+    libcellml::VariablePtr v2 = libcellml::Variable::create("v2");
+    libcellml::VariablePtr v3 = libcellml::Variable::create("v1");
+
+    c->addVariable(v1);
+    c->addVariable(v2);
+    c->addVariable(v3);
+
+    EXPECT_EQ(v1, c->variable("v1"));
+    EXPECT_EQ(v2, c->variable("v2"));
+
+    v1->setName("v4");
+
+    EXPECT_EQ(v3, c->variable("v1"));
+    EXPECT_EQ(v1, c->variable("v4"));
+
+    v3->setName("v4");
+
+    EXPECT_FALSE(c->hasVariable("v1"));
+    EXPECT_EQ(v1, c->variable("v4"));
+
+    EXPECT_TRUE(c->removeVariable(size_t(0)));
+    EXPECT_EQ(v3, c->variable("v4"));
+    EXPECT_EQ(v2, c->variable("v2"));
+
+    EXPECT_EQ(v2, c->takeVariable("v2"));
+    EXPECT_EQ(size_t(1), c->variableCount());
+    EXPECT_FALSE(c->hasVariable("v2"));
+    EXPECT_EQ(v3, c->variable("v4"));
+
+    v2->setName("v5");
+
+    EXPECT_FALSE(c->hasVariable("v5"));
+
+    v3->removeName();
+
+    EXPECT_FALSE(c->hasVariable("v4"));
+    EXPECT_EQ(v3, c->variable(""));
+
+    c->removeAllVariables();
+    v3->setName("v6");
+
+    EXPECT_EQ(nullptr, c->variable(""));
+    EXPECT_EQ(nullptr, c->variable("v6"));
+}
+
+TEST(Component, variableLookupByNameWhenMovedToAnotherComponent)
+{
+    libcellml::ComponentPtr c1 = libcellml::Component::create("c1");
+    libcellml::ComponentPtr c2 = libcellml::Component::create("c2");
+    libcellml::VariablePtr v = libcellml::Variable::create("v");
+
+    c1->addVariable(v);
+    c2->addVariable(v);
+    v->setName("w");
+
+    EXPECT_FALSE(c1->hasVariable("v"));
+    EXPECT_FALSE(c1->hasVariable("w"));
+    EXPECT_EQ(v, c2->variable("w"));
+}
+
+TEST(Component, variableLookupByNameInLargeComponent)
+{
+    const size_t count = 10000;
+    libcellml::ComponentPtr c = libcellml::Component::create("component");
+
+    for (size_t i = 0; i < count; ++i) {
+        c->addVariable(libcellml::Variable::create("v" + std::to_string(i)));
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(c->variable(i), c->variable("v" + std::to_string(i)));
+    }
+
+    EXPECT_TRUE(c->removeVariable("v0"));
+    EXPECT_EQ(c->variable(count - 2), c->variable("v" + std::to_string(count - 1)));
+}
+
+TEST(Component, encapsulatedComponentLookupByNameAfterChanges)
+{
+    libcellml::ComponentPtr c = libcellml::Component::create("component");
+    libcellml::ComponentPtr c1 = libcellml::Component::create("c1");
+    libcellml::ComponentPtr c2 = libcellml::Component::create("c2");
+    libcellml::ComponentPtr c3 = libcellml::Component::create("c3");
+
+    c->addComponent(c1);
+    c->addComponent(c2);
+
+    c1->setName("c2");
+
+    EXPECT_EQ(c1, c->component("c2"));
+    EXPECT_FALSE(c->containsComponent("c1"));
+
+    EXPECT_TRUE(c->replaceComponent(size_t(0), c3));
+    EXPECT_EQ(c3, c->component("c3"));
+    EXPECT_EQ(c2, c->component("c2"));
+
+    c1->setName("c3");
+
+    EXPECT_EQ(c3, c->component("c3"));
+
+    EXPECT_EQ(c2, c->takeComponent(size_t(1)));
+    EXPECT_FALSE(c->containsComponent("c2"));
+}
@@ -394,6 +394,13 @@ TEST(Coverage, analyser)
     EXPECT_EQ(size_t(0), analyserModel->equations().size());
     EXPECT_EQ(nullptr, analyserModel->equation(0));
 
+    EXPECT_EQ(size_t(0), analyserModel->jacobianNonZeroCount());
+    EXPECT_EQ(size_t(0), analyserModel->jacobianRowOffsets().size());
+    EXPECT_EQ(size_t(0), analyserModel->jacobianColumnIndices().size());
+    EXPECT_EQ(size_t(0), analyserModel->stateDependencies(0).size());
+    EXPECT_EQ(size_t(0), analyserModel->equationDependencyRowOffsets().size());
+    EXPECT_EQ(size_t(0), analyserModel->equationDependencyColumnIndices().size());
+
     EXPECT_FALSE(analyserModel->needEqFunction());
     EXPECT_FALSE(analyserModel->needNeqFunction());
     EXPECT_FALSE(analyserModel->needLtFunction());
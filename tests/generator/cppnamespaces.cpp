@@ -0,0 +1,49 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include "../resources/generator/dae_cellml_1_1_model/model.hpp"
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.hpp"
+
+TEST(Generator, cppCodeForDifferentModelsInSameProgram)
+{
+    // The C++ code generated for a model lives in its own namespace, so the
+    // code generated for different models can be used in the same program.
+
+    EXPECT_EQ(size_t(2), BG3::STATE_COUNT);
+    EXPECT_EQ(size_t(4), hodgkin_huxley_squid_axon_model_1952::STATE_COUNT);
+
+    auto bg3States = BG3::createStatesArray<double>();
+    auto bg3Rates = BG3::createStatesArray<double>();
+    auto bg3Variables = BG3::createVariablesArray<double>();
+    auto hhStates = hodgkin_huxley_squid_axon_model_1952::createStatesArray<double>();
+    auto hhRates = hodgkin_huxley_squid_axon_model_1952::createStatesArray<double>();
+    auto hhVariables = hodgkin_huxley_squid_axon_model_1952::createVariablesArray<double>();
+
+    BG3::initialiseVariables<double>(bg3States, bg3Rates, bg3Variables);
+    hodgkin_huxley_squid_axon_model_1952::initialiseVariables<double>(hhStates, hhRates, hhVariables);
+
+    EXPECT_EQ(1.0, bg3States[0]);
+    EXPECT_EQ(0.0, hhStates[0]);
+
+    BG3::deleteArray(bg3States);
+    BG3::deleteArray(bg3Rates);
+    BG3::deleteArray(bg3Variables);
+    hodgkin_huxley_squid_axon_model_1952::deleteArray(hhStates);
+    hodgkin_huxley_squid_axon_model_1952::deleteArray(hhRates);
+    hodgkin_huxley_squid_axon_model_1952::deleteArray(hhVariables);
+}
@@ -0,0 +1,38 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include "../resources/generator/cellml_state_initialised_using_variable/model.ensemble.c"
+
+TEST(Generator, cellmlStateInitialisedUsingVariableEnsembleIsInitialisedUsingItsParameters)
+{
+    // The state of each instance is initialised using the ensemble parameter,
+    // so it must have the value of that instance's parameter rather than the
+    // default value of the ensemble parameter (i.e. 123).
+
+    double parameters[] = {1.0, 2.0};
+    double states[2 * STATE_COUNT];
+    double rates[2 * STATE_COUNT];
+    double variables[2 * VARIABLE_COUNT];
+
+    initialiseEnsemble(2, parameters, states, rates, variables);
+
+    EXPECT_EQ(1.0, variables[0]);
+    EXPECT_EQ(1.0, states[0]);
+    EXPECT_EQ(2.0, variables[VARIABLE_COUNT]);
+    EXPECT_EQ(2.0, states[STATE_COUNT]);
+}
@@ -824,6 +824,43 @@ TEST(Generator, cellmlStateInitialisedUsingVariable)
     EXPECT_EQ(fileContents("generator/cellml_state_initialised_using_variable/model.py"), generator->implementationCode());
 }
 
+TEST(Generator, cellmlStateInitialisedUsingVariableWithEnsembleParameter)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/cellml_state_initialised_using_variable/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    // The state is initialised using the ensemble parameter, so it must be
+    // reinitialised once the ensemble parameter has been assigned.
+
+    EXPECT_TRUE(generator->addEnsembleParameter(model->component("constants")->variable("k")));
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.ensemble.h");
+
+    EXPECT_EQ(fileContents("generator/cellml_state_initialised_using_variable/model.ensemble.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/cellml_state_initialised_using_variable/model.ensemble.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/cellml_state_initialised_using_variable/model.ensemble.py"), generator->implementationCode());
+}
+
 TEST(Generator, cellmlUnitScalingVoiIndirect)
 {
     auto parser = libcellml::Parser::create();
@@ -1195,6 +1232,541 @@ TEST(Generator, hodgkinHuxleySquidAxonModel1952)
     EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
 }
 
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithLookupTables)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+    auto membraneV = model->component("membrane")->variable("V");
+    auto sodiumChannelV = model->component("sodium_channel")->variable("V");
+    auto membraneCm = model->component("membrane")->variable("Cm");
+
+    generator->setModel(analyserModel);
+
+    EXPECT_FALSE(generator->addLookupTable(nullptr, -100.0, 50.0, 0.01));
+    EXPECT_FALSE(generator->addLookupTable(membraneV, 50.0, -100.0, 0.01));
+    EXPECT_FALSE(generator->addLookupTable(membraneV, -100.0, 50.0, 0.0));
+    EXPECT_TRUE(generator->addLookupTable(membraneV, -100.0, 50.0, 0.01));
+    EXPECT_FALSE(generator->addLookupTable(membraneV, -100.0, 50.0, 0.01));
+    EXPECT_TRUE(generator->containsLookupTable(membraneV));
+    EXPECT_FALSE(generator->containsLookupTable(sodiumChannelV));
+
+    // A lookup table for an equivalent state or for a variable that is not a
+    // state is not used.
+
+    EXPECT_TRUE(generator->addLookupTable(sodiumChannelV, -50.0, 50.0, 0.1));
+    EXPECT_TRUE(generator->addLookupTable(membraneCm, 0.0, 1.0, 0.1));
+    EXPECT_EQ(size_t(3), generator->lookupTableCount());
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.lookup.tables.h");
+
+    EXPECT_EQ("model.lookup.tables.h", profile->interfaceFileNameString());
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.lookup.tables.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.lookup.tables.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::CPP);
+
+    profile->setNamespaceString("hodgkin_huxley_squid_axon_model_1952_with_lookup_tables");
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.lookup.tables.hpp"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.lookup.tables.py"), generator->implementationCode());
+
+    EXPECT_TRUE(generator->removeLookupTable(membraneCm));
+    EXPECT_FALSE(generator->removeLookupTable(membraneCm));
+    EXPECT_EQ(size_t(2), generator->lookupTableCount());
+
+    generator->removeAllLookupTables();
+
+    EXPECT_EQ(size_t(0), generator->lookupTableCount());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithLocalVariables)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    auto profile = generator->profile();
+
+    profile->setHasLocalVariablesInComputeRates(true);
+    profile->setInterfaceFileNameString("model.local.variables.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.local.variables.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.local.variables.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    profile->setHasLocalVariablesInComputeRates(true);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.local.variables.py"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithSpecialisedConstants)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+    auto membraneCm = model->component("membrane")->variable("Cm");
+    auto membraneV = model->component("membrane")->variable("V");
+
+    generator->setModel(analyserModel);
+
+    EXPECT_FALSE(generator->hasConstantSpecialisation());
+
+    generator->setConstantSpecialisation(true);
+
+    EXPECT_TRUE(generator->hasConstantSpecialisation());
+
+    EXPECT_FALSE(generator->addConstantOverride(nullptr, 2.0));
+    EXPECT_TRUE(generator->addConstantOverride(membraneCm, 2.0));
+    EXPECT_FALSE(generator->addConstantOverride(membraneCm, 3.0));
+    EXPECT_TRUE(generator->containsConstantOverride(membraneCm));
+    EXPECT_FALSE(generator->containsConstantOverride(membraneV));
+
+    // A constant override for a variable that is not a constant is not used.
+
+    EXPECT_TRUE(generator->addConstantOverride(membraneV, 3.0));
+    EXPECT_EQ(size_t(2), generator->constantOverrideCount());
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.specialised.constants.c"), generator->implementationCode());
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.specialised.constants.py"), generator->implementationCode());
+
+    EXPECT_TRUE(generator->removeConstantOverride(membraneV));
+    EXPECT_FALSE(generator->removeConstantOverride(membraneV));
+    EXPECT_EQ(size_t(1), generator->constantOverrideCount());
+
+    generator->removeAllConstantOverrides();
+
+    EXPECT_EQ(size_t(0), generator->constantOverrideCount());
+
+    generator->setConstantSpecialisation(false);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, algebraicEqnNonTerminatingComputedConstantWithSpecialisedConstants)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/algebraic_eqn_non_terminating_computed_constant/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+    generator->setConstantSpecialisation(true);
+
+    EXPECT_EQ(fileContents("generator/algebraic_eqn_non_terminating_computed_constant/model.specialised.constants.c"), generator->implementationCode());
+}
+
+TEST(Generator, algebraicEqnNonTerminatingComputedConstantWithConstantOverride)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/algebraic_eqn_non_terminating_computed_constant/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+    generator->setConstantSpecialisation(true);
+
+    EXPECT_TRUE(generator->addConstantOverride(model->component("my_algebraic_eqn")->variable("a"), 0.1 + 0.2));
+
+    EXPECT_EQ(fileContents("generator/algebraic_eqn_non_terminating_computed_constant/model.specialised.constants.override.c"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithEnsembleParameters)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+    auto membraneCm = model->component("membrane")->variable("Cm");
+    auto membraneV = model->component("membrane")->variable("V");
+    auto sodiumChannelGNa = model->component("sodium_channel")->variable("g_Na");
+
+    generator->setModel(analyserModel);
+
+    EXPECT_FALSE(generator->addEnsembleParameter(nullptr));
+    EXPECT_TRUE(generator->addEnsembleParameter(membraneCm));
+    EXPECT_FALSE(generator->addEnsembleParameter(membraneCm));
+    EXPECT_TRUE(generator->addEnsembleParameter(sodiumChannelGNa));
+    EXPECT_TRUE(generator->containsEnsembleParameter(membraneCm));
+    EXPECT_FALSE(generator->containsEnsembleParameter(membraneV));
+
+    // An ensemble parameter for a variable that is not a constant is not used.
+
+    EXPECT_TRUE(generator->addEnsembleParameter(membraneV));
+    EXPECT_EQ(size_t(3), generator->ensembleParameterCount());
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.ensemble.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.ensemble.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.ensemble.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.ensemble.py"), generator->implementationCode());
+
+    EXPECT_TRUE(generator->removeEnsembleParameter(membraneV));
+    EXPECT_FALSE(generator->removeEnsembleParameter(membraneV));
+    EXPECT_EQ(size_t(2), generator->ensembleParameterCount());
+
+    generator->removeAllEnsembleParameters();
+
+    EXPECT_EQ(size_t(0), generator->ensembleParameterCount());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithSensitivityParameters)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+    auto membraneCm = model->component("membrane")->variable("Cm");
+    auto membraneV = model->component("membrane")->variable("V");
+    auto sodiumChannelGNa = model->component("sodium_channel")->variable("g_Na");
+
+    generator->setModel(analyserModel);
+
+    EXPECT_FALSE(generator->addSensitivityParameter(nullptr));
+    EXPECT_TRUE(generator->addSensitivityParameter(membraneCm));
+    EXPECT_FALSE(generator->addSensitivityParameter(membraneCm));
+    EXPECT_TRUE(generator->addSensitivityParameter(sodiumChannelGNa));
+    EXPECT_TRUE(generator->containsSensitivityParameter(membraneCm));
+    EXPECT_FALSE(generator->containsSensitivityParameter(membraneV));
+
+    // A sensitivity parameter for a variable that is not a constant is not
+    // used.
+
+    EXPECT_TRUE(generator->addSensitivityParameter(membraneV));
+    EXPECT_EQ(size_t(3), generator->sensitivityParameterCount());
+
+    auto profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.sensitivities.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.sensitivities.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.sensitivities.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.sensitivities.py"), generator->implementationCode());
+
+    EXPECT_TRUE(generator->removeSensitivityParameter(membraneV));
+    EXPECT_FALSE(generator->removeSensitivityParameter(membraneV));
+    EXPECT_EQ(size_t(2), generator->sensitivityParameterCount());
+
+    // Sensitivities cannot be generated without a sensitivity name.
+
+    profile->setSensitivityNameString("");
+
+    auto implementationCode = generator->implementationCode();
+
+    profile->setSensitivityNameString("d[NAME]_d[PARAMETER]");
+
+    EXPECT_EQ(std::string::npos, implementationCode.find("dV_dCm"));
+
+    generator->removeAllSensitivityParameters();
+
+    EXPECT_EQ(size_t(0), generator->sensitivityParameterCount());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithSingleAndMixedPrecisions)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    auto profile = generator->profile();
+
+    profile->setPrecision(libcellml::GeneratorProfile::Precision::SINGLE);
+    profile->setInterfaceFileNameString("model.single.precision.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.single.precision.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.single.precision.c"), generator->implementationCode());
+
+    profile->setPrecision(libcellml::GeneratorProfile::Precision::MIXED);
+    profile->setInterfaceFileNameString("model.mixed.precision.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.mixed.precision.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.mixed.precision.c"), generator->implementationCode());
+
+    // The precision has no effect on the Python profile.
+
+    profile->setProfile(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithCppProfile)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::CPP);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.hpp"), generator->implementationCode());
+
+    // The precision has no effect on the C++ profile.
+
+    profile->setPrecision(libcellml::GeneratorProfile::Precision::SINGLE);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.hpp"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithNumpyProfile)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::NUMPY);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.numpy.py"), generator->implementationCode());
+
+    // Lookup tables are not supported by the NumPy profile since they would
+    // need to be tabulated for each instance.
+
+    EXPECT_TRUE(generator->addLookupTable(model->component("membrane")->variable("V"), -100.0, 50.0, 0.01));
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.numpy.py"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithImplementationChunks)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    EXPECT_EQ(size_t(0), generator->implementationChunkCount());
+    EXPECT_EQ(EMPTY_STRING, generator->implementationChunkCode(0));
+
+    generator->setImplementationChunkCount(2);
+
+    EXPECT_EQ(size_t(2), generator->implementationChunkCount());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.chunks.c"), generator->implementationCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.chunks.chunk0.c"), generator->implementationChunkCode(0));
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.chunks.chunk1.c"), generator->implementationChunkCode(1));
+    EXPECT_EQ(EMPTY_STRING, generator->implementationChunkCode(2));
+
+    // The chunk methods are reused until the model, the profile, or the options
+    // of the generator change.
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.chunks.chunk0.c"), generator->implementationChunkCode(0));
+
+    generator->profile()->setPrecision(libcellml::GeneratorProfile::Precision::SINGLE);
+
+    EXPECT_NE(std::string::npos, generator->implementationChunkCode(0).find("float"));
+
+    generator->profile()->setPrecision(libcellml::GeneratorProfile::Precision::DOUBLE);
+    generator->setImplementationChunkCount(3);
+
+    EXPECT_NE(EMPTY_STRING, generator->implementationChunkCode(2));
+
+    generator->setImplementationChunkCount(2);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.chunks.chunk1.c"), generator->implementationChunkCode(1));
+    EXPECT_EQ(EMPTY_STRING, generator->implementationChunkCode(2));
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.chunks.py"), generator->implementationCode());
+    EXPECT_EQ(EMPTY_STRING, generator->implementationChunkCode(0));
+
+    generator->setImplementationChunkCount(0);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithProfileModifiedBetweenGenerations)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+    auto profile = generator->profile();
+    auto variableInfoEntryString = profile->variableInfoEntryString();
+
+    generator->setModel(analyserModel);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.c"), generator->implementationCode());
+
+    // Modifying the profile must be reflected in the generated code, i.e. both
+    // in the origin comment and in the variable information entries.
+
+    profile->setVariableInfoEntryString("{\"[NAME]\", \"[UNITS]\", [TYPE]}");
+
+    auto implementationCode = generator->implementationCode();
+
+    EXPECT_NE(std::string::npos, implementationCode.find("using a modified C profile"));
+    EXPECT_NE(std::string::npos, implementationCode.find("{\"time\", \"millisecond\", VARIABLE_OF_INTEGRATION}"));
+
+    // Restoring the profile must give us our original generated code back.
+
+    profile->setVariableInfoEntryString(variableInfoEntryString);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.c"), generator->implementationCode());
+}
+
 TEST(Generator, hodgkinHuxleySquidAxonModel1952UnknownVarsOnRhs)
 {
     auto parser = libcellml::Parser::create();
@@ -1808,6 +2380,117 @@ TEST(Generator, daeModel)
     generator->setProfile(profile);
 
     EXPECT_EQ(fileContents("generator/dae_cellml_1_1_model/model.py"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::CPP);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/dae_cellml_1_1_model/model.hpp"), generator->implementationCode());
+}
+
+TEST(Generator, gatingVariables)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/gating_variables/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    generator->profile()->setHasComputeRushLarsenCoefficientsMethod(true);
+
+    EXPECT_EQ(fileContents("generator/gating_variables/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/gating_variables/model.c"), generator->implementationCode());
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    profile->setHasComputeRushLarsenCoefficientsMethod(true);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/gating_variables/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, gatingVariablesWithIntegrateMethods)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/gating_variables/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    auto profile = generator->profile();
+
+    profile->setHasComputeRushLarsenCoefficientsMethod(true);
+    profile->setHasIntegrateMethods(true);
+    profile->setInterfaceFileNameString("model.integrate.h");
+
+    EXPECT_EQ(fileContents("generator/gating_variables/model.integrate.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/gating_variables/model.integrate.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    profile->setHasComputeRushLarsenCoefficientsMethod(true);
+    profile->setHasIntegrateMethods(true);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/gating_variables/model.integrate.py"), generator->implementationCode());
+}
+
+TEST(Generator, gatingVariablesWithLocalVariables)
+{
+    // Variables needed to compute the Rush-Larsen coefficients must remain in
+    // the variables array.
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/gating_variables/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    generator->profile()->setHasComputeRushLarsenCoefficientsMethod(true);
+    generator->profile()->setHasLocalVariablesInComputeRates(true);
+
+    EXPECT_EQ(fileContents("generator/gating_variables/model.local.variables.c"), generator->implementationCode());
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    profile->setHasComputeRushLarsenCoefficientsMethod(true);
+    profile->setHasLocalVariablesInComputeRates(true);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/gating_variables/model.local.variables.py"), generator->implementationCode());
 }
 
 TEST(Generator, variableInitialisedUsingAConstant)
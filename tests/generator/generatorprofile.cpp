@@ -40,7 +40,13 @@ TEST(GeneratorProfile, defaultGeneralValues)
     EXPECT_EQ(libcellml::GeneratorProfile::Profile::C, generatorProfile->profile());
     EXPECT_EQ("c", libcellml::GeneratorProfile::profileAsString(generatorProfile->profile()));
 
+    EXPECT_EQ(libcellml::GeneratorProfile::Precision::DOUBLE, generatorProfile->precision());
+    EXPECT_EQ("double", libcellml::GeneratorProfile::precisionAsString(generatorProfile->precision()));
+
     EXPECT_EQ(true, generatorProfile->hasInterface());
+    EXPECT_EQ(false, generatorProfile->hasComputeRushLarsenCoefficientsMethod());
+    EXPECT_EQ(false, generatorProfile->hasLocalVariablesInComputeRates());
+    EXPECT_EQ(false, generatorProfile->hasIntegrateMethods());
 }
 
 TEST(GeneratorProfile, defaultRelationalAndLogicalOperatorValues)
@@ -147,6 +153,7 @@ TEST(GeneratorProfile, defaultConstantValues)
     EXPECT_EQ(convertToString(M_PI), generatorProfile->piString());
     EXPECT_EQ("INFINITY", generatorProfile->infString());
     EXPECT_EQ("NAN", generatorProfile->nanString());
+    EXPECT_EQ("", generatorProfile->literalSuffixString());
 }
 
 TEST(GeneratorProfile, defaultArithmeticFunctionValues)
@@ -270,6 +277,10 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
               "#include <stdlib.h>\n",
               generatorProfile->implementationHeaderString());
 
+    EXPECT_EQ("", generatorProfile->namespaceString());
+    EXPECT_EQ("", generatorProfile->implementationNamespaceBeginString());
+    EXPECT_EQ("", generatorProfile->implementationNamespaceEndString());
+
     EXPECT_EQ("extern const char VERSION[];\n", generatorProfile->interfaceVersionString());
     EXPECT_EQ("const char VERSION[] = \"0.5.0\";\n", generatorProfile->implementationVersionString());
 
@@ -282,6 +293,11 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
     EXPECT_EQ("extern const size_t VARIABLE_COUNT;\n", generatorProfile->interfaceVariableCountString());
     EXPECT_EQ("const size_t VARIABLE_COUNT = [VARIABLE_COUNT];\n", generatorProfile->implementationVariableCountString());
 
+    EXPECT_EQ("extern const size_t ENSEMBLE_PARAMETER_COUNT;\n",
+              generatorProfile->interfaceEnsembleParameterCountString());
+    EXPECT_EQ("const size_t ENSEMBLE_PARAMETER_COUNT = [ENSEMBLE_PARAMETER_COUNT];\n",
+              generatorProfile->implementationEnsembleParameterCountString());
+
     EXPECT_EQ("typedef enum {\n"
               "    CONSTANT,\n"
               "    COMPUTED_CONSTANT,\n"
@@ -351,6 +367,88 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
     EXPECT_EQ("rates", generatorProfile->ratesArrayString());
     EXPECT_EQ("variables", generatorProfile->variablesArrayString());
 
+    EXPECT_EQ("taus", generatorProfile->rushLarsenTausArrayString());
+    EXPECT_EQ("yInfs", generatorProfile->rushLarsenSteadyStatesArrayString());
+    EXPECT_EQ("[NAME]_[INDEX]", generatorProfile->localVariableNameString());
+    EXPECT_EQ("double ", generatorProfile->localVariableDeclarationString());
+
+    EXPECT_EQ("        states[[INDEX]] += dt*rates[[INDEX]];\n",
+              generatorProfile->forwardEulerStateUpdateString());
+    EXPECT_EQ("        states[[INDEX]] = yInfs[[INDEX]]+(states[[INDEX]]-yInfs[[INDEX]])*exp(-dt/taus[[INDEX]]);\n",
+              generatorProfile->rushLarsenStateUpdateString());
+
+    EXPECT_EQ("d[NAME]_d[PARAMETER]", generatorProfile->sensitivityNameString());
+    EXPECT_EQ("[NAME]Chunk[INDEX]", generatorProfile->chunkMethodNameString());
+
+    EXPECT_EQ("static double lookupTable[INDEX][[SIZE]];\n", generatorProfile->lookupTableDeclarationString());
+    EXPECT_EQ("lookupTable[INDEX][[COLUMN_COUNT]*i+[COLUMN]]", generatorProfile->lookupTableEntryString());
+    EXPECT_EQ("lookupTableValue(lookupTable[INDEX], [COLUMN_COUNT], [COLUMN], [STATE], [MINIMUM], [STEP], [SIZE])", generatorProfile->lookupTableValueCallString());
+    EXPECT_EQ("maxError = lookupTableError(maxError, [CODE], [VALUE]);\n", generatorProfile->lookupTableErrorString());
+    EXPECT_EQ("static double lookupTableValue(double *table, size_t columnCount, size_t column, double x, double minimum, double step, size_t size)\n"
+              "{\n"
+              "    double position = (x-minimum)/step;\n"
+              "\n"
+              "    if (isnan(position)) {\n"
+              "        return NAN;\n"
+              "    }\n"
+              "\n"
+              "    if (position <= 0.0) {\n"
+              "        return table[column];\n"
+              "    }\n"
+              "\n"
+              "    if (position >= size-1) {\n"
+              "        return table[columnCount*(size-1)+column];\n"
+              "    }\n"
+              "\n"
+              "    size_t i = (size_t) position;\n"
+              "    double fraction = position-i;\n"
+              "\n"
+              "    return (1.0-fraction)*table[columnCount*i+column]+fraction*table[columnCount*(i+1)+column];\n"
+              "}\n"
+              "\n"
+              "static double lookupTableError(double maxError, double exactValue, double value)\n"
+              "{\n"
+              "    if (isnan(maxError) || !isfinite(exactValue)) {\n"
+              "        return maxError;\n"
+              "    }\n"
+              "\n"
+              "    double error = fabs(exactValue-value);\n"
+              "\n"
+              "    return (error <= maxError)?maxError:error;\n"
+              "}\n",
+              generatorProfile->lookupTableValueMethodString());
+    EXPECT_EQ("    for (size_t i = 0; i < [SIZE]; ++i) {\n"
+              "        double row[[COLUMN_COUNT]];\n"
+              "\n"
+              "        [STATE] = [MINIMUM]+(i-0.001)*[STEP];\n"
+              "\n"
+              "[CODE]"
+              "\n"
+              "        for (size_t j = 0; j < [COLUMN_COUNT]; ++j) {\n"
+              "            row[j] = [ENTRY];\n"
+              "        }\n"
+              "\n"
+              "        [STATE] = [MINIMUM]+(i+0.001)*[STEP];\n"
+              "\n"
+              "[CODE]"
+              "\n"
+              "        for (size_t j = 0; j < [COLUMN_COUNT]; ++j) {\n"
+              "            [ENTRY] = 0.5*(row[j]+[ENTRY]);\n"
+              "        }\n"
+              "    }\n"
+              "\n"
+              "    for (size_t i = 0; i < [SIZE]-1; ++i) {\n"
+              "        [STATE] = [MINIMUM]+(i+0.5)*[STEP];\n"
+              "\n"
+              "[ERROR_CODE]"
+              "    }\n",
+              generatorProfile->lookupTableInitialisationString());
+
+    EXPECT_EQ("#pragma omp parallel for schedule(static, [BLOCK_SIZE])\n",
+              generatorProfile->ensembleOpenmpPragmaString());
+    EXPECT_EQ("    variables[[INDEX]] = parameters[[PARAMETER_INDEX]];\n",
+              generatorProfile->ensembleParameterAssignmentString());
+
     EXPECT_EQ("typedef double (* ExternalVariable)(double *variables, size_t index);\n", generatorProfile->externalVariableMethodTypeDefinitionString(false));
     EXPECT_EQ("typedef double (* ExternalVariable)(double voi, double *states, double *rates, double *variables, size_t index);\n", generatorProfile->externalVariableMethodTypeDefinitionString(true));
 
@@ -509,6 +607,177 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
               "}\n",
               generatorProfile->implementationComputeRatesMethodString(true));
 
+    EXPECT_EQ("void computeRushLarsenCoefficients(double voi, double *states, double *variables, double *taus, double *yInfs);\n",
+              generatorProfile->interfaceComputeRushLarsenCoefficientsMethodString());
+    EXPECT_EQ("void computeRushLarsenCoefficients(double voi, double *states, double *variables, double *taus, double *yInfs)\n"
+              "{\n"
+              "[CODE]"
+              "}\n",
+              generatorProfile->implementationComputeRushLarsenCoefficientsMethodString());
+    EXPECT_EQ("void computeRates(double voi, double * restrict states, double * restrict rates, double * restrict variables)\n"
+              "{\n"
+              "[CODE]"
+              "}\n",
+              generatorProfile->implementationComputeRatesMethodWithLocalVariablesString());
+
+    EXPECT_EQ("double initialiseLookupTables(double *variables);\n",
+              generatorProfile->interfaceInitialiseLookupTablesMethodString());
+    EXPECT_EQ("double initialiseLookupTables(double *variables)\n"
+              "{\n"
+              "    double *states = createStatesArray();\n"
+              "    double maxError = 0.0;\n"
+              "\n"
+              "[CODE]"
+              "\n"
+              "    deleteArray(states);\n"
+              "\n"
+              "    return maxError;\n"
+              "}\n",
+              generatorProfile->implementationInitialiseLookupTablesMethodString());
+
+    EXPECT_EQ("void initialiseEnsemble(size_t instanceCount, double *parameters, double *states, double *rates, double *variables);\n",
+              generatorProfile->interfaceInitialiseEnsembleMethodString());
+    EXPECT_EQ("static void initialiseEnsembleInstance(double *parameters, double *states, double *variables)\n"
+              "{\n"
+              "[CODE]"
+              "}\n"
+              "\n"
+              "void initialiseEnsemble(size_t instanceCount, double *parameters, double *states, double *rates, double *variables)\n"
+              "{\n"
+              "[OPENMP_PRAGMA]"
+              "    for (size_t i = 0; i < instanceCount; ++i) {\n"
+              "        initialiseVariables(states+i*STATE_COUNT, rates+i*STATE_COUNT, variables+i*VARIABLE_COUNT);\n"
+              "        initialiseEnsembleInstance(parameters+i*ENSEMBLE_PARAMETER_COUNT, states+i*STATE_COUNT, variables+i*VARIABLE_COUNT);\n"
+              "        computeComputedConstants(variables+i*VARIABLE_COUNT);\n"
+              "    }\n"
+              "}\n",
+              generatorProfile->implementationInitialiseEnsembleMethodString());
+
+    EXPECT_EQ("void computeEnsembleRates(size_t instanceCount, double voi, double *states, double *rates, double *variables);\n",
+              generatorProfile->interfaceComputeEnsembleRatesMethodString());
+    EXPECT_EQ("void computeEnsembleRates(size_t instanceCount, double voi, double *states, double *rates, double *variables)\n"
+              "{\n"
+              "[OPENMP_PRAGMA]"
+              "    for (size_t i = 0; i < instanceCount; ++i) {\n"
+              "        computeRates(voi, states+i*STATE_COUNT, rates+i*STATE_COUNT, variables+i*VARIABLE_COUNT);\n"
+              "    }\n"
+              "}\n",
+              generatorProfile->implementationComputeEnsembleRatesMethodString());
+
+    EXPECT_EQ("void computeEnsembleVariables(size_t instanceCount, double voi, double *states, double *rates, double *variables);\n",
+              generatorProfile->interfaceComputeEnsembleVariablesMethodString());
+    EXPECT_EQ("void computeEnsembleVariables(size_t instanceCount, double voi, double *states, double *rates, double *variables)\n"
+              "{\n"
+              "[OPENMP_PRAGMA]"
+              "    for (size_t i = 0; i < instanceCount; ++i) {\n"
+              "        computeVariables(voi, states+i*STATE_COUNT, rates+i*STATE_COUNT, variables+i*VARIABLE_COUNT);\n"
+              "    }\n"
+              "}\n",
+              generatorProfile->implementationComputeEnsembleVariablesMethodString());
+
+    EXPECT_EQ("void integrateForwardEuler(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer);\n",
+              generatorProfile->interfaceIntegrateForwardEulerMethodString());
+    EXPECT_EQ("void integrateForwardEuler(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer)\n"
+              "{\n"
+              "    for (size_t step = 0; step < nSteps; ++step) {\n"
+              "        computeRates(voi0+step*dt, states, rates, variables);\n"
+              "\n"
+              "        for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+              "            states[i] += dt*rates[i];\n"
+              "        }\n"
+              "\n"
+              "        if ((outputBuffer != NULL) && (outputStride != 0) && ((step+1)%outputStride == 0)) {\n"
+              "            for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+              "                outputBuffer[i] = states[i];\n"
+              "            }\n"
+              "\n"
+              "            outputBuffer += STATE_COUNT;\n"
+              "        }\n"
+              "    }\n"
+              "}\n",
+              generatorProfile->implementationIntegrateForwardEulerMethodString());
+
+    EXPECT_EQ("void integrateRK4(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer);\n",
+              generatorProfile->interfaceIntegrateRk4MethodString());
+    EXPECT_EQ("void integrateRK4(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer)\n"
+              "{\n"
+              "    double *k2 = createStatesArray();\n"
+              "    double *k3 = createStatesArray();\n"
+              "    double *k4 = createStatesArray();\n"
+              "    double *y = createStatesArray();\n"
+              "\n"
+              "    for (size_t step = 0; step < nSteps; ++step) {\n"
+              "        double voi = voi0+step*dt;\n"
+              "\n"
+              "        computeRates(voi, states, rates, variables);\n"
+              "\n"
+              "        for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+              "            y[i] = states[i]+0.5*dt*rates[i];\n"
+              "        }\n"
+              "\n"
+              "        computeRates(voi+0.5*dt, y, k2, variables);\n"
+              "\n"
+              "        for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+              "            y[i] = states[i]+0.5*dt*k2[i];\n"
+              "        }\n"
+              "\n"
+              "        computeRates(voi+0.5*dt, y, k3, variables);\n"
+              "\n"
+              "        for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+              "            y[i] = states[i]+dt*k3[i];\n"
+              "        }\n"
+              "\n"
+              "        computeRates(voi+dt, y, k4, variables);\n"
+              "\n"
+              "        for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+              "            states[i] += dt*(rates[i]+2.0*(k2[i]+k3[i])+k4[i])/6.0;\n"
+              "        }\n"
+              "\n"
+              "        if ((outputBuffer != NULL) && (outputStride != 0) && ((step+1)%outputStride == 0)) {\n"
+              "            for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+              "                outputBuffer[i] = states[i];\n"
+              "            }\n"
+              "\n"
+              "            outputBuffer += STATE_COUNT;\n"
+              "        }\n"
+              "    }\n"
+              "\n"
+              "    deleteArray(k2);\n"
+              "    deleteArray(k3);\n"
+              "    deleteArray(k4);\n"
+              "    deleteArray(y);\n"
+              "}\n",
+              generatorProfile->implementationIntegrateRk4MethodString());
+
+    EXPECT_EQ("void integrateRushLarsen(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer);\n",
+              generatorProfile->interfaceIntegrateRushLarsenMethodString());
+    EXPECT_EQ("void integrateRushLarsen(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer)\n"
+              "{\n"
+              "    double *taus = createStatesArray();\n"
+              "    double *yInfs = createStatesArray();\n"
+              "\n"
+              "    for (size_t step = 0; step < nSteps; ++step) {\n"
+              "        double voi = voi0+step*dt;\n"
+              "\n"
+              "        computeRates(voi, states, rates, variables);\n"
+              "        computeRushLarsenCoefficients(voi, states, variables, taus, yInfs);\n"
+              "\n"
+              "[CODE]"
+              "\n"
+              "        if ((outputBuffer != NULL) && (outputStride != 0) && ((step+1)%outputStride == 0)) {\n"
+              "            for (size_t i = 0; i < STATE_COUNT; ++i) {\n"
+              "                outputBuffer[i] = states[i];\n"
+              "            }\n"
+              "\n"
+              "            outputBuffer += STATE_COUNT;\n"
+              "        }\n"
+              "    }\n"
+              "\n"
+              "    deleteArray(taus);\n"
+              "    deleteArray(yInfs);\n"
+              "}\n",
+              generatorProfile->implementationIntegrateRushLarsenMethodString());
+
     EXPECT_EQ("void computeVariables(double *variables);\n",
               generatorProfile->interfaceComputeVariablesMethodString(false, false));
     EXPECT_EQ("void computeVariables(double *variables)\n"
@@ -568,11 +837,167 @@ TEST(GeneratorProfile, generalSettings)
     generatorProfile->setProfile(profile);
 
     generatorProfile->setHasInterface(falseValue);
+    generatorProfile->setHasComputeRushLarsenCoefficientsMethod(!falseValue);
+    generatorProfile->setHasLocalVariablesInComputeRates(!falseValue);
+    generatorProfile->setHasIntegrateMethods(!falseValue);
 
     EXPECT_EQ(profile, generatorProfile->profile());
     EXPECT_EQ("python", libcellml::GeneratorProfile::profileAsString(generatorProfile->profile()));
 
     EXPECT_EQ(falseValue, generatorProfile->hasInterface());
+    EXPECT_EQ(!falseValue, generatorProfile->hasComputeRushLarsenCoefficientsMethod());
+    EXPECT_EQ(!falseValue, generatorProfile->hasLocalVariablesInComputeRates());
+    EXPECT_EQ(!falseValue, generatorProfile->hasIntegrateMethods());
+}
+
+TEST(GeneratorProfile, precision)
+{
+    libcellml::GeneratorProfilePtr generatorProfile = libcellml::GeneratorProfile::create();
+
+    // Single precision.
+
+    generatorProfile->setPrecision(libcellml::GeneratorProfile::Precision::SINGLE);
+
+    EXPECT_EQ(libcellml::GeneratorProfile::Precision::SINGLE, generatorProfile->precision());
+    EXPECT_EQ("single", libcellml::GeneratorProfile::precisionAsString(generatorProfile->precision()));
+
+    EXPECT_EQ("powf", generatorProfile->powerString());
+    EXPECT_EQ("expf", generatorProfile->exponentialString());
+    EXPECT_EQ("atanhf", generatorProfile->atanhString());
+    EXPECT_EQ("1.0f", generatorProfile->trueString());
+    EXPECT_EQ("f", generatorProfile->literalSuffixString());
+    EXPECT_EQ("float ", generatorProfile->localVariableDeclarationString());
+    EXPECT_EQ("float sec(float x)\n"
+              "{\n"
+              "    return 1.0f/cosf(x);\n"
+              "}\n",
+              generatorProfile->secFunctionString());
+    EXPECT_EQ("float * createStatesArray();\n", generatorProfile->interfaceCreateStatesArrayMethodString());
+    EXPECT_EQ("float * createVariablesArray();\n", generatorProfile->interfaceCreateVariablesArrayMethodString());
+    EXPECT_EQ("void computeRates(float voi, float *states, float *rates, float *variables);\n", generatorProfile->interfaceComputeRatesMethodString(false));
+    EXPECT_EQ("const char VERSION[] = \"0.5.0\";\n", generatorProfile->implementationVersionString());
+
+    // Mixed precision.
+
+    generatorProfile->setPrecision(libcellml::GeneratorProfile::Precision::MIXED);
+
+    EXPECT_EQ(libcellml::GeneratorProfile::Precision::MIXED, generatorProfile->precision());
+    EXPECT_EQ("mixed", libcellml::GeneratorProfile::precisionAsString(generatorProfile->precision()));
+
+    EXPECT_EQ("exp", generatorProfile->exponentialString());
+    EXPECT_EQ("1.0", generatorProfile->trueString());
+    EXPECT_EQ("", generatorProfile->literalSuffixString());
+    EXPECT_EQ("float ", generatorProfile->localVariableDeclarationString());
+    EXPECT_EQ("double * createStatesArray();\n", generatorProfile->interfaceCreateStatesArrayMethodString());
+    EXPECT_EQ("float * createVariablesArray();\n", generatorProfile->interfaceCreateVariablesArrayMethodString());
+    EXPECT_EQ("void deleteArray(void *array);\n", generatorProfile->interfaceDeleteArrayMethodString());
+    EXPECT_EQ("void computeRates(double voi, double *states, double *rates, float *variables);\n", generatorProfile->interfaceComputeRatesMethodString(false));
+
+    // Setting the precision reloads the profile.
+
+    generatorProfile->setExponentialString("myExp");
+    generatorProfile->setPrecision(libcellml::GeneratorProfile::Precision::DOUBLE);
+
+    EXPECT_EQ("exp", generatorProfile->exponentialString());
+    EXPECT_EQ("double ", generatorProfile->localVariableDeclarationString());
+    EXPECT_EQ("void deleteArray(double *array);\n", generatorProfile->interfaceDeleteArrayMethodString());
+
+    // The precision is kept when changing profiles, but it has no effect on the
+    // Python profile.
+
+    generatorProfile->setPrecision(libcellml::GeneratorProfile::Precision::SINGLE);
+    generatorProfile->setProfile(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    EXPECT_EQ(libcellml::GeneratorProfile::Precision::SINGLE, generatorProfile->precision());
+    EXPECT_EQ("exp", generatorProfile->exponentialString());
+    EXPECT_EQ("", generatorProfile->literalSuffixString());
+
+    generatorProfile->setProfile(libcellml::GeneratorProfile::Profile::C);
+
+    EXPECT_EQ("expf", generatorProfile->exponentialString());
+}
+
+TEST(GeneratorProfile, cppProfile)
+{
+    libcellml::GeneratorProfilePtr generatorProfile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::CPP);
+
+    EXPECT_EQ(libcellml::GeneratorProfile::Profile::CPP, generatorProfile->profile());
+    EXPECT_EQ("cpp", libcellml::GeneratorProfile::profileAsString(generatorProfile->profile()));
+
+    EXPECT_EQ(false, generatorProfile->hasInterface());
+    EXPECT_EQ("", generatorProfile->interfaceFileNameString());
+    EXPECT_EQ("", generatorProfile->interfaceComputeRatesMethodString(false));
+
+    EXPECT_EQ("", generatorProfile->namespaceString());
+    EXPECT_EQ("namespace [NAMESPACE] {\n", generatorProfile->implementationNamespaceBeginString());
+    EXPECT_EQ("} // namespace [NAMESPACE]\n", generatorProfile->implementationNamespaceEndString());
+
+    EXPECT_EQ("T ", generatorProfile->localVariableDeclarationString());
+    EXPECT_EQ("constexpr size_t STATE_COUNT = [STATE_COUNT];\n", generatorProfile->implementationStateCountString());
+    EXPECT_EQ("template <typename T>\n"
+              "inline void computeRates(T voi, T *states, T *rates, T *variables)\n"
+              "{\n"
+              "[CODE]"
+              "}\n",
+              generatorProfile->implementationComputeRatesMethodString(false));
+    EXPECT_EQ("template <typename T>\n"
+              "inline void deleteArray(T *array)\n"
+              "{\n"
+              "    delete[] array;\n"
+              "}\n",
+              generatorProfile->implementationDeleteArrayMethodString());
+
+    // The precision has no effect on the C++ profile.
+
+    generatorProfile->setPrecision(libcellml::GeneratorProfile::Precision::SINGLE);
+
+    EXPECT_EQ("exp", generatorProfile->exponentialString());
+    EXPECT_EQ("", generatorProfile->literalSuffixString());
+    EXPECT_EQ("T ", generatorProfile->localVariableDeclarationString());
+}
+
+TEST(GeneratorProfile, numpyProfile)
+{
+    libcellml::GeneratorProfilePtr generatorProfile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::NUMPY);
+
+    EXPECT_EQ(libcellml::GeneratorProfile::Profile::NUMPY, generatorProfile->profile());
+    EXPECT_EQ("numpy", libcellml::GeneratorProfile::profileAsString(generatorProfile->profile()));
+
+    EXPECT_EQ(false, generatorProfile->hasInterface());
+
+    EXPECT_EQ("eq_func", generatorProfile->eqString());
+    EXPECT_EQ("\n"
+              "def eq_func(x, y):\n"
+              "    return numpy.where(x == y, 1.0, 0.0)\n",
+              generatorProfile->eqFunctionString());
+    EXPECT_EQ("numpy.exp", generatorProfile->exponentialString());
+    EXPECT_EQ("numpy.minimum", generatorProfile->minString());
+    EXPECT_EQ("", generatorProfile->minFunctionString());
+    EXPECT_EQ("numpy.arcsin", generatorProfile->asinString());
+    EXPECT_EQ("numpy.where([CONDITION], [IF_STATEMENT]", generatorProfile->conditionalOperatorIfString());
+    EXPECT_EQ(", [ELSE_STATEMENT])", generatorProfile->conditionalOperatorElseString());
+    EXPECT_EQ("numpy.nan", generatorProfile->nanString());
+    EXPECT_EQ("\n"
+              "def create_states_array(instance_count=1):\n"
+              "    return numpy.full((STATE_COUNT, instance_count), numpy.nan)\n",
+              generatorProfile->implementationCreateStatesArrayMethodString());
+
+    // Lookup tables are not supported.
+
+    EXPECT_EQ("", generatorProfile->lookupTableDeclarationString());
+    EXPECT_EQ("", generatorProfile->lookupTableEntryString());
+    EXPECT_EQ("", generatorProfile->lookupTableValueCallString());
+    EXPECT_EQ("", generatorProfile->lookupTableErrorString());
+    EXPECT_EQ("", generatorProfile->lookupTableValueMethodString());
+    EXPECT_EQ("", generatorProfile->lookupTableInitialisationString());
+    EXPECT_EQ("", generatorProfile->implementationInitialiseLookupTablesMethodString());
+
+    // The rest of the profile is the same as the Python profile.
+
+    EXPECT_EQ("\n"
+              "def compute_rates(voi, states, rates, variables):\n"
+              "[CODE]",
+              generatorProfile->implementationComputeRatesMethodString(false));
 }
 
 TEST(GeneratorProfile, relationalAndLogicalOperators)
@@ -767,6 +1192,7 @@ TEST(GeneratorProfile, constants)
     generatorProfile->setPiString(value);
     generatorProfile->setInfString(value);
     generatorProfile->setNanString(value);
+    generatorProfile->setLiteralSuffixString(value);
 
     EXPECT_EQ(value, generatorProfile->trueString());
     EXPECT_EQ(value, generatorProfile->falseString());
@@ -774,6 +1200,7 @@ TEST(GeneratorProfile, constants)
     EXPECT_EQ(value, generatorProfile->piString());
     EXPECT_EQ(value, generatorProfile->infString());
     EXPECT_EQ(value, generatorProfile->nanString());
+    EXPECT_EQ(value, generatorProfile->literalSuffixString());
 }
 
 TEST(GeneratorProfile, arithmeticFunctions)
@@ -856,6 +1283,10 @@ TEST(GeneratorProfile, miscellaneous)
     generatorProfile->setInterfaceHeaderString(value);
     generatorProfile->setImplementationHeaderString(value);
 
+    generatorProfile->setNamespaceString(value);
+    generatorProfile->setImplementationNamespaceBeginString(value);
+    generatorProfile->setImplementationNamespaceEndString(value);
+
     generatorProfile->setInterfaceVersionString(value);
     generatorProfile->setImplementationVersionString(value);
 
@@ -868,6 +1299,9 @@ TEST(GeneratorProfile, miscellaneous)
     generatorProfile->setInterfaceVariableCountString(value);
     generatorProfile->setImplementationVariableCountString(value);
 
+    generatorProfile->setInterfaceEnsembleParameterCountString(value);
+    generatorProfile->setImplementationEnsembleParameterCountString(value);
+
     generatorProfile->setVariableTypeObjectString(false, false, value);
     generatorProfile->setVariableTypeObjectString(false, true, value);
     generatorProfile->setVariableTypeObjectString(true, false, value);
@@ -899,6 +1333,27 @@ TEST(GeneratorProfile, miscellaneous)
     generatorProfile->setRatesArrayString(value);
     generatorProfile->setVariablesArrayString(value);
 
+    generatorProfile->setRushLarsenTausArrayString(value);
+    generatorProfile->setRushLarsenSteadyStatesArrayString(value);
+    generatorProfile->setLocalVariableNameString(value);
+    generatorProfile->setLocalVariableDeclarationString(value);
+
+    generatorProfile->setForwardEulerStateUpdateString(value);
+    generatorProfile->setRushLarsenStateUpdateString(value);
+
+    generatorProfile->setSensitivityNameString(value);
+    generatorProfile->setChunkMethodNameString(value);
+
+    generatorProfile->setLookupTableDeclarationString(value);
+    generatorProfile->setLookupTableEntryString(value);
+    generatorProfile->setLookupTableValueCallString(value);
+    generatorProfile->setLookupTableErrorString(value);
+    generatorProfile->setLookupTableValueMethodString(value);
+    generatorProfile->setLookupTableInitialisationString(value);
+
+    generatorProfile->setEnsembleOpenmpPragmaString(value);
+    generatorProfile->setEnsembleParameterAssignmentString(value);
+
     generatorProfile->setExternalVariableMethodTypeDefinitionString(false, value);
     generatorProfile->setExternalVariableMethodTypeDefinitionString(true, value);
 
@@ -949,6 +1404,31 @@ TEST(GeneratorProfile, miscellaneous)
     generatorProfile->setInterfaceComputeRatesMethodString(true, value);
     generatorProfile->setImplementationComputeRatesMethodString(true, value);
 
+    generatorProfile->setInterfaceComputeRushLarsenCoefficientsMethodString(value);
+    generatorProfile->setImplementationComputeRushLarsenCoefficientsMethodString(value);
+    generatorProfile->setImplementationComputeRatesMethodWithLocalVariablesString(value);
+
+    generatorProfile->setInterfaceInitialiseLookupTablesMethodString(value);
+    generatorProfile->setImplementationInitialiseLookupTablesMethodString(value);
+
+    generatorProfile->setInterfaceInitialiseEnsembleMethodString(value);
+    generatorProfile->setImplementationInitialiseEnsembleMethodString(value);
+
+    generatorProfile->setInterfaceComputeEnsembleRatesMethodString(value);
+    generatorProfile->setImplementationComputeEnsembleRatesMethodString(value);
+
+    generatorProfile->setInterfaceComputeEnsembleVariablesMethodString(value);
+    generatorProfile->setImplementationComputeEnsembleVariablesMethodString(value);
+
+    generatorProfile->setInterfaceIntegrateForwardEulerMethodString(value);
+    generatorProfile->setImplementationIntegrateForwardEulerMethodString(value);
+
+    generatorProfile->setInterfaceIntegrateRk4MethodString(value);
+    generatorProfile->setImplementationIntegrateRk4MethodString(value);
+
+    generatorProfile->setInterfaceIntegrateRushLarsenMethodString(value);
+    generatorProfile->setImplementationIntegrateRushLarsenMethodString(value);
+
     generatorProfile->setInterfaceComputeVariablesMethodString(false, false, value);
     generatorProfile->setImplementationComputeVariablesMethodString(false, false, value);
 
@@ -985,6 +1465,10 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->interfaceHeaderString());
     EXPECT_EQ(value, generatorProfile->implementationHeaderString());
 
+    EXPECT_EQ(value, generatorProfile->namespaceString());
+    EXPECT_EQ(value, generatorProfile->implementationNamespaceBeginString());
+    EXPECT_EQ(value, generatorProfile->implementationNamespaceEndString());
+
     EXPECT_EQ(value, generatorProfile->interfaceVersionString());
     EXPECT_EQ(value, generatorProfile->implementationVersionString());
 
@@ -997,6 +1481,9 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->interfaceVariableCountString());
     EXPECT_EQ(value, generatorProfile->implementationVariableCountString());
 
+    EXPECT_EQ(value, generatorProfile->interfaceEnsembleParameterCountString());
+    EXPECT_EQ(value, generatorProfile->implementationEnsembleParameterCountString());
+
     EXPECT_EQ(value, generatorProfile->variableTypeObjectString(false, false));
     EXPECT_EQ(value, generatorProfile->variableTypeObjectString(false, true));
     EXPECT_EQ(value, generatorProfile->variableTypeObjectString(true, false));
@@ -1028,6 +1515,27 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->ratesArrayString());
     EXPECT_EQ(value, generatorProfile->variablesArrayString());
 
+    EXPECT_EQ(value, generatorProfile->rushLarsenTausArrayString());
+    EXPECT_EQ(value, generatorProfile->rushLarsenSteadyStatesArrayString());
+    EXPECT_EQ(value, generatorProfile->localVariableNameString());
+    EXPECT_EQ(value, generatorProfile->localVariableDeclarationString());
+
+    EXPECT_EQ(value, generatorProfile->forwardEulerStateUpdateString());
+    EXPECT_EQ(value, generatorProfile->rushLarsenStateUpdateString());
+
+    EXPECT_EQ(value, generatorProfile->sensitivityNameString());
+    EXPECT_EQ(value, generatorProfile->chunkMethodNameString());
+
+    EXPECT_EQ(value, generatorProfile->lookupTableDeclarationString());
+    EXPECT_EQ(value, generatorProfile->lookupTableEntryString());
+    EXPECT_EQ(value, generatorProfile->lookupTableValueCallString());
+    EXPECT_EQ(value, generatorProfile->lookupTableErrorString());
+    EXPECT_EQ(value, generatorProfile->lookupTableValueMethodString());
+    EXPECT_EQ(value, generatorProfile->lookupTableInitialisationString());
+
+    EXPECT_EQ(value, generatorProfile->ensembleOpenmpPragmaString());
+    EXPECT_EQ(value, generatorProfile->ensembleParameterAssignmentString());
+
     EXPECT_EQ(value, generatorProfile->externalVariableMethodTypeDefinitionString(false));
     EXPECT_EQ(value, generatorProfile->externalVariableMethodTypeDefinitionString(true));
 
@@ -1078,6 +1586,31 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->interfaceComputeRatesMethodString(true));
     EXPECT_EQ(value, generatorProfile->implementationComputeRatesMethodString(true));
 
+    EXPECT_EQ(value, generatorProfile->interfaceComputeRushLarsenCoefficientsMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeRushLarsenCoefficientsMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeRatesMethodWithLocalVariablesString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceInitialiseLookupTablesMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationInitialiseLookupTablesMethodString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceInitialiseEnsembleMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationInitialiseEnsembleMethodString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceComputeEnsembleRatesMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeEnsembleRatesMethodString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceComputeEnsembleVariablesMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeEnsembleVariablesMethodString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceIntegrateForwardEulerMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationIntegrateForwardEulerMethodString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceIntegrateRk4MethodString());
+    EXPECT_EQ(value, generatorProfile->implementationIntegrateRk4MethodString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceIntegrateRushLarsenMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationIntegrateRushLarsenMethodString());
+
     EXPECT_EQ(value, generatorProfile->interfaceComputeVariablesMethodString(false, false));
     EXPECT_EQ(value, generatorProfile->implementationComputeVariablesMethodString(false, false));
 
@@ -0,0 +1,62 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.lookup.tables.hpp"
+
+using namespace hodgkin_huxley_squid_axon_model_1952_with_lookup_tables;
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952LookupTablesAreFinite)
+{
+    // alpha_m and alpha_n have a removable singularity at V = -25 mV and
+    // V = -10 mV, respectively, both of which fall on a row of the lookup
+    // table, so make sure that none of its entries are non-finite.
+
+    auto states = createStatesArray<double>();
+    auto rates = createStatesArray<double>();
+    auto variables = createVariablesArray<double>();
+
+    initialiseVariables<double>(states, rates, variables);
+    computeComputedConstants<double>(variables);
+
+    auto maxError = initialiseLookupTables<double>(variables);
+
+    EXPECT_TRUE(std::isfinite(maxError));
+    EXPECT_LT(maxError, 1.0e-5);
+
+    for (size_t i = 0; i < 15001 * 6; ++i) {
+        EXPECT_TRUE(std::isfinite(lookupTable0<double>[i])) << "Entry " << i << " is not finite.";
+    }
+
+    states[0] = -25.0;
+
+    computeRates<double>(0.0, states, rates, variables);
+
+    EXPECT_NEAR(1.0, variables[10], 1.0e-6);
+
+    states[0] = -10.0;
+
+    computeRates<double>(0.0, states, rates, variables);
+
+    EXPECT_NEAR(0.1, variables[16], 1.0e-6);
+
+    deleteArray(states);
+    deleteArray(rates);
+    deleteArray(variables);
+}
@@ -0,0 +1,93 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+// The generated code for the different precisions defines the same symbols, so
+// include each version of it in its own namespace, after having included the
+// system headers it relies on (so that they don't end up in those namespaces).
+
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+namespace doublePrecision {
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.c"
+} // namespace doublePrecision
+
+namespace singlePrecision {
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.single.precision.c"
+} // namespace singlePrecision
+
+namespace mixedPrecision {
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.mixed.precision.c"
+} // namespace mixedPrecision
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952PrecisionDeviation)
+{
+    // Integrate the model for 50 ms using forward Euler with a time step of
+    // 0.001 ms in double, single, and mixed precision, and check that the
+    // maximum deviation of the membrane potential from its double-precision
+    // value is in line with what is expected from single- and mixed-precision
+    // code, i.e. about 4e-2 mV and 7e-7 mV, respectively.
+
+    static const double END = 50.0;
+    static const double STEP = 0.001;
+
+    double dStates[4];
+    double dRates[4];
+    double dVariables[18];
+    float sStates[4];
+    float sRates[4];
+    float sVariables[18];
+    double mStates[4];
+    double mRates[4];
+    float mVariables[18];
+
+    doublePrecision::initialiseVariables(dStates, dRates, dVariables);
+    doublePrecision::computeComputedConstants(dVariables);
+    singlePrecision::initialiseVariables(sStates, sRates, sVariables);
+    singlePrecision::computeComputedConstants(sVariables);
+    mixedPrecision::initialiseVariables(mStates, mRates, mVariables);
+    mixedPrecision::computeComputedConstants(mVariables);
+
+    double singleMaxDeviation = 0.0;
+    double mixedMaxDeviation = 0.0;
+    size_t stepCount = static_cast<size_t>(std::round(END / STEP));
+
+    for (size_t i = 0; i < stepCount; ++i) {
+        double voi = static_cast<double>(i) * STEP;
+
+        doublePrecision::computeRates(voi, dStates, dRates, dVariables);
+        singlePrecision::computeRates(static_cast<float>(voi), sStates, sRates, sVariables);
+        mixedPrecision::computeRates(voi, mStates, mRates, mVariables);
+
+        for (size_t j = 0; j < 4; ++j) {
+            dStates[j] += STEP * dRates[j];
+            sStates[j] += static_cast<float>(STEP) * sRates[j];
+            mStates[j] += STEP * mRates[j];
+        }
+
+        singleMaxDeviation = std::fmax(singleMaxDeviation, std::fabs(static_cast<double>(sStates[0]) - dStates[0]));
+        mixedMaxDeviation = std::fmax(mixedMaxDeviation, std::fabs(mStates[0] - dStates[0]));
+    }
+
+    EXPECT_TRUE(std::isfinite(dStates[0]));
+    EXPECT_LT(singleMaxDeviation, 5.0e-2);
+    EXPECT_LT(mixedMaxDeviation, 1.0e-6);
+}
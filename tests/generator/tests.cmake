@@ -4,6 +4,26 @@ set(${CURRENT_TEST}_CATEGORY io)
 list(APPEND LIBCELLML_TESTS ${CURRENT_TEST})
 
 set(${CURRENT_TEST}_SRCS
+  ${CMAKE_CURRENT_LIST_DIR}/cppnamespaces.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/ensemble.cpp
   ${CMAKE_CURRENT_LIST_DIR}/generator.cpp
   ${CMAKE_CURRENT_LIST_DIR}/generatorprofile.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/lookuptables.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/precision.cpp
 )
+
+# The generated code that is included in some of our tests doesn't use all of
+# the parameters of its methods and may contain OpenMP pragmas.
+
+set(GENERATED_CODE_TEST_SRCS
+  ${CMAKE_CURRENT_LIST_DIR}/cppnamespaces.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/ensemble.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/lookuptables.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/precision.cpp
+)
+
+if(MSVC)
+  set_source_files_properties(${GENERATED_CODE_TEST_SRCS} PROPERTIES COMPILE_OPTIONS "/wd4068;/wd4100")
+else()
+  set_source_files_properties(${GENERATED_CODE_TEST_SRCS} PROPERTIES COMPILE_OPTIONS "-Wno-unknown-pragmas;-Wno-unused-parameter")
+endif()
@@ -1315,3 +1315,32 @@ TEST(Importer, importingCommonUnitsFromTriangleImportStructureStrict)
 {
     testImporterWithInvalidImportedModels(true);
 }
+
+TEST(Importer, issueStreaming)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("importer/import_invalid_component.cellml"));
+    auto importer = libcellml::Importer::create();
+
+    importer->resolveImports(model, resourcePath("importer"));
+
+    EXPECT_LT(size_t(0), importer->issueCount());
+
+    // Check that the issues of an import are only streamed once they are
+    // final, i.e. once the import has been resolved.
+
+    auto streamingImporter = libcellml::Importer::create();
+    std::vector<std::string> streamedIssues;
+
+    streamingImporter->setIssueCallback([&streamedIssues](const libcellml::IssuePtr &issue) {
+        streamedIssues.push_back(issue->description());
+
+        return true;
+    });
+    streamingImporter->setRetainIssues(false);
+    streamingImporter->resolveImports(model, resourcePath("importer"));
+
+    EXPECT_EQ(importer->issueCount(), streamingImporter->issueCount());
+    EXPECT_EQ(nullptr, streamingImporter->issue(0));
+    EXPECT_EQ_ISSUES(streamedIssues, importer);
+}
@@ -1163,3 +1163,38 @@ TEST(Model, removeAllComponentsImportedChild)
     model->removeAllComponents();
     EXPECT_EQ(size_t(0), model->componentCount());
 }
+
+TEST(Model, unitsLookupByNameAfterChanges)
+{
+    libcellml::ModelPtr m = libcellml::Model::create("model");
+    libcellml::UnitsPtr u1 = libcellml::Units::create("u1");
+    libcellml::UnitsPtr u2 = libcellml::Units::create("u2");
+    libcellml::UnitsPtr u3 = libcellml::Units::create("u3");
+
+    m->addUnits(u1);
+    m->addUnits(u2);
+
+    u1->setName("u2");
+
+    EXPECT_EQ(u1, m->units("u2"));
+    EXPECT_FALSE(m->hasUnits("u1"));
+
+    EXPECT_TRUE(m->replaceUnits(size_t(0), u3));
+    EXPECT_EQ(u3, m->units("u3"));
+    EXPECT_EQ(u2, m->units("u2"));
+
+    u3->setName("u4");
+
+    EXPECT_EQ(u3, m->units("u4"));
+    EXPECT_FALSE(m->hasUnits("u3"));
+
+    EXPECT_EQ(u2, m->takeUnits("u2"));
+    EXPECT_EQ(nullptr, m->units("u2"));
+
+    u2->setName("u4");
+
+    EXPECT_EQ(u3, m->units("u4"));
+
+    EXPECT_TRUE(m->removeUnits("u4"));
+    EXPECT_EQ(size_t(0), m->unitsCount());
+}
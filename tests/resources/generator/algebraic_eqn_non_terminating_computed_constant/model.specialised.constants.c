@@ -0,0 +1,48 @@
+/* The content of this file was generated using the C profile of libCellML 0.5.0. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.5.0";
+const char LIBCELLML_VERSION[] = "0.5.0";
+
+const size_t VARIABLE_COUNT = 3;
+
+const VariableInfo VARIABLE_INFO[] = {
+    {"x", "dimensionless", "my_algebraic_eqn", COMPUTED_CONSTANT},
+    {"a", "dimensionless", "my_algebraic_eqn", CONSTANT},
+    {"b", "dimensionless", "my_algebraic_eqn", CONSTANT}
+};
+
+double * createVariablesArray()
+{
+    double *res = (double *) malloc(VARIABLE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initialiseVariables(double *variables)
+{
+    variables[1] = 1.0;
+    variables[2] = 3.0;
+}
+
+void computeComputedConstants(double *variables)
+{
+    variables[0] = 0.33333333333333331;
+}
+
+void computeVariables(double *variables)
+{
+}
@@ -0,0 +1,101 @@
+/* The content of this file was generated using the C profile of libCellML 0.5.0. */
+
+#include "model.ensemble.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.5.0";
+const char LIBCELLML_VERSION[] = "0.5.0";
+
+const size_t STATE_COUNT = 1;
+const size_t VARIABLE_COUNT = 1;
+const size_t ENSEMBLE_PARAMETER_COUNT = 1;
+
+const VariableInfo VOI_INFO = {"t", "ms", "environment", VARIABLE_OF_INTEGRATION};
+
+const VariableInfo STATE_INFO[] = {
+    {"x", "mV", "main", STATE}
+};
+
+const VariableInfo VARIABLE_INFO[] = {
+    {"k", "mV", "constants", CONSTANT}
+};
+
+double * createStatesArray()
+{
+    double *res = (double *) malloc(STATE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+double * createVariablesArray()
+{
+    double *res = (double *) malloc(VARIABLE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initialiseVariables(double *states, double *rates, double *variables)
+{
+    variables[0] = 123.0;
+    states[0] = variables[0];
+}
+
+void computeComputedConstants(double *variables)
+{
+}
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    rates[0] = 1.23;
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+}
+
+static void initialiseEnsembleInstance(double *parameters, double *states, double *variables)
+{
+    variables[0] = parameters[0];
+    states[0] = variables[0];
+}
+
+void initialiseEnsemble(size_t instanceCount, double *parameters, double *states, double *rates, double *variables)
+{
+#pragma omp parallel for schedule(static, 1365)
+    for (size_t i = 0; i < instanceCount; ++i) {
+        initialiseVariables(states+i*STATE_COUNT, rates+i*STATE_COUNT, variables+i*VARIABLE_COUNT);
+        initialiseEnsembleInstance(parameters+i*ENSEMBLE_PARAMETER_COUNT, states+i*STATE_COUNT, variables+i*VARIABLE_COUNT);
+        computeComputedConstants(variables+i*VARIABLE_COUNT);
+    }
+}
+
+void computeEnsembleRates(size_t instanceCount, double voi, double *states, double *rates, double *variables)
+{
+#pragma omp parallel for schedule(static, 1365)
+    for (size_t i = 0; i < instanceCount; ++i) {
+        computeRates(voi, states+i*STATE_COUNT, rates+i*STATE_COUNT, variables+i*VARIABLE_COUNT);
+    }
+}
+
+void computeEnsembleVariables(size_t instanceCount, double voi, double *states, double *rates, double *variables)
+{
+#pragma omp parallel for schedule(static, 1365)
+    for (size_t i = 0; i < instanceCount; ++i) {
+        computeVariables(voi, states+i*STATE_COUNT, rates+i*STATE_COUNT, variables+i*VARIABLE_COUNT);
+    }
+}
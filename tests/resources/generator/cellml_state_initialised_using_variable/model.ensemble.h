@@ -0,0 +1,44 @@
+/* The content of this file was generated using the C profile of libCellML 0.5.0. */
+
+#pragma once
+
+#include <stddef.h>
+
+extern const char VERSION[];
+extern const char LIBCELLML_VERSION[];
+
+extern const size_t STATE_COUNT;
+extern const size_t VARIABLE_COUNT;
+extern const size_t ENSEMBLE_PARAMETER_COUNT;
+
+typedef enum {
+    VARIABLE_OF_INTEGRATION,
+    STATE,
+    CONSTANT,
+    COMPUTED_CONSTANT,
+    ALGEBRAIC
+} VariableType;
+
+typedef struct {
+    char name[2];
+    char units[3];
+    char component[12];
+    VariableType type;
+} VariableInfo;
+
+extern const VariableInfo VOI_INFO;
+extern const VariableInfo STATE_INFO[];
+extern const VariableInfo VARIABLE_INFO[];
+
+double * createStatesArray();
+double * createVariablesArray();
+void deleteArray(double *array);
+
+void initialiseVariables(double *states, double *rates, double *variables);
+void computeComputedConstants(double *variables);
+void computeRates(double voi, double *states, double *rates, double *variables);
+void computeVariables(double voi, double *states, double *rates, double *variables);
+
+void initialiseEnsemble(size_t instanceCount, double *parameters, double *states, double *rates, double *variables);
+void computeEnsembleRates(size_t instanceCount, double voi, double *states, double *rates, double *variables);
+void computeEnsembleVariables(size_t instanceCount, double voi, double *states, double *rates, double *variables);
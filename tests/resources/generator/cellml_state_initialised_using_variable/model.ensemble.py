@@ -0,0 +1,78 @@
+# The content of this file was generated using the Python profile of libCellML 0.5.0.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.4.0"
+LIBCELLML_VERSION = "0.5.0"
+
+STATE_COUNT = 1
+VARIABLE_COUNT = 1
+ENSEMBLE_PARAMETER_COUNT = 1
+
+
+class VariableType(Enum):
+    VARIABLE_OF_INTEGRATION = 0
+    STATE = 1
+    CONSTANT = 2
+    COMPUTED_CONSTANT = 3
+    ALGEBRAIC = 4
+
+
+VOI_INFO = {"name": "t", "units": "ms", "component": "environment", "type": VariableType.VARIABLE_OF_INTEGRATION}
+
+STATE_INFO = [
+    {"name": "x", "units": "mV", "component": "main", "type": VariableType.STATE}
+]
+
+VARIABLE_INFO = [
+    {"name": "k", "units": "mV", "component": "constants", "type": VariableType.CONSTANT}
+]
+
+
+def create_states_array():
+    return [nan]*STATE_COUNT
+
+
+def create_variables_array():
+    return [nan]*VARIABLE_COUNT
+
+
+def initialise_variables(states, rates, variables):
+    variables[0] = 123.0
+    states[0] = variables[0]
+
+
+def compute_computed_constants(variables):
+    pass
+
+
+def compute_rates(voi, states, rates, variables):
+    rates[0] = 1.23
+
+
+def compute_variables(voi, states, rates, variables):
+    pass
+
+
+def initialise_ensemble_instance(parameters, states, variables):
+    variables[0] = parameters[0]
+    states[0] = variables[0]
+
+
+def initialise_ensemble(parameters, states, rates, variables):
+    for i in range(0, len(states)):
+        initialise_variables(states[i], rates[i], variables[i])
+        initialise_ensemble_instance(parameters[i], states[i], variables[i])
+        compute_computed_constants(variables[i])
+
+
+def compute_ensemble_rates(voi, states, rates, variables):
+    for i in range(0, len(states)):
+        compute_rates(voi, states[i], rates[i], variables[i])
+
+
+def compute_ensemble_variables(voi, states, rates, variables):
+    for i in range(0, len(states)):
+        compute_variables(voi, states[i], rates[i], variables[i])
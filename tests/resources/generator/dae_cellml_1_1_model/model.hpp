@@ -0,0 +1,187 @@
+/* The content of this file was generated using the C++ profile of libCellML 0.5.0. */
+
+#pragma once
+
+#include <array>
+#include <math.h>
+#include <stddef.h>
+
+namespace BG3 {
+
+constexpr char VERSION[] = "0.5.0";
+constexpr char LIBCELLML_VERSION[] = "0.5.0";
+
+constexpr size_t STATE_COUNT = 2;
+constexpr size_t VARIABLE_COUNT = 10;
+
+enum class VariableType {
+    VARIABLE_OF_INTEGRATION,
+    STATE,
+    CONSTANT,
+    COMPUTED_CONSTANT,
+    ALGEBRAIC
+};
+
+struct VariableInfo {
+    const char *name;
+    const char *units;
+    const char *component;
+    VariableType type;
+};
+
+constexpr VariableInfo VOI_INFO = {"t", "second", "main", VariableType::VARIABLE_OF_INTEGRATION};
+
+constexpr std::array<VariableInfo, STATE_COUNT> STATE_INFO = {{
+    {"q_1", "coulomb", "main", VariableType::STATE},
+    {"v_3", "C_per_s", "main", VariableType::STATE}
+}};
+
+constexpr std::array<VariableInfo, VARIABLE_COUNT> VARIABLE_INFO = {{
+    {"v_1", "C_per_s", "main", VariableType::ALGEBRAIC},
+    {"v_in", "C_per_s", "main", VariableType::CONSTANT},
+    {"v_2", "C_per_s", "main", VariableType::ALGEBRAIC},
+    {"v_out", "C_per_s", "main", VariableType::CONSTANT},
+    {"u_1", "J_per_C", "main", VariableType::ALGEBRAIC},
+    {"u_2", "J_per_C", "main", VariableType::ALGEBRAIC},
+    {"u_3", "J_per_C", "main", VariableType::ALGEBRAIC},
+    {"C", "C2_per_J", "main", VariableType::CONSTANT},
+    {"R", "Js_per_C2", "main", VariableType::CONSTANT},
+    {"L", "Js2_per_C2", "main", VariableType::CONSTANT}
+}};
+
+template <typename T>
+inline T * createStatesArray()
+{
+    T *res = new T[STATE_COUNT];
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+template <typename T>
+inline T * createVariablesArray()
+{
+    T *res = new T[VARIABLE_COUNT];
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+template <typename T>
+inline void deleteArray(T *array)
+{
+    delete[] array;
+}
+
+template <typename T>
+struct RootFindingInfo {
+    T voi;
+    T *states;
+    T *rates;
+    T *variables;
+};
+
+template <typename T>
+void nlaSolve(void (*objectiveFunction)(T *, T *, void *),
+              T *u, size_t n, void *data);
+
+template <typename T>
+inline void objectiveFunction0(T *u, T *f, void *data)
+{
+    T voi = static_cast<RootFindingInfo<T> *>(data)->voi;
+    T *states = static_cast<RootFindingInfo<T> *>(data)->states;
+    T *rates = static_cast<RootFindingInfo<T> *>(data)->rates;
+    T *variables = static_cast<RootFindingInfo<T> *>(data)->variables;
+
+    variables[0] = u[0];
+
+    f[0] = variables[1]-(variables[0]+variables[2]);
+}
+
+template <typename T>
+inline void findRoot0(T voi, T *states, T *rates, T *variables)
+{
+    RootFindingInfo<T> rfi = { voi, states, rates, variables };
+    T u[1];
+
+    u[0] = variables[0];
+
+    nlaSolve(objectiveFunction0<T>, u, 1, &rfi);
+
+    variables[0] = u[0];
+}
+
+template <typename T>
+inline void objectiveFunction1(T *u, T *f, void *data)
+{
+    T voi = static_cast<RootFindingInfo<T> *>(data)->voi;
+    T *states = static_cast<RootFindingInfo<T> *>(data)->states;
+    T *rates = static_cast<RootFindingInfo<T> *>(data)->rates;
+    T *variables = static_cast<RootFindingInfo<T> *>(data)->variables;
+
+    variables[6] = u[0];
+
+    f[0] = variables[4]-(variables[5]+variables[6]);
+}
+
+template <typename T>
+inline void findRoot1(T voi, T *states, T *rates, T *variables)
+{
+    RootFindingInfo<T> rfi = { voi, states, rates, variables };
+    T u[1];
+
+    u[0] = variables[6];
+
+    nlaSolve(objectiveFunction1<T>, u, 1, &rfi);
+
+    variables[6] = u[0];
+}
+
+template <typename T>
+inline void initialiseVariables(T *states, T *rates, T *variables)
+{
+    variables[0] = 0.0;
+    variables[1] = 1.0;
+    variables[3] = 1.0;
+    variables[6] = 0.0;
+    variables[7] = 20.0;
+    variables[8] = 2.0;
+    variables[9] = 10.0;
+    states[0] = 1.0;
+    states[1] = 0.0;
+}
+
+template <typename T>
+inline void computeComputedConstants(T *variables)
+{
+}
+
+template <typename T>
+inline void computeRates(T voi, T *states, T *rates, T *variables)
+{
+    variables[2] = states[1]+variables[3];
+    findRoot0(voi, states, rates, variables);
+    rates[0] = variables[0];
+    variables[4] = states[0]/variables[7];
+    variables[5] = variables[8]*variables[2];
+    findRoot1(voi, states, rates, variables);
+    rates[1] = variables[6]/variables[9];
+}
+
+template <typename T>
+inline void computeVariables(T voi, T *states, T *rates, T *variables)
+{
+    variables[2] = states[1]+variables[3];
+    findRoot0(voi, states, rates, variables);
+    variables[4] = states[0]/variables[7];
+    variables[5] = variables[8]*variables[2];
+    findRoot1(voi, states, rates, variables);
+}
+
+} // namespace BG3
@@ -0,0 +1,213 @@
+/* The content of this file was generated using a modified C profile of libCellML 0.5.0. */
+
+#include "model.integrate.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.5.0.post0";
+const char LIBCELLML_VERSION[] = "0.5.0";
+
+const size_t STATE_COUNT = 6;
+const size_t VARIABLE_COUNT = 10;
+
+const VariableInfo VOI_INFO = {"t", "second", "environment", VARIABLE_OF_INTEGRATION};
+
+const VariableInfo STATE_INFO[] = {
+    {"a", "dimensionless", "my_component", STATE},
+    {"b", "dimensionless", "my_component", STATE},
+    {"c", "dimensionless", "my_component", STATE},
+    {"d", "dimensionless", "my_component", STATE},
+    {"e", "dimensionless", "my_component", STATE},
+    {"f", "dimensionless", "my_component", STATE}
+};
+
+const VariableInfo VARIABLE_INFO[] = {
+    {"alpha_a", "per_s", "my_component", ALGEBRAIC},
+    {"beta_a", "per_s", "my_component", CONSTANT},
+    {"alpha_b", "per_s", "my_component", CONSTANT},
+    {"beta_b", "per_s", "my_component", CONSTANT},
+    {"c_inf", "dimensionless", "my_component", ALGEBRAIC},
+    {"tau_c", "second", "my_component", CONSTANT},
+    {"alpha_d", "per_s", "my_component", ALGEBRAIC},
+    {"beta_d", "per_s", "my_component", CONSTANT},
+    {"tau_e", "second", "my_component", ALGEBRAIC},
+    {"e_inf", "dimensionless", "my_component", CONSTANT}
+};
+
+double * createStatesArray()
+{
+    double *res = (double *) malloc(STATE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+double * createVariablesArray()
+{
+    double *res = (double *) malloc(VARIABLE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initialiseVariables(double *states, double *rates, double *variables)
+{
+    variables[1] = 3.0;
+    variables[2] = 5.0;
+    variables[3] = 7.0;
+    variables[5] = 1.5;
+    variables[7] = 3.0;
+    variables[9] = 1.0;
+    states[0] = 0.0;
+    states[1] = 0.1;
+    states[2] = 0.2;
+    states[3] = 0.3;
+    states[4] = 0.4;
+    states[5] = 0.5;
+}
+
+void computeComputedConstants(double *variables)
+{
+}
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    variables[0] = 2.0*voi/1.0;
+    rates[0] = variables[0]*(1.0-states[0])-variables[1]*states[0];
+    rates[1] = (1.0-states[1])*variables[2]-states[1]*variables[3];
+    variables[4] = states[0]/(states[0]+states[1]);
+    rates[2] = (variables[4]-states[2])/variables[5];
+    variables[6] = 2.0*states[3];
+    rates[3] = variables[6]*(1.0-states[3])-variables[7]*states[3];
+    variables[8] = 1.0*(1.0+states[4]);
+    rates[4] = (variables[9]-states[4])/variables[8];
+    rates[5] = -1.0*states[5];
+}
+
+void computeRushLarsenCoefficients(double voi, double *states, double *variables, double *taus, double *yInfs)
+{
+    taus[0] = 1.0/(variables[0]+variables[1]);
+    yInfs[0] = variables[0]/(variables[0]+variables[1]);
+    taus[1] = 1.0/(variables[2]+variables[3]);
+    yInfs[1] = variables[2]/(variables[2]+variables[3]);
+    taus[2] = variables[5];
+    yInfs[2] = variables[4];
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+    variables[4] = states[0]/(states[0]+states[1]);
+    variables[6] = 2.0*states[3];
+    variables[8] = 1.0*(1.0+states[4]);
+}
+
+void integrateForwardEuler(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer)
+{
+    for (size_t step = 0; step < nSteps; ++step) {
+        computeRates(voi0+step*dt, states, rates, variables);
+
+        for (size_t i = 0; i < STATE_COUNT; ++i) {
+            states[i] += dt*rates[i];
+        }
+
+        if ((outputBuffer != NULL) && (outputStride != 0) && ((step+1)%outputStride == 0)) {
+            for (size_t i = 0; i < STATE_COUNT; ++i) {
+                outputBuffer[i] = states[i];
+            }
+
+            outputBuffer += STATE_COUNT;
+        }
+    }
+}
+
+void integrateRK4(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer)
+{
+    double *k2 = createStatesArray();
+    double *k3 = createStatesArray();
+    double *k4 = createStatesArray();
+    double *y = createStatesArray();
+
+    for (size_t step = 0; step < nSteps; ++step) {
+        double voi = voi0+step*dt;
+
+        computeRates(voi, states, rates, variables);
+
+        for (size_t i = 0; i < STATE_COUNT; ++i) {
+            y[i] = states[i]+0.5*dt*rates[i];
+        }
+
+        computeRates(voi+0.5*dt, y, k2, variables);
+
+        for (size_t i = 0; i < STATE_COUNT; ++i) {
+            y[i] = states[i]+0.5*dt*k2[i];
+        }
+
+        computeRates(voi+0.5*dt, y, k3, variables);
+
+        for (size_t i = 0; i < STATE_COUNT; ++i) {
+            y[i] = states[i]+dt*k3[i];
+        }
+
+        computeRates(voi+dt, y, k4, variables);
+
+        for (size_t i = 0; i < STATE_COUNT; ++i) {
+            states[i] += dt*(rates[i]+2.0*(k2[i]+k3[i])+k4[i])/6.0;
+        }
+
+        if ((outputBuffer != NULL) && (outputStride != 0) && ((step+1)%outputStride == 0)) {
+            for (size_t i = 0; i < STATE_COUNT; ++i) {
+                outputBuffer[i] = states[i];
+            }
+
+            outputBuffer += STATE_COUNT;
+        }
+    }
+
+    deleteArray(k2);
+    deleteArray(k3);
+    deleteArray(k4);
+    deleteArray(y);
+}
+
+void integrateRushLarsen(double voi0, double dt, size_t nSteps, double *states, double *rates, double *variables, size_t outputStride, double *outputBuffer)
+{
+    double *taus = createStatesArray();
+    double *yInfs = createStatesArray();
+
+    for (size_t step = 0; step < nSteps; ++step) {
+        double voi = voi0+step*dt;
+
+        computeRates(voi, states, rates, variables);
+        computeRushLarsenCoefficients(voi, states, variables, taus, yInfs);
+
+        states[0] = yInfs[0]+(states[0]-yInfs[0])*exp(-dt/taus[0]);
+        states[1] = yInfs[1]+(states[1]-yInfs[1])*exp(-dt/taus[1]);
+        states[2] = yInfs[2]+(states[2]-yInfs[2])*exp(-dt/taus[2]);
+        states[3] += dt*rates[3];
+        states[4] += dt*rates[4];
+        states[5] += dt*rates[5];
+
+        if ((outputBuffer != NULL) && (outputStride != 0) && ((step+1)%outputStride == 0)) {
+            for (size_t i = 0; i < STATE_COUNT; ++i) {
+                outputBuffer[i] = states[i];
+            }
+
+            outputBuffer += STATE_COUNT;
+        }
+    }
+
+    deleteArray(taus);
+    deleteArray(yInfs);
+}
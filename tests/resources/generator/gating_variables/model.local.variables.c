@@ -0,0 +1,114 @@
+/* The content of this file was generated using a modified C profile of libCellML 0.5.0. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.5.0.post0";
+const char LIBCELLML_VERSION[] = "0.5.0";
+
+const size_t STATE_COUNT = 6;
+const size_t VARIABLE_COUNT = 10;
+
+const VariableInfo VOI_INFO = {"t", "second", "environment", VARIABLE_OF_INTEGRATION};
+
+const VariableInfo STATE_INFO[] = {
+    {"a", "dimensionless", "my_component", STATE},
+    {"b", "dimensionless", "my_component", STATE},
+    {"c", "dimensionless", "my_component", STATE},
+    {"d", "dimensionless", "my_component", STATE},
+    {"e", "dimensionless", "my_component", STATE},
+    {"f", "dimensionless", "my_component", STATE}
+};
+
+const VariableInfo VARIABLE_INFO[] = {
+    {"alpha_a", "per_s", "my_component", ALGEBRAIC},
+    {"beta_a", "per_s", "my_component", CONSTANT},
+    {"alpha_b", "per_s", "my_component", CONSTANT},
+    {"beta_b", "per_s", "my_component", CONSTANT},
+    {"c_inf", "dimensionless", "my_component", ALGEBRAIC},
+    {"tau_c", "second", "my_component", CONSTANT},
+    {"alpha_d", "per_s", "my_component", ALGEBRAIC},
+    {"beta_d", "per_s", "my_component", CONSTANT},
+    {"tau_e", "second", "my_component", ALGEBRAIC},
+    {"e_inf", "dimensionless", "my_component", CONSTANT}
+};
+
+double * createStatesArray()
+{
+    double *res = (double *) malloc(STATE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+double * createVariablesArray()
+{
+    double *res = (double *) malloc(VARIABLE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initialiseVariables(double *states, double *rates, double *variables)
+{
+    variables[1] = 3.0;
+    variables[2] = 5.0;
+    variables[3] = 7.0;
+    variables[5] = 1.5;
+    variables[7] = 3.0;
+    variables[9] = 1.0;
+    states[0] = 0.0;
+    states[1] = 0.1;
+    states[2] = 0.2;
+    states[3] = 0.3;
+    states[4] = 0.4;
+    states[5] = 0.5;
+}
+
+void computeComputedConstants(double *variables)
+{
+}
+
+void computeRates(double voi, double * restrict states, double * restrict rates, double * restrict variables)
+{
+    variables[0] = 2.0*voi/1.0;
+    rates[0] = variables[0]*(1.0-states[0])-variables[1]*states[0];
+    rates[1] = (1.0-states[1])*variables[2]-states[1]*variables[3];
+    variables[4] = states[0]/(states[0]+states[1]);
+    rates[2] = (variables[4]-states[2])/variables[5];
+    double alpha_d_6 = 2.0*states[3];
+    rates[3] = alpha_d_6*(1.0-states[3])-variables[7]*states[3];
+    double tau_e_8 = 1.0*(1.0+states[4]);
+    rates[4] = (variables[9]-states[4])/tau_e_8;
+    rates[5] = -1.0*states[5];
+}
+
+void computeRushLarsenCoefficients(double voi, double *states, double *variables, double *taus, double *yInfs)
+{
+    taus[0] = 1.0/(variables[0]+variables[1]);
+    yInfs[0] = variables[0]/(variables[0]+variables[1]);
+    taus[1] = 1.0/(variables[2]+variables[3]);
+    yInfs[1] = variables[2]/(variables[2]+variables[3]);
+    taus[2] = variables[5];
+    yInfs[2] = variables[4];
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+    variables[4] = states[0]/(states[0]+states[1]);
+    variables[6] = 2.0*states[3];
+    variables[8] = 1.0*(1.0+states[4]);
+}
@@ -0,0 +1,99 @@
+# The content of this file was generated using a modified Python profile of libCellML 0.5.0.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.4.0.post0"
+LIBCELLML_VERSION = "0.5.0"
+
+STATE_COUNT = 6
+VARIABLE_COUNT = 10
+
+
+class VariableType(Enum):
+    VARIABLE_OF_INTEGRATION = 0
+    STATE = 1
+    CONSTANT = 2
+    COMPUTED_CONSTANT = 3
+    ALGEBRAIC = 4
+
+
+VOI_INFO = {"name": "t", "units": "second", "component": "environment", "type": VariableType.VARIABLE_OF_INTEGRATION}
+
+STATE_INFO = [
+    {"name": "a", "units": "dimensionless", "component": "my_component", "type": VariableType.STATE},
+    {"name": "b", "units": "dimensionless", "component": "my_component", "type": VariableType.STATE},
+    {"name": "c", "units": "dimensionless", "component": "my_component", "type": VariableType.STATE},
+    {"name": "d", "units": "dimensionless", "component": "my_component", "type": VariableType.STATE},
+    {"name": "e", "units": "dimensionless", "component": "my_component", "type": VariableType.STATE},
+    {"name": "f", "units": "dimensionless", "component": "my_component", "type": VariableType.STATE}
+]
+
+VARIABLE_INFO = [
+    {"name": "alpha_a", "units": "per_s", "component": "my_component", "type": VariableType.ALGEBRAIC},
+    {"name": "beta_a", "units": "per_s", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "alpha_b", "units": "per_s", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "beta_b", "units": "per_s", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "c_inf", "units": "dimensionless", "component": "my_component", "type": VariableType.ALGEBRAIC},
+    {"name": "tau_c", "units": "second", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "alpha_d", "units": "per_s", "component": "my_component", "type": VariableType.ALGEBRAIC},
+    {"name": "beta_d", "units": "per_s", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "tau_e", "units": "second", "component": "my_component", "type": VariableType.ALGEBRAIC},
+    {"name": "e_inf", "units": "dimensionless", "component": "my_component", "type": VariableType.CONSTANT}
+]
+
+
+def create_states_array():
+    return [nan]*STATE_COUNT
+
+
+def create_variables_array():
+    return [nan]*VARIABLE_COUNT
+
+
+def initialise_variables(states, rates, variables):
+    variables[1] = 3.0
+    variables[2] = 5.0
+    variables[3] = 7.0
+    variables[5] = 1.5
+    variables[7] = 3.0
+    variables[9] = 1.0
+    states[0] = 0.0
+    states[1] = 0.1
+    states[2] = 0.2
+    states[3] = 0.3
+    states[4] = 0.4
+    states[5] = 0.5
+
+
+def compute_computed_constants(variables):
+    pass
+
+
+def compute_rates(voi, states, rates, variables):
+    variables[0] = 2.0*voi/1.0
+    rates[0] = variables[0]*(1.0-states[0])-variables[1]*states[0]
+    rates[1] = (1.0-states[1])*variables[2]-states[1]*variables[3]
+    variables[4] = states[0]/(states[0]+states[1])
+    rates[2] = (variables[4]-states[2])/variables[5]
+    variables[6] = 2.0*states[3]
+    rates[3] = variables[6]*(1.0-states[3])-variables[7]*states[3]
+    variables[8] = 1.0*(1.0+states[4])
+    rates[4] = (variables[9]-states[4])/variables[8]
+    rates[5] = -1.0*states[5]
+
+
+def compute_rush_larsen_coefficients(voi, states, variables, taus, y_infs):
+    taus[0] = 1.0/(variables[0]+variables[1])
+    y_infs[0] = variables[0]/(variables[0]+variables[1])
+    taus[1] = 1.0/(variables[2]+variables[3])
+    y_infs[1] = variables[2]/(variables[2]+variables[3])
+    taus[2] = variables[5]
+    y_infs[2] = variables[4]
+
+
+def compute_variables(voi, states, rates, variables):
+    variables[4] = states[0]/(states[0]+states[1])
+    variables[6] = 2.0*states[3]
+    variables[8] = 1.0*(1.0+states[4])
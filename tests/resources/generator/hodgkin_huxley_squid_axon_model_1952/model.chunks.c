@@ -0,0 +1,107 @@
+/* The content of this file was generated using the C profile of libCellML 0.5.0. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.5.0";
+const char LIBCELLML_VERSION[] = "0.5.0";
+
+const size_t STATE_COUNT = 4;
+const size_t VARIABLE_COUNT = 18;
+
+const VariableInfo VOI_INFO = {"time", "millisecond", "environment", VARIABLE_OF_INTEGRATION};
+
+const VariableInfo STATE_INFO[] = {
+    {"V", "millivolt", "membrane", STATE},
+    {"h", "dimensionless", "sodium_channel_h_gate", STATE},
+    {"m", "dimensionless", "sodium_channel_m_gate", STATE},
+    {"n", "dimensionless", "potassium_channel_n_gate", STATE}
+};
+
+const VariableInfo VARIABLE_INFO[] = {
+    {"i_Stim", "microA_per_cm2", "membrane", ALGEBRAIC},
+    {"i_L", "microA_per_cm2", "leakage_current", ALGEBRAIC},
+    {"i_K", "microA_per_cm2", "potassium_channel", ALGEBRAIC},
+    {"i_Na", "microA_per_cm2", "sodium_channel", ALGEBRAIC},
+    {"Cm", "microF_per_cm2", "membrane", CONSTANT},
+    {"E_R", "millivolt", "membrane", CONSTANT},
+    {"E_L", "millivolt", "leakage_current", COMPUTED_CONSTANT},
+    {"g_L", "milliS_per_cm2", "leakage_current", CONSTANT},
+    {"E_Na", "millivolt", "sodium_channel", COMPUTED_CONSTANT},
+    {"g_Na", "milliS_per_cm2", "sodium_channel", CONSTANT},
+    {"alpha_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"beta_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"alpha_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"beta_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"E_K", "millivolt", "potassium_channel", COMPUTED_CONSTANT},
+    {"g_K", "milliS_per_cm2", "potassium_channel", CONSTANT},
+    {"alpha_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC},
+    {"beta_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC}
+};
+
+double * createStatesArray()
+{
+    double *res = (double *) malloc(STATE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+double * createVariablesArray()
+{
+    double *res = (double *) malloc(VARIABLE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initialiseVariables(double *states, double *rates, double *variables)
+{
+    variables[4] = 1.0;
+    variables[5] = 0.0;
+    variables[7] = 0.3;
+    variables[9] = 120.0;
+    variables[15] = 36.0;
+    states[0] = 0.0;
+    states[1] = 0.6;
+    states[2] = 0.05;
+    states[3] = 0.325;
+}
+
+void computeComputedConstants(double *variables)
+{
+    variables[6] = variables[5]-10.613;
+    variables[8] = variables[5]-115.0;
+    variables[14] = variables[5]+12.0;
+}
+
+void computeRatesChunk0(double voi, double *states, double *rates, double *variables);
+void computeRatesChunk1(double voi, double *states, double *rates, double *variables);
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    computeRatesChunk0(voi, states, rates, variables);
+    computeRatesChunk1(voi, states, rates, variables);
+}
+
+void computeVariablesChunk0(double voi, double *states, double *rates, double *variables);
+void computeVariablesChunk1(double voi, double *states, double *rates, double *variables);
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+    computeVariablesChunk0(voi, states, rates, variables);
+    computeVariablesChunk1(voi, states, rates, variables);
+}
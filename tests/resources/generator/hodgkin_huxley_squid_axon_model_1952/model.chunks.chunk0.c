@@ -0,0 +1,26 @@
+/* The content of this file was generated using the C profile of libCellML 0.5.0. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+void computeRatesChunk0(double voi, double *states, double *rates, double *variables)
+{
+    variables[0] = ((voi >= 10.0) && (voi <= 10.5))?-20.0:0.0;
+    variables[1] = variables[7]*(states[0]-variables[6]);
+    variables[2] = variables[15]*pow(states[3], 4.0)*(states[0]-variables[14]);
+    variables[3] = variables[9]*pow(states[2], 3.0)*states[1]*(states[0]-variables[8]);
+    rates[0] = -(-variables[0]+variables[3]+variables[2]+variables[1])/variables[4];
+    variables[10] = 0.1*(states[0]+25.0)/(exp((states[0]+25.0)/10.0)-1.0);
+    variables[11] = 4.0*exp(states[0]/18.0);
+}
+
+void computeVariablesChunk0(double voi, double *states, double *rates, double *variables)
+{
+    variables[1] = variables[7]*(states[0]-variables[6]);
+    variables[3] = variables[9]*pow(states[2], 3.0)*states[1]*(states[0]-variables[8]);
+    variables[10] = 0.1*(states[0]+25.0)/(exp((states[0]+25.0)/10.0)-1.0);
+    variables[11] = 4.0*exp(states[0]/18.0);
+    variables[12] = 0.07*exp(states[0]/20.0);
+}
@@ -0,0 +1,25 @@
+/* The content of this file was generated using the C profile of libCellML 0.5.0. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+void computeRatesChunk1(double voi, double *states, double *rates, double *variables)
+{
+    rates[2] = variables[10]*(1.0-states[2])-variables[11]*states[2];
+    variables[12] = 0.07*exp(states[0]/20.0);
+    variables[13] = 1.0/(exp((states[0]+30.0)/10.0)+1.0);
+    rates[1] = variables[12]*(1.0-states[1])-variables[13]*states[1];
+    variables[16] = 0.01*(states[0]+10.0)/(exp((states[0]+10.0)/10.0)-1.0);
+    variables[17] = 0.125*exp(states[0]/80.0);
+    rates[3] = variables[16]*(1.0-states[3])-variables[17]*states[3];
+}
+
+void computeVariablesChunk1(double voi, double *states, double *rates, double *variables)
+{
+    variables[13] = 1.0/(exp((states[0]+30.0)/10.0)+1.0);
+    variables[2] = variables[15]*pow(states[3], 4.0)*(states[0]-variables[14]);
+    variables[16] = 0.01*(states[0]+10.0)/(exp((states[0]+10.0)/10.0)-1.0);
+    variables[17] = 0.125*exp(states[0]/80.0);
+}
@@ -0,0 +1,237 @@
+/* The content of this file was generated using the C++ profile of libCellML 0.5.0. */
+
+#pragma once
+
+#include <array>
+#include <math.h>
+#include <stddef.h>
+
+namespace hodgkin_huxley_squid_axon_model_1952_with_lookup_tables {
+
+constexpr char VERSION[] = "0.5.0";
+constexpr char LIBCELLML_VERSION[] = "0.5.0";
+
+constexpr size_t STATE_COUNT = 4;
+constexpr size_t VARIABLE_COUNT = 18;
+
+enum class VariableType {
+    VARIABLE_OF_INTEGRATION,
+    STATE,
+    CONSTANT,
+    COMPUTED_CONSTANT,
+    ALGEBRAIC
+};
+
+struct VariableInfo {
+    const char *name;
+    const char *units;
+    const char *component;
+    VariableType type;
+};
+
+constexpr VariableInfo VOI_INFO = {"time", "millisecond", "environment", VariableType::VARIABLE_OF_INTEGRATION};
+
+constexpr std::array<VariableInfo, STATE_COUNT> STATE_INFO = {{
+    {"V", "millivolt", "membrane", VariableType::STATE},
+    {"h", "dimensionless", "sodium_channel_h_gate", VariableType::STATE},
+    {"m", "dimensionless", "sodium_channel_m_gate", VariableType::STATE},
+    {"n", "dimensionless", "potassium_channel_n_gate", VariableType::STATE}
+}};
+
+constexpr std::array<VariableInfo, VARIABLE_COUNT> VARIABLE_INFO = {{
+    {"i_Stim", "microA_per_cm2", "membrane", VariableType::ALGEBRAIC},
+    {"i_L", "microA_per_cm2", "leakage_current", VariableType::ALGEBRAIC},
+    {"i_K", "microA_per_cm2", "potassium_channel", VariableType::ALGEBRAIC},
+    {"i_Na", "microA_per_cm2", "sodium_channel", VariableType::ALGEBRAIC},
+    {"Cm", "microF_per_cm2", "membrane", VariableType::CONSTANT},
+    {"E_R", "millivolt", "membrane", VariableType::CONSTANT},
+    {"E_L", "millivolt", "leakage_current", VariableType::COMPUTED_CONSTANT},
+    {"g_L", "milliS_per_cm2", "leakage_current", VariableType::CONSTANT},
+    {"E_Na", "millivolt", "sodium_channel", VariableType::COMPUTED_CONSTANT},
+    {"g_Na", "milliS_per_cm2", "sodium_channel", VariableType::CONSTANT},
+    {"alpha_m", "per_millisecond", "sodium_channel_m_gate", VariableType::ALGEBRAIC},
+    {"beta_m", "per_millisecond", "sodium_channel_m_gate", VariableType::ALGEBRAIC},
+    {"alpha_h", "per_millisecond", "sodium_channel_h_gate", VariableType::ALGEBRAIC},
+    {"beta_h", "per_millisecond", "sodium_channel_h_gate", VariableType::ALGEBRAIC},
+    {"E_K", "millivolt", "potassium_channel", VariableType::COMPUTED_CONSTANT},
+    {"g_K", "milliS_per_cm2", "potassium_channel", VariableType::CONSTANT},
+    {"alpha_n", "per_millisecond", "potassium_channel_n_gate", VariableType::ALGEBRAIC},
+    {"beta_n", "per_millisecond", "potassium_channel_n_gate", VariableType::ALGEBRAIC}
+}};
+
+template <typename T>
+T lookupTable0[90006];
+
+template <typename T>
+inline T * createStatesArray()
+{
+    T *res = new T[STATE_COUNT];
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+template <typename T>
+inline T * createVariablesArray()
+{
+    T *res = new T[VARIABLE_COUNT];
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+template <typename T>
+inline void deleteArray(T *array)
+{
+    delete[] array;
+}
+
+template <typename T>
+inline T lookupTableValue(T *table, size_t columnCount, size_t column, T x, T minimum, T step, size_t size)
+{
+    T position = (x-minimum)/step;
+
+    if (isnan(position)) {
+        return NAN;
+    }
+
+    if (position <= 0.0) {
+        return table[column];
+    }
+
+    if (position >= size-1) {
+        return table[columnCount*(size-1)+column];
+    }
+
+    size_t i = static_cast<size_t>(position);
+    T fraction = position-i;
+
+    return (1.0-fraction)*table[columnCount*i+column]+fraction*table[columnCount*(i+1)+column];
+}
+
+template <typename T>
+inline T lookupTableError(T maxError, T exactValue, T value)
+{
+    if (isnan(maxError) || !isfinite(exactValue)) {
+        return maxError;
+    }
+
+    T error = fabs(exactValue-value);
+
+    return (error <= maxError)?maxError:error;
+}
+
+template <typename T>
+inline void initialiseVariables(T *states, T *rates, T *variables)
+{
+    variables[4] = 1.0;
+    variables[5] = 0.0;
+    variables[7] = 0.3;
+    variables[9] = 120.0;
+    variables[15] = 36.0;
+    states[0] = 0.0;
+    states[1] = 0.6;
+    states[2] = 0.05;
+    states[3] = 0.325;
+}
+
+template <typename T>
+inline void computeComputedConstants(T *variables)
+{
+    variables[6] = variables[5]-10.613;
+    variables[8] = variables[5]-115.0;
+    variables[14] = variables[5]+12.0;
+}
+
+template <typename T>
+inline T initialiseLookupTables(T *variables)
+{
+    T *states = createStatesArray<T>();
+    T maxError = 0.0;
+
+    for (size_t i = 0; i < 15001; ++i) {
+        T row[6];
+
+        states[0] = -100.0+(i-0.001)*0.01;
+
+        lookupTable0<T>[6*i+0] = 0.1*(states[0]+25.0)/(exp((states[0]+25.0)/10.0)-1.0);
+        lookupTable0<T>[6*i+1] = 4.0*exp(states[0]/18.0);
+        lookupTable0<T>[6*i+2] = 0.07*exp(states[0]/20.0);
+        lookupTable0<T>[6*i+3] = 1.0/(exp((states[0]+30.0)/10.0)+1.0);
+        lookupTable0<T>[6*i+4] = 0.01*(states[0]+10.0)/(exp((states[0]+10.0)/10.0)-1.0);
+        lookupTable0<T>[6*i+5] = 0.125*exp(states[0]/80.0);
+
+        for (size_t j = 0; j < 6; ++j) {
+            row[j] = lookupTable0<T>[6*i+j];
+        }
+
+        states[0] = -100.0+(i+0.001)*0.01;
+
+        lookupTable0<T>[6*i+0] = 0.1*(states[0]+25.0)/(exp((states[0]+25.0)/10.0)-1.0);
+        lookupTable0<T>[6*i+1] = 4.0*exp(states[0]/18.0);
+        lookupTable0<T>[6*i+2] = 0.07*exp(states[0]/20.0);
+        lookupTable0<T>[6*i+3] = 1.0/(exp((states[0]+30.0)/10.0)+1.0);
+        lookupTable0<T>[6*i+4] = 0.01*(states[0]+10.0)/(exp((states[0]+10.0)/10.0)-1.0);
+        lookupTable0<T>[6*i+5] = 0.125*exp(states[0]/80.0);
+
+        for (size_t j = 0; j < 6; ++j) {
+            lookupTable0<T>[6*i+j] = 0.5*(row[j]+lookupTable0<T>[6*i+j]);
+        }
+    }
+
+    for (size_t i = 0; i < 15001-1; ++i) {
+        states[0] = -100.0+(i+0.5)*0.01;
+
+        maxError = lookupTableError<T>(maxError, 0.1*(states[0]+25.0)/(exp((states[0]+25.0)/10.0)-1.0), lookupTableValue<T>(lookupTable0<T>, 6, 0, states[0], -100.0, 0.01, 15001));
+        maxError = lookupTableError<T>(maxError, 4.0*exp(states[0]/18.0), lookupTableValue<T>(lookupTable0<T>, 6, 1, states[0], -100.0, 0.01, 15001));
+        maxError = lookupTableError<T>(maxError, 0.07*exp(states[0]/20.0), lookupTableValue<T>(lookupTable0<T>, 6, 2, states[0], -100.0, 0.01, 15001));
+        maxError = lookupTableError<T>(maxError, 1.0/(exp((states[0]+30.0)/10.0)+1.0), lookupTableValue<T>(lookupTable0<T>, 6, 3, states[0], -100.0, 0.01, 15001));
+        maxError = lookupTableError<T>(maxError, 0.01*(states[0]+10.0)/(exp((states[0]+10.0)/10.0)-1.0), lookupTableValue<T>(lookupTable0<T>, 6, 4, states[0], -100.0, 0.01, 15001));
+        maxError = lookupTableError<T>(maxError, 0.125*exp(states[0]/80.0), lookupTableValue<T>(lookupTable0<T>, 6, 5, states[0], -100.0, 0.01, 15001));
+    }
+
+    deleteArray(states);
+
+    return maxError;
+}
+
+template <typename T>
+inline void computeRates(T voi, T *states, T *rates, T *variables)
+{
+    variables[0] = ((voi >= 10.0) && (voi <= 10.5))?-20.0:0.0;
+    variables[1] = variables[7]*(states[0]-variables[6]);
+    variables[2] = variables[15]*pow(states[3], 4.0)*(states[0]-variables[14]);
+    variables[3] = variables[9]*pow(states[2], 3.0)*states[1]*(states[0]-variables[8]);
+    rates[0] = -(-variables[0]+variables[3]+variables[2]+variables[1])/variables[4];
+    variables[10] = lookupTableValue<T>(lookupTable0<T>, 6, 0, states[0], -100.0, 0.01, 15001);
+    variables[11] = lookupTableValue<T>(lookupTable0<T>, 6, 1, states[0], -100.0, 0.01, 15001);
+    rates[2] = variables[10]*(1.0-states[2])-variables[11]*states[2];
+    variables[12] = lookupTableValue<T>(lookupTable0<T>, 6, 2, states[0], -100.0, 0.01, 15001);
+    variables[13] = lookupTableValue<T>(lookupTable0<T>, 6, 3, states[0], -100.0, 0.01, 15001);
+    rates[1] = variables[12]*(1.0-states[1])-variables[13]*states[1];
+    variables[16] = lookupTableValue<T>(lookupTable0<T>, 6, 4, states[0], -100.0, 0.01, 15001);
+    variables[17] = lookupTableValue<T>(lookupTable0<T>, 6, 5, states[0], -100.0, 0.01, 15001);
+    rates[3] = variables[16]*(1.0-states[3])-variables[17]*states[3];
+}
+
+template <typename T>
+inline void computeVariables(T voi, T *states, T *rates, T *variables)
+{
+    variables[1] = variables[7]*(states[0]-variables[6]);
+    variables[3] = variables[9]*pow(states[2], 3.0)*states[1]*(states[0]-variables[8]);
+    variables[10] = lookupTableValue<T>(lookupTable0<T>, 6, 0, states[0], -100.0, 0.01, 15001);
+    variables[11] = lookupTableValue<T>(lookupTable0<T>, 6, 1, states[0], -100.0, 0.01, 15001);
+    variables[12] = lookupTableValue<T>(lookupTable0<T>, 6, 2, states[0], -100.0, 0.01, 15001);
+    variables[13] = lookupTableValue<T>(lookupTable0<T>, 6, 3, states[0], -100.0, 0.01, 15001);
+    variables[2] = variables[15]*pow(states[3], 4.0)*(states[0]-variables[14]);
+    variables[16] = lookupTableValue<T>(lookupTable0<T>, 6, 4, states[0], -100.0, 0.01, 15001);
+    variables[17] = lookupTableValue<T>(lookupTable0<T>, 6, 5, states[0], -100.0, 0.01, 15001);
+}
+
+} // namespace hodgkin_huxley_squid_axon_model_1952_with_lookup_tables
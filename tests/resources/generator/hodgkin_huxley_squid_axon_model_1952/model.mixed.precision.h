@@ -0,0 +1,39 @@
+/* The content of this file was generated using the mixed-precision C profile of libCellML 0.5.0. */
+
+#pragma once
+
+#include <stddef.h>
+
+extern const char VERSION[];
+extern const char LIBCELLML_VERSION[];
+
+extern const size_t STATE_COUNT;
+extern const size_t VARIABLE_COUNT;
+
+typedef enum {
+    VARIABLE_OF_INTEGRATION,
+    STATE,
+    CONSTANT,
+    COMPUTED_CONSTANT,
+    ALGEBRAIC
+} VariableType;
+
+typedef struct {
+    char name[8];
+    char units[16];
+    char component[25];
+    VariableType type;
+} VariableInfo;
+
+extern const VariableInfo VOI_INFO;
+extern const VariableInfo STATE_INFO[];
+extern const VariableInfo VARIABLE_INFO[];
+
+double * createStatesArray();
+float * createVariablesArray();
+void deleteArray(void *array);
+
+void initialiseVariables(double *states, double *rates, float *variables);
+void computeComputedConstants(float *variables);
+void computeRates(double voi, double *states, double *rates, float *variables);
+void computeVariables(double voi, double *states, double *rates, float *variables);
@@ -0,0 +1,162 @@
+/* The content of this file was generated using the C profile of libCellML 0.5.0. */
+
+#include "model.sensitivities.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.5.0";
+const char LIBCELLML_VERSION[] = "0.5.0";
+
+const size_t STATE_COUNT = 12;
+const size_t VARIABLE_COUNT = 18;
+
+const VariableInfo VOI_INFO = {"time", "millisecond", "environment", VARIABLE_OF_INTEGRATION};
+
+const VariableInfo STATE_INFO[] = {
+    {"V", "millivolt", "membrane", STATE},
+    {"h", "dimensionless", "sodium_channel_h_gate", STATE},
+    {"m", "dimensionless", "sodium_channel_m_gate", STATE},
+    {"n", "dimensionless", "potassium_channel_n_gate", STATE},
+    {"dV_dCm", "millivolt/microF_per_cm2", "membrane", STATE},
+    {"dh_dCm", "dimensionless/microF_per_cm2", "sodium_channel_h_gate", STATE},
+    {"dm_dCm", "dimensionless/microF_per_cm2", "sodium_channel_m_gate", STATE},
+    {"dn_dCm", "dimensionless/microF_per_cm2", "potassium_channel_n_gate", STATE},
+    {"dV_dg_Na", "millivolt/milliS_per_cm2", "membrane", STATE},
+    {"dh_dg_Na", "dimensionless/milliS_per_cm2", "sodium_channel_h_gate", STATE},
+    {"dm_dg_Na", "dimensionless/milliS_per_cm2", "sodium_channel_m_gate", STATE},
+    {"dn_dg_Na", "dimensionless/milliS_per_cm2", "potassium_channel_n_gate", STATE}
+};
+
+const VariableInfo VARIABLE_INFO[] = {
+    {"i_Stim", "microA_per_cm2", "membrane", ALGEBRAIC},
+    {"i_L", "microA_per_cm2", "leakage_current", ALGEBRAIC},
+    {"i_K", "microA_per_cm2", "potassium_channel", ALGEBRAIC},
+    {"i_Na", "microA_per_cm2", "sodium_channel", ALGEBRAIC},
+    {"Cm", "microF_per_cm2", "membrane", CONSTANT},
+    {"E_R", "millivolt", "membrane", CONSTANT},
+    {"E_L", "millivolt", "leakage_current", COMPUTED_CONSTANT},
+    {"g_L", "milliS_per_cm2", "leakage_current", CONSTANT},
+    {"E_Na", "millivolt", "sodium_channel", COMPUTED_CONSTANT},
+    {"g_Na", "milliS_per_cm2", "sodium_channel", CONSTANT},
+    {"alpha_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"beta_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"alpha_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"beta_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"E_K", "millivolt", "potassium_channel", COMPUTED_CONSTANT},
+    {"g_K", "milliS_per_cm2", "potassium_channel", CONSTANT},
+    {"alpha_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC},
+    {"beta_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC}
+};
+
+double * createStatesArray()
+{
+    double *res = (double *) malloc(STATE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+double * createVariablesArray()
+{
+    double *res = (double *) malloc(VARIABLE_COUNT*sizeof(double));
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        res[i] = NAN;
+    }
+
+    return res;
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initialiseVariables(double *states, double *rates, double *variables)
+{
+    variables[4] = 1.0;
+    variables[5] = 0.0;
+    variables[7] = 0.3;
+    variables[9] = 120.0;
+    variables[15] = 36.0;
+    states[0] = 0.0;
+    states[1] = 0.6;
+    states[2] = 0.05;
+    states[3] = 0.325;
+    states[4] = 0.0;
+    states[5] = 0.0;
+    states[6] = 0.0;
+    states[7] = 0.0;
+    states[8] = 0.0;
+    states[9] = 0.0;
+    states[10] = 0.0;
+    states[11] = 0.0;
+}
+
+void computeComputedConstants(double *variables)
+{
+    variables[6] = variables[5]-10.613;
+    variables[8] = variables[5]-115.0;
+    variables[14] = variables[5]+12.0;
+}
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    variables[0] = ((voi >= 10.0) && (voi <= 10.5))?-20.0:0.0;
+    variables[1] = variables[7]*(states[0]-variables[6]);
+    variables[2] = variables[15]*pow(states[3], 4.0)*(states[0]-variables[14]);
+    variables[3] = variables[9]*pow(states[2], 3.0)*states[1]*(states[0]-variables[8]);
+    rates[0] = -(-variables[0]+variables[3]+variables[2]+variables[1])/variables[4];
+    variables[10] = 0.1*(states[0]+25.0)/(exp((states[0]+25.0)/10.0)-1.0);
+    variables[11] = 4.0*exp(states[0]/18.0);
+    rates[2] = variables[10]*(1.0-states[2])-variables[11]*states[2];
+    variables[12] = 0.07*exp(states[0]/20.0);
+    variables[13] = 1.0/(exp((states[0]+30.0)/10.0)+1.0);
+    rates[1] = variables[12]*(1.0-states[1])-variables[13]*states[1];
+    variables[16] = 0.01*(states[0]+10.0)/(exp((states[0]+10.0)/10.0)-1.0);
+    variables[17] = 0.125*exp(states[0]/80.0);
+    rates[3] = variables[16]*(1.0-states[3])-variables[17]*states[3];
+    double di_L_dCm_1 = variables[7]*states[4];
+    double di_K_dCm_2 = variables[15]*(4.0*pow(states[3], 3.0)*states[7]*(states[0]-variables[14])+pow(states[3], 4.0)*states[4]);
+    double di_Na_dCm_3 = variables[9]*(3.0*pow(states[2], 2.0)*states[6]*states[1]*(states[0]-variables[8])+pow(states[2], 3.0)*(states[5]*(states[0]-variables[8])+states[1]*states[4]));
+    rates[4] = -(di_Na_dCm_3+di_K_dCm_2+di_L_dCm_1)/variables[4]-(-(-variables[0]+variables[3]+variables[2]+variables[1])/(variables[4]*variables[4]));
+    double dalpha_m_dCm_10 = 0.1*states[4]/(exp((states[0]+25.0)/10.0)-1.0)-0.1*(states[0]+25.0)*exp((states[0]+25.0)/10.0)*states[4]/10.0/((exp((states[0]+25.0)/10.0)-1.0)*(exp((states[0]+25.0)/10.0)-1.0));
+    double dbeta_m_dCm_11 = 4.0*exp(states[0]/18.0)*states[4]/18.0;
+    rates[6] = dalpha_m_dCm_10*(1.0-states[2])+variables[10]*-states[6]-(dbeta_m_dCm_11*states[2]+variables[11]*states[6]);
+    double dalpha_h_dCm_12 = 0.07*exp(states[0]/20.0)*states[4]/20.0;
+    double dbeta_h_dCm_13 = -exp((states[0]+30.0)/10.0)*states[4]/10.0/((exp((states[0]+30.0)/10.0)+1.0)*(exp((states[0]+30.0)/10.0)+1.0));
+    rates[5] = dalpha_h_dCm_12*(1.0-states[1])+variables[12]*-states[5]-(dbeta_h_dCm_13*states[1]+variables[13]*states[5]);
+    double dalpha_n_dCm_16 = 0.01*states[4]/(exp((states[0]+10.0)/10.0)-1.0)-0.01*(states[0]+10.0)*exp((states[0]+10.0)/10.0)*states[4]/10.0/((exp((states[0]+10.0)/10.0)-1.0)*(exp((states[0]+10.0)/10.0)-1.0));
+    double dbeta_n_dCm_17 = 0.125*exp(states[0]/80.0)*states[4]/80.0;
+    rates[7] = dalpha_n_dCm_16*(1.0-states[3])+variables[16]*-states[7]-(dbeta_n_dCm_17*states[3]+variables[17]*states[7]);
+    double di_L_dg_Na_19 = variables[7]*states[8];
+    double di_K_dg_Na_20 = variables[15]*(4.0*pow(states[3], 3.0)*states[11]*(states[0]-variables[14])+pow(states[3], 4.0)*states[8]);
+    double di_Na_dg_Na_21 = pow(states[2], 3.0)*states[1]*(states[0]-variables[8])+variables[9]*(3.0*pow(states[2], 2.0)*states[10]*states[1]*(states[0]-variables[8])+pow(states[2], 3.0)*(states[9]*(states[0]-variables[8])+states[1]*states[8]));
+    rates[8] = -(di_Na_dg_Na_21+di_K_dg_Na_20+di_L_dg_Na_19)/variables[4];
+    double dalpha_m_dg_Na_28 = 0.1*states[8]/(exp((states[0]+25.0)/10.0)-1.0)-0.1*(states[0]+25.0)*exp((states[0]+25.0)/10.0)*states[8]/10.0/((exp((states[0]+25.0)/10.0)-1.0)*(exp((states[0]+25.0)/10.0)-1.0));
+    double dbeta_m_dg_Na_29 = 4.0*exp(states[0]/18.0)*states[8]/18.0;
+    rates[10] = dalpha_m_dg_Na_28*(1.0-states[2])+variables[10]*-states[10]-(dbeta_m_dg_Na_29*states[2]+variables[11]*states[10]);
+    double dalpha_h_dg_Na_30 = 0.07*exp(states[0]/20.0)*states[8]/20.0;
+    double dbeta_h_dg_Na_31 = -exp((states[0]+30.0)/10.0)*states[8]/10.0/((exp((states[0]+30.0)/10.0)+1.0)*(exp((states[0]+30.0)/10.0)+1.0));
+    rates[9] = dalpha_h_dg_Na_30*(1.0-states[1])+variables[12]*-states[9]-(dbeta_h_dg_Na_31*states[1]+variables[13]*states[9]);
+    double dalpha_n_dg_Na_34 = 0.01*states[8]/(exp((states[0]+10.0)/10.0)-1.0)-0.01*(states[0]+10.0)*exp((states[0]+10.0)/10.0)*states[8]/10.0/((exp((states[0]+10.0)/10.0)-1.0)*(exp((states[0]+10.0)/10.0)-1.0));
+    double dbeta_n_dg_Na_35 = 0.125*exp(states[0]/80.0)*states[8]/80.0;
+    rates[11] = dalpha_n_dg_Na_34*(1.0-states[3])+variables[16]*-states[11]-(dbeta_n_dg_Na_35*states[3]+variables[17]*states[11]);
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+    variables[1] = variables[7]*(states[0]-variables[6]);
+    variables[3] = variables[9]*pow(states[2], 3.0)*states[1]*(states[0]-variables[8]);
+    variables[10] = 0.1*(states[0]+25.0)/(exp((states[0]+25.0)/10.0)-1.0);
+    variables[11] = 4.0*exp(states[0]/18.0);
+    variables[12] = 0.07*exp(states[0]/20.0);
+    variables[13] = 1.0/(exp((states[0]+30.0)/10.0)+1.0);
+    variables[2] = variables[15]*pow(states[3], 4.0)*(states[0]-variables[14]);
+    variables[16] = 0.01*(states[0]+10.0)/(exp((states[0]+10.0)/10.0)-1.0);
+    variables[17] = 0.125*exp(states[0]/80.0);
+}
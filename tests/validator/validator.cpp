@@ -868,7 +868,7 @@ TEST(Validator, invalidMathmlCellMLNsOnNode)
         "Math has a 'bvar' element that is not a supported MathML element.",
         "MathML ci element has the child text 'B' which does not correspond with any variable names present in component ''.",
         "W3C MathML DTD error: No declaration for attribute units of element ci.",
-        "Math has a 'bvar' element without exactly two MathML siblings.",
+        "Math has a 'apply' element without at least one MathML child.",
     };
     libcellml::ValidatorPtr v = libcellml::Validator::create();
     libcellml::ModelPtr m = libcellml::Model::create();
@@ -1675,6 +1675,14 @@ TEST(Validator, validMathCnElementsMissingCellMLNamespace)
         "</math>\n";
 
     const std::vector<std::string> expectedIssues {
+        "LibXml2 error: Namespace prefix cellml for units on cn is not defined.",
+        "LibXml2 error: Namespace prefix cellml for units on cn is not defined.",
+        "Math cn element with the value '3.44' does not have a valid cellml:units attribute. CellML identifiers must contain one or more basic Latin alphabetic characters.",
+        "Math cn element with the value '-9.612' does not have a valid cellml:units attribute. CellML identifiers must contain one or more basic Latin alphabetic characters.",
+        "W3C MathML DTD error: No declaration for attribute cellml:units of element cn.",
+        "W3C MathML DTD error: No declaration for attribute cellml:units of element cn.",
+    };
+    const std::vector<std::string> expectedCompatibilityIssues {
         "LibXml2 error: Namespace prefix cellml for units on cn is not defined.",
         "LibXml2 error: Namespace prefix cellml for units on cn is not defined.",
         "Math cn element with the value '3.44' does not have a valid cellml:units attribute. CellML identifiers must contain one or more basic Latin alphabetic characters.",
@@ -1702,6 +1710,13 @@ TEST(Validator, validMathCnElementsMissingCellMLNamespace)
 
     v->validateModel(m);
     EXPECT_EQ_ISSUES(expectedIssues, v);
+
+    // The compatibility mode also reports the issues found when parsing the
+    // serialised math, in which the cellml namespace is not defined.
+
+    v->setHasMathMLDtdCompatibility(true);
+    v->validateModel(m);
+    EXPECT_EQ_ISSUES(expectedCompatibilityIssues, v);
 }
 
 TEST(Validator, unitAmericanSpellingOfUnitsRemoved)
@@ -2508,6 +2523,73 @@ TEST(Validator, unitComplexCycleChangeOrderOfUnits)
     EXPECT_EQ_ISSUES(expectedIssues, v);
 }
 
+TEST(Validator, unitCyclesSharingUnits)
+{
+    // Two cycles sharing some units, which are also depended on by units that
+    // are not part of any cycle. The network is:
+    //
+    //     user -> a -> b -> c
+    //             ^    |^   |
+    //             +----++---+
+    //
+    // All the units of the cycles depend on each other, so they only get
+    // reported once, starting from the first of them in the model.
+
+    const std::vector<std::string> expectedIssues = {
+        "Cyclic units exist: 'a' -> 'b' -> 'a'.",
+    };
+
+    libcellml::ValidatorPtr v = libcellml::Validator::create();
+    libcellml::ModelPtr m = libcellml::Model::create("model");
+
+    libcellml::UnitsPtr user = libcellml::Units::create("user");
+    libcellml::UnitsPtr a = libcellml::Units::create("a");
+    libcellml::UnitsPtr b = libcellml::Units::create("b");
+    libcellml::UnitsPtr c = libcellml::Units::create("c");
+
+    user->addUnit("a");
+    a->addUnit("b");
+    b->addUnit("a");
+    b->addUnit("c");
+    c->addUnit("b");
+
+    m->addUnits(user);
+    m->addUnits(a);
+    m->addUnits(b);
+    m->addUnits(c);
+
+    v->validateModel(m);
+
+    EXPECT_EQ_ISSUES(expectedIssues, v);
+    EXPECT_EQ(a, v->issue(0)->item()->units());
+}
+
+TEST(Validator, unitLongCycle)
+{
+    const size_t count = 1000;
+
+    libcellml::ValidatorPtr v = libcellml::Validator::create();
+    libcellml::ModelPtr m = libcellml::Model::create("model");
+    std::string expectedDescription = "Cyclic units exist: ";
+
+    for (size_t i = 0; i < count; ++i) {
+        auto units = libcellml::Units::create("units_" + std::to_string(i));
+
+        units->addUnit("units_" + std::to_string((i + 1) % count));
+
+        m->addUnits(units);
+
+        expectedDescription += "'units_" + std::to_string(i) + "' -> ";
+    }
+
+    expectedDescription += "'units_0'.";
+
+    v->validateModel(m);
+
+    EXPECT_EQ(size_t(1), v->issueCount());
+    EXPECT_EQ(expectedDescription, v->issue(0)->description());
+}
+
 TEST(Validator, duplicatedCellMLUnitsOnCiElement)
 {
     const std::string math =
@@ -3855,3 +3937,686 @@ TEST(Validator, invalidMathMLElementsChildrenOrSiblings)
 
     EXPECT_EQ_ISSUES(expectedIssues, validator);
 }
+
+TEST(Validator, parallelValidation)
+{
+    auto validator = libcellml::Validator::create();
+
+    EXPECT_EQ(size_t(1), validator->threadCount());
+
+    validator->setThreadCount(4);
+
+    EXPECT_EQ(size_t(4), validator->threadCount());
+
+    // Check that the issues logged when validating models in parallel are the
+    // same, and in the same order, as when validating them serially.
+
+    auto checkParallelValidation = [](const libcellml::ModelPtr &model) {
+        auto serialValidator = libcellml::Validator::create();
+
+        serialValidator->validateModel(model);
+
+        for (size_t threadCount : {size_t(0), size_t(3), size_t(16)}) {
+            auto parallelValidator = libcellml::Validator::create();
+
+            parallelValidator->setThreadCount(threadCount);
+            parallelValidator->validateModel(model);
+
+            EXPECT_EQ(serialValidator->issueCount(), parallelValidator->issueCount());
+            EXPECT_EQ(serialValidator->errorCount(), parallelValidator->errorCount());
+            EXPECT_EQ(serialValidator->warningCount(), parallelValidator->warningCount());
+
+            for (size_t i = 0; i < std::min(serialValidator->issueCount(), parallelValidator->issueCount()); ++i) {
+                EXPECT_EQ(serialValidator->issue(i)->description(), parallelValidator->issue(i)->description());
+                EXPECT_EQ(serialValidator->issue(i)->referenceRule(), parallelValidator->issue(i)->referenceRule());
+                EXPECT_EQ(serialValidator->issue(i)->item()->type(), parallelValidator->issue(i)->item()->type());
+            }
+        }
+    };
+
+    auto parser = libcellml::Parser::create();
+
+    for (const auto &fileName : {"invalid_cellml_2.0.xml",
+                                 "invalidmathmlelementschildrenorsiblings.cellml",
+                                 "annotator/invalid_ids_on_every_element.cellml",
+                                 "complex_encapsulation.xml"}) {
+        checkParallelValidation(parser->parseModel(fileContents(fileName)));
+    }
+
+    auto importer = libcellml::Importer::create();
+
+    for (const auto &fileName : {"circularImport_1.cellml",
+                                 "import_units_that_are_invalid.cellml"}) {
+        auto model = parser->parseModel(fileContents(std::string("importer/") + fileName));
+
+        importer->resolveImports(model, resourcePath("importer/"));
+
+        checkParallelValidation(model);
+    }
+
+    // Check a model with non-unique component names, which issues are logged
+    // before those of the components themselves.
+
+    auto model = libcellml::Model::create("model");
+    auto c1 = libcellml::Component::create("c");
+    auto c2 = libcellml::Component::create("c");
+    auto c3 = libcellml::Component::create("c");
+
+    c1->addVariable(libcellml::Variable::create("1v"));
+    c2->addVariable(libcellml::Variable::create("2v"));
+    c3->addVariable(libcellml::Variable::create("3v"));
+
+    model->addComponent(c1);
+    c1->addComponent(c2);
+    model->addComponent(c3);
+
+    checkParallelValidation(model);
+}
+
+TEST(Validator, incrementalValidation)
+{
+    auto validator = libcellml::Validator::create();
+
+    EXPECT_FALSE(validator->isIncremental());
+
+    validator->setIncremental(true);
+
+    EXPECT_TRUE(validator->isIncremental());
+
+    // Check that the issues logged when validating a model incrementally are
+    // the same, and in the same order, as when fully validating it.
+
+    auto checkIncrementalValidation = [&](const libcellml::ModelPtr &model) {
+        auto fullValidator = libcellml::Validator::create();
+
+        fullValidator->validateModel(model);
+        validator->validateModel(model);
+
+        EXPECT_EQ(fullValidator->issueCount(), validator->issueCount());
+        EXPECT_EQ(fullValidator->errorCount(), validator->errorCount());
+        EXPECT_EQ(fullValidator->warningCount(), validator->warningCount());
+
+        for (size_t i = 0; i < std::min(fullValidator->issueCount(), validator->issueCount()); ++i) {
+            EXPECT_EQ(fullValidator->issue(i)->description(), validator->issue(i)->description());
+            EXPECT_EQ(fullValidator->issue(i)->referenceRule(), validator->issue(i)->referenceRule());
+            EXPECT_EQ(fullValidator->issue(i)->item()->type(), validator->issue(i)->item()->type());
+        }
+    };
+
+    auto issues = [&]() {
+        std::vector<libcellml::IssuePtr> res;
+
+        for (size_t i = 0; i < validator->issueCount(); ++i) {
+            res.push_back(validator->issue(i));
+        }
+
+        return res;
+    };
+
+    auto parser = libcellml::Parser::create();
+
+    for (const auto &fileName : {"invalid_cellml_2.0.xml",
+                                 "annotator/invalid_ids_on_every_element.cellml",
+                                 "sine_approximations.xml"}) {
+        auto model = parser->parseModel(fileContents(fileName));
+
+        checkIncrementalValidation(model);
+        checkIncrementalValidation(model);
+    }
+
+    // Validating an unmodified model reuses all of its issues, except those
+    // about the model itself.
+
+    auto invalidModel = parser->parseModel(fileContents("invalid_cellml_2.0.xml"));
+
+    checkIncrementalValidation(invalidModel);
+
+    auto invalidModelIssues = issues();
+
+    checkIncrementalValidation(invalidModel);
+
+    EXPECT_NE(invalidModelIssues[0], validator->issue(0));
+
+    for (size_t i = 1; i < validator->issueCount(); ++i) {
+        EXPECT_EQ(invalidModelIssues[i], validator->issue(i));
+    }
+
+    // Check a model that gets modified between validations.
+
+    auto model = libcellml::Model::create("model");
+    auto mV = libcellml::Units::create("mV");
+    auto ms = libcellml::Units::create("ms");
+    auto c1 = libcellml::Component::create("c1");
+    auto c2 = libcellml::Component::create("c2");
+    auto c3 = libcellml::Component::create("c3");
+    auto c4 = libcellml::Component::create("c4");
+    auto v1 = libcellml::Variable::create("v1");
+    auto v2 = libcellml::Variable::create("v2");
+    auto v3 = libcellml::Variable::create("v3");
+    auto x = libcellml::Variable::create("x");
+    auto reset = libcellml::Reset::create();
+
+    mV->addUnit("volt", "milli");
+    ms->addUnit("second", "milli");
+
+    model->addUnits(mV);
+    model->addUnits(ms);
+
+    v1->setUnits(mV);
+    v1->setInterfaceType("public");
+    v2->setUnits(ms);
+    v3->setUnits(mV);
+    x->setUnits("unknown");
+
+    c1->addVariable(v1);
+    c1->addVariable(x);
+    c1->setMath("<math xmlns=\"http://www.w3.org/1998/Math/MathML\"><apply><eq/><ci>y</ci></apply></math>");
+    c2->addVariable(v2);
+    c3->addVariable(v3);
+
+    reset->setVariable(v3);
+    c4->addReset(reset);
+
+    model->addComponent(c1);
+    c1->addComponent(c2);
+    model->addComponent(c3);
+    model->addComponent(c4);
+
+    libcellml::Variable::addEquivalence(v1, v2);
+    libcellml::Variable::addEquivalence(v1, v3);
+
+    checkIncrementalValidation(model);
+
+    // Modifying a component reuses the issues of the components that come
+    // before it, i.e. those about the math of the first component.
+
+    auto previousIssues = issues();
+
+    c3->setId("invalid id");
+
+    checkIncrementalValidation(model);
+
+    EXPECT_EQ(previousIssues[0], validator->issue(0));
+    EXPECT_EQ(previousIssues[1], validator->issue(1));
+
+    v2->setUnits(mV);
+
+    checkIncrementalValidation(model);
+
+    c3->setName("c1");
+
+    checkIncrementalValidation(model);
+
+    mV->addUnit("second");
+
+    checkIncrementalValidation(model);
+
+    model->setName("renamed_model");
+
+    checkIncrementalValidation(model);
+
+    c1->removeComponent(c2);
+    model->addComponent(c2);
+
+    checkIncrementalValidation(model);
+
+    x->setId("dup");
+    c2->setEncapsulationId("dup");
+
+    checkIncrementalValidation(model);
+
+    libcellml::Variable::setEquivalenceMappingId(v1, v3, "dup");
+
+    checkIncrementalValidation(model);
+
+    libcellml::Variable::removeEquivalence(v1, v3);
+
+    checkIncrementalValidation(model);
+
+    ms->setName("mV");
+
+    checkIncrementalValidation(model);
+
+    model->removeUnits(ms);
+
+    checkIncrementalValidation(model);
+
+    c1->setMath("");
+
+    checkIncrementalValidation(model);
+
+    c2->removeVariable(v2);
+
+    checkIncrementalValidation(model);
+
+    reset->setVariable(v1);
+
+    checkIncrementalValidation(model);
+
+    auto importSource = libcellml::ImportSource::create();
+
+    c3->setSourceComponent(importSource, "c");
+
+    checkIncrementalValidation(model);
+
+    importSource->setId("dup");
+
+    checkIncrementalValidation(model);
+
+    // Check an equivalence with a variable that is not part of the model.
+
+    auto orphan = libcellml::Variable::create("orphan");
+
+    libcellml::Variable::addEquivalence(v1, orphan);
+
+    checkIncrementalValidation(model);
+
+    orphan->setName("renamed_orphan");
+
+    checkIncrementalValidation(model);
+
+    // Check an incremental validation in parallel.
+
+    validator->setThreadCount(3);
+
+    v1->setName("v_1");
+
+    checkIncrementalValidation(model);
+
+    c1->setId("invalid id");
+
+    checkIncrementalValidation(model);
+
+    // Check that validating another model does not reuse the issues of the
+    // previous one.
+
+    checkIncrementalValidation(parser->parseModel(fileContents("invalid_cellml_2.0.xml")));
+    checkIncrementalValidation(model);
+
+    // Check that turning incremental validation off and on again does not
+    // reuse the issues of the previous validation.
+
+    previousIssues = issues();
+
+    validator->setIncremental(false);
+    validator->setIncremental(true);
+
+    checkIncrementalValidation(model);
+
+    EXPECT_NE(previousIssues[0], validator->issue(0));
+}
+
+TEST(Validator, manyDuplicateUnitsAndCycles)
+{
+    // Check that a model with many duplicate units and many cyclic units only
+    // gets each of those issues reported once.
+
+    auto validator = libcellml::Validator::create();
+    auto model = libcellml::Model::create("model");
+    const size_t count = 500;
+
+    for (size_t i = 0; i < count; ++i) {
+        auto units = libcellml::Units::create("duplicated");
+
+        model->addUnits(units);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        auto units1 = libcellml::Units::create("units_a_" + std::to_string(i));
+        auto units2 = libcellml::Units::create("units_b_" + std::to_string(i));
+
+        units1->addUnit(units2->name());
+        units2->addUnit(units1->name());
+
+        model->addUnits(units1);
+        model->addUnits(units2);
+    }
+
+    validator->validateModel(model);
+
+    EXPECT_EQ(count + 1, validator->issueCount());
+    EXPECT_EQ("Model 'model' contains multiple units with the name 'duplicated'. Valid units names must be unique to their model.", validator->issue(0)->description());
+    EXPECT_EQ("Cyclic units exist: 'units_a_0' -> 'units_b_0' -> 'units_a_0'.", validator->issue(1)->description());
+    EXPECT_EQ("Cyclic units exist: 'units_a_" + std::to_string(count - 1) + "' -> 'units_b_" + std::to_string(count - 1) + "' -> 'units_a_" + std::to_string(count - 1) + "'.", validator->issue(count)->description());
+}
+
+TEST(Validator, issueDescriptionsAfterChanges)
+{
+    // Check that the description of an issue is the same whether it is first
+    // retrieved before or after the model gets changed.
+
+    auto validator = libcellml::Validator::create();
+    auto model = libcellml::Model::create("model");
+    auto component = libcellml::Component::create("component");
+    auto variable = libcellml::Variable::create("variable");
+
+    component->addVariable(variable);
+    model->addComponent(component);
+
+    validator->validateModel(model);
+
+    auto issue = validator->issue(0);
+
+    component->setName("other_component");
+    variable->setName("other_variable");
+
+    EXPECT_EQ(size_t(1), validator->issueCount());
+    EXPECT_EQ("Variable 'variable' in component 'component' does not have any units specified.", issue->description());
+    EXPECT_EQ(libcellml::Issue::ReferenceRule::VARIABLE_UNITS, issue->referenceRule());
+}
+
+TEST(Validator, duplicateIdsInMathAfterChanges)
+{
+    // Check that the identifiers collected while validating some math are
+    // kept up to date when the math or the identifiers of the model change.
+
+    const std::string math =
+        "<math xmlns=\"http://www.w3.org/1998/Math/MathML\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\">\n"
+        "  <apply id=\"%ID%\">\n"
+        "    <eq/>\n"
+        "    <ci>v</ci>\n"
+        "    <cn cellml:units=\"dimensionless\">1</cn>\n"
+        "  </apply>\n"
+        "</math>\n";
+    auto mathWithId = [&](const std::string &id) {
+        auto result = math;
+
+        result.replace(result.find("%ID%"), 4, id);
+
+        return result;
+    };
+
+    auto validator = libcellml::Validator::create();
+    auto model = libcellml::Model::create("model");
+    auto component = libcellml::Component::create("component");
+    auto variable = libcellml::Variable::create("v");
+
+    variable->setUnits("dimensionless");
+    variable->setId("id");
+
+    component->addVariable(variable);
+    component->setMath(mathWithId("id"));
+
+    model->addComponent(component);
+
+    validator->setIncremental(true);
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(1), validator->issueCount());
+    EXPECT_EQ("Duplicated identifier attribute 'id' has been found in:\n"
+              " - variable 'v' in component 'component'; and\n"
+              " - MathML apply element in math in component 'component'.\n",
+              validator->issue(0)->description());
+
+    component->setMath(mathWithId("other_id"));
+
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(0), validator->issueCount());
+
+    variable->setId("other_id");
+
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(1), validator->issueCount());
+    EXPECT_EQ("Duplicated identifier attribute 'other_id' has been found in:\n"
+              " - variable 'v' in component 'component'; and\n"
+              " - MathML apply element in math in component 'component'.\n",
+              validator->issue(0)->description());
+
+    variable->setId("");
+
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(0), validator->issueCount());
+}
+
+TEST(Validator, boundedValidation)
+{
+    auto validator = libcellml::Validator::create();
+
+    EXPECT_EQ(size_t(0), validator->maximumErrorCount());
+    EXPECT_TRUE(validator->hasMathMLDtdValidation());
+    EXPECT_TRUE(validator->hasUniqueIdValidation());
+
+    auto parser = libcellml::Parser::create();
+
+    for (const auto &fileName : {"invalid_cellml_2.0.xml",
+                                 "invalidmathmlelementschildrenorsiblings.cellml",
+                                 "annotator/invalid_ids_on_every_element.cellml",
+                                 "multiplecellmlnamespaces.cellml",
+                                 "sine_approximations.xml"}) {
+        auto model = parser->parseModel(fileContents(fileName));
+        auto fullValidator = libcellml::Validator::create();
+
+        fullValidator->validateModel(model);
+
+        // Check that a bounded validation logs the issues of a full validation
+        // up to and including the last allowed error.
+
+        for (size_t maximumErrorCount : {1, 3, 10}) {
+            validator->setMaximumErrorCount(maximumErrorCount);
+            validator->setThreadCount((maximumErrorCount == 3) ? 2 : 1);
+            validator->setIncremental(maximumErrorCount == 10);
+
+            EXPECT_EQ(maximumErrorCount, validator->maximumErrorCount());
+
+            validator->validateModel(model);
+
+            auto errorCount = std::min(maximumErrorCount, fullValidator->errorCount());
+
+            EXPECT_EQ(errorCount, validator->errorCount());
+
+            if (errorCount == 0) {
+                EXPECT_EQ(fullValidator->issueCount(), validator->issueCount());
+            } else {
+                EXPECT_EQ(libcellml::Issue::Level::ERROR, validator->issue(validator->issueCount() - 1)->level());
+            }
+
+            for (size_t i = 0; i < validator->issueCount(); ++i) {
+                EXPECT_EQ(fullValidator->issue(i)->description(), validator->issue(i)->description());
+            }
+        }
+
+        validator->setMaximumErrorCount(0);
+        validator->setThreadCount(1);
+        validator->setIncremental(false);
+
+        // Check that skipping the MathML DTD validation and the identifier
+        // uniqueness check only drops the issues that they report.
+
+        validator->setHasMathMLDtdValidation(false);
+        validator->setHasUniqueIdValidation(false);
+
+        EXPECT_FALSE(validator->hasMathMLDtdValidation());
+        EXPECT_FALSE(validator->hasUniqueIdValidation());
+
+        validator->validateModel(model);
+
+        std::vector<std::string> expectedIssues;
+
+        for (size_t i = 0; i < fullValidator->issueCount(); ++i) {
+            auto description = fullValidator->issue(i)->description();
+
+            if ((description.find("W3C MathML DTD error: ") != 0)
+                && (description.find("Duplicated identifier attribute ") != 0)) {
+                expectedIssues.push_back(description);
+            }
+        }
+
+        EXPECT_EQ_ISSUES(expectedIssues, validator);
+
+        validator->setHasMathMLDtdValidation(true);
+        validator->setHasUniqueIdValidation(true);
+    }
+}
+
+TEST(Validator, mathmlDtdCompatibility)
+{
+    auto validator = libcellml::Validator::create();
+    auto compatibilityValidator = libcellml::Validator::create();
+
+    EXPECT_FALSE(validator->hasMathMLDtdCompatibility());
+
+    compatibilityValidator->setHasMathMLDtdCompatibility(true);
+
+    EXPECT_TRUE(compatibilityValidator->hasMathMLDtdCompatibility());
+
+    // Check that the native validation of math logs the same issues as its
+    // validation using the W3C MathML DTD itself.
+
+    auto parser = libcellml::Parser::create();
+
+    for (const auto &fileName : {"invalid_cellml_2.0.xml",
+                                 "invalidmathmlelementschildrenorsiblings.cellml",
+                                 "annotator/invalid_ids_on_every_element.cellml",
+                                 "sine_approximations.xml"}) {
+        auto model = parser->parseModel(fileContents(fileName));
+
+        compatibilityValidator->validateModel(model);
+        validator->validateModel(model);
+
+        EXPECT_EQ(compatibilityValidator->issueCount(), validator->issueCount());
+
+        for (size_t i = 0; i < std::min(compatibilityValidator->issueCount(), validator->issueCount()); ++i) {
+            EXPECT_EQ(compatibilityValidator->issue(i)->description(), validator->issue(i)->description());
+        }
+    }
+
+    const std::string mathHeader = "<math xmlns=\"http://www.w3.org/1998/Math/MathML\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\"";
+    const std::string cn = "<cn cellml:units=\"dimensionless\">1</cn>";
+
+    for (const auto &math : {mathHeader + " overflow=\"wrap\" xmlns:other=\"other\" xmlns:xlink=\"xlink\"><apply bogus=\"1\"><eq/><ci>x</ci>" + cn + "</apply></math>",
+                             mathHeader + " id=\"a\"><apply id=\"a\" xref=\"b\"><eq id=\"1a\"/><ci style=\"s\">x</ci><ci xref=\"a\" class=\"c\">x</ci></apply></math>",
+                             mathHeader + "><apply><eq/><ci>x<sep/><mi>x</mi></ci><cn cellml:units=\"dimensionless\" base=\"2\" type=\"e-notation\">1<sep/>2</cn></apply></math>",
+                             mathHeader + "><apply>text<eq/><ci>x</ci><!-- comment --><piecewise><otherwise>" + cn + "</otherwise><piece><ci>x</ci>" + cn + "</piece></piecewise><pi>3.14</pi></apply></math>",
+                             mathHeader + "><apply><eq/><ci>x</ci><apply><sin/><nonsense>" + cn + "</nonsense></apply></apply></math>"}) {
+        auto model = libcellml::Model::create("model");
+        auto component = libcellml::Component::create("component");
+        auto variable = libcellml::Variable::create("x");
+
+        variable->setUnits("dimensionless");
+        component->addVariable(variable);
+        component->setMath(math);
+        model->addComponent(component);
+
+        compatibilityValidator->validateModel(model);
+        validator->validateModel(model);
+
+        EXPECT_LT(size_t(0), validator->issueCount());
+        EXPECT_EQ(compatibilityValidator->issueCount(), validator->issueCount());
+
+        for (size_t i = 0; i < std::min(compatibilityValidator->issueCount(), validator->issueCount()); ++i) {
+            EXPECT_EQ(compatibilityValidator->issue(i)->description(), validator->issue(i)->description());
+        }
+    }
+}
+
+TEST(Validator, issueStreaming)
+{
+    auto validator = libcellml::Validator::create();
+
+    EXPECT_EQ(nullptr, validator->issueCallback());
+    EXPECT_TRUE(validator->retainIssues());
+
+    auto parser = libcellml::Parser::create();
+
+    for (const auto &fileName : {"invalid_cellml_2.0.xml",
+                                 "invalidmathmlelementschildrenorsiblings.cellml",
+                                 "annotator/invalid_ids_on_every_element.cellml",
+                                 "multiplecellmlnamespaces.cellml",
+                                 "sine_approximations.xml"}) {
+        auto model = parser->parseModel(fileContents(fileName));
+        auto fullValidator = libcellml::Validator::create();
+
+        fullValidator->validateModel(model);
+
+        // Check that the streamed issues are those of a full validation, in
+        // the same order, whether or not they are retained.
+
+        std::vector<libcellml::IssuePtr> streamedIssues;
+
+        validator->setIssueCallback([&streamedIssues](const libcellml::IssuePtr &issue) {
+            streamedIssues.push_back(issue);
+
+            return true;
+        });
+
+        EXPECT_NE(nullptr, validator->issueCallback());
+
+        for (size_t threadCount : {1, 2}) {
+            for (bool retainIssues : {true, false}) {
+                validator->setThreadCount(threadCount);
+                validator->setIncremental(retainIssues);
+                validator->setRetainIssues(retainIssues);
+
+                EXPECT_EQ(retainIssues, validator->retainIssues());
+
+                streamedIssues.clear();
+
+                validator->validateModel(model);
+
+                EXPECT_EQ(fullValidator->issueCount(), streamedIssues.size());
+                EXPECT_EQ(fullValidator->issueCount(), validator->issueCount());
+                EXPECT_EQ(fullValidator->errorCount(), validator->errorCount());
+                EXPECT_EQ(fullValidator->warningCount(), validator->warningCount());
+                EXPECT_EQ(fullValidator->messageCount(), validator->messageCount());
+
+                for (size_t i = 0; i < std::min(fullValidator->issueCount(), streamedIssues.size()); ++i) {
+                    EXPECT_EQ(fullValidator->issue(i)->description(), streamedIssues[i]->description());
+
+                    if (retainIssues) {
+                        EXPECT_EQ(streamedIssues[i], validator->issue(i));
+                    } else {
+                        EXPECT_EQ(nullptr, validator->issue(i));
+                    }
+                }
+
+                EXPECT_EQ(nullptr, validator->issue(validator->issueCount()));
+            }
+        }
+
+        // Check that the issues streamed by a bounded validation are those of
+        // a full validation up to and including the last allowed error.
+
+        validator->setThreadCount(1);
+        validator->setIncremental(false);
+        validator->setMaximumErrorCount(3);
+
+        streamedIssues.clear();
+
+        validator->validateModel(model);
+
+        EXPECT_EQ(std::min(size_t(3), fullValidator->errorCount()), validator->errorCount());
+        EXPECT_EQ(validator->issueCount(), streamedIssues.size());
+
+        for (size_t i = 0; i < streamedIssues.size(); ++i) {
+            EXPECT_EQ(fullValidator->issue(i)->description(), streamedIssues[i]->description());
+        }
+
+        validator->setMaximumErrorCount(0);
+        validator->setRetainIssues(true);
+
+        // Check that cancelling the streaming of issues stops the validation
+        // early, with the issues logged up to then being retained.
+
+        streamedIssues.clear();
+
+        validator->setIssueCallback([&streamedIssues](const libcellml::IssuePtr &issue) {
+            streamedIssues.push_back(issue);
+
+            return false;
+        });
+
+        validator->validateModel(model);
+
+        EXPECT_EQ(std::min(size_t(1), fullValidator->issueCount()), streamedIssues.size());
+        EXPECT_LE(validator->issueCount(), fullValidator->issueCount());
+
+        for (size_t i = 0; i < validator->issueCount(); ++i) {
+            EXPECT_EQ(fullValidator->issue(i)->description(), validator->issue(i)->description());
+        }
+
+        validator->setIssueCallback(nullptr);
+    }
+}